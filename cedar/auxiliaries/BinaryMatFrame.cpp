@@ -0,0 +1,256 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryMatFrame.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::aux::BinaryMatFrame.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/BinaryMatFrame.h"
+#include "cedar/auxiliaries/utilities.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#ifdef CEDAR_USE_LZ4
+  #include <lz4.h>
+#endif // CEDAR_USE_LZ4
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef CEDAR_COMPILER_MSVC
+const unsigned int cedar::aux::BinaryMatFrame::MAX_DIMENSIONALITY;
+const uint32_t cedar::aux::BinaryMatFrame::MAGIC;
+const uint16_t cedar::aux::BinaryMatFrame::VERSION;
+#endif // CEDAR_COMPILER_MSVC
+
+// the header is sent as raw bytes, so its layout must not depend on the compiler's padding
+static_assert(sizeof(cedar::aux::BinaryMatFrame::Header) == 80, "unexpected size of the binary frame header");
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::BinaryMatFrame::BinaryMatFrame()
+:
+mpPayload(nullptr)
+{
+  std::memset(&this->mHeader, 0, sizeof(Header));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cedar::aux::BinaryMatFrame::isCompressionAvailable()
+{
+#ifdef CEDAR_USE_LZ4
+  return true;
+#else
+  return false;
+#endif // CEDAR_USE_LZ4
+}
+
+void cedar::aux::BinaryMatFrame::pack(const cv::Mat& matrix, uint64_t sequenceNumber, bool compress)
+{
+  if (matrix.dims > static_cast<int>(MAX_DIMENSIONALITY))
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::RangeException,
+      "Cannot send matrices with " + cedar::aux::toString(matrix.dims) + " dimensions, the maximum is "
+        + cedar::aux::toString(MAX_DIMENSIONALITY) + "."
+    );
+  }
+
+  if (matrix.isContinuous())
+  {
+    this->mMatrix = matrix;
+  }
+  else
+  {
+    this->mMatrix = matrix.clone();
+  }
+
+  std::memset(&this->mHeader, 0, sizeof(Header));
+  this->mHeader.mMagic = MAGIC;
+  this->mHeader.mVersion = VERSION;
+  this->mHeader.mType = this->mMatrix.type();
+  this->mHeader.mDimensionality = static_cast<uint32_t>(this->mMatrix.dims);
+  for (int d = 0; d < this->mMatrix.dims; ++d)
+  {
+    this->mHeader.mSizes[d] = this->mMatrix.size[d];
+  }
+  this->mHeader.mSequenceNumber = sequenceNumber;
+  this->mHeader.mRawSize = this->mMatrix.total() * this->mMatrix.elemSize();
+  this->mHeader.mPayloadSize = this->mHeader.mRawSize;
+  this->mpPayload = reinterpret_cast<const char*>(this->mMatrix.data);
+
+#ifdef CEDAR_USE_LZ4
+  if (compress && this->mHeader.mRawSize > 0 && this->mHeader.mRawSize <= static_cast<uint64_t>(LZ4_MAX_INPUT_SIZE))
+  {
+    int raw_size = static_cast<int>(this->mHeader.mRawSize);
+    int bound = LZ4_compressBound(raw_size);
+    // resizing never shrinks the capacity, so this only allocates when the matrix grows
+    this->mBuffer.resize(static_cast<size_t>(bound));
+    int compressed_size = LZ4_compress_default(this->mpPayload, this->mBuffer.data(), raw_size, bound);
+
+    // incompressible data (e.g., noise) is sent as it is
+    if (compressed_size > 0 && compressed_size < raw_size)
+    {
+      this->mHeader.mFlags |= FLAG_LZ4;
+      this->mHeader.mPayloadSize = static_cast<uint64_t>(compressed_size);
+      this->mpPayload = this->mBuffer.data();
+    }
+  }
+#else
+  // without LZ4, frames are always sent uncompressed
+  (void) compress;
+#endif // CEDAR_USE_LZ4
+
+  this->mHeader.mChecksum = computeChecksum(this->mHeader);
+}
+
+const cedar::aux::BinaryMatFrame::Header& cedar::aux::BinaryMatFrame::getHeader() const
+{
+  return this->mHeader;
+}
+
+const char* cedar::aux::BinaryMatFrame::getPayload() const
+{
+  return this->mpPayload;
+}
+
+size_t cedar::aux::BinaryMatFrame::getPayloadSize() const
+{
+  return static_cast<size_t>(this->mHeader.mPayloadSize);
+}
+
+uint32_t cedar::aux::BinaryMatFrame::computeChecksum(const Header& header)
+{
+  Header copy = header;
+  copy.mChecksum = 0;
+  return cedar::aux::generateCR32Checksum(reinterpret_cast<const char*>(&copy), sizeof(Header));
+}
+
+bool cedar::aux::BinaryMatFrame::isValid(const Header& header)
+{
+  if (header.mMagic != MAGIC || header.mVersion != VERSION || header.mChecksum != computeChecksum(header))
+  {
+    return false;
+  }
+
+  if (header.mDimensionality > MAX_DIMENSIONALITY || header.mDimensionality == 1)
+  {
+    return false;
+  }
+
+  if (CV_MAT_DEPTH(header.mType) > CV_64F)
+  {
+    return false;
+  }
+
+  uint64_t raw_size = header.mDimensionality == 0 ? 0 : static_cast<uint64_t>(CV_ELEM_SIZE(header.mType));
+  for (unsigned int d = 0; d < header.mDimensionality; ++d)
+  {
+    if (header.mSizes[d] <= 0)
+    {
+      return false;
+    }
+    raw_size *= static_cast<uint64_t>(header.mSizes[d]);
+  }
+  if (raw_size != header.mRawSize)
+  {
+    return false;
+  }
+
+  if (header.mFlags & FLAG_LZ4)
+  {
+    return isCompressionAvailable() && header.mPayloadSize > 0 && header.mPayloadSize < header.mRawSize;
+  }
+  else
+  {
+    return header.mFlags == 0 && header.mPayloadSize == header.mRawSize;
+  }
+}
+
+char* cedar::aux::BinaryMatFrame::preparePayload(const Header& header, cv::Mat& target)
+{
+  if (header.mDimensionality == 0)
+  {
+    target = cv::Mat();
+  }
+  else
+  {
+    // does nothing if the target already has this type and size
+    target.create(static_cast<int>(header.mDimensionality), header.mSizes, header.mType);
+  }
+
+  if (header.mFlags & FLAG_LZ4)
+  {
+    this->mBuffer.resize(static_cast<size_t>(header.mPayloadSize));
+    return this->mBuffer.data();
+  }
+  else
+  {
+    return reinterpret_cast<char*>(target.data);
+  }
+}
+
+bool cedar::aux::BinaryMatFrame::unpack(const Header& header, cv::Mat& target)
+{
+  if (!(header.mFlags & FLAG_LZ4))
+  {
+    // the payload was read into the target directly
+    return true;
+  }
+
+#ifdef CEDAR_USE_LZ4
+  int decompressed_size = LZ4_decompress_safe
+                          (
+                            this->mBuffer.data(),
+                            reinterpret_cast<char*>(target.data),
+                            static_cast<int>(header.mPayloadSize),
+                            static_cast<int>(header.mRawSize)
+                          );
+  return decompressed_size >= 0 && static_cast<uint64_t>(decompressed_size) == header.mRawSize;
+#else
+  (void) target;
+  return false;
+#endif // CEDAR_USE_LZ4
+}
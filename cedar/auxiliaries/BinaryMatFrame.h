@@ -0,0 +1,196 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryMatFrame.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::BinaryMatFrame.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_BINARY_MAT_FRAME_H
+#define CEDAR_AUX_BINARY_MAT_FRAME_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/BinaryMatFrame.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <vector>
+
+
+/*!@brief Packs matrices into binary frames for streaming them over a byte stream (e.g., a TCP socket), and back.
+ *
+ *        A frame consists of a fixed-size header followed by the payload, i.e., the raw elements of the matrix in
+ *        OpenCV (row-major) order, optionally compressed with LZ4. The header holds the type, dimensionality and sizes
+ *        of the matrix, a sequence number and the size of the payload, so the receiver knows how many bytes to read
+ *        without scanning for delimiters. All values are in the byte order of the sender; a receiver with a different
+ *        byte order rejects the frames because the magic number does not match.
+ *
+ *        On the sending side, pack() does not copy uncompressed matrices: getPayload() points into the matrix, so the
+ *        header and the payload can be sent with a single scatter-gather write. On the receiving side, preparePayload()
+ *        returns the memory the payload should be read into, which is the target matrix itself for uncompressed frames.
+ */
+class cedar::aux::BinaryMatFrame
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Maximal number of dimensions of matrices that can be sent.
+  static const unsigned int MAX_DIMENSIONALITY = 8;
+
+  //! Header that precedes the payload of each frame.
+  struct Header
+  {
+    //! Always MAGIC.
+    uint32_t mMagic;
+    //! Version of the frame format.
+    uint16_t mVersion;
+    //! Combination of the values in Flags.
+    uint16_t mFlags;
+    //! OpenCV type of the matrix.
+    int32_t mType;
+    //! Number of dimensions of the matrix.
+    uint32_t mDimensionality;
+    //! Sizes of the matrix along each dimension; unused entries are zero.
+    int32_t mSizes[MAX_DIMENSIONALITY];
+    //! Number of the frame, counted by the sender.
+    uint64_t mSequenceNumber;
+    //! Size of the matrix data in bytes.
+    uint64_t mRawSize;
+    //! Size of the payload that follows the header in bytes.
+    uint64_t mPayloadSize;
+    //! CRC-32 checksum of the header, computed with this field set to zero.
+    uint32_t mChecksum;
+    //! Padding, always zero.
+    uint32_t mReserved;
+  };
+
+  //! Flags of a frame.
+  enum Flags
+  {
+    //! The payload is compressed with LZ4.
+    FLAG_LZ4 = 1
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  BinaryMatFrame();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Packs the matrix into this frame.
+   *
+   *        Non-continuous matrices are copied. If compression is requested but LZ4 is not available or does not make
+   *        the payload smaller, the frame is sent uncompressed.
+   *
+   * @throws cedar::aux::RangeException if the matrix has more than MAX_DIMENSIONALITY dimensions.
+   */
+  void pack(const cv::Mat& matrix, uint64_t sequenceNumber, bool compress = false);
+
+  //!@brief Returns the header of the frame last packed.
+  const Header& getHeader() const;
+
+  //!@brief Returns the payload of the frame last packed.
+  const char* getPayload() const;
+
+  //!@brief Returns the size of the payload of the frame last packed in bytes.
+  size_t getPayloadSize() const;
+
+  //!@brief Checks that the header belongs to a frame this class can read.
+  static bool isValid(const Header& header);
+
+  /*!@brief Prepares receiving the payload that belongs to the given (valid) header.
+   *
+   *        The target matrix is (re)allocated only if its type or size differs from the one in the header.
+   *
+   * @returns The memory into which header.mPayloadSize bytes of payload should be read.
+   */
+  char* preparePayload(const Header& header, cv::Mat& target);
+
+  /*!@brief Finishes receiving a frame whose payload was read into the memory returned by preparePayload.
+   *
+   * @returns False, if the payload could not be decompressed.
+   */
+  bool unpack(const Header& header, cv::Mat& target);
+
+  //!@brief Returns true if cedar was built with LZ4, i.e., if frames can be compressed and decompressed.
+  static bool isCompressionAvailable();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Computes the checksum of the header.
+  static uint32_t computeChecksum(const Header& header);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Magic number at the start of each frame ("CMF1" when read as bytes on a little-endian machine).
+  static const uint32_t MAGIC = 0x31464D43;
+
+  //! Version of the frame format.
+  static const uint16_t VERSION = 1;
+
+private:
+  //! Header of the frame last packed.
+  Header mHeader;
+
+  //! The matrix last packed; keeps the data pointed to by the payload alive.
+  cv::Mat mMatrix;
+
+  //! Holds compressed payloads, both when sending and when receiving.
+  std::vector<char> mBuffer;
+
+  //! Points to the payload of the frame last packed.
+  const char* mpPayload;
+
+}; // class cedar::aux::BinaryMatFrame
+
+#endif // CEDAR_AUX_BINARY_MAT_FRAME_H
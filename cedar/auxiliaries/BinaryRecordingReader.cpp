@@ -0,0 +1,217 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryRecordingReader.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Reader for the binary chunked recording format.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/BinaryRecordingReader.h"
+#include "cedar/auxiliaries/BinaryRecordingWriter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// SYSTEM INCLUDES
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::BinaryRecordingReader::BinaryRecordingReader(const std::string& path)
+:
+mPath(path),
+mStream(path, std::ios::in | std::ios::binary),
+mChunkType(-1),
+mRemainingRecords(0),
+mTruncated(false)
+{
+  if (!this->mStream.is_open())
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + path + "\" for reading.");
+  }
+
+  char magic[sizeof(cedar::aux::BinaryRecordingWriter::FILE_MAGIC)];
+  uint32_t version = 0;
+  uint32_t byte_order_mark = 0;
+  if
+  (
+    !this->read(magic, sizeof(magic))
+    || std::memcmp(magic, cedar::aux::BinaryRecordingWriter::FILE_MAGIC, sizeof(magic)) != 0
+    || !this->read(&version, sizeof(version))
+    || !this->read(&byte_order_mark, sizeof(byte_order_mark))
+  )
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "\"" + path + "\" is not a binary cedar recording.");
+  }
+
+  if (byte_order_mark != cedar::aux::BinaryRecordingWriter::BYTE_ORDER_MARK)
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "\"" + path + "\" was recorded on a machine with a different byte order.");
+  }
+
+  if (version > cedar::aux::BinaryRecordingWriter::FORMAT_VERSION)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::ParseException,
+      "\"" + path + "\" was written by a newer version of cedar (format version "
+      + cedar::aux::toString(version) + ")."
+    );
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cedar::aux::BinaryRecordingReader::read(void* data, size_t size)
+{
+  this->mStream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+  return static_cast<size_t>(this->mStream.gcount()) == size;
+}
+
+bool cedar::aux::BinaryRecordingReader::isTruncated() const
+{
+  return this->mTruncated;
+}
+
+bool cedar::aux::BinaryRecordingReader::readChunkHeader()
+{
+  char magic[sizeof(cedar::aux::BinaryRecordingWriter::CHUNK_MAGIC)];
+  this->mStream.read(magic, sizeof(magic));
+  if (this->mStream.gcount() == 0)
+  {
+    // regular end of the file
+    return false;
+  }
+
+  int32_t type = 0;
+  int32_t dims = 0;
+  if
+  (
+    static_cast<size_t>(this->mStream.gcount()) != sizeof(magic)
+    || std::memcmp(magic, cedar::aux::BinaryRecordingWriter::CHUNK_MAGIC, sizeof(magic)) != 0
+    || !this->read(&type, sizeof(type))
+    || !this->read(&dims, sizeof(dims))
+    || dims < 1
+  )
+  {
+    this->mTruncated = true;
+    return false;
+  }
+
+  this->mChunkSizes.resize(static_cast<size_t>(dims));
+  for (auto& size : this->mChunkSizes)
+  {
+    int32_t size_32 = 0;
+    if (!this->read(&size_32, sizeof(size_32)))
+    {
+      this->mTruncated = true;
+      return false;
+    }
+    size = static_cast<int>(size_32);
+  }
+
+  if (!this->read(&this->mRemainingRecords, sizeof(this->mRemainingRecords)))
+  {
+    this->mTruncated = true;
+    return false;
+  }
+  this->mChunkType = static_cast<int>(type);
+  return true;
+}
+
+bool cedar::aux::BinaryRecordingReader::readNext(cedar::unit::Time& time, cv::Mat& matrix)
+{
+  // skip to the next chunk that contains records
+  while (this->mRemainingRecords == 0)
+  {
+    if (this->mTruncated || !this->readChunkHeader())
+    {
+      return false;
+    }
+  }
+
+  matrix.create(static_cast<int>(this->mChunkSizes.size()), &this->mChunkSizes.front(), this->mChunkType);
+  CEDAR_DEBUG_ASSERT(matrix.isContinuous());
+
+  double seconds = 0.0;
+  if (!this->read(&seconds, sizeof(seconds)) || !this->read(matrix.data, matrix.total() * matrix.elemSize()))
+  {
+    this->mTruncated = true;
+    this->mRemainingRecords = 0;
+    return false;
+  }
+
+  time = cedar::unit::Time(seconds * cedar::unit::seconds);
+  --this->mRemainingRecords;
+  return true;
+}
+
+void cedar::aux::BinaryRecordingReader::writeCSV(std::ostream& stream)
+{
+  cedar::unit::Time time;
+  cv::Mat matrix;
+  cedar::aux::MatDataPtr data(new cedar::aux::MatData());
+  bool first = true;
+  while (this->readNext(time, matrix))
+  {
+    data->setData(matrix);
+    if (first)
+    {
+      first = false;
+      data->serializeHeader(stream, cedar::aux::SerializationFormat::CSV);
+      stream << std::endl;
+    }
+
+    // same layout as the rows the recorder writes in CSV mode
+    stream << time << ",";
+    data->serializeData(stream, cedar::aux::SerializationFormat::CSV);
+    stream << std::endl;
+  }
+}
+
+void cedar::aux::BinaryRecordingReader::convertToCSV(const std::string& binaryPath, const std::string& csvPath)
+{
+  cedar::aux::BinaryRecordingReader reader(binaryPath);
+  std::ofstream stream(csvPath, std::ios::out | std::ios::trunc);
+  if (!stream.is_open())
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + csvPath + "\" for writing.");
+  }
+  reader.writeCSV(stream);
+}
@@ -0,0 +1,143 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryRecordingReader.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Reader for the binary chunked recording format.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_BINARY_RECORDING_READER_H
+#define CEDAR_AUX_BINARY_RECORDING_READER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/BinaryRecordingReader.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/*!@brief Reads files written by cedar::aux::BinaryRecordingWriter.
+ *
+ *        Records are read one after another with readNext(). writeCSV() and convertToCSV() turn a binary recording into
+ *        the CSV format the recorder writes in cedar::aux::SerializationFormat::CSV mode.
+ */
+class cedar::aux::BinaryRecordingReader
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Opens the given file and checks its header.
+   *
+   * @throws cedar::aux::FileNotFoundException if the file cannot be opened.
+   * @throws cedar::aux::ParseException if the file is not a binary recording or was written on a machine with a
+   *         different byte order.
+   */
+  BinaryRecordingReader(const std::string& path);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Reads the next record.
+   *
+   *        matrix is only reallocated if its type or size differs from that of the record.
+   *
+   * @returns false if there are no more records. A chunk that was cut off (e.g., because the recording was
+   *          interrupted) ends the recording; check isTruncated() to find out if this happened.
+   */
+  bool readNext(cedar::unit::Time& time, cv::Mat& matrix);
+
+  //!@brief Returns true if the last chunk of the file is incomplete.
+  bool isTruncated() const;
+
+  //!@brief Reads all remaining records and writes them to the stream as CSV.
+  void writeCSV(std::ostream& stream);
+
+  //!@brief Converts the binary recording at binaryPath to a CSV file at csvPath.
+  static void convertToCSV(const std::string& binaryPath, const std::string& csvPath);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Reads the header of the next chunk. Returns false at the end of the file.
+  bool readChunkHeader();
+
+  //! Reads size bytes into data. Returns false if the file ends before.
+  bool read(void* data, size_t size);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  //! Path of the file.
+  std::string mPath;
+
+  //! Stream reading the file.
+  std::ifstream mStream;
+
+  //! Type of the matrices in the current chunk.
+  int mChunkType;
+
+  //! Sizes of the matrices in the current chunk.
+  std::vector<int> mChunkSizes;
+
+  //! Number of records left in the current chunk.
+  uint32_t mRemainingRecords;
+
+  //! Whether the file ended within a chunk.
+  bool mTruncated;
+
+}; // class cedar::aux::BinaryRecordingReader
+
+#endif // CEDAR_AUX_BINARY_RECORDING_READER_H
+
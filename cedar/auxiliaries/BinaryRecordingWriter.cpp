@@ -0,0 +1,248 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryRecordingWriter.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Writer for the binary chunked recording format.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/BinaryRecordingWriter.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/Log.h"
+
+// SYSTEM INCLUDES
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+const char cedar::aux::BinaryRecordingWriter::FILE_MAGIC[8] = {'C', 'E', 'D', 'A', 'R', 'R', 'E', 'C'};
+const char cedar::aux::BinaryRecordingWriter::CHUNK_MAGIC[4] = {'C', 'H', 'N', 'K'};
+
+#ifndef CEDAR_COMPILER_MSVC
+const uint32_t cedar::aux::BinaryRecordingWriter::FORMAT_VERSION;
+const uint32_t cedar::aux::BinaryRecordingWriter::BYTE_ORDER_MARK;
+#endif // CEDAR_COMPILER_MSVC
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::BinaryRecordingWriter::BinaryRecordingWriter(const std::string& path, size_t chunkSize)
+:
+mPath(path),
+mpFile(nullptr),
+mChunkSize(chunkSize),
+mRecordCountOffset(0),
+mRecordCount(0),
+mChunkType(-1)
+{
+  // append mode: every chunk is added to the end of the file with a single write
+  this->mpFile = std::fopen(path.c_str(), "ab");
+  if (this->mpFile == nullptr)
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + path + "\" for writing.");
+  }
+
+  // the position of a file opened for appending is implementation-defined, so check the size explicitly
+  std::fseek(this->mpFile, 0, SEEK_END);
+  if (std::ftell(this->mpFile) == 0)
+  {
+    uint32_t version = FORMAT_VERSION;
+    uint32_t byte_order_mark = BYTE_ORDER_MARK;
+    this->append(FILE_MAGIC, sizeof(FILE_MAGIC));
+    this->append(&version, sizeof(version));
+    this->append(&byte_order_mark, sizeof(byte_order_mark));
+  }
+
+  this->mBuffer.reserve(this->mChunkSize);
+}
+
+cedar::aux::BinaryRecordingWriter::~BinaryRecordingWriter()
+{
+  try
+  {
+    this->close();
+  }
+  catch (const cedar::aux::ExceptionBase& e)
+  {
+    cedar::aux::LogSingleton::getInstance()->error
+    (
+      "Could not write the last records to \"" + this->mPath + "\": " + e.getMessage(),
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+const std::string& cedar::aux::BinaryRecordingWriter::getPath() const
+{
+  return this->mPath;
+}
+
+bool cedar::aux::BinaryRecordingWriter::fitsChunk(const cv::Mat& matrix) const
+{
+  if (this->mRecordCount == 0 || matrix.type() != this->mChunkType
+      || static_cast<size_t>(matrix.dims) != this->mChunkSizes.size())
+  {
+    return false;
+  }
+
+  for (int d = 0; d < matrix.dims; ++d)
+  {
+    if (matrix.size[d] != this->mChunkSizes[d])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void cedar::aux::BinaryRecordingWriter::startChunk(const cv::Mat& matrix)
+{
+  this->mChunkType = matrix.type();
+  this->mChunkSizes.assign(matrix.size.p, matrix.size.p + matrix.dims);
+
+  int32_t type = static_cast<int32_t>(matrix.type());
+  int32_t dims = static_cast<int32_t>(matrix.dims);
+  this->append(CHUNK_MAGIC, sizeof(CHUNK_MAGIC));
+  this->append(&type, sizeof(type));
+  this->append(&dims, sizeof(dims));
+  for (int size : this->mChunkSizes)
+  {
+    int32_t size_32 = static_cast<int32_t>(size);
+    this->append(&size_32, sizeof(size_32));
+  }
+
+  // the record count is filled in when the chunk is written
+  this->mRecordCountOffset = this->mBuffer.size();
+  this->mRecordCount = 0;
+  this->append(&this->mRecordCount, sizeof(this->mRecordCount));
+}
+
+void cedar::aux::BinaryRecordingWriter::append(const void* data, size_t size)
+{
+  const char* bytes = static_cast<const char*>(data);
+  this->mBuffer.insert(this->mBuffer.end(), bytes, bytes + size);
+}
+
+void cedar::aux::BinaryRecordingWriter::write(const cedar::unit::Time& time, const cv::Mat& matrix)
+{
+  if (this->mpFile == nullptr)
+  {
+    CEDAR_THROW(cedar::aux::InvalidValueException, "Cannot write to \"" + this->mPath + "\": the file was closed.");
+  }
+
+  if (matrix.channels() != 1)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::NotImplementedException,
+      "Binary recordings of matrices with more than one channel are not supported."
+    );
+  }
+
+  if (!this->fitsChunk(matrix))
+  {
+    this->flush();
+    this->startChunk(matrix);
+  }
+
+  double seconds = time / cedar::unit::seconds;
+  this->append(&seconds, sizeof(seconds));
+
+  if (matrix.isContinuous())
+  {
+    this->append(matrix.data, matrix.total() * matrix.elemSize());
+  }
+  else
+  {
+    const cv::Mat* arrays[] = {&matrix, nullptr};
+    uchar* planes[1];
+    cv::NAryMatIterator iterator(arrays, planes, 1);
+    for (size_t plane = 0; plane < iterator.nplanes; ++plane, ++iterator)
+    {
+      this->append(planes[0], static_cast<size_t>(iterator.size) * matrix.elemSize());
+    }
+  }
+  ++this->mRecordCount;
+
+  if (this->mBuffer.size() >= this->mChunkSize)
+  {
+    this->flush();
+  }
+}
+
+void cedar::aux::BinaryRecordingWriter::flush()
+{
+  if (this->mpFile == nullptr || this->mBuffer.empty())
+  {
+    return;
+  }
+
+  if (this->mRecordCount > 0)
+  {
+    std::memcpy(&this->mBuffer[this->mRecordCountOffset], &this->mRecordCount, sizeof(this->mRecordCount));
+  }
+
+  size_t written = std::fwrite(&this->mBuffer.front(), 1, this->mBuffer.size(), this->mpFile);
+  std::fflush(this->mpFile);
+  if (written != this->mBuffer.size())
+  {
+    CEDAR_THROW(cedar::aux::InvalidValueException, "Could not write to \"" + this->mPath + "\".");
+  }
+
+  // the next record starts a new chunk
+  this->mBuffer.clear();
+  this->mRecordCount = 0;
+  this->mChunkType = -1;
+  this->mChunkSizes.clear();
+}
+
+void cedar::aux::BinaryRecordingWriter::close()
+{
+  if (this->mpFile == nullptr)
+  {
+    return;
+  }
+
+  this->flush();
+  std::fclose(this->mpFile);
+  this->mpFile = nullptr;
+}
@@ -0,0 +1,172 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BinaryRecordingWriter.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Writer for the binary chunked recording format.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_BINARY_RECORDING_WRITER_H
+#define CEDAR_AUX_BINARY_RECORDING_WRITER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/BinaryRecordingWriter.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/*!@brief Writes time-stamped matrices to a file in cedar's binary chunked recording format.
+ *
+ *        The file starts with a file header, followed by any number of chunks. Each chunk describes the type and size
+ *        of its matrices and contains a number of records, i.e., a time stamp followed by the raw matrix elements. All
+ *        values are stored in the byte order of the writing machine, which is marked in the file header:
+ *
+ *        file header:   char[8] "CEDARREC", uint32 format version, uint32 byte order mark (0x01020304)
+ *        chunk header:  char[4] "CHNK", int32 OpenCV type, int32 dimensionality, int32 size of each dimension,
+ *                       uint32 number of records
+ *        record:        double time in seconds, raw elements in OpenCV (row-major) order
+ *
+ *        Records are collected in memory and written as one complete chunk once the chunk is full, the matrix type or
+ *        size changes, or flush() is called. The file is opened in append mode, so each chunk is appended in a single
+ *        write and an interrupted recording loses at most the last chunk.
+ *
+ *        Use cedar::aux::BinaryRecordingReader to read the files or to convert them to CSV.
+ */
+class cedar::aux::BinaryRecordingWriter
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Opens the given file for appending. If the file is empty, the file header is written.
+   *
+   * @param path      Path of the file.
+   * @param chunkSize Number of bytes after which the current chunk is written to the file.
+   */
+  BinaryRecordingWriter(const std::string& path, size_t chunkSize = 1024 * 1024);
+
+  //!@brief Destructor. Writes the current chunk and closes the file.
+  ~BinaryRecordingWriter();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Adds a record to the current chunk.
+   *
+   * @remarks Only single-channel matrices are supported. Non-continuous matrices are copied element by element.
+   */
+  void write(const cedar::unit::Time& time, const cv::Mat& matrix);
+
+  //!@brief Writes the current chunk to the file, even if it is not full yet.
+  void flush();
+
+  //!@brief Writes the current chunk and closes the file. Further calls to write() throw.
+  void close();
+
+  //!@brief Returns the path of the file.
+  const std::string& getPath() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Returns true if the matrix can be appended to the current chunk.
+  bool fitsChunk(const cv::Mat& matrix) const;
+
+  //! Writes the header of a new chunk for matrices like the given one into the buffer.
+  void startChunk(const cv::Mat& matrix);
+
+  //! Appends raw bytes to the buffer.
+  void append(const void* data, size_t size);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Magic bytes at the start of each file.
+  static const char FILE_MAGIC[8];
+
+  //! Magic bytes at the start of each chunk.
+  static const char CHUNK_MAGIC[4];
+
+  //! Version of the format written by this class.
+  static const uint32_t FORMAT_VERSION = 1;
+
+  //! Value written to detect the byte order of the file.
+  static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+private:
+  //! Path of the file.
+  std::string mPath;
+
+  //! The opened file.
+  std::FILE* mpFile;
+
+  //! Number of bytes after which a chunk is written.
+  size_t mChunkSize;
+
+  //! Buffer holding the current chunk.
+  std::vector<char> mBuffer;
+
+  //! Offset of the record count of the current chunk in mBuffer.
+  size_t mRecordCountOffset;
+
+  //! Number of records in the current chunk.
+  uint32_t mRecordCount;
+
+  //! Type of the matrices in the current chunk.
+  int mChunkType;
+
+  //! Sizes of the matrices in the current chunk.
+  std::vector<int> mChunkSizes;
+
+}; // class cedar::aux::BinaryRecordingWriter
+
+#endif // CEDAR_AUX_BINARY_RECORDING_WRITER_H
+
@@ -67,7 +67,8 @@ cedar::aux::Configurable::Configurable()
 :
 mHasShared(false),
 mIsAdvanced(false),
-mIsConfigured(true)
+mIsConfigured(true),
+mParameterGeneration(0)
 {
   this->connectToTreeChangedSignal(boost::bind(&cedar::aux::Configurable::updateLockSet, this));
 }
@@ -198,12 +199,12 @@ size_t cedar::aux::Configurable::countAdvanced() const
 
 void cedar::aux::Configurable::lockParameters(cedar::aux::LOCK_TYPE lockType) const
 {
-  cedar::aux::lock(this->mParameterLocks, lockType);
+  cedar::aux::lock(this->mFlatParameterLocks, lockType);
 }
 
 void cedar::aux::Configurable::unlockParameters(cedar::aux::LOCK_TYPE lockType) const
 {
-  cedar::aux::unlock(this->mParameterLocks, lockType);
+  cedar::aux::unlock(this->mFlatParameterLocks, lockType);
 }
 
 void cedar::aux::Configurable::updateLockSet()
@@ -211,6 +212,7 @@ void cedar::aux::Configurable::updateLockSet()
   this->mParameterLocks.clear();
 
   this->appendLocks(this->mParameterLocks);
+  this->mFlatParameterLocks.assign(this->mParameterLocks.begin(), this->mParameterLocks.end());
 }
 
 void cedar::aux::Configurable::appendLocks(std::set<QReadWriteLock*>& locks)
@@ -740,6 +742,21 @@ void cedar::aux::Configurable::resetChangedStates(bool newChangedFlagValue) cons
   }
 }
 
+unsigned long long cedar::aux::Configurable::getParameterGeneration() const
+{
+  return this->mParameterGeneration.load(std::memory_order_acquire);
+}
+
+void cedar::aux::Configurable::parameterValueChanged()
+{
+  this->mParameterGeneration.fetch_add(1, std::memory_order_acq_rel);
+
+  if (auto parent = this->mpParent.lock())
+  {
+    parent->parameterValueChanged();
+  }
+}
+
 void cedar::aux::Configurable::writeConfiguration(cedar::aux::ConfigurationNode& root) const
 {
   for
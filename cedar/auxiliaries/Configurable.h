@@ -68,6 +68,7 @@
 #include <iostream>
 #include <vector>
 #include <set>
+#include <atomic>
 
 /*!@brief An interface for classes that can store and load parameters from files.
  *
@@ -178,6 +179,11 @@ public:
    */
   void resetChangedStates(bool newChangedFlagValue) const;
 
+  /*!@brief Returns a counter that is incremented whenever the value of a parameter of this configurable or of one of
+   *        its configurable children changes.
+   */
+  unsigned long long getParameterGeneration() const;
+
   //!@brief copy a configuration from another instance of the same class (type check included)
   virtual void copyFrom(ConstConfigurablePtr src);
 
@@ -291,6 +297,9 @@ private:
    */
   void unregisterParameter(cedar::aux::Parameter* parameter);
 
+  //! Called by parameters whenever their value changes; increments the parameter generation of this and all parents.
+  void parameterValueChanged();
+
   //!@brief Transforms the old config format to one readable in the new interface.
   void oldFormatToNew(cedar::aux::ConfigurationNode& node);
 
@@ -442,12 +451,18 @@ private:
 
   bool mHasShared;
 
+  //! Incremented whenever a parameter value changes, see getParameterGeneration().
+  std::atomic<unsigned long long> mParameterGeneration;
+
   /*!@brief   The lockable used for locking this configurable and all its parameters.
    *
    * @remarks In order to avoid multiple inheritance down the line, configurable has, rather than is, a lockable.
    */
   mutable std::set<QReadWriteLock*> mParameterLocks;
 
+  //! mParameterLocks copied into a flat array in the same (canonical) order, which is what is iterated when locking.
+  std::vector<QReadWriteLock*> mFlatParameterLocks;
+
   //! Lock that is used to protect access to the various data members of the configurable itself.
   mutable QReadWriteLock mConfigurableLock;
 
@@ -45,6 +45,12 @@
 
 // SYSTEM INCLUDES
 
+namespace
+{
+  //! Source of the generations of all data objects; starts at one so that zero can stand for "never seen".
+  std::atomic<unsigned long long> next_generation(1);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -52,7 +58,8 @@
 cedar::aux::Data::Data()
 :
 mpLock(new QReadWriteLock()),
-mpeOwner(NULL)
+mpeOwner(NULL),
+mGeneration(next_generation.fetch_add(1, std::memory_order_relaxed))
 {
 }
 
@@ -105,6 +112,11 @@ void cedar::aux::Data::setOwner(cedar::aux::Configurable* step)
   this->mpeOwner = step;
 }
 
+void cedar::aux::Data::markChanged()
+{
+  this->mGeneration.store(next_generation.fetch_add(1, std::memory_order_relaxed), std::memory_order_release);
+}
+
 void cedar::aux::Data::copyValueFrom(cedar::aux::ConstDataPtr)
 {
   CEDAR_THROW
@@ -55,6 +55,7 @@
 #include <QReadWriteLock>
 #include <iostream>
 #include <fstream>
+#include <atomic>
 
 /*!@brief This is an abstract interface for all kinds of data.
  *
@@ -157,6 +158,23 @@ public:
   //! Clones this data object.
   virtual cedar::aux::DataPtr clone() const;
 
+  /*!@brief Returns the generation of this data object.
+   *
+   *        The generation changes whenever the data is marked as changed. Generations are drawn from one counter shared
+   *        by all data objects, so a generation never occurs twice, even for different objects.
+   */
+  inline unsigned long long getGeneration() const
+  {
+    return this->mGeneration.load(std::memory_order_acquire);
+  }
+
+  /*!@brief Gives the data a new generation.
+   *
+   *        setData does this automatically; code that writes into the data in-place (e.g., via getData()) should call
+   *        this afterwards. Outputs of processing steps are marked after every compute call that actually ran.
+   */
+  void markChanged();
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -180,6 +198,9 @@ private:
   //!@todo This should be a DataOwner* (if that would exist as interface)
   cedar::aux::Configurable* mpeOwner;
 
+  //! The current generation of the data, see getGeneration().
+  std::atomic<unsigned long long> mGeneration;
+
 }; // class cedar::aux::Data
 
 #endif // CEDAR_AUX_DATA_H
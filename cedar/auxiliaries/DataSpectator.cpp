@@ -40,6 +40,11 @@
 #include "cedar/auxiliaries/Recorder.h"
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/BinaryRecordingWriter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/sleepFunctions.h"
+#include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/units/Time.h"
 
 #include <boost/regex.hpp>
@@ -66,8 +71,14 @@ cedar::aux::DataSpectator::DataSpectator
 :
 mData(toSpectate),
 mpOfstreamLock(new QReadWriteLock()),
-mpQueueLock(new QReadWriteLock()),
-mName(name)
+mName(name),
+mSerializationMode(cedar::aux::SerializationFormat::CSV),
+mBackPressurePolicy(cedar::aux::RecorderBackPressurePolicy::Drop),
+mSkipNextRecord(false),
+mDroppedRecords(0),
+mLateRecords(0),
+mHasRecorded(false),
+mSerializationData(new cedar::aux::MatData())
 {
   this->setStepSize(recordIntervall);
 
@@ -81,9 +92,9 @@ cedar::aux::DataSpectator::~DataSpectator()
   {
     QWriteLocker locker(mpOfstreamLock);
     mOutputStream.close();
+    mBinaryWriter.reset();
   }
   delete mpOfstreamLock;
-  delete mpQueueLock;
 }
 
 void cedar::aux::DataSpectator::step(cedar::unit::Time)
@@ -94,6 +105,17 @@ void cedar::aux::DataSpectator::step(cedar::unit::Time)
 void cedar::aux::DataSpectator::prepareStart()
 {
   auto mode = cedar::aux::RecorderSingleton::getInstance()->getSerializationMode();
+  if (mode == cedar::aux::SerializationFormat::Binary && !boost::dynamic_pointer_cast<const cedar::aux::MatData>(mData))
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "\"" + mName + "\" does not contain matrix data and cannot be recorded in binary format; recording it as CSV.",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
+    mode = cedar::aux::SerializationFormat::CSV;
+  }
+  mSerializationMode = mode;
+
   std::string extension;
   switch (mode)
   {
@@ -104,99 +126,203 @@ void cedar::aux::DataSpectator::prepareStart()
     case cedar::aux::SerializationFormat::CSV:
       extension = "csv";
       break;
+
+    case cedar::aux::SerializationFormat::Binary:
+      extension = "bin";
+      break;
   }
 
   boost::regex re("[[:space:]/]");
 
   mOutputPath = cedar::aux::RecorderSingleton::getInstance()->getOutputDirectory() + "/" +
           boost::regex_replace(mName,re,"_") + "." + extension;
-  mOutputStream.open(mOutputPath, std::ios::out | std::ios::app);
-  writeHeader(mode);
+
+  // set up the buffer; the producer is not running yet, but the recorder might still be writing
+  {
+    QMutexLocker locker(&mBufferReadLock);
+    auto settings = cedar::aux::SettingsSingleton::getInstance();
+    mBackPressurePolicy = settings->getRecorderBackPressurePolicy();
+    mRecordBuffer.reset(settings->getRecorderBufferSize());
+    mSkipNextRecord = false;
+    mDroppedRecords = 0;
+    mLateRecords = 0;
+    mHasRecorded = false;
+
+    // preallocate the matrices of all slots so that recording does not allocate memory
+    if (auto mat_data = boost::dynamic_pointer_cast<const cedar::aux::MatData>(mData))
+    {
+      QReadLocker data_locker(&mat_data->getLock());
+      for (auto& slot : mRecordBuffer.slots())
+      {
+        mat_data->getData().copyTo(slot.mMatrix);
+        slot.mData.reset();
+      }
+    }
+  }
+
+  if (mode == cedar::aux::SerializationFormat::Binary)
+  {
+    // the binary format describes the data in each chunk, so there is no separate header
+    QWriteLocker locker(mpOfstreamLock);
+    mBinaryWriter = cedar::aux::BinaryRecordingWriterPtr(new cedar::aux::BinaryRecordingWriter(mOutputPath));
+  }
+  else
+  {
+    mOutputStream.open(mOutputPath, std::ios::out | std::ios::app);
+    writeHeader();
+  }
 }
 
 void cedar::aux::DataSpectator::processQuit()
 {
-  writeAllRecordData(cedar::aux::RecorderSingleton::getInstance()->getSerializationMode());
+  writeAllRecordData();
   
   {
     QWriteLocker locker(mpOfstreamLock);
     mOutputStream.close();
+    // closing writes the last chunk
+    mBinaryWriter.reset();
+  }
+
+  if (mDroppedRecords > 0 || mLateRecords > 0)
+  {
+    cedar::aux::LogSingleton::getInstance()->warning
+    (
+      "Recording of \"" + mName + "\" dropped " + cedar::aux::toString(mDroppedRecords.load()) + " and delayed "
+        + cedar::aux::toString(mLateRecords.load()) + " record(s).",
+      CEDAR_CURRENT_FUNCTION_NAME
+    );
   }
 }
 
-void cedar::aux::DataSpectator::writeHeader(cedar::aux::SerializationFormat::Id mode)
+void cedar::aux::DataSpectator::writeHeader()
 {
   QWriteLocker locker(mpOfstreamLock);
-  mData->serializeHeader(mOutputStream, mode);
+  mData->serializeHeader(mOutputStream, mSerializationMode);
   mOutputStream << std::endl;
 }
 
 void cedar::aux::DataSpectator::record()
 {
-  // Copy the Data
-  cedar::aux::DataPtr data = mData->clone();
+  // thread context: called from this thread only, i.e., this is the single producer of mRecordBuffer.
+  cedar::unit::Time time = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
+  if (mHasRecorded && time - mLastRecordTime > 1.5 * this->getStepSize())
+  {
+    ++mLateRecords;
+  }
+  mLastRecordTime = time;
+  mHasRecorded = true;
 
-  //Create new recordData
-  RecordData rec;
-  rec.mData = data;
-  rec.mRecordTime = cedar::aux::GlobalClockSingleton::getInstance()->getTime();
-  //Lock the Queue and push record Data
-  QWriteLocker locker(mpQueueLock);
-  mDataQueue.push_back(rec);
+  RecordData* slot = this->acquireSlot();
+  if (slot == nullptr)
+  {
+    ++mDroppedRecords;
+    return;
+  }
+
+  slot->mRecordTime = time;
+  this->copyData(*slot);
+  mRecordBuffer.commitWrite();
 }
 
-void cedar::aux::DataSpectator::writeFirstRecordData(cedar::aux::SerializationFormat::Id mode)
+cedar::aux::DataSpectator::RecordData* cedar::aux::DataSpectator::acquireSlot()
 {
-  // thread context: called from Recorder's thread.
-  /* This function uses a lot of locks. It is important to don't lock the queue during the serialization (takes 25-30ms)
-   * to not block the record function for pushing new RecordData into the queue.
-   */
-  unsigned int size;
+  switch (mBackPressurePolicy)
+  {
+    case cedar::aux::RecorderBackPressurePolicy::Block:
+    {
+      // wait for the recorder for at most one record interval so that this thread does not fall behind
+      RecordData* slot = mRecordBuffer.beginWrite();
+      cedar::unit::Time waited(0.0 * cedar::unit::seconds);
+      const cedar::unit::Time wait_step(0.1 * cedar::unit::milli * cedar::unit::seconds);
+      while (slot == nullptr && waited < this->getStepSize() && !this->stopRequested())
+      {
+        cedar::aux::sleep(wait_step);
+        waited += wait_step;
+        slot = mRecordBuffer.beginWrite();
+      }
+      return slot;
+    }
 
+    case cedar::aux::RecorderBackPressurePolicy::Decimate:
+      // while the buffer is more than half full, every other record is skipped
+      if (2 * mRecordBuffer.size() > mRecordBuffer.capacity())
+      {
+        mSkipNextRecord = !mSkipNextRecord;
+        if (!mSkipNextRecord)
+        {
+          return nullptr;
+        }
+      }
+      else
+      {
+        mSkipNextRecord = false;
+      }
+      return mRecordBuffer.beginWrite();
+
+    case cedar::aux::RecorderBackPressurePolicy::Drop:
+    default:
+      return mRecordBuffer.beginWrite();
+  }
+}
+
+void cedar::aux::DataSpectator::copyData(RecordData& slot) const
+{
+  if (auto mat_data = boost::dynamic_pointer_cast<const cedar::aux::MatData>(mData))
   {
-    QReadLocker locker(mpQueueLock);
-    size = mDataQueue.size();
+    // copyTo reuses the memory of the slot as long as size and type of the data do not change; double-buffered data
+    // is copied from its front buffer without locking
+    mat_data->copyFrontTo(slot.mMatrix);
   }
+  else
+  {
+    slot.mData = mData->clone();
+  }
+}
 
-  if (size > 0)
+void cedar::aux::DataSpectator::writeAllRecordData()
+{
+  // thread context: called from Recorder's thread and when this thread quits.
+  /* Only the records that are in the buffer when this function is entered are written so that a fast producer cannot
+   * keep the recorder in here. The buffer is not locked for the producer during serialization.
+   */
+  QMutexLocker locker(&mBufferReadLock);
+
+  for (size_t count = mRecordBuffer.size(); count > 0; --count)
   {
-    // Save data to disk.
-    RecordData data;
+    RecordData* data = mRecordBuffer.beginRead();
+    if (data == nullptr)
     {
-      QWriteLocker locker(mpQueueLock);
-      data = mDataQueue.front();
-      mDataQueue.pop_front();
+      break;
     }
 
-    {
-      QWriteLocker locker(mpOfstreamLock);
-      mOutputStream << data.mRecordTime << ",";
-      data.mData->serializeData(mOutputStream, mode);
-      mOutputStream << std::endl;
-    }
+    writeRecordData(*data);
+    mRecordBuffer.commitRead();
   }
 }
 
-void cedar::aux::DataSpectator::writeAllRecordData(cedar::aux::SerializationFormat::Id mode)
+void cedar::aux::DataSpectator::writeRecordData(const RecordData& data)
 {
-  // thread context: called from Recorder's thread.
-  // here a single lock is enough. No new recordData will be created so the list can be blocked.
-
-  QWriteLocker locker(mpQueueLock);
-
-  while (mDataQueue.size() > 0)
+  QWriteLocker locker(mpOfstreamLock);
+  if (mBinaryWriter)
   {
-    RecordData data;
-    data = mDataQueue.front();
-
+    // prepareStart made sure that the data is a MatData
+    mBinaryWriter->write(data.mRecordTime, data.mMatrix);
+  }
+  else
+  {
+    mOutputStream << data.mRecordTime << ",";
+    if (data.mData)
     {
-      QWriteLocker locker(mpOfstreamLock);
-      mOutputStream << data.mRecordTime << ",";
-      data.mData->serializeData(mOutputStream, mode);
-      mOutputStream << std::endl;
+      data.mData->serializeData(mOutputStream, mSerializationMode);
     }
-    mDataQueue.pop_front();
-
+    else
+    {
+      // only shares the matrix, the slot is not released before the data is written
+      mSerializationData->setData(data.mMatrix);
+      mSerializationData->serializeData(mOutputStream, mSerializationMode);
+    }
+    mOutputStream << std::endl;
   }
 }
 
@@ -222,12 +348,22 @@ cedar::unit::Time cedar::aux::DataSpectator::getRecordIntervalTime() const
   return this->getStepSize();
 }
 
+unsigned int cedar::aux::DataSpectator::getNumberOfDroppedRecords() const
+{
+  return this->mDroppedRecords;
+}
+
+unsigned int cedar::aux::DataSpectator::getNumberOfLateRecords() const
+{
+  return this->mLateRecords;
+}
+
 void cedar::aux::DataSpectator::makeSnapshot()
 {
   // Create Directory
   std::string project_name = cedar::aux::RecorderSingleton::getInstance()->getRecorderProjectName();
   std::string time_stamp = cedar::aux::RecorderSingleton::getInstance()->getTimeStamp();
-  std::string output_dir = cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory()
+  std::string output_dir = cedar::aux::RecorderSingleton::getInstance()->getOutputBaseDirectory()
                            + "/"+project_name+"/Snapshots/snapshot_"+ time_stamp;
   boost::filesystem::create_directories(output_dir);
 
@@ -41,21 +41,32 @@
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/Data.h"
 #include "cedar/auxiliaries/LoopedThread.h"
+#include "cedar/auxiliaries/SerializationFormat.h"
+#include "cedar/auxiliaries/RecorderBackPressurePolicy.h"
+#include "cedar/auxiliaries/RingBuffer.h"
 #include "cedar/units/Time.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/DataSpectator.fwd.h"
 #include "cedar/auxiliaries/Recorder.fwd.h"
+#include "cedar/auxiliaries/BinaryRecordingWriter.fwd.h"
+#include "cedar/auxiliaries/MatData.fwd.h"
 
 // SYSTEM INCLUDES
 #include <QTime>
+#include <QMutex>
+#include <opencv2/opencv.hpp>
 #include <string>
 #include <fstream>
-#include <list>
+#include <atomic>
 
 /*!@brief The Recorder uses this class to observe the registered DataPtr.
- *        This class copies the observed DataPtr in each time step and stores the copy in a queue together with time
- *        stamp. The recorder can access this queue and write the elements to disk.
+ *        This class copies the observed DataPtr in each time step and stores the copy in a ring buffer together with
+ *        a time stamp. The recorder can access this buffer and write the elements to disk.
+ *
+ *        The buffer is a preallocated single-producer/single-consumer ring; matrix data is copied into the memory of
+ *        its slots, so recording does not allocate. When the buffer is full, the back-pressure policy set in
+ *        cedar::aux::Settings decides what happens with new records.
  */
 class cedar::aux::DataSpectator : public cedar::aux::LoopedThread
 {
@@ -72,10 +83,13 @@ class cedar::aux::DataSpectator : public cedar::aux::LoopedThread
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  //!@brief A data structure to store all the DataPtr with time stamp (in ms) in a list.
+  //!@brief A data structure to store a recorded DataPtr with time stamp (in ms) in the ring buffer.
   struct RecordData
   {
     cedar::unit::Time mRecordTime;
+    //! Copy of the data if it is a matrix; the memory is reused between records.
+    cv::Mat mMatrix;
+    //! Copy of the data if it is not a matrix.
     cedar::aux::DataPtr mData;
   };
 
@@ -110,6 +124,14 @@ public:
   //!@brief Makes a snapshot of the data.
   void makeSnapshot();
 
+  //!@brief Returns the number of records of the current recording that were lost because the buffer was full.
+  unsigned int getNumberOfDroppedRecords() const;
+
+  /*!@brief Returns the number of records of the current recording that were taken later than one and a half record
+   *        intervals after their predecessor.
+   */
+  unsigned int getNumberOfLateRecords() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -124,17 +146,23 @@ private:
   void step(cedar::unit::Time time);
 
   //!@brief Writes the header for the DataPtr to the output file.
-  void writeHeader(cedar::aux::SerializationFormat::Id mode);
+  void writeHeader();
 
-  //!@brief Writes the first element of the RecordData queue to the output file.
-  void writeFirstRecordData(cedar::aux::SerializationFormat::Id mode);
+  //!@brief Writes all RecordData currently in the buffer to the output file.
+  void writeAllRecordData();
 
-  //!@brief Writes the whole RecordData queue to the output file.
-  void writeAllRecordData(cedar::aux::SerializationFormat::Id mode);
+  //!@brief Writes one element of the RecordData buffer to the output file.
+  void writeRecordData(const RecordData& data);
 
-  //!@brief Copies the DataPtr and stores it as new RecordData in the queue.
+  //!@brief Copies the DataPtr and stores it as new RecordData in the buffer.
   void record();
 
+  //!@brief Returns a free slot of the buffer according to the back-pressure policy, or null if the record is dropped.
+  RecordData* acquireSlot();
+
+  //!@brief Copies the observed data into the given slot.
+  void copyData(RecordData& slot) const;
+
   //!@brief Starts the DataSpectator: Before starting the output file will be opened and the header be written.
   void prepareStart();
 
@@ -161,14 +189,41 @@ private:
   //!@brief The Lock for mOutputStream.
   QReadWriteLock* mpOfstreamLock;
 
-  //!@brief This queue will be write to disk every time step is called.
-  std::list<RecordData> mDataQueue;
+  //!@brief The ring the records are handed to the recorder with. Filled by this thread, emptied by the recorder.
+  cedar::aux::RingBuffer<RecordData> mRecordBuffer;
+
+  //!@brief Makes sure that only one thread at a time empties mRecordBuffer.
+  QMutex mBufferReadLock;
+
+  //!@brief What to do when mRecordBuffer is full; fixed when the recording starts.
+  cedar::aux::RecorderBackPressurePolicy::Id mBackPressurePolicy;
 
-  //!@brief Locks mDataQueue.
-  QReadWriteLock* mpQueueLock;
+  //!@brief Whether the next record is skipped when decimating.
+  bool mSkipNextRecord;
+
+  //!@brief Number of records lost in the current recording.
+  std::atomic<unsigned int> mDroppedRecords;
+
+  //!@brief Number of late records in the current recording.
+  std::atomic<unsigned int> mLateRecords;
+
+  //!@brief Time of the last record, used to detect late records.
+  cedar::unit::Time mLastRecordTime;
+
+  //!@brief Whether there has been a record in the current recording.
+  bool mHasRecorded;
+
+  //!@brief Wraps recorded matrices for serializing them as text.
+  cedar::aux::MatDataPtr mSerializationData;
 
   //!@brief Unique name of the DataPtr.
   std::string mName;
+
+  //!@brief The format of the current recording; fixed when the recording starts.
+  cedar::aux::SerializationFormat::Id mSerializationMode;
+
+  //!@brief Writes the records in binary mode. Null in all other modes.
+  cedar::aux::BinaryRecordingWriterPtr mBinaryWriter;
 };
 
 #endif // CEDAR_AUX_DATASPECTATOR_H_
@@ -40,6 +40,9 @@
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 
+// SYSTEM INCLUDES
+#include <algorithm>
+
 cedar::aux::GlobalClock::GlobalClock()
 :
 mpAccessLock(new QReadWriteLock()),
@@ -61,6 +64,9 @@ seedState(0)
   //Initialize to 100.0, which is the default field value
   mCurMinTau.store(100.0);
 
+  mMultiRateEnabled.store(false);
+  mMaximumUpdateRatio.store(16);
+
   this->mGlobalTimeFactorConnection = cedar::aux::SettingsSingleton::getInstance()->connectToGlobalTimeFactorChangedSignal
   (
     boost::bind(&cedar::aux::GlobalClock::globalTimeFactorChanged, this, _1)
@@ -252,6 +258,14 @@ void cedar::aux::GlobalClock::setSeed(uint64 seed)
   seedState = cv::theRNG().state;
 }
 
+uint64 cedar::aux::GlobalClock::mixSeed(uint64 value)
+{
+  value += 0x9E3779B97F4A7C15ULL;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
+}
+
 bool cedar::aux::GlobalClock::isBatchMode()
 {
   return mBatchMode;
@@ -331,3 +345,51 @@ void cedar::aux::GlobalClock::updateFieldTauMap(cedar::aux::ConfigurableWeakPtr
 
 
 }
+
+void cedar::aux::GlobalClock::setMultiRateEnabled(bool enabled)
+{
+  bool changed = (this->mMultiRateEnabled.exchange(enabled) != enabled);
+  if (changed)
+  {
+    this->mMultiRateChangedSignal(enabled);
+  }
+}
+
+bool cedar::aux::GlobalClock::isMultiRateEnabled() const
+{
+  return this->mMultiRateEnabled.load();
+}
+
+void cedar::aux::GlobalClock::setMaximumUpdateRatio(unsigned int ratio)
+{
+  this->mMaximumUpdateRatio.store(std::max(ratio, 1u));
+}
+
+unsigned int cedar::aux::GlobalClock::getMaximumUpdateRatio() const
+{
+  return this->mMaximumUpdateRatio.load();
+}
+
+unsigned int cedar::aux::GlobalClock::getUpdateRatio(const cedar::unit::Time& timeScale) const
+{
+  if (!this->mMultiRateEnabled.load())
+  {
+    return 1;
+  }
+
+  double time_scale = timeScale / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds);
+  double min_tau = this->mCurMinTau.load();
+  if (!(time_scale > 0.0) || !(min_tau > 0.0))
+  {
+    return 1;
+  }
+
+  double slowdown = time_scale / min_tau;
+  unsigned int maximum = this->mMaximumUpdateRatio.load();
+  unsigned int ratio = 1;
+  while (ratio * 2 <= maximum && ratio * 2 <= slowdown)
+  {
+    ratio *= 2;
+  }
+  return ratio;
+}
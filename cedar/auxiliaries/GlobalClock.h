@@ -51,6 +51,7 @@
   #include <boost/signals2.hpp>
 #endif // Q_MOC_RUN
 #include <QReadWriteLock>
+#include <atomic>
 
 //!@brief Can start, stop and reset the network time and should be used as a central time giver in a network.
 class cedar::aux::GlobalClock
@@ -114,6 +115,9 @@ public:
   uint64 getSeed();
   void setSeed(uint64 seed);
 
+  //! Scrambles a seed (splitmix64), so that seeds derived from neighboring values are unrelated.
+  static uint64 mixSeed(uint64 value);
+
   void setLoopMode(cedar::aux::LoopMode::Id newLoopMode);
 
   void setBatchMode(bool batchMode);
@@ -128,6 +132,27 @@ public:
 
   void updateFieldTauMap(cedar::aux::ConfigurableWeakPtr confWPointer, double tauValue);
 
+  //! Enables or disables multi-rate simulation, i.e., updating slow dynamics less often than fast ones.
+  void setMultiRateEnabled(bool enabled);
+
+  //! Returns true if multi-rate simulation is enabled.
+  bool isMultiRateEnabled() const;
+
+  //! Sets the largest number of global steps that may pass between two updates of a slow element.
+  void setMaximumUpdateRatio(unsigned int ratio);
+
+  //! Returns the largest number of global steps that may pass between two updates of a slow element.
+  unsigned int getMaximumUpdateRatio() const;
+
+  /*!@brief Returns after how many global steps an element with the given time scale should be updated.
+   *
+   *        The ratio is the element's time scale divided by the current minimal tau, rounded down to a power of two so
+   *        that the updates of slow elements coincide, and limited by the maximum update ratio. Elements are thus never
+   *        simulated with a coarser step relative to their time scale than the fastest field. Without multi-rate
+   *        simulation, or for elements with no known time scale (zero), the ratio is one.
+   */
+  unsigned int getUpdateRatio(const cedar::unit::Time& timeScale) const;
+
   boost::signals2::connection connectToDefaultCPUStepSizeChangedSignal(boost::function<void(cedar::unit::Time)> slot)
   {
     return this->mDefaultCPUStepSizeChangedSignal.connect(slot);
@@ -153,6 +178,11 @@ public:
       return this->mMinCurTauChangedSignal.connect(slot);
   }
 
+  boost::signals2::connection connectToMultiRateChangedSignal(boost::function<void(bool)> slot)
+  {
+    return this->mMultiRateChangedSignal.connect(slot);
+  }
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -211,6 +241,12 @@ private:
 
   std::map<cedar::aux::ConfigurableWeakPtr , double> mFieldTauMap;
 
+  //! Whether slow dynamics are updated less often than fast ones.
+  std::atomic<bool> mMultiRateEnabled;
+
+  //! Upper limit for the number of global steps between two updates of an element in multi-rate simulation.
+  std::atomic<unsigned int> mMaximumUpdateRatio;
+
   //! Connected to the change signal of the global time factor.
   boost::signals2::scoped_connection mGlobalTimeFactorConnection;
 
@@ -223,6 +259,8 @@ private:
   boost::signals2::signal<void(cedar::aux::LoopMode::Id)> mLoopModeChangedSignal;
 
   boost::signals2::signal<void()> mMinCurTauChangedSignal;
+
+  boost::signals2::signal<void(bool)> mMultiRateChangedSignal;
 };
 
 #include "cedar/auxiliaries/Singleton.h"
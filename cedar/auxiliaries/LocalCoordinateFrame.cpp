@@ -143,10 +143,16 @@ cv::Mat cedar::aux::LocalCoordinateFrame::getTransformation() const
   return mTransformation.clone();
 }
 
+void cedar::aux::LocalCoordinateFrame::getTransformation(cv::Mat& transformation) const
+{
+  QReadLocker locker(&mLock);
+  mTransformation.copyTo(transformation);
+}
+
 void cedar::aux::LocalCoordinateFrame::setTransformation(cv::Mat transformation)
 {
   QWriteLocker locker(&mLock);
-  mTransformation = transformation;
+  transformation.copyTo(mTransformation);
 }
 
 void cedar::aux::LocalCoordinateFrame::update()
@@ -110,8 +110,17 @@ public:
    */
   cv::Mat getTransformation() const;
 
+  /*!@brief copies the \f$4 \times 4\f$ rigid transformation matrix into the given matrix
+   *
+   * Does not allocate memory if the matrix already is a \f$4 \times 4\f$ CV_32F matrix.
+   * @param transformation receives the transformation of the local frame relative to the world frame
+   */
+  void getTransformation(cv::Mat& transformation) const;
+
   /*!@brief sets the transformation matrix
    * @param transformation \f$4 \times 4\f$ rigid transformation matrix of the object frame relative to the world frame
+   *
+   * The matrix is copied into the frame's own storage.
    */
   void setTransformation(cv::Mat transformation);
 
@@ -54,6 +54,7 @@
 cedar::aux::Lockable::Lockable()
 {
   this->mLockSets.push_back(Locks());
+  this->mFlatLockSets.push_back(FlatLocks());
   this->mLockSetHandles["all"] = 0;
 }
 
@@ -83,6 +84,7 @@ cedar::aux::Lockable::LockSetHandle cedar::aux::Lockable::defineLockSet(const st
 
   cedar::aux::Lockable::LockSetHandle new_handle = this->mLockSets.size();
   this->mLockSets.push_back(Locks());
+  this->mFlatLockSets.push_back(FlatLocks());
   this->mLockSetHandles[lockSet] = new_handle;
 
   return new_handle;
@@ -106,18 +108,11 @@ void cedar::aux::Lockable::lockAll(cedar::aux::LOCK_TYPE lockType, LockSetHandle
 {
   QReadLocker locker(&this->mLocksLock);
 
-  CEDAR_ASSERT(lockSet < this->mLockSets.size());
+  CEDAR_ASSERT(lockSet < this->mFlatLockSets.size());
 
-  QReadWriteLock* p_last = NULL;
-  for (Locks::const_iterator iter = this->mLockSets[lockSet].begin(); iter != this->mLockSets[lockSet].end(); ++iter)
+  for (const auto& lock_type_pair : this->mFlatLockSets[lockSet])
   {
-    QReadWriteLock* p_lock = iter->first;
-
-    if (p_lock != p_last)
-    {
-      p_last = p_lock;
-      cedar::aux::Lockable::applyLockType(p_lock, lockType);
-    }
+    cedar::aux::Lockable::applyLockType(lock_type_pair.first, lockType);
   }
 }
 
@@ -125,18 +120,11 @@ void cedar::aux::Lockable::lockAll(LockSetHandle lockSet) const
 {
   QReadLocker locker(&this->mLocksLock);
 
-  CEDAR_ASSERT(lockSet < this->mLockSets.size());
+  CEDAR_ASSERT(lockSet < this->mFlatLockSets.size());
 
-  QReadWriteLock* p_last = NULL;
-  for (Locks::const_iterator iter = this->mLockSets[lockSet].begin(); iter != this->mLockSets[lockSet].end(); ++iter)
+  for (const auto& lock_type_pair : this->mFlatLockSets[lockSet])
   {
-    QReadWriteLock* p_lock = iter->first;
-
-    if (p_lock != p_last)
-    {
-      p_last = p_lock;
-      this->applyLockType(p_lock, iter->second);
-    }
+    cedar::aux::Lockable::applyLockType(lock_type_pair.first, lock_type_pair.second);
   }
 }
 
@@ -144,17 +132,28 @@ void cedar::aux::Lockable::unlockAll(LockSetHandle lockSet) const
 {
   QReadLocker locker(&this->mLocksLock);
 
-  CEDAR_ASSERT(lockSet < this->mLockSets.size());
+  CEDAR_ASSERT(lockSet < this->mFlatLockSets.size());
 
-  QReadWriteLock* p_last = NULL;
-  for (Locks::const_iterator iter = this->mLockSets[lockSet].begin(); iter != this->mLockSets[lockSet].end(); ++iter)
+  for (const auto& lock_type_pair : this->mFlatLockSets[lockSet])
   {
-    QReadWriteLock* p_lock = iter->first;
+    if (lock_type_pair.second != cedar::aux::LOCK_TYPE_DONT_LOCK)
+    {
+      lock_type_pair.first->unlock();
+    }
+  }
+}
 
-    if (p_lock != p_last && iter->second != cedar::aux::LOCK_TYPE_DONT_LOCK)
+void cedar::aux::Lockable::updateFlatLocks(LockSetHandle lockSet)
+{
+  // locks that are stored multiple times are only locked once, with the type that is ordered first (i.e., reading
+  // before writing, and not locking only if that is the only type it is stored with)
+  FlatLocks& flat_locks = this->mFlatLockSets[lockSet];
+  flat_locks.clear();
+  for (const auto& lock_type_pair : this->mLockSets[lockSet])
+  {
+    if (flat_locks.empty() || flat_locks.back().first != lock_type_pair.first)
     {
-      p_last = p_lock;
-      p_lock->unlock();
+      flat_locks.push_back(lock_type_pair);
     }
   }
 }
@@ -166,6 +165,7 @@ void cedar::aux::Lockable::addLock(QReadWriteLock* pLock, cedar::aux::LOCK_TYPE
   CEDAR_ASSERT(lockSet < this->mLockSets.size());
 
   this->mLockSets[lockSet].insert(std::make_pair(pLock, lockType));
+  this->updateFlatLocks(lockSet);
 
   if (lockSet != 0)
   {
@@ -188,6 +188,7 @@ void cedar::aux::Lockable::removeLock(QReadWriteLock* pLock, cedar::aux::LOCK_TY
     CEDAR_THROW(cedar::aux::NotFoundException, "The given data object was not found in this lockable.");
   }
   lock_set.erase(iter);
+  this->updateFlatLocks(lockSet);
 
   // remove the automatically added locks from the "all" set.
   if (lockSet != 0)
@@ -75,6 +75,9 @@ public:
   //! Storage for locks in this class.
   typedef std::multiset<std::pair<QReadWriteLock*, cedar::aux::LOCK_TYPE> > Locks;
 
+  //! Each lock of a lock set once, in locking order; this is what is iterated when locking.
+  typedef std::vector<std::pair<QReadWriteLock*, cedar::aux::LOCK_TYPE> > FlatLocks;
+
 public:
   /*! @brief A RAII-based locker for lockables. Will automatically unlock when the locker is destroyed.
    *
@@ -228,6 +231,9 @@ protected:
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
+  //! Rebuilds the flat array of the given lock set; mLocksLock must be locked for writing.
+  void updateFlatLocks(LockSetHandle lockSet);
+
   inline static void applyLockType(QReadWriteLock* pLock, cedar::aux::LOCK_TYPE lockType)
   {
     switch (lockType)
@@ -261,6 +267,9 @@ private:
   //! Storage of the lock sets. mLockSets[0] contains all locks.
   mutable std::vector<Locks> mLockSets;
 
+  //! The lock sets flattened for locking, see updateFlatLocks.
+  std::vector<FlatLocks> mFlatLockSets;
+
 }; // class cedar::aux::Lockable
 
 #endif // CEDAR_AUX_LOCKABLE_H
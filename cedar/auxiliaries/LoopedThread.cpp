@@ -127,6 +127,47 @@ _mUseDefaultCPUStep
     "use default CPU step",
     true
   )
+),
+_mPreciseTiming
+(
+  new cedar::aux::BoolParameter
+  (
+    this,
+    "precise timing",
+    false
+  )
+),
+_mSpinTime
+(
+  new cedar::aux::TimeParameter
+  (
+    this,
+    "spin time",
+    cedar::unit::Time(0.0 * cedar::unit::seconds),
+    cedar::aux::TimeParameter::LimitType::positiveZero()
+  )
+),
+_mCPUAffinity
+(
+  new cedar::aux::IntParameter
+  (
+    this,
+    "CPU affinity",
+    -1,
+    -1,
+    1023
+  )
+),
+_mRealTimePriority
+(
+  new cedar::aux::UIntParameter
+  (
+    this,
+    "real-time priority",
+    0,
+    0,
+    99
+  )
 )
 {
   init();
@@ -209,7 +250,48 @@ _mUseDefaultCPUStep
                 "use default CPU step",
                 true
                 )
-                )
+                ),
+_mPreciseTiming
+(
+  new cedar::aux::BoolParameter
+  (
+    this,
+    "precise timing",
+    false
+  )
+),
+_mSpinTime
+(
+  new cedar::aux::TimeParameter
+  (
+    this,
+    "spin time",
+    cedar::unit::Time(0.0 * cedar::unit::seconds),
+    cedar::aux::TimeParameter::LimitType::positiveZero()
+  )
+),
+_mCPUAffinity
+(
+  new cedar::aux::IntParameter
+  (
+    this,
+    "CPU affinity",
+    -1,
+    -1,
+    1023
+  )
+),
+_mRealTimePriority
+(
+  new cedar::aux::UIntParameter
+  (
+    this,
+    "real-time priority",
+    0,
+    0,
+    99
+  )
+)
 {
   init();
 }
@@ -283,6 +365,12 @@ void cedar::aux::LoopedThread::makeParametersConst(bool makeConst)
     this->_mStepSize->setConstant(makeConst);
     this->_mSimulatedTime->setConstant(makeConst);
   }
+
+  // the timing and scheduling of the thread are set up when it starts
+  this->_mPreciseTiming->setConstant(makeConst);
+  this->_mSpinTime->setConstant(makeConst);
+  this->_mCPUAffinity->setConstant(makeConst);
+  this->_mRealTimePriority->setConstant(makeConst);
 }
 
 void cedar::aux::LoopedThread::stopStatistics()
@@ -389,6 +477,93 @@ void cedar::aux::LoopedThread::setSimulatedTime(cedar::unit::Time simulatedTime)
   _mSimulatedTime->setValue(simulatedTime);
 }
  
+void cedar::aux::LoopedThread::setPreciseTiming(bool precise)
+{
+  QWriteLocker locker(this->_mPreciseTiming->getLock());
+
+  this->_mPreciseTiming->setValue(precise);
+}
+
+bool cedar::aux::LoopedThread::usesPreciseTiming() const
+{
+  QReadLocker locker(this->_mPreciseTiming->getLock());
+
+  return this->_mPreciseTiming->getValue();
+}
+
+void cedar::aux::LoopedThread::setSpinTime(cedar::unit::Time spinTime)
+{
+  QWriteLocker locker(this->_mSpinTime->getLock());
+
+  this->_mSpinTime->setValue(spinTime);
+}
+
+cedar::unit::Time cedar::aux::LoopedThread::getSpinTime() const
+{
+  QReadLocker locker(this->_mSpinTime->getLock());
+  cedar::unit::Time spin_time = this->_mSpinTime->getValue();
+  return spin_time;
+}
+
+void cedar::aux::LoopedThread::setCPUAffinity(int cpu)
+{
+  QWriteLocker locker(this->_mCPUAffinity->getLock());
+
+  this->_mCPUAffinity->setValue(cpu);
+}
+
+int cedar::aux::LoopedThread::getCPUAffinity() const
+{
+  QReadLocker locker(this->_mCPUAffinity->getLock());
+
+  return this->_mCPUAffinity->getValue();
+}
+
+void cedar::aux::LoopedThread::setRealTimePriority(unsigned int priority)
+{
+  QWriteLocker locker(this->_mRealTimePriority->getLock());
+
+  this->_mRealTimePriority->setValue(priority);
+}
+
+unsigned int cedar::aux::LoopedThread::getRealTimePriority() const
+{
+  QReadLocker locker(this->_mRealTimePriority->getLock());
+
+  return this->_mRealTimePriority->getValue();
+}
+
+std::vector<unsigned long> cedar::aux::LoopedThread::getWakeupLatencyHistogram() const
+{
+  if (this->mpWorker)
+  {
+    return this->mpWorker->getWakeupLatencyHistogram();
+  }
+  else
+  {
+    return std::vector<unsigned long>(cedar::aux::detail::LoopedThreadWorker::WAKEUP_LATENCY_BINS, 0);
+  }
+}
+
+cedar::unit::Time cedar::aux::LoopedThread::getWakeupLatencyBinWidth()
+{
+  return cedar::unit::Time
+         (
+           static_cast<double>(cedar::aux::detail::LoopedThreadWorker::WAKEUP_LATENCY_BIN_WIDTH_NS)
+             * cedar::unit::nano * cedar::unit::seconds
+         );
+}
+
+cedar::unit::Time cedar::aux::LoopedThread::getMaximumWakeupLatency() const
+{
+  long long latency = 0;
+  if (this->mpWorker)
+  {
+    latency = this->mpWorker->getMaximumWakeupLatency();
+  }
+  return cedar::unit::Time(static_cast<double>(latency) * cedar::unit::nano * cedar::unit::seconds);
+}
+
 cedar::aux::detail::ThreadWorker* cedar::aux::LoopedThread::resetWorker()
 {
   mpWorker = new cedar::aux::detail::LoopedThreadWorker(this);
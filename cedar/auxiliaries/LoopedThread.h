@@ -46,6 +46,8 @@
 #include "cedar/auxiliaries/DoubleParameter.h"
 #include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/EnumParameter.h"
+#include "cedar/auxiliaries/IntParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
 #include "cedar/auxiliaries/LoopMode.h"
 #include "cedar/auxiliaries/ThreadWrapper.h"
 #include "cedar/auxiliaries/TimeParameter.h"
@@ -61,6 +63,7 @@
 #include <QThread>
 #include <QMutex>
 #include <QReadWriteLock>
+#include <vector>
 #ifndef Q_MOC_RUN
   #include <boost/date_time/posix_time/posix_time_types.hpp>
 #endif
@@ -111,6 +114,13 @@
  * to fulfill real-time constraints.
  *
  * The preferred way to stop the thread from itself is to call requestStop().
+ *
+ * For control loops that need low jitter, the real deltaT and fake deltaT modes can use precise timing
+ * (setPreciseTiming()): the thread then sleeps until absolute deadlines on the monotonic clock, optionally followed by
+ * a short spin-wait (setSpinTime()), and stays on the grid of its first deadline. Independent of the mode, the thread
+ * can be pinned to a CPU (setCPUAffinity()) and run with a SCHED_FIFO real-time priority (setRealTimePriority()). In
+ * the real deltaT and fake deltaT modes, the latency of every wakeup is recorded in a histogram
+ * (getWakeupLatencyHistogram()). Precise timing, affinity and priorities are only available on Linux.
  */
 class cedar::aux::LoopedThread : public cedar::aux::ThreadWrapper
 {
@@ -341,6 +351,55 @@ public:
     mpWorker->setDebugMe(b);
   }
 
+  /*!@brief Sets whether the thread sleeps until absolute deadlines on the monotonic clock.
+   *
+   * Only used in the real deltaT and fake deltaT modes with a step size above zero. Takes effect when the thread is
+   * (re-)started.
+   */
+  void setPreciseTiming(bool precise);
+
+  //! Returns whether the thread sleeps until absolute deadlines on the monotonic clock.
+  bool usesPreciseTiming() const;
+
+  /*!@brief Sets how long before each deadline the thread stops sleeping and spins instead.
+   *
+   * Only used with precise timing. Spinning trades CPU time for a lower wakeup latency; a few tens of microseconds
+   * are usually enough to hide the scheduler's wakeup latency.
+   */
+  void setSpinTime(cedar::unit::Time spinTime);
+
+  //! Returns how long before each deadline the thread stops sleeping and spins instead.
+  cedar::unit::Time getSpinTime() const;
+
+  //! Sets the CPU the thread is pinned to; -1 lets the thread run on any CPU. Takes effect on the next start.
+  void setCPUAffinity(int cpu);
+
+  //! Returns the CPU the thread is pinned to or -1 if it may run on any CPU.
+  int getCPUAffinity() const;
+
+  /*!@brief Sets the SCHED_FIFO priority (1 to 99) of the thread; 0 keeps the normal scheduling policy.
+   *
+   * Takes effect on the next start. Real-time priorities usually require special permissions (e.g., an rtprio limit);
+   * if they cannot be set, a warning is logged and the thread runs with its normal priority.
+   */
+  void setRealTimePriority(unsigned int priority);
+
+  //! Returns the SCHED_FIFO priority of the thread; 0 means normal scheduling.
+  unsigned int getRealTimePriority() const;
+
+  /*!@brief Returns the number of wakeups per latency bin since the last start.
+   *
+   * Bin i counts the wakeups that were between i and i + 1 bin widths (see getWakeupLatencyBinWidth()) late; the last
+   * bin also counts all later wakeups.
+   */
+  std::vector<unsigned long> getWakeupLatencyHistogram() const;
+
+  //! Returns the width of the bins of the wakeup latency histogram.
+  static cedar::unit::Time getWakeupLatencyBinWidth();
+
+  //! Returns the largest wakeup latency since the last start.
+  cedar::unit::Time getMaximumWakeupLatency() const;
+
 
   //----------------------------------------------------------------------------
   // protected methods
@@ -423,6 +482,18 @@ protected:
 
   cedar::aux::BoolParameterPtr _mUseDefaultCPUStep;
 
+  //! Whether the thread sleeps until absolute deadlines on the monotonic clock
+  cedar::aux::BoolParameterPtr _mPreciseTiming;
+
+  //! How long before each deadline the thread spins instead of sleeping
+  cedar::aux::TimeParameterPtr _mSpinTime;
+
+  //! The CPU the thread is pinned to, or -1
+  cedar::aux::IntParameterPtr _mCPUAffinity;
+
+  //! The SCHED_FIFO priority of the thread, or 0 for normal scheduling
+  cedar::aux::UIntParameterPtr _mRealTimePriority;
+
 private:
     // none yet
 
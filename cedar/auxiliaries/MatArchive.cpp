@@ -0,0 +1,342 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        MatArchive.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Binary archive of named matrices that is read via a memory mapping.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/MatArchive.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#ifdef CEDAR_OS_UNIX
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif // CEDAR_OS_UNIX
+#include <fstream>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef CEDAR_COMPILER_MSVC
+const uint32_t cedar::aux::MatArchive::MAGIC;
+const uint16_t cedar::aux::MatArchive::VERSION;
+const uint32_t cedar::aux::MatArchive::BLOB_ALIGNMENT;
+#endif // CEDAR_COMPILER_MSVC
+
+// the header is written as raw bytes, so its layout must not depend on the compiler's padding
+static_assert(sizeof(cedar::aux::MatArchive::FileHeader) == 32, "unexpected size of the archive header");
+
+namespace
+{
+  //! Size of an index entry without the name.
+  const size_t index_entry_size = sizeof(cedar::aux::BinaryMatFrame::Header) + sizeof(uint64_t) + sizeof(uint32_t);
+
+  uint64_t align(uint64_t offset)
+  {
+    const uint64_t alignment = cedar::aux::MatArchive::BLOB_ALIGNMENT;
+    return (offset + alignment - 1) / alignment * alignment;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::MatArchive::MatArchive()
+:
+mpMapping(nullptr),
+mMappingSize(0)
+{
+}
+
+cedar::aux::MatArchive::~MatArchive()
+{
+  this->close();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::MatArchive::add(const std::string& name, const cv::Mat& matrix)
+{
+  if (matrix.dims > static_cast<int>(cedar::aux::BinaryMatFrame::MAX_DIMENSIONALITY))
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::RangeException,
+      "Cannot store matrices with " + cedar::aux::toString(matrix.dims) + " dimensions, the maximum is "
+        + cedar::aux::toString(cedar::aux::BinaryMatFrame::MAX_DIMENSIONALITY) + "."
+    );
+  }
+  this->mEntries[name] = matrix;
+}
+
+void cedar::aux::MatArchive::write(const std::string& path) const
+{
+  // pack all matrices first; this fixes the size of the index and thus the offsets of the blobs
+  std::vector<cedar::aux::BinaryMatFrame> frames(this->mEntries.size());
+  uint64_t index_size = 0;
+  size_t i = 0;
+  for (const auto& name_matrix_pair : this->mEntries)
+  {
+    frames.at(i++).pack(name_matrix_pair.second, 0);
+    index_size += index_entry_size + name_matrix_pair.first.size();
+  }
+
+  FileHeader file_header;
+  std::memset(&file_header, 0, sizeof(FileHeader));
+  file_header.mMagic = MAGIC;
+  file_header.mVersion = VERSION;
+  file_header.mNumberOfEntries = static_cast<uint32_t>(this->mEntries.size());
+  file_header.mAlignment = BLOB_ALIGNMENT;
+  file_header.mIndexSize = index_size;
+
+  std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+  if (!stream.good())
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + path + "\" for writing.");
+  }
+
+  stream.write(reinterpret_cast<const char*>(&file_header), sizeof(FileHeader));
+
+  uint64_t offset = align(sizeof(FileHeader) + index_size);
+  i = 0;
+  for (const auto& name_matrix_pair : this->mEntries)
+  {
+    const auto& frame = frames.at(i++);
+    uint32_t name_length = static_cast<uint32_t>(name_matrix_pair.first.size());
+    stream.write(reinterpret_cast<const char*>(&frame.getHeader()), sizeof(cedar::aux::BinaryMatFrame::Header));
+    stream.write(reinterpret_cast<const char*>(&offset), sizeof(uint64_t));
+    stream.write(reinterpret_cast<const char*>(&name_length), sizeof(uint32_t));
+    stream.write(name_matrix_pair.first.data(), name_length);
+    offset = align(offset + frame.getPayloadSize());
+  }
+
+  const char padding[BLOB_ALIGNMENT] = {0};
+  uint64_t position = sizeof(FileHeader) + index_size;
+  for (const auto& frame : frames)
+  {
+    uint64_t blob_start = align(position);
+    stream.write(padding, static_cast<std::streamsize>(blob_start - position));
+    stream.write(frame.getPayload(), static_cast<std::streamsize>(frame.getPayloadSize()));
+    position = blob_start + frame.getPayloadSize();
+  }
+
+  if (!stream.good())
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not write \"" + path + "\".");
+  }
+}
+
+void cedar::aux::MatArchive::open(const std::string& path)
+{
+  this->close();
+
+#ifdef CEDAR_OS_UNIX
+  int file = ::open(path.c_str(), O_RDONLY);
+  if (file < 0)
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + path + "\".");
+  }
+
+  struct stat file_status;
+  if (fstat(file, &file_status) != 0)
+  {
+    ::close(file);
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not determine the size of \"" + path + "\".");
+  }
+
+  this->mMappingSize = static_cast<size_t>(file_status.st_size);
+  if (this->mMappingSize > 0)
+  {
+    // a private mapping: pages are only read from disk when they are accessed, and writes are never written back
+    void* mapping = mmap(nullptr, this->mMappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+    if (mapping == MAP_FAILED)
+    {
+      ::close(file);
+      this->mMappingSize = 0;
+      CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not map \"" + path + "\" into memory.");
+    }
+    this->mpMapping = static_cast<char*>(mapping);
+  }
+  // the mapping stays valid after the file is closed
+  ::close(file);
+#else
+  std::ifstream stream(path, std::ios::binary | std::ios::ate);
+  if (!stream.good())
+  {
+    CEDAR_THROW(cedar::aux::FileNotFoundException, "Could not open \"" + path + "\".");
+  }
+  this->mFileContents.resize(static_cast<size_t>(stream.tellg()));
+  stream.seekg(0);
+  stream.read(this->mFileContents.data(), static_cast<std::streamsize>(this->mFileContents.size()));
+  this->mpMapping = this->mFileContents.data();
+  this->mMappingSize = this->mFileContents.size();
+#endif // CEDAR_OS_UNIX
+
+  try
+  {
+    this->parseIndex(path);
+  }
+  catch (...)
+  {
+    this->close();
+    throw;
+  }
+}
+
+void cedar::aux::MatArchive::parseIndex(const std::string& path)
+{
+  FileHeader file_header;
+  if (this->mMappingSize < sizeof(FileHeader))
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "\"" + path + "\" is too short to be a matrix archive.");
+  }
+  std::memcpy(&file_header, this->mpMapping, sizeof(FileHeader));
+
+  if (file_header.mMagic != MAGIC || file_header.mVersion != VERSION)
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "\"" + path + "\" is not a matrix archive of a known version.");
+  }
+  if (file_header.mIndexSize > this->mMappingSize - sizeof(FileHeader))
+  {
+    CEDAR_THROW(cedar::aux::ParseException, "The index of \"" + path + "\" is truncated.");
+  }
+
+  const char* index = this->mpMapping + sizeof(FileHeader);
+  const char* index_end = index + file_header.mIndexSize;
+  for (uint32_t i = 0; i < file_header.mNumberOfEntries; ++i)
+  {
+    if (static_cast<size_t>(index_end - index) < index_entry_size)
+    {
+      CEDAR_THROW(cedar::aux::ParseException, "The index of \"" + path + "\" is truncated.");
+    }
+
+    cedar::aux::BinaryMatFrame::Header header;
+    uint64_t offset;
+    uint32_t name_length;
+    std::memcpy(&header, index, sizeof(header));
+    index += sizeof(header);
+    std::memcpy(&offset, index, sizeof(offset));
+    index += sizeof(offset);
+    std::memcpy(&name_length, index, sizeof(name_length));
+    index += sizeof(name_length);
+
+    if (static_cast<size_t>(index_end - index) < name_length)
+    {
+      CEDAR_THROW(cedar::aux::ParseException, "The index of \"" + path + "\" is truncated.");
+    }
+    std::string name(index, name_length);
+    index += name_length;
+
+    // archives are never compressed, so the payload is the raw matrix data
+    if
+    (
+      !cedar::aux::BinaryMatFrame::isValid(header)
+      || header.mPayloadSize != header.mRawSize
+      || offset > this->mMappingSize
+      || header.mRawSize > this->mMappingSize - offset
+    )
+    {
+      CEDAR_THROW(cedar::aux::ParseException, "Entry \"" + name + "\" of \"" + path + "\" is invalid.");
+    }
+
+    if (header.mDimensionality == 0)
+    {
+      this->mEntries[name] = cv::Mat();
+    }
+    else
+    {
+      this->mEntries[name] = cv::Mat
+                             (
+                               static_cast<int>(header.mDimensionality),
+                               header.mSizes,
+                               header.mType,
+                               this->mpMapping + offset
+                             );
+    }
+  }
+}
+
+void cedar::aux::MatArchive::close()
+{
+  this->mEntries.clear();
+
+#ifdef CEDAR_OS_UNIX
+  if (this->mpMapping != nullptr)
+  {
+    munmap(this->mpMapping, this->mMappingSize);
+  }
+#else
+  this->mFileContents.clear();
+  this->mFileContents.shrink_to_fit();
+#endif // CEDAR_OS_UNIX
+
+  this->mpMapping = nullptr;
+  this->mMappingSize = 0;
+}
+
+bool cedar::aux::MatArchive::hasEntry(const std::string& name) const
+{
+  return this->mEntries.find(name) != this->mEntries.end();
+}
+
+cv::Mat cedar::aux::MatArchive::getEntry(const std::string& name) const
+{
+  auto iter = this->mEntries.find(name);
+  if (iter == this->mEntries.end())
+  {
+    CEDAR_THROW(cedar::aux::NotFoundException, "The archive contains no matrix named \"" + name + "\".");
+  }
+  return iter->second;
+}
+
+std::vector<std::string> cedar::aux::MatArchive::listEntries() const
+{
+  std::vector<std::string> names;
+  for (const auto& name_matrix_pair : this->mEntries)
+  {
+    names.push_back(name_matrix_pair.first);
+  }
+  return names;
+}
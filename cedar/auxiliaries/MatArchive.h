@@ -0,0 +1,189 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        MatArchive.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Binary archive of named matrices that is read via a memory mapping.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_MAT_ARCHIVE_H
+#define CEDAR_AUX_MAT_ARCHIVE_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/BinaryMatFrame.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/MatArchive.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#ifndef Q_MOC_RUN
+  #include <boost/noncopyable.hpp>
+#endif // Q_MOC_RUN
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+
+/*!@brief A file that holds named matrices as raw binary blobs.
+ *
+ *        The file starts with a small header and an index that lists the name, the frame header (see
+ *        cedar::aux::BinaryMatFrame::Header) and the offset of each matrix. The matrix data follows the index, each blob
+ *        aligned to BLOB_ALIGNMENT bytes. Loading maps the file into memory instead of reading and parsing it, so the
+ *        matrices returned by getEntry() point directly into the mapping. All values are in the byte order of the
+ *        writer.
+ *
+ *        Matrices are written in the order of their names with add() and write(), and read with open() and getEntry().
+ */
+class cedar::aux::MatArchive : public boost::noncopyable
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Header at the start of each archive file.
+  struct FileHeader
+  {
+    //! Always MAGIC.
+    uint32_t mMagic;
+    //! Version of the archive format.
+    uint16_t mVersion;
+    //! Padding, always zero.
+    uint16_t mReserved;
+    //! Number of matrices in the archive.
+    uint32_t mNumberOfEntries;
+    //! Alignment of the blobs in bytes.
+    uint32_t mAlignment;
+    //! Size of the index that follows the header in bytes.
+    uint64_t mIndexSize;
+    //! Padding, always zero.
+    uint64_t mReserved2;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor. Creates an empty archive.
+  MatArchive();
+
+  //!@brief Destructor; unmaps the file that was opened, if any.
+  ~MatArchive();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Adds a matrix to the archive; an existing matrix of the same name is replaced.
+   *
+   *        The matrix is not copied, so it must not be changed until the archive is written.
+   *
+   * @throws cedar::aux::RangeException if the matrix has more than BinaryMatFrame::MAX_DIMENSIONALITY dimensions.
+   */
+  void add(const std::string& name, const cv::Mat& matrix);
+
+  /*!@brief Writes all matrices of the archive to the given file.
+   *
+   * @throws cedar::aux::FileNotFoundException if the file cannot be written.
+   */
+  void write(const std::string& path) const;
+
+  /*!@brief Replaces the content of the archive with the matrices in the given file.
+   *
+   * @throws cedar::aux::FileNotFoundException if the file cannot be opened.
+   * @throws cedar::aux::ParseException if the file is not a valid archive.
+   */
+  void open(const std::string& path);
+
+  //! Returns true if the archive contains a matrix of the given name.
+  bool hasEntry(const std::string& name) const;
+
+  /*!@brief Returns the matrix of the given name.
+   *
+   *        For opened archives, the matrix points into the mapped file and is only valid as long as the archive exists;
+   *        writing to it changes only this process' copy of the page (copy-on-write). Copy it to keep it longer.
+   *
+   * @throws cedar::aux::NotFoundException if there is no matrix of this name.
+   */
+  cv::Mat getEntry(const std::string& name) const;
+
+  //! Returns the names of all matrices in the archive.
+  std::vector<std::string> listEntries() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Releases the mapped file, if any, and clears all entries.
+  void close();
+
+  //! Reads the index of the mapped file and creates the entries from it.
+  void parseIndex(const std::string& path);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Magic number at the start of each archive ("CMA1" when read as bytes on a little-endian machine).
+  static const uint32_t MAGIC = 0x31414D43;
+
+  //! Version of the archive format.
+  static const uint16_t VERSION = 1;
+
+  //! Alignment of the matrix blobs in the file in bytes.
+  static const uint32_t BLOB_ALIGNMENT = 64;
+
+private:
+  //! The matrices, by name.
+  std::map<std::string, cv::Mat> mEntries;
+
+  //! Start of the mapped file, or null if no file is mapped.
+  char* mpMapping;
+
+  //! Size of the mapped file in bytes.
+  size_t mMappingSize;
+
+  //! Holds the file on systems without memory mapping.
+  std::vector<char> mFileContents;
+
+}; // class cedar::aux::MatArchive
+
+#endif // CEDAR_AUX_MAT_ARCHIVE_H
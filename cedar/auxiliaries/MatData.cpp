@@ -41,6 +41,7 @@
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/opencv_helper.h"
 
 // SYSTEM INCLUDES
 #include <vector>
@@ -48,10 +49,23 @@
 #include <fstream>
 #include <QReadLocker>
 #include <QReadWriteLock>
+#include <QMutexLocker>
+#include <boost/make_shared.hpp>
+
+std::atomic<unsigned int> cedar::aux::MatData::mNumberOfDoubleBuffered(0);
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
 
+cedar::aux::MatData::~MatData()
+{
+  if (this->mDoubleBuffered.load())
+  {
+    --mNumberOfDoubleBuffered;
+  }
+}
+
 
 //----------------------------------------------------------------------------------------------------------------------
 // methods
@@ -382,6 +396,94 @@ cedar::aux::DataPtr cedar::aux::MatData::clone() const
   return cloned;
 }
 
+void cedar::aux::MatData::setDoubleBuffered(bool doubleBuffered)
+{
+  {
+    QMutexLocker locker(&this->mPublishLock);
+    if (this->mDoubleBuffered.exchange(doubleBuffered) != doubleBuffered)
+    {
+      if (doubleBuffered)
+      {
+        ++mNumberOfDoubleBuffered;
+      }
+      else
+      {
+        --mNumberOfDoubleBuffered;
+      }
+    }
+    if (!doubleBuffered)
+    {
+      boost::atomic_store(&this->mFront, ConstMatPtr());
+      this->mSpare.reset();
+    }
+  }
+
+  if (doubleBuffered)
+  {
+    QReadLocker locker(this->mpLock);
+    this->publish();
+  }
+}
+
+bool cedar::aux::MatData::isDoubleBuffered() const
+{
+  return this->mDoubleBuffered.load();
+}
+
+bool cedar::aux::MatData::isAnyDoubleBuffered()
+{
+  return mNumberOfDoubleBuffered.load(std::memory_order_relaxed) > 0;
+}
+
+void cedar::aux::MatData::publish()
+{
+  // the common case: no double buffering, so don't touch the mutex
+  if (!this->mDoubleBuffered.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  QMutexLocker locker(&this->mPublishLock);
+  if (!this->mDoubleBuffered.load())
+  {
+    return;
+  }
+
+  // reuse the previous front buffer if no reader holds on to it anymore; once it is no longer the front buffer, no
+  // reader can obtain it, so it stays unused
+  boost::shared_ptr<cv::Mat> next;
+  if (this->mSpare && this->mSpare.unique() && !cedar::aux::sharesData(*this->mSpare))
+  {
+    next.swap(this->mSpare);
+  }
+  else
+  {
+    next = boost::make_shared<cv::Mat>();
+  }
+  this->mData.copyTo(*next);
+
+  ConstMatPtr previous = boost::atomic_exchange(&this->mFront, ConstMatPtr(next));
+  this->mSpare = boost::const_pointer_cast<cv::Mat>(previous);
+}
+
+cedar::aux::MatData::ConstMatPtr cedar::aux::MatData::getFront() const
+{
+  return boost::atomic_load(&this->mFront);
+}
+
+void cedar::aux::MatData::copyFrontTo(cv::Mat& target) const
+{
+  if (ConstMatPtr front = this->getFront())
+  {
+    front->copyTo(target);
+  }
+  else
+  {
+    QReadLocker locker(this->mpLock);
+    this->mData.copyTo(target);
+  }
+}
+
 unsigned int cedar::aux::MatData::getDimensionality() const
 {
   return cedar::aux::math::getDimensionalityOf(this->mData);
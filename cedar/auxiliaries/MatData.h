@@ -46,6 +46,11 @@
 
 // SYSTEM INCLUDES
 #include <QReadWriteLock>
+#include <QMutex>
+#ifndef Q_MOC_RUN
+  #include <boost/shared_ptr.hpp>
+#endif
+#include <atomic>
 #include <string>
 
 /*!@brief Data containing matrices.
@@ -62,22 +67,32 @@ class cedar::aux::MatData : public cedar::aux::DataTemplate<cv::Mat>
 private:
   typedef cedar::aux::DataTemplate<cv::Mat> Super;
 
+public:
+  //! Pointer to a published matrix, see getFront().
+  typedef boost::shared_ptr<const cv::Mat> ConstMatPtr;
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
 public:
   //!@brief The standard constructor.
   MatData()
+  :
+  mDoubleBuffered(false)
   {
   }
 
   //!@brief This constructor initializes the internal data to a value.
   MatData(const cv::Mat& value)
   :
-  cedar::aux::DataTemplate<cv::Mat>(value)
+  cedar::aux::DataTemplate<cv::Mat>(value),
+  mDoubleBuffered(false)
   {
   }
 
+  //!@brief Destructor.
+  ~MatData();
+
   //--------------------------------------------------------------------------------------------------------------------
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -121,6 +136,17 @@ public:
     }
   }
 
+  /*!@brief Sets the matrix and publishes it if the data is double-buffered.
+   *
+   *        Hides DataTemplate::setData, so that writes outside of compute calls (e.g., resets or restored data) reach
+   *        the readers of the front buffer.
+   */
+  void setData(const cv::Mat& data)
+  {
+    this->Super::setData(data);
+    this->publish();
+  }
+
   //! Checks if the matrix is empty.
   bool isEmpty() const
   {
@@ -134,6 +160,39 @@ public:
     return cedar::aux::math::getMatrixEntry<ReturnT>(this->getData(), row, col);
   }
 
+  /*!@brief Enables or disables double buffering.
+   *
+   *        The matrix returned by getData() then acts as a back buffer that is written under the data's lock as usual.
+   *        publish() copies it into a front buffer that is exchanged atomically, so readers that only need a
+   *        consistent snapshot (plots, the recorder) can read the front buffer via getFront() without locking and
+   *        without ever waiting for the writer.
+   */
+  void setDoubleBuffered(bool doubleBuffered);
+
+  //! Returns whether the data is double-buffered.
+  bool isDoubleBuffered() const;
+
+  //! Returns false if no matrix data is double-buffered, i.e., if publishing can be skipped altogether.
+  static bool isAnyDoubleBuffered();
+
+  /*!@brief Publishes the current matrix as the new front buffer. Does nothing if the data is not double-buffered.
+   *
+   *        The caller must hold a lock on the data. Steps publish their outputs after every compute call and reset;
+   *        setData publishes as well.
+   */
+  void publish();
+
+  /*!@brief Returns the last published matrix, or a null pointer if the data is not double-buffered.
+   *
+   *        The matrix stays valid and unchanged for as long as the returned pointer is held.
+   */
+  ConstMatPtr getFront() const;
+
+  /*!@brief Copies the last published matrix into target if the data is double-buffered; otherwise, copies the
+   *        current matrix under a read lock.
+   */
+  void copyFrontTo(cv::Mat& target) const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -153,7 +212,20 @@ protected:
   // none yet
 
 private:
-  // none yet
+  //! Whether the data is double-buffered; read without locking before anything else in publish().
+  std::atomic<bool> mDoubleBuffered;
+
+  //! Number of double-buffered matrix data objects.
+  static std::atomic<unsigned int> mNumberOfDoubleBuffered;
+
+  //! The last published matrix; only accessed with the atomic shared pointer functions.
+  ConstMatPtr mFront;
+
+  //! The previous front buffer; its memory is reused by the next publish() once no reader holds it anymore.
+  boost::shared_ptr<cv::Mat> mSpare;
+
+  //! Serializes publishers; readers never take this lock.
+  QMutex mPublishLock;
 
 }; // class cedar::aux::MatData
 
@@ -264,6 +264,10 @@ void cedar::aux::Parameter::setChangedFlag(bool changed)
 void cedar::aux::Parameter::emitChangedSignal()
 {
   this->setChangedFlag(true);
+  if (this->mpOwner != nullptr)
+  {
+    this->mpOwner->parameterValueChanged();
+  }
   emit valueChanged();
 }
 
@@ -93,14 +93,22 @@ void cedar::aux::Recorder::setSerializationMode(cedar::aux::SerializationFormat:
   cedar::aux::SettingsSingleton::getInstance()->setSerializationFormat(mode);
 }
 
-void cedar::aux::Recorder::step(cedar::unit::Time)
+cedar::aux::RecorderBackPressurePolicy::Id cedar::aux::Recorder::getBackPressurePolicy() const
+{
+  return cedar::aux::SettingsSingleton::getInstance()->getRecorderBackPressurePolicy();
+}
+
+void cedar::aux::Recorder::setBackPressurePolicy(cedar::aux::RecorderBackPressurePolicy::Id policy)
 {
-  auto mode = this->getSerializationMode();
+  cedar::aux::SettingsSingleton::getInstance()->setRecorderBackPressurePolicy(policy);
+}
 
-  // Writing the first value of every DataSpectator queue.
+void cedar::aux::Recorder::step(cedar::unit::Time)
+{
+  // Writing the buffered records of every DataSpectator.
   for (auto data_spectator : mDataSpectators)
   {
-    boost::static_pointer_cast<cedar::aux::DataSpectator>(data_spectator.second)->writeFirstRecordData(mode);
+    boost::static_pointer_cast<cedar::aux::DataSpectator>(data_spectator.second)->writeAllRecordData();
   }
 }
 
@@ -179,8 +187,7 @@ void cedar::aux::Recorder::unregisterData(cedar::aux::ConstDataPtr data)
 
 void cedar::aux::Recorder::createOutputDirectory()
 {
-  mOutputDirectory = cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory()
-                           + "/"+mProjectName+"/"+ mSubFolder ;
+  mOutputDirectory = this->getOutputBaseDirectory() + "/"+mProjectName+"/"+ mSubFolder ;
   std::string time_stamp = this->getTimeStamp();
   boost::replace_all(mOutputDirectory, "#T#", time_stamp);
   boost::filesystem::create_directories(mOutputDirectory);
@@ -250,6 +257,20 @@ const std::string& cedar::aux::Recorder::getOutputDirectory() const
   return this->mOutputDirectory;
 }
 
+void cedar::aux::Recorder::setOutputBaseDirectory(const std::string& directory)
+{
+  this->mOutputBaseDirectory = directory;
+}
+
+std::string cedar::aux::Recorder::getOutputBaseDirectory() const
+{
+  if (!this->mOutputBaseDirectory.empty())
+  {
+    return this->mOutputBaseDirectory;
+  }
+  return cedar::aux::SettingsSingleton::getInstance()->getRecorderOutputDirectory();
+}
+
 void cedar::aux::Recorder::setRecordIntervalTime(const std::string& name, cedar::unit::Time recordInterval)
 {
   // throw exception if running
@@ -281,6 +302,26 @@ cedar::unit::Time cedar::aux::Recorder::getRecordIntervalTime(const std::string&
   }
 }
 
+unsigned int cedar::aux::Recorder::getNumberOfDroppedRecords(const std::string& name) const
+{
+  auto it = mDataSpectators.find(name);
+  if (it == mDataSpectators.end())
+  {
+    CEDAR_THROW(cedar::aux::NotFoundException, "No data of name \"" + name + "\" registered.");
+  }
+  return it->second->getNumberOfDroppedRecords();
+}
+
+unsigned int cedar::aux::Recorder::getNumberOfLateRecords(const std::string& name) const
+{
+  auto it = mDataSpectators.find(name);
+  if (it == mDataSpectators.end())
+  {
+    CEDAR_THROW(cedar::aux::NotFoundException, "No data of name \"" + name + "\" registered.");
+  }
+  return it->second->getNumberOfLateRecords();
+}
+
 cedar::unit::Time cedar::aux::Recorder::getRecordIntervalTime(cedar::aux::ConstDataPtr data) const
 {
   for (auto data_spectator : mDataSpectators)
@@ -121,6 +121,16 @@ public:
   //!@brief Gets the OutputDirectory
   const std::string& getOutputDirectory() const;
 
+  /*!@brief Sets the directory recordings and snapshots of this process are written to.
+   *
+   *        This overrides the recorder workspace of the settings without changing them; pass an empty string to use
+   *        the settings again.
+   */
+  void setOutputBaseDirectory(const std::string& directory);
+
+  //!@brief Returns the directory recordings and snapshots of this process are written to.
+  std::string getOutputBaseDirectory() const;
+
   /*!@brief Change the record interval of 'name'
    *          If 'name' is not a registered it will throw an UnknownNameExeption.
    */
@@ -134,6 +144,15 @@ public:
    */
   cedar::unit::Time getRecordIntervalTime(cedar::aux::ConstDataPtr data) const;
 
+  /*!@brief Returns the number of records of 'name' that were dropped in the current or last recording because the
+   *        recorder did not keep up.
+   */
+  unsigned int getNumberOfDroppedRecords(const std::string& name) const;
+
+  /*!@brief Returns the number of records of 'name' that were taken late in the current or last recording.
+   */
+  unsigned int getNumberOfLateRecords(const std::string& name) const;
+
   //!@brief Checks if a DataPtr with a certain name is registered.
   bool isRegistered(const std::string& name) const;
 
@@ -167,6 +186,12 @@ public:
   //! Sets the serialization mode for writing data.
   void setSerializationMode(cedar::aux::SerializationFormat::Id mode);
 
+  //! Returns what happens with new records when the recorder does not keep up with writing them.
+  cedar::aux::RecorderBackPressurePolicy::Id getBackPressurePolicy() const;
+
+  //! Sets what happens with new records when the recorder does not keep up with writing them.
+  void setBackPressurePolicy(cedar::aux::RecorderBackPressurePolicy::Id policy);
+
 signals:
   //! Emitted whenver data is added or removed.
   void recordedDataChanged();
@@ -215,6 +240,9 @@ private:
   //!@brief The output directory.
   std::string mOutputDirectory;
 
+  //!@brief Directory that replaces the recorder workspace of the settings; empty if the settings are used.
+  std::string mOutputBaseDirectory;
+
   //!@brief The name of the project that will be recorded
   std::string mProjectName;
 
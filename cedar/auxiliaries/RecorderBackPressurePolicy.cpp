@@ -0,0 +1,84 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        RecorderBackPressurePolicy.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Enum class for what the recorder does when its buffers are full.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/auxiliaries/RecorderBackPressurePolicy.h"
+
+// CEDAR INCLUDES
+
+// SYSTEM INCLUDES
+
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::EnumType<cedar::aux::RecorderBackPressurePolicy>
+  cedar::aux::RecorderBackPressurePolicy::mType("cedar::aux::RecorderBackPressurePolicy::");
+
+#ifndef CEDAR_COMPILER_MSVC
+const cedar::aux::RecorderBackPressurePolicy::Id cedar::aux::RecorderBackPressurePolicy::Drop;
+const cedar::aux::RecorderBackPressurePolicy::Id cedar::aux::RecorderBackPressurePolicy::Block;
+const cedar::aux::RecorderBackPressurePolicy::Id cedar::aux::RecorderBackPressurePolicy::Decimate;
+#endif // CEDAR_COMPILER_MSVC
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::RecorderBackPressurePolicy::construct()
+{
+  mType.type()->def(cedar::aux::Enum(cedar::aux::RecorderBackPressurePolicy::Drop, "Drop", "Drop"));
+  mType.type()->def(cedar::aux::Enum(cedar::aux::RecorderBackPressurePolicy::Block, "Block", "Block"));
+  mType.type()->def(cedar::aux::Enum(cedar::aux::RecorderBackPressurePolicy::Decimate, "Decimate", "Decimate"));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+const cedar::aux::EnumBase& cedar::aux::RecorderBackPressurePolicy::type()
+{
+  return *cedar::aux::RecorderBackPressurePolicy::mType.type();
+}
+
+const cedar::aux::RecorderBackPressurePolicy::TypePtr& cedar::aux::RecorderBackPressurePolicy::typePtr()
+{
+  return cedar::aux::RecorderBackPressurePolicy::mType.type();
+}
@@ -0,0 +1,128 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        RecorderBackPressurePolicy.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Enum class for what the recorder does when its buffers are full.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_RECORDER_BACK_PRESSURE_POLICY_H
+#define CEDAR_AUX_RECORDER_BACK_PRESSURE_POLICY_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/EnumType.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/RecorderBackPressurePolicy.fwd.h"
+
+// SYSTEM INCLUDES
+
+
+/*!@brief Enum class for what a cedar::aux::DataSpectator does when the recorder does not write the records to disk as
+ *        fast as they are recorded, i.e., when the spectator's record buffer runs full.
+ */
+class cedar::aux::RecorderBackPressurePolicy
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Type of the enum.
+  typedef cedar::aux::EnumId Id;
+public:
+  //! Pointer to the enumeration type.
+  typedef boost::shared_ptr<cedar::aux::EnumBase> TypePtr;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Constructs the enumeration values.
+  static void construct();
+
+  //! Returns the enum base class.
+  static const cedar::aux::EnumBase& type();
+
+  //! Returns a pointer to the enum base class.
+  static const cedar::aux::RecorderBackPressurePolicy::TypePtr& typePtr();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Records that do not fit into the buffer are dropped.
+  static const Id Drop = 0;
+
+  //! The recording thread waits for a free slot for at most one record interval, then drops the record.
+  static const Id Block = 1;
+
+  //! Every second record is dropped while the buffer is more than half full; records are dropped when it is full.
+  static const Id Decimate = 2;
+
+protected:
+  // none yet
+private:
+  static cedar::aux::EnumType<cedar::aux::RecorderBackPressurePolicy> mType;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // parameters
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  // none yet
+
+}; // class cedar::aux::RecorderBackPressurePolicy
+
+#endif // CEDAR_AUX_RECORDER_BACK_PRESSURE_POLICY_H
+
@@ -0,0 +1,164 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        RingBuffer.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Lock-free single-producer/single-consumer ring of preallocated slots.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_RING_BUFFER_H
+#define CEDAR_AUX_RING_BUFFER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/RingBuffer.fwd.h"
+
+// SYSTEM INCLUDES
+#include <atomic>
+#include <vector>
+
+
+/*!@brief A lock-free ring of preallocated slots for handing data from one producer thread to one consumer thread.
+ *
+ *        The slots are allocated once (see reset()) and reused afterwards, so objects that keep their memory when they
+ *        are overwritten (e.g., cv::Mat with copyTo) can be passed through the ring without any allocation.
+ *
+ *        The producer fills the slot returned by beginWrite() and publishes it with commitWrite(); the consumer
+ *        processes the slot returned by beginRead() and releases it with commitRead(). At any time, there may be at
+ *        most one producer and one consumer thread.
+ */
+template <typename T>
+class cedar::aux::RingBuffer
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief Constructs a ring with the given number of slots.
+  RingBuffer(size_t capacity = 0)
+  :
+  mSlots(capacity),
+  mReadIndex(0),
+  mWriteIndex(0)
+  {
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Empties the ring and changes its number of slots.
+   *
+   * @remarks Not thread-safe; neither the producer nor the consumer may use the ring during this call.
+   */
+  void reset(size_t capacity)
+  {
+    this->mSlots.resize(capacity);
+    this->mReadIndex.store(0);
+    this->mWriteIndex.store(0);
+  }
+
+  //!@brief Returns the number of slots.
+  size_t capacity() const
+  {
+    return this->mSlots.size();
+  }
+
+  //!@brief Returns the number of filled slots. Only a snapshot if the other thread is active.
+  size_t size() const
+  {
+    return this->mWriteIndex.load(std::memory_order_acquire) - this->mReadIndex.load(std::memory_order_acquire);
+  }
+
+  //!@brief Returns all slots, e.g., for preallocating their contents. Must not be used while the ring is in use.
+  std::vector<T>& slots()
+  {
+    return this->mSlots;
+  }
+
+  //!@brief Producer: returns the next free slot, or a null pointer if the ring is full.
+  T* beginWrite()
+  {
+    size_t write_index = this->mWriteIndex.load(std::memory_order_relaxed);
+    if (this->mSlots.empty() || write_index - this->mReadIndex.load(std::memory_order_acquire) >= this->mSlots.size())
+    {
+      return nullptr;
+    }
+    return &this->mSlots[write_index % this->mSlots.size()];
+  }
+
+  //!@brief Producer: publishes the slot returned by the last call to beginWrite().
+  void commitWrite()
+  {
+    this->mWriteIndex.store(this->mWriteIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  //!@brief Consumer: returns the oldest filled slot, or a null pointer if the ring is empty.
+  T* beginRead()
+  {
+    size_t read_index = this->mReadIndex.load(std::memory_order_relaxed);
+    if (read_index == this->mWriteIndex.load(std::memory_order_acquire))
+    {
+      return nullptr;
+    }
+    return &this->mSlots[read_index % this->mSlots.size()];
+  }
+
+  //!@brief Consumer: releases the slot returned by the last call to beginRead().
+  void commitRead()
+  {
+    this->mReadIndex.store(this->mReadIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! The preallocated slots.
+  std::vector<T> mSlots;
+
+  //! Number of slots read so far; only changed by the consumer.
+  std::atomic<size_t> mReadIndex;
+
+  //! Keeps the two indices in separate cache lines so producer and consumer do not slow each other down.
+  char mPadding[64];
+
+  //! Number of slots written so far; only changed by the producer.
+  std::atomic<size_t> mWriteIndex;
+
+}; // class cedar::aux::RingBuffer
+
+#endif // CEDAR_AUX_RING_BUFFER_H
+
@@ -104,6 +104,9 @@ public:
   //! Write data in a compact (binary) format.
   static const Id Compact = 1;
 
+  //! Write recordings in the binary chunked format of cedar::aux::BinaryRecordingWriter (matrix data only).
+  static const Id Binary = 2;
+
 protected:
   // none yet
 private:
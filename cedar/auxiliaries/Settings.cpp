@@ -36,6 +36,7 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/convolution/FFTWPlanningStrategy.h"
+#include "cedar/auxiliaries/ThreadPool.h"
 #include "cedar/auxiliaries/Settings.h"
 #include "cedar/auxiliaries/SetParameter.h"
 #include "cedar/auxiliaries/FileParameter.h"
@@ -72,6 +73,8 @@ cedar::aux::Configurable(),
 mGlobalTimeFactor(1.0),
 _mMemoryDebugOutput(new cedar::aux::BoolParameter(this, "memory debug output", false)),
 _mRecorderSerializationFormat(new cedar::aux::EnumParameter(this, "recorder data format", cedar::aux::SerializationFormat::typePtr(), cedar::aux::SerializationFormat::CSV)),
+_mRecorderBackPressurePolicy(new cedar::aux::EnumParameter(this, "recorder back-pressure policy", cedar::aux::RecorderBackPressurePolicy::typePtr(), cedar::aux::RecorderBackPressurePolicy::Drop)),
+_mRecorderBufferSize(new cedar::aux::UIntParameter(this, "recorder buffer size", 64, 1, 65536)),
 _mYarpConfigInfo(new cedar::aux::StringParameter(this,"yarp config info","134.147.176.97 10000"))
 {
   _mRecorderWorkspace = new cedar::aux::DirectoryParameter
@@ -113,6 +116,27 @@ _mYarpConfigInfo(new cedar::aux::StringParameter(this,"yarp config info","134.14
                                 (std::vector<std::string>())
                               );
 
+  this->_mNumberOfTriggerThreads = new cedar::aux::UIntParameter
+                                   (
+                                     this,
+                                     "number of trigger threads",
+                                     0
+                                   );
+
+  this->_mParallelTriggerStepping = new cedar::aux::BoolParameter
+                                    (
+                                      this,
+                                      "parallel trigger stepping",
+                                      false
+                                    );
+
+  this->_mDoubleBufferedOutputs = new cedar::aux::BoolParameter
+                                  (
+                                    this,
+                                    "double-buffered outputs",
+                                    false
+                                  );
+
 #ifdef CEDAR_USE_FFTW
   this->_mFFTWNumberOfThreads = new cedar::aux::UIntParameter
                                 (
@@ -143,6 +167,9 @@ _mYarpConfigInfo(new cedar::aux::StringParameter(this,"yarp config info","134.14
     );
   }
 
+  // connected only after loading; the initial value is applied by the first user of the thread pool
+  QObject::connect(this->_mNumberOfTriggerThreads.get(), SIGNAL(valueChanged()), this, SLOT(updateTriggerThreads()));
+
   this->_mYarpConfigInfo->setConstant(true);
 #ifdef CEDAR_USE_YARP
 #if (YARP_VERSION_MAJOR > 2)
@@ -234,6 +261,32 @@ cedar::aux::EnumParameterPtr cedar::aux::Settings::getRecorderSerializationForma
   return this->_mRecorderSerializationFormat;
 }
 
+cedar::aux::RecorderBackPressurePolicy::Id cedar::aux::Settings::getRecorderBackPressurePolicy() const
+{
+  QReadLocker l(this->_mRecorderBackPressurePolicy->getLock());
+  auto copy = this->_mRecorderBackPressurePolicy->getValue();
+  l.unlock();
+  return copy;
+}
+
+void cedar::aux::Settings::setRecorderBackPressurePolicy(cedar::aux::RecorderBackPressurePolicy::Id policy)
+{
+  this->_mRecorderBackPressurePolicy->setValue(policy, true);
+}
+
+unsigned int cedar::aux::Settings::getRecorderBufferSize() const
+{
+  QReadLocker l(this->_mRecorderBufferSize->getLock());
+  auto copy = this->_mRecorderBufferSize->getValue();
+  l.unlock();
+  return copy;
+}
+
+void cedar::aux::Settings::setRecorderBufferSize(unsigned int size)
+{
+  this->_mRecorderBufferSize->setValue(size, true);
+}
+
 void cedar::aux::Settings::setGlobalTimeFactor(double factor)
 {
   QWriteLocker locker(this->mGlobalTimeFactor.getLockPtr());
@@ -523,6 +576,41 @@ void cedar::aux::Settings::setCurrentArchitectureFileName(std::string newFileNam
   emit currentArchitectureFileChanged();
 }
 
+unsigned int cedar::aux::Settings::getNumberOfTriggerThreads() const
+{
+  return this->_mNumberOfTriggerThreads->getValue();
+}
+
+void cedar::aux::Settings::setNumberOfTriggerThreads(unsigned int threads)
+{
+  this->_mNumberOfTriggerThreads->setValue(threads, true);
+}
+
+bool cedar::aux::Settings::getParallelTriggerStepping() const
+{
+  return this->_mParallelTriggerStepping->getValue();
+}
+
+void cedar::aux::Settings::setParallelTriggerStepping(bool parallel)
+{
+  this->_mParallelTriggerStepping->setValue(parallel, true);
+}
+
+bool cedar::aux::Settings::getDoubleBufferedOutputs() const
+{
+  return this->_mDoubleBufferedOutputs->getValue();
+}
+
+void cedar::aux::Settings::setDoubleBufferedOutputs(bool doubleBuffered)
+{
+  this->_mDoubleBufferedOutputs->setValue(doubleBuffered, true);
+}
+
+void cedar::aux::Settings::updateTriggerThreads()
+{
+  cedar::aux::ThreadPoolSingleton::getInstance()->setNumberOfThreads(this->getNumberOfTriggerThreads());
+}
+
 #ifdef CEDAR_USE_FFTW
 unsigned int cedar::aux::Settings::getFFTWNumberOfThreads() const
 {
@@ -49,6 +49,7 @@
 #include "cedar/auxiliaries/boostSignalsHelper.h"
 #include "cedar/auxiliaries/LockableMember.h"
 #include "cedar/auxiliaries/SerializationFormat.h"
+#include "cedar/auxiliaries/RecorderBackPressurePolicy.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/Settings.fwd.h"
@@ -134,6 +135,30 @@ public:
   //! Returns the planning strategy that should be used for FFTW
   std::string getFFTWPlanningStrategyString() const;
 
+  /*! Returns the number of worker threads used to process the triggerables of one trigger level in parallel. Zero
+   *  means that all triggerables are processed one after another on the triggering thread.
+   */
+  unsigned int getNumberOfTriggerThreads() const;
+
+  //! Sets the number of worker threads that step independent triggerables of a trigger concurrently.
+  void setNumberOfTriggerThreads(unsigned int threads);
+
+  /*! Returns true if the looped triggers of an architecture are stepped concurrently on the trigger threads when they
+   *  are stepped by the trigger stepper or by single steps (e.g., in batch mode).
+   */
+  bool getParallelTriggerStepping() const;
+
+  //! Sets whether the looped triggers are stepped concurrently.
+  void setParallelTriggerStepping(bool parallel);
+
+  /*! Returns true if matrix outputs of processing steps are double-buffered, i.e., plots and the recorder read a
+   *  published copy of them without locking (see cedar::aux::MatData::setDoubleBuffered).
+   */
+  bool getDoubleBufferedOutputs() const;
+
+  //! Sets whether matrix outputs declared from now on are double-buffered.
+  void setDoubleBufferedOutputs(bool doubleBuffered);
+
   //! Adds a plugin search path.
   void addPluginSearchPath(const std::string& path);
 
@@ -220,6 +245,18 @@ public:
 
   cedar::aux::EnumParameterPtr getRecorderSerializationFormatParameter() const;
 
+  //! Returns what the recorder does when it cannot write the records to disk as fast as they are recorded.
+  cedar::aux::RecorderBackPressurePolicy::Id getRecorderBackPressurePolicy() const;
+
+  //! Sets what the recorder does when it cannot write the records to disk as fast as they are recorded.
+  void setRecorderBackPressurePolicy(cedar::aux::RecorderBackPressurePolicy::Id policy);
+
+  //! Returns the number of records each recorded data can buffer before the back-pressure policy applies.
+  unsigned int getRecorderBufferSize() const;
+
+  //! Sets the number of records each recorded data can buffer before the back-pressure policy applies.
+  void setRecorderBufferSize(unsigned int size);
+
   void setCurrentArchitectureFileName(std::string newFileName);
 
   std::string getCurrentArchitectureFileName();
@@ -229,6 +266,10 @@ public:
 signals:
   void currentArchitectureFileChanged();
 
+private slots:
+  //! Applies a changed number of trigger threads to the thread pool.
+  void updateTriggerThreads();
+
 public:
   CEDAR_DECLARE_SIGNAL(GlobalTimeFactorChanged, void(double));
 
@@ -297,9 +338,24 @@ protected:
   //! Planning strategy of FFTW.
   cedar::aux::EnumParameterPtr _mFFTWPlanningStrategy;
 
+  //! Number of worker threads for parallel triggering.
+  cedar::aux::UIntParameterPtr _mNumberOfTriggerThreads;
+
+  //! Whether looped triggers are stepped concurrently.
+  cedar::aux::BoolParameterPtr _mParallelTriggerStepping;
+
+  //! Whether matrix outputs of steps are double-buffered.
+  cedar::aux::BoolParameterPtr _mDoubleBufferedOutputs;
+
   //! Format of data written out by the recorder
   cedar::aux::EnumParameterPtr _mRecorderSerializationFormat;
 
+  //! What the recorder does when its record buffers are full
+  cedar::aux::EnumParameterPtr _mRecorderBackPressurePolicy;
+
+  //! Number of records buffered per recorded data
+  cedar::aux::UIntParameterPtr _mRecorderBufferSize;
+
   cedar::aux::StringParameterPtr _mYarpConfigInfo;
 
 private:
@@ -0,0 +1,553 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        SharedMemoryMatChannel.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Transports matrices between processes through a POSIX shared memory segment.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/SharedMemoryMatChannel.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/assert.h"
+#include "cedar/auxiliaries/opencv_helper.h"
+
+// SYSTEM INCLUDES
+#ifdef CEDAR_OS_UNIX
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif // CEDAR_OS_UNIX
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef CEDAR_COMPILER_MSVC
+const uint32_t cedar::aux::SharedMemoryMatChannel::MAGIC;
+const uint16_t cedar::aux::SharedMemoryMatChannel::VERSION;
+const unsigned int cedar::aux::SharedMemoryMatChannel::MAX_DIMENSIONALITY;
+const unsigned int cedar::aux::SharedMemoryMatChannel::DEFAULT_NUMBER_OF_SLOTS;
+#endif // CEDAR_COMPILER_MSVC
+
+namespace
+{
+  // the atomics below are shared between processes, which only works if they do not fall back to a hidden lock
+  static_assert(ATOMIC_INT_LOCK_FREE == 2, "shared memory channels need lock-free 32 bit atomics");
+  static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory channels need lock-free 64 bit atomics");
+
+  //! Header at the start of each segment.
+  struct SegmentHeader
+  {
+    //! MAGIC once the segment is initialized; written last by the writer.
+    std::atomic<uint32_t> mMagic;
+    //! Version of the segment layout.
+    uint16_t mVersion;
+    //! Number of slots in the ring.
+    uint16_t mNumberOfSlots;
+    //! Number of bytes each slot can hold.
+    uint64_t mSlotCapacity;
+    //! Number of frames the writer has published; the latest one is in slot (mPublishedFrames - 1) % mNumberOfSlots.
+    std::atomic<uint64_t> mPublishedFrames;
+    //! Non-zero once the writer has replaced or removed the segment.
+    std::atomic<uint32_t> mStale;
+    //! Padding, always zero.
+    uint32_t mReserved;
+  };
+
+  //! Header at the start of each slot, followed by the matrix data.
+  struct SlotHeader
+  {
+    //! Sequence lock; odd while the writer changes the slot.
+    std::atomic<uint64_t> mSequence;
+    //! OpenCV type of the matrix.
+    int32_t mType;
+    //! Number of dimensions of the matrix; zero for empty matrices.
+    uint32_t mDimensionality;
+    //! Sizes of the matrix along each dimension.
+    int32_t mSizes[cedar::aux::SharedMemoryMatChannel::MAX_DIMENSIONALITY];
+    //! Size of the matrix data in bytes.
+    uint64_t mRawSize;
+  };
+
+  //! Alignment of the slots within the segment in bytes.
+  const uint64_t slot_alignment = 64;
+
+  //! Smallest capacity of a slot in bytes.
+  const uint64_t minimum_slot_capacity = 4096;
+
+  //! How often a reader tries to get a consistent copy before it gives up for this call.
+  const unsigned int max_read_attempts = 16;
+
+  uint64_t align(uint64_t size, uint64_t alignment)
+  {
+    return (size + alignment - 1) / alignment * alignment;
+  }
+
+  uint64_t slotStride(uint64_t capacity)
+  {
+    return align(sizeof(SlotHeader), slot_alignment) + capacity;
+  }
+
+  size_t segmentSize(unsigned int numberOfSlots, uint64_t capacity)
+  {
+    return static_cast<size_t>(align(sizeof(SegmentHeader), slot_alignment) + numberOfSlots * slotStride(capacity));
+  }
+
+  SegmentHeader* segmentHeader(char* mapping)
+  {
+    return reinterpret_cast<SegmentHeader*>(mapping);
+  }
+
+#ifdef CEDAR_OS_UNIX
+  //! Marks the segment that currently has the given name as stale, e.g., one that was left over by a crashed writer.
+  void markStale(const std::string& segmentName)
+  {
+    int file = shm_open(segmentName.c_str(), O_RDWR, 0);
+    if (file < 0)
+    {
+      return;
+    }
+
+    struct stat file_status;
+    if (fstat(file, &file_status) == 0 && static_cast<size_t>(file_status.st_size) >= sizeof(SegmentHeader))
+    {
+      void* mapping = mmap(nullptr, sizeof(SegmentHeader), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+      if (mapping != MAP_FAILED)
+      {
+        segmentHeader(static_cast<char*>(mapping))->mStale.store(1, std::memory_order_release);
+        munmap(mapping, sizeof(SegmentHeader));
+      }
+    }
+    ::close(file);
+  }
+#endif // CEDAR_OS_UNIX
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::SharedMemoryMatChannel::SharedMemoryMatChannel
+(
+  const std::string& port,
+  Role role,
+  unsigned int numberOfSlots
+)
+:
+mSegmentName(getSegmentName(port)),
+mRole(role),
+mNumberOfSlots(numberOfSlots),
+mpMapping(nullptr),
+mMappingSize(0),
+mSlotCapacity(0),
+mSlotStride(0),
+mLastReadFrame(0),
+mLastReadStatus(READ_NOTHING_PUBLISHED),
+mSegmentId(0)
+{
+  if (!isAvailable())
+  {
+    CEDAR_THROW(cedar::aux::NotImplementedException, "Shared memory channels are not available on this system.");
+  }
+  CEDAR_ASSERT(numberOfSlots > 0 && numberOfSlots <= 0xFFFF);
+}
+
+cedar::aux::SharedMemoryMatChannel::~SharedMemoryMatChannel()
+{
+#ifdef CEDAR_OS_UNIX
+  if (this->mRole == ROLE_WRITER && this->mpMapping != nullptr)
+  {
+    segmentHeader(this->mpMapping)->mStale.store(1, std::memory_order_release);
+
+    // only remove the name if it still refers to this writer's segment
+    int file = shm_open(this->mSegmentName.c_str(), O_RDONLY, 0);
+    if (file >= 0)
+    {
+      struct stat file_status;
+      bool own_segment = fstat(file, &file_status) == 0
+                         && static_cast<uint64_t>(file_status.st_ino) == this->mSegmentId;
+      ::close(file);
+      if (own_segment)
+      {
+        shm_unlink(this->mSegmentName.c_str());
+      }
+    }
+  }
+#endif // CEDAR_OS_UNIX
+  this->unmapSegment();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+std::string cedar::aux::SharedMemoryMatChannel::getSegmentName(const std::string& port)
+{
+  std::string name = port;
+  std::replace(name.begin(), name.end(), '/', '_');
+  return "/cedar.local." + name;
+}
+
+bool cedar::aux::SharedMemoryMatChannel::isAvailable()
+{
+#ifdef CEDAR_OS_UNIX
+  return true;
+#else
+  return false;
+#endif // CEDAR_OS_UNIX
+}
+
+char* cedar::aux::SharedMemoryMatChannel::getSlot(uint64_t index) const
+{
+  uint64_t offset = align(sizeof(SegmentHeader), slot_alignment) + (index % this->mNumberOfSlots) * this->mSlotStride;
+  return this->mpMapping + offset;
+}
+
+void cedar::aux::SharedMemoryMatChannel::unmapSegment()
+{
+#ifdef CEDAR_OS_UNIX
+  if (this->mpMapping != nullptr)
+  {
+    munmap(this->mpMapping, this->mMappingSize);
+  }
+#endif // CEDAR_OS_UNIX
+  this->mpMapping = nullptr;
+  this->mMappingSize = 0;
+}
+
+void cedar::aux::SharedMemoryMatChannel::createSegment(size_t minimumCapacity)
+{
+  CEDAR_DEBUG_ASSERT(this->mRole == ROLE_WRITER);
+
+#ifdef CEDAR_OS_UNIX
+  // grow by at least a factor of two so that slowly growing matrices do not cause a new segment every step
+  uint64_t capacity = std::max<uint64_t>(2 * this->mSlotCapacity, minimum_slot_capacity);
+  capacity = std::max<uint64_t>(capacity, minimumCapacity);
+  capacity = align(capacity, slot_alignment);
+  size_t size = segmentSize(this->mNumberOfSlots, capacity);
+
+  // readers that are attached to someone else's segment have to be told right away; readers of this writer's own
+  // segment keep reading from it until the new one is ready
+  if (this->mpMapping == nullptr)
+  {
+    markStale(this->mSegmentName);
+  }
+
+  // the old segment stays valid for readers that still have it mapped, so the name can be reused right away
+  shm_unlink(this->mSegmentName.c_str());
+  int file = shm_open(this->mSegmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (file < 0)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::InitializationException,
+      "Could not create the shared memory segment \"" + this->mSegmentName + "\"."
+    );
+  }
+
+  struct stat file_status;
+  void* mapping = MAP_FAILED;
+  if (ftruncate(file, static_cast<off_t>(size)) == 0 && fstat(file, &file_status) == 0)
+  {
+    mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+  }
+  // the mapping stays valid after the file is closed
+  ::close(file);
+
+  if (mapping == MAP_FAILED)
+  {
+    shm_unlink(this->mSegmentName.c_str());
+    CEDAR_THROW
+    (
+      cedar::aux::InitializationException,
+      "Could not map the shared memory segment \"" + this->mSegmentName + "\" of "
+        + cedar::aux::toString(size) + " bytes."
+    );
+  }
+
+  // the segment is filled with zeros, so all sequence numbers start out even and nothing is published
+  char* new_mapping = static_cast<char*>(mapping);
+  SegmentHeader* header = segmentHeader(new_mapping);
+  header->mVersion = VERSION;
+  header->mNumberOfSlots = static_cast<uint16_t>(this->mNumberOfSlots);
+  header->mSlotCapacity = capacity;
+  header->mMagic.store(MAGIC, std::memory_order_release);
+
+  // only now may readers of the old segment switch over
+  if (this->mpMapping != nullptr)
+  {
+    segmentHeader(this->mpMapping)->mStale.store(1, std::memory_order_release);
+  }
+  this->unmapSegment();
+
+  this->mpMapping = new_mapping;
+  this->mMappingSize = size;
+  this->mSlotCapacity = capacity;
+  this->mSlotStride = slotStride(capacity);
+  this->mSegmentId = static_cast<uint64_t>(file_status.st_ino);
+#else
+  CEDAR_THROW(cedar::aux::NotImplementedException, "Shared memory channels are not available on this system.");
+#endif // CEDAR_OS_UNIX
+}
+
+bool cedar::aux::SharedMemoryMatChannel::openSegment()
+{
+  CEDAR_DEBUG_ASSERT(this->mRole == ROLE_READER);
+  this->unmapSegment();
+  this->mLastReadFrame = 0;
+
+#ifdef CEDAR_OS_UNIX
+  int file = shm_open(this->mSegmentName.c_str(), O_RDONLY, 0);
+  if (file < 0)
+  {
+    return false;
+  }
+
+  struct stat file_status;
+  if (fstat(file, &file_status) != 0 || static_cast<size_t>(file_status.st_size) < sizeof(SegmentHeader))
+  {
+    // either broken or the writer has not sized it yet
+    ::close(file);
+    return false;
+  }
+
+  size_t size = static_cast<size_t>(file_status.st_size);
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+  ::close(file);
+  if (mapping == MAP_FAILED)
+  {
+    return false;
+  }
+
+  this->mpMapping = static_cast<char*>(mapping);
+  this->mMappingSize = size;
+
+  SegmentHeader* header = segmentHeader(this->mpMapping);
+  if
+  (
+    header->mMagic.load(std::memory_order_acquire) != MAGIC
+    || header->mVersion != VERSION
+    || header->mNumberOfSlots == 0
+    || segmentSize(header->mNumberOfSlots, header->mSlotCapacity) > size
+  )
+  {
+    this->unmapSegment();
+    return false;
+  }
+
+  this->mNumberOfSlots = header->mNumberOfSlots;
+  this->mSlotCapacity = header->mSlotCapacity;
+  this->mSlotStride = slotStride(this->mSlotCapacity);
+  return true;
+#else
+  return false;
+#endif // CEDAR_OS_UNIX
+}
+
+void cedar::aux::SharedMemoryMatChannel::write(const cv::Mat& matrix)
+{
+  CEDAR_ASSERT(this->mRole == ROLE_WRITER);
+
+  if (matrix.dims > static_cast<int>(MAX_DIMENSIONALITY))
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::RangeException,
+      "Cannot send matrices with more than " + cedar::aux::toString(MAX_DIMENSIONALITY) + " dimensions."
+    );
+  }
+
+  size_t raw_size = matrix.total() * matrix.elemSize();
+  if (this->mpMapping == nullptr || raw_size > this->mSlotCapacity)
+  {
+    this->createSegment(raw_size);
+  }
+
+  SegmentHeader* header = segmentHeader(this->mpMapping);
+  uint64_t frame = header->mPublishedFrames.load(std::memory_order_relaxed);
+  SlotHeader* slot = reinterpret_cast<SlotHeader*>(this->getSlot(frame));
+  char* data = reinterpret_cast<char*>(slot) + align(sizeof(SlotHeader), slot_alignment);
+
+  // readers only pick the newest slot, so they only collide with this write if they fell behind by a whole ring
+  uint64_t sequence = slot->mSequence.load(std::memory_order_relaxed);
+  slot->mSequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot->mType = matrix.type();
+  slot->mDimensionality = matrix.empty() ? 0 : static_cast<uint32_t>(matrix.dims);
+  for (unsigned int d = 0; d < MAX_DIMENSIONALITY; ++d)
+  {
+    slot->mSizes[d] = (d < slot->mDimensionality) ? matrix.size[d] : 0;
+  }
+  slot->mRawSize = raw_size;
+
+  if (!matrix.empty())
+  {
+    if (matrix.isContinuous())
+    {
+      std::memcpy(data, matrix.data, raw_size);
+    }
+    else
+    {
+      // a header over the slot's memory, so copyTo does not reallocate
+      cv::Mat target(matrix.dims, matrix.size.p, matrix.type(), data);
+      matrix.copyTo(target);
+    }
+  }
+
+  slot->mSequence.store(sequence + 2, std::memory_order_release);
+  header->mPublishedFrames.store(frame + 1, std::memory_order_release);
+}
+
+bool cedar::aux::SharedMemoryMatChannel::read(cv::Mat& matrix)
+{
+  CEDAR_ASSERT(this->mRole == ROLE_READER);
+
+  if (this->mpMapping == nullptr || segmentHeader(this->mpMapping)->mStale.load(std::memory_order_acquire) != 0)
+  {
+    if (!this->openSegment())
+    {
+      this->mLastReadStatus = READ_NOTHING_PUBLISHED;
+      return false;
+    }
+  }
+
+  SegmentHeader* header = segmentHeader(this->mpMapping);
+  for (unsigned int attempt = 0; attempt < max_read_attempts; ++attempt)
+  {
+    uint64_t published = header->mPublishedFrames.load(std::memory_order_acquire);
+    if (published == 0)
+    {
+      this->mLastReadStatus = READ_NOTHING_PUBLISHED;
+      return false;
+    }
+    if (published == this->mLastReadFrame)
+    {
+      this->mLastReadStatus = READ_OK;
+      return true;
+    }
+
+    const SlotHeader* slot = reinterpret_cast<const SlotHeader*>(this->getSlot(published - 1));
+    const char* data = reinterpret_cast<const char*>(slot) + align(sizeof(SlotHeader), slot_alignment);
+
+    uint64_t sequence = slot->mSequence.load(std::memory_order_acquire);
+    if (sequence % 2 != 0)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // copy the description first and only use it once it is known to be consistent
+    int32_t type = slot->mType;
+    uint32_t dimensionality = slot->mDimensionality;
+    int sizes[MAX_DIMENSIONALITY];
+    for (unsigned int d = 0; d < MAX_DIMENSIONALITY; ++d)
+    {
+      sizes[d] = slot->mSizes[d];
+    }
+    uint64_t raw_size = slot->mRawSize;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->mSequence.load(std::memory_order_relaxed) != sequence)
+    {
+      continue;
+    }
+
+    if (dimensionality > MAX_DIMENSIONALITY || raw_size > this->mSlotCapacity)
+    {
+      this->mLastReadStatus = READ_INVALID_FRAME;
+      return false;
+    }
+
+    if (dimensionality == 0)
+    {
+      this->mReadBuffer = cv::Mat();
+    }
+    else
+    {
+      uint64_t elements = 1;
+      for (unsigned int d = 0; d < dimensionality; ++d)
+      {
+        elements *= static_cast<uint64_t>(std::max(sizes[d], 0));
+      }
+      if (elements * CV_ELEM_SIZE(type) != raw_size)
+      {
+        this->mLastReadStatus = READ_INVALID_FRAME;
+        return false;
+      }
+
+      // the buffer is the matrix's previous memory; it is only written to if no one else still refers to it
+      if (cedar::aux::sharesData(this->mReadBuffer))
+      {
+        this->mReadBuffer = cv::Mat();
+      }
+      // create() keeps the existing buffer if type and size already match
+      this->mReadBuffer.create(static_cast<int>(dimensionality), sizes, type);
+      CEDAR_DEBUG_ASSERT(this->mReadBuffer.isContinuous());
+      std::memcpy(this->mReadBuffer.data, data, raw_size);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->mSequence.load(std::memory_order_relaxed) != sequence)
+    {
+      continue;
+    }
+
+    // the frame is complete, so it replaces the matrix without another copy
+    cv::swap(matrix, this->mReadBuffer);
+    this->mLastReadFrame = published;
+    this->mLastReadStatus = READ_OK;
+    return true;
+  }
+
+  // the writer kept overtaking this reader; torn copies only ever end up in the buffer, so the matrix is untouched
+  if (this->mLastReadFrame == 0)
+  {
+    this->mLastReadStatus = READ_OVERTAKEN;
+    return false;
+  }
+  this->mLastReadStatus = READ_OK;
+  return true;
+}
+
+cedar::aux::SharedMemoryMatChannel::ReadStatus cedar::aux::SharedMemoryMatChannel::getLastReadStatus() const
+{
+  return this->mLastReadStatus;
+}
@@ -0,0 +1,222 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        SharedMemoryMatChannel.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Transports matrices between processes through a POSIX shared memory segment.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_SHARED_MEMORY_MAT_CHANNEL_H
+#define CEDAR_AUX_SHARED_MEMORY_MAT_CHANNEL_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/SharedMemoryMatChannel.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#ifndef Q_MOC_RUN
+  #include <boost/noncopyable.hpp>
+#endif // Q_MOC_RUN
+#include <cstdint>
+#include <string>
+
+
+/*!@brief Sends matrices from one writer to any number of readers in other processes via POSIX shared memory.
+ *
+ *        The channel of a port is a shared memory segment that holds a small header and a ring of preallocated slots.
+ *        The writer copies each matrix into the next slot and then publishes it; readers copy the most recently
+ *        published slot into a buffer and swap it into their matrix once the copy is complete. Each slot is protected
+ *        by a sequence lock: the writer makes the slot's sequence number odd while it writes, and a reader that sees
+ *        the number change during its copy simply retries. Neither side ever waits for the other, and there is exactly
+ *        one copy per side.
+ *
+ *        When a matrix no longer fits into the slots, the writer replaces the segment by a larger one and marks the
+ *        old one as stale; readers then switch to the new segment by themselves.
+ *
+ *        The channel is only available on unix systems; on other systems, the constructor throws.
+ */
+class cedar::aux::SharedMemoryMatChannel : public boost::noncopyable
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Which end of the channel an instance is.
+  enum Role
+  {
+    //! Creates the segment and writes into it; there must be at most one writer per port.
+    ROLE_WRITER,
+    //! Reads from a segment created by a writer.
+    ROLE_READER
+  };
+
+  //! The outcome of the last call of read().
+  enum ReadStatus
+  {
+    //! The matrix holds a complete frame; if the writer kept overtaking the reader, this is the last one read before.
+    READ_OK,
+    //! There is no writer for the port, or it has not published anything yet.
+    READ_NOTHING_PUBLISHED,
+    //! The writer overwrote every frame while it was being copied, so no consistent frame could be read.
+    READ_OVERTAKEN,
+    //! The published frame does not describe a valid matrix.
+    READ_INVALID_FRAME
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Opens the channel of the given port.
+   *
+   *        Readers do not need the writer to exist yet; they connect on the first call of read() that finds the
+   *        segment. Writers create the segment when they first write; a segment of the same name that was left over by
+   *        a crashed writer is replaced.
+   *
+   * @throws cedar::aux::NotImplementedException if shared memory is not available on this system.
+   */
+  SharedMemoryMatChannel(const std::string& port, Role role, unsigned int numberOfSlots = DEFAULT_NUMBER_OF_SLOTS);
+
+  //!@brief Destructor; a writer marks its segment as stale and removes it.
+  ~SharedMemoryMatChannel();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Publishes a copy of the matrix to all readers. Only valid for writers.
+   *
+   * @throws cedar::aux::RangeException if the matrix has more than MAX_DIMENSIONALITY dimensions.
+   * @throws cedar::aux::InitializationException if the segment cannot be created.
+   */
+  void write(const cv::Mat& matrix);
+
+  /*!@brief Copies the most recently published matrix into the given one. Only valid for readers.
+   *
+   *        The frame is copied into a buffer of the channel and swapped with the matrix once it is known to be
+   *        complete, so the matrix never holds a partly written frame. The matrix's previous memory becomes the buffer
+   *        for the next frame unless other matrices still share it. If nothing new was published since the last call or
+   *        no consistent frame could be read, the matrix is left as it is.
+   *
+   * @returns True if the matrix holds a complete frame; otherwise, getLastReadStatus() tells why it does not.
+   */
+  bool read(cv::Mat& matrix);
+
+  //! Returns the outcome of the last call of read().
+  ReadStatus getLastReadStatus() const;
+
+  //! Returns the name of the shared memory segment that is used for the given port.
+  static std::string getSegmentName(const std::string& port);
+
+  //! Returns true if shared memory channels are supported on this system.
+  static bool isAvailable();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Replaces the segment of a writer by one whose slots can hold at least the given number of bytes.
+  void createSegment(size_t minimumCapacity);
+
+  //! Maps the segment of the port for reading; returns false if it does not exist or is not initialized yet.
+  bool openSegment();
+
+  //! Unmaps the current segment, if any.
+  void unmapSegment();
+
+  //! Returns the header of the slot with the given index.
+  char* getSlot(uint64_t index) const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Magic number at the start of each segment ("CSM1" when read as bytes on a little-endian machine).
+  static const uint32_t MAGIC = 0x314D5343;
+
+  //! Version of the segment layout.
+  static const uint16_t VERSION = 1;
+
+  //! Maximum number of dimensions of the matrices.
+  static const unsigned int MAX_DIMENSIONALITY = 8;
+
+  //! Number of slots of a segment unless specified otherwise.
+  static const unsigned int DEFAULT_NUMBER_OF_SLOTS = 4;
+
+private:
+  //! Name of the shared memory segment.
+  std::string mSegmentName;
+
+  //! Whether this is the writing or a reading end.
+  Role mRole;
+
+  //! Number of slots in the ring.
+  unsigned int mNumberOfSlots;
+
+  //! Start of the mapped segment, or null if no segment is mapped.
+  char* mpMapping;
+
+  //! Size of the mapped segment in bytes.
+  size_t mMappingSize;
+
+  //! Number of bytes each slot can hold.
+  uint64_t mSlotCapacity;
+
+  //! Distance between two slots in bytes.
+  uint64_t mSlotStride;
+
+  //! Number of published frames at the last successful read.
+  uint64_t mLastReadFrame;
+
+  //! The outcome of the last call of read().
+  ReadStatus mLastReadStatus;
+
+  //! Frames are copied into this buffer first, so that torn copies never reach the reader's matrix.
+  cv::Mat mReadBuffer;
+
+  //! Identifies the segment a writer created, so that it only removes its own segment.
+  uint64_t mSegmentId;
+
+}; // class cedar::aux::SharedMemoryMatChannel
+
+#endif // CEDAR_AUX_SHARED_MEMORY_MAT_CHANNEL_H
+
@@ -0,0 +1,281 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        ThreadPool.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Implementation file for the class cedar::aux::ThreadPool.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/ThreadPool.h"
+#include "cedar/auxiliaries/CallOnScopeExit.h"
+#include "cedar/auxiliaries/assert.h"
+
+// SYSTEM INCLUDES
+#include <QWriteLocker>
+#include <algorithm>
+#include <chrono>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::ThreadPool::ThreadPool(unsigned int numberOfThreads)
+:
+mNumberOfThreads(0),
+mNextQueue(0),
+mQueuedTasks(0),
+mStopRequested(false)
+{
+  this->startWorkers(numberOfThreads);
+}
+
+cedar::aux::ThreadPool::~ThreadPool()
+{
+  QWriteLocker workers_locker(&this->mWorkersLock);
+  this->stopWorkers();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+unsigned int cedar::aux::ThreadPool::getNumberOfThreads() const
+{
+  return this->mNumberOfThreads.load();
+}
+
+void cedar::aux::ThreadPool::setNumberOfThreads(unsigned int numberOfThreads)
+{
+  QWriteLocker workers_locker(&this->mWorkersLock);
+  if (numberOfThreads == this->mWorkers.size())
+  {
+    return;
+  }
+  this->stopWorkers();
+  this->startWorkers(numberOfThreads);
+}
+
+void cedar::aux::ThreadPool::startWorkers(unsigned int numberOfThreads)
+{
+  CEDAR_DEBUG_ASSERT(this->mWorkers.empty());
+  this->mStopRequested = false;
+
+  // there is always at least one queue; without workers, it is drained by the callers of run
+  this->mQueues.clear();
+  for (unsigned int i = 0; i < std::max(1u, numberOfThreads); ++i)
+  {
+    this->mQueues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+  }
+
+  for (unsigned int i = 0; i < numberOfThreads; ++i)
+  {
+    this->mWorkers.push_back(std::thread(&cedar::aux::ThreadPool::work, this, static_cast<size_t>(i)));
+  }
+  this->mNumberOfThreads = numberOfThreads;
+}
+
+void cedar::aux::ThreadPool::stopWorkers()
+{
+  {
+    std::lock_guard<std::mutex> sleep_lock(this->mSleepMutex);
+    this->mStopRequested = true;
+  }
+  this->mWorkAvailable.notify_all();
+
+  for (auto& worker : this->mWorkers)
+  {
+    if (worker.joinable())
+    {
+      worker.join();
+    }
+  }
+  this->mWorkers.clear();
+  this->mNumberOfThreads = 0;
+}
+
+void cedar::aux::ThreadPool::run(const std::vector<Task>& tasks)
+{
+  if (tasks.empty())
+  {
+    return;
+  }
+
+  // if the pool is being resized (or this is a nested call during a resize), don't wait for it
+  bool locked = this->mNumberOfThreads.load() > 0 && tasks.size() > 1 && this->mWorkersLock.tryLockForRead();
+  if (!locked || this->mWorkers.empty())
+  {
+    if (locked)
+    {
+      this->mWorkersLock.unlock();
+    }
+    // nothing to distribute, run everything right here
+    for (const auto& task : tasks)
+    {
+      task();
+    }
+    return;
+  }
+  // the workers cannot be replaced while this batch is in flight
+  cedar::aux::CallOnScopeExit workers_unlocker(boost::bind(&QReadWriteLock::unlock, &this->mWorkersLock));
+
+  Batch batch(tasks.size());
+
+  // announce the tasks before queueing them so that they are never taken before they are counted
+  {
+    std::lock_guard<std::mutex> sleep_lock(this->mSleepMutex);
+    this->mQueuedTasks += tasks.size();
+  }
+
+  // distribute the tasks round-robin, starting at a different queue for every batch to spread the load
+  size_t queue_count = this->mQueues.size();
+  size_t start = this->mNextQueue.fetch_add(1) % queue_count;
+  for (size_t i = 0; i < tasks.size(); ++i)
+  {
+    WorkerQueue& queue = *this->mQueues.at((start + i) % queue_count);
+    std::lock_guard<std::mutex> queue_lock(queue.mMutex);
+    QueuedTask queued;
+    queued.mpTask = &tasks.at(i);
+    queued.mpBatch = &batch;
+    queue.mTasks.push_back(queued);
+  }
+  this->mWorkAvailable.notify_all();
+
+  // help out until the batch is done; this may also execute tasks of other batches
+  QueuedTask task;
+  while (batch.mRemaining.load() > 0)
+  {
+    if (this->fetch(start, task))
+    {
+      this->execute(task);
+    }
+    else
+    {
+      std::unique_lock<std::mutex> sleep_lock(this->mSleepMutex);
+      this->mTaskFinished.wait_for
+      (
+        sleep_lock,
+        std::chrono::microseconds(100),
+        [&] { return batch.mRemaining.load() == 0 || this->mQueuedTasks.load() > 0; }
+      );
+    }
+  }
+
+  if (batch.mException)
+  {
+    std::rethrow_exception(batch.mException);
+  }
+}
+
+bool cedar::aux::ThreadPool::fetch(size_t preferred, QueuedTask& task)
+{
+  size_t queue_count = this->mQueues.size();
+
+  // own queue first (front) ...
+  {
+    WorkerQueue& own = *this->mQueues.at(preferred % queue_count);
+    std::lock_guard<std::mutex> queue_lock(own.mMutex);
+    if (!own.mTasks.empty())
+    {
+      task = own.mTasks.front();
+      own.mTasks.pop_front();
+      --this->mQueuedTasks;
+      return true;
+    }
+  }
+
+  // ... then steal from the back of the others
+  for (size_t offset = 1; offset < queue_count; ++offset)
+  {
+    WorkerQueue& victim = *this->mQueues.at((preferred + offset) % queue_count);
+    std::lock_guard<std::mutex> queue_lock(victim.mMutex);
+    if (!victim.mTasks.empty())
+    {
+      task = victim.mTasks.back();
+      victim.mTasks.pop_back();
+      --this->mQueuedTasks;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void cedar::aux::ThreadPool::execute(const QueuedTask& task)
+{
+  try
+  {
+    (*task.mpTask)();
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> exception_lock(task.mpBatch->mExceptionMutex);
+    if (!task.mpBatch->mException)
+    {
+      task.mpBatch->mException = std::current_exception();
+    }
+  }
+
+  // the batch may be destroyed by its owner as soon as the counter reaches zero, so it must not be touched afterwards
+  if (task.mpBatch->mRemaining.fetch_sub(1) == 1)
+  {
+    std::lock_guard<std::mutex> sleep_lock(this->mSleepMutex);
+    this->mTaskFinished.notify_all();
+  }
+}
+
+void cedar::aux::ThreadPool::work(size_t index)
+{
+  QueuedTask task;
+  while (true)
+  {
+    if (this->fetch(index, task))
+    {
+      this->execute(task);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> sleep_lock(this->mSleepMutex);
+    this->mWorkAvailable.wait
+    (
+      sleep_lock,
+      [this] { return this->mStopRequested.load() || this->mQueuedTasks.load() > 0; }
+    );
+
+    if (this->mStopRequested.load() && this->mQueuedTasks.load() == 0)
+    {
+      return;
+    }
+  }
+}
@@ -0,0 +1,213 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        ThreadPool.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::ThreadPool.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_THREAD_POOL_H
+#define CEDAR_AUX_THREAD_POOL_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Singleton.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/ThreadPool.fwd.h"
+
+// SYSTEM INCLUDES
+#ifndef Q_MOC_RUN
+  #include <boost/function.hpp>
+#endif // Q_MOC_RUN
+#include <QReadWriteLock>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*!@brief A work-stealing pool of worker threads for running batches of independent tasks.
+ *
+ *        Tasks are handed to the pool in batches via run(). The tasks of a batch are distributed over per-worker
+ *        queues; a worker that runs out of work steals from the back of the other queues. run() blocks until every
+ *        task of the batch has finished, i.e., it acts as a barrier. While waiting, the calling thread executes queued
+ *        tasks itself, so nested calls to run() (e.g., a task that triggers another chain) cannot deadlock the pool.
+ *
+ *        With zero worker threads (or while the pool is being resized), run() simply executes all tasks on the calling
+ *        thread in the given order.
+ *
+ *        Exceptions thrown by a task are caught; after the whole batch has finished, the first one is rethrown by
+ *        run().
+ */
+class cedar::aux::ThreadPool
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // friends
+  //--------------------------------------------------------------------------------------------------------------------
+  friend class cedar::aux::Singleton<cedar::aux::ThreadPool>;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Type of the tasks run by the pool.
+  typedef boost::function<void ()> Task;
+
+private:
+  //! Bookkeeping for one call to run().
+  struct Batch
+  {
+    Batch(size_t size)
+    :
+    mRemaining(size)
+    {
+    }
+
+    std::atomic<size_t> mRemaining;
+    std::mutex mExceptionMutex;
+    std::exception_ptr mException;
+  };
+
+  //! A task together with the batch it belongs to.
+  struct QueuedTask
+  {
+    const Task* mpTask;
+    Batch* mpBatch;
+  };
+
+  //! A task queue owned by one worker.
+  struct WorkerQueue
+  {
+    std::mutex mMutex;
+    std::deque<QueuedTask> mTasks;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief Creates a pool with the given number of worker threads.
+  ThreadPool(unsigned int numberOfThreads = 0);
+
+  //!@brief Destructor. Stops and joins all workers.
+  ~ThreadPool();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Runs all tasks and returns once every one of them has finished.
+   *
+   * @remarks The tasks must stay valid until this method returns.
+   */
+  void run(const std::vector<Task>& tasks);
+
+  /*!@brief Changes the number of worker threads.
+   *
+   *        Waits for all batches in flight to finish. Batches started in the meantime are run on their calling thread.
+   *        Must not be called from within a task run by this pool.
+   */
+  void setNumberOfThreads(unsigned int numberOfThreads);
+
+  //! Returns the number of worker threads.
+  unsigned int getNumberOfThreads() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Main loop of worker @em index.
+  void work(size_t index);
+
+  //! Takes a task from the front of queue @em preferred or, failing that, steals one from the back of another queue.
+  bool fetch(size_t preferred, QueuedTask& task);
+
+  //! Executes a task and marks it as done in its batch.
+  void execute(const QueuedTask& task);
+
+  void startWorkers(unsigned int numberOfThreads);
+
+  void stopWorkers();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  /*! Guards (re-)creation of the workers. Batches hold it for reading while they are in flight, setNumberOfThreads
+   *  holds it for writing.
+   */
+  mutable QReadWriteLock mWorkersLock;
+
+  //! Number of worker threads; readable without locking.
+  std::atomic<unsigned int> mNumberOfThreads;
+
+  std::vector<std::thread> mWorkers;
+
+  //! One queue per worker.
+  std::vector<std::unique_ptr<WorkerQueue> > mQueues;
+
+  //! Used to distribute batches round-robin over the queues.
+  std::atomic<size_t> mNextQueue;
+
+  //! Number of tasks that are queued but not yet taken.
+  std::atomic<size_t> mQueuedTasks;
+
+  std::mutex mSleepMutex;
+
+  //! Signals the workers that new tasks are available.
+  std::condition_variable mWorkAvailable;
+
+  //! Signals waiting callers of run() that a task has finished.
+  std::condition_variable mTaskFinished;
+
+  std::atomic<bool> mStopRequested;
+
+}; // class cedar::aux::ThreadPool
+
+CEDAR_AUX_SINGLETON(ThreadPool);
+
+#endif // CEDAR_AUX_THREAD_POOL_H
+
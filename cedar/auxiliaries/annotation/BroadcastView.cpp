@@ -0,0 +1,97 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BroadcastView.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::aux::annotation::BroadcastView.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CLASS HEADER
+#include "cedar/auxiliaries/annotation/BroadcastView.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+
+// SYSTEM INCLUDES
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::annotation::BroadcastView::BroadcastView()
+{
+}
+
+cedar::aux::annotation::BroadcastView::~BroadcastView()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+bool cedar::aux::annotation::BroadcastView::excludeFromCopying() const
+{
+  return true;
+}
+
+void cedar::aux::annotation::BroadcastView::setSource(const cv::Mat& source)
+{
+  // copyTo only reallocates if the size or type of the source changes
+  source.copyTo(this->mSource);
+}
+
+const cv::Mat& cedar::aux::annotation::BroadcastView::getSource() const
+{
+  return this->mSource;
+}
+
+void cedar::aux::annotation::BroadcastView::setMapping(const std::vector<unsigned int>& mapping)
+{
+  this->mMapping = mapping;
+}
+
+const std::vector<unsigned int>& cedar::aux::annotation::BroadcastView::getMapping() const
+{
+  return this->mMapping;
+}
+
+std::string cedar::aux::annotation::BroadcastView::getDescription() const
+{
+  std::string description = "broadcast of a ";
+  description += cedar::aux::toString(cedar::aux::math::getDimensionalityOf(this->mSource));
+  description += "D matrix";
+  return description;
+}
@@ -0,0 +1,130 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        BroadcastView.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::annotation::BroadcastView.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_ANNOTATION_BROADCAST_VIEW_H
+#define CEDAR_AUX_ANNOTATION_BROADCAST_VIEW_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/annotation/Annotation.h"
+#include "cedar/auxiliaries/Cloneable.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/annotation/BroadcastView.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+
+/*!@brief An annotation stating that a matrix is a broadcast of a smaller source matrix.
+ *
+ *        Data carrying this annotation is not filled by its owner; instead, each entry of the (full-size) matrix is
+ *        given by the entry of the source matrix that is reached by dropping all dimensions that the source matrix is
+ *        broadcast along. Dimension i of the source matrix corresponds to dimension getMapping()[i] of the annotated
+ *        matrix. Consumers that know about this annotation can thus work on the source directly without the full
+ *        matrix ever being written.
+ */
+class cedar::aux::annotation::BroadcastView
+:
+public cedar::aux::annotation::Annotation,
+public cedar::aux::Cloneable<cedar::aux::annotation::BroadcastView, cedar::aux::annotation::Annotation>
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  BroadcastView();
+
+  //!@brief Destructor
+  virtual ~BroadcastView();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  std::string getDescription() const;
+
+  //! Broadcasts only describe the data they were set on, so they must not be passed on to other data.
+  bool excludeFromCopying() const;
+
+  //! Copies the given matrix into the source of the broadcast. The source's memory is reused whenever possible.
+  void setSource(const cv::Mat& source);
+
+  //! Returns the matrix that is broadcast.
+  const cv::Mat& getSource() const;
+
+  //! Sets the dimension of the annotated matrix that each dimension of the source corresponds to.
+  void setMapping(const std::vector<unsigned int>& mapping);
+
+  //! Returns the dimension of the annotated matrix that each dimension of the source corresponds to.
+  const std::vector<unsigned int>& getMapping() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! The matrix that is broadcast.
+  cv::Mat mSource;
+
+  //! For each dimension of the source, the dimension of the annotated matrix it corresponds to.
+  std::vector<unsigned int> mMapping;
+
+}; // class cedar::aux::annotation::BroadcastView
+
+#endif // CEDAR_AUX_ANNOTATION_BROADCAST_VIEW_H
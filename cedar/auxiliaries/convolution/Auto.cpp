@@ -0,0 +1,600 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Auto.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::aux::conv::Auto.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+#define CEDAR_INTERNAL
+#include "cedar/internals.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/convolution/Auto.h"
+#include "cedar/auxiliaries/convolution/EngineManager.h"
+#include "cedar/auxiliaries/convolution/OpenCV.h"
+#include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/kernel/Kernel.h"
+#include "cedar/auxiliaries/kernel/Separable.h"
+#include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/FactoryManager.h"
+#include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/Singleton.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/auxiliaries/systemFunctions.h"
+#include "cedar/auxiliaries/Path.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+std::map<std::string, std::string> cedar::aux::conv::Auto::mSelectedEngines;
+QMutex cedar::aux::conv::Auto::mSelectedEnginesLock;
+std::once_flag cedar::aux::conv::Auto::mLoadCacheFlag;
+
+//----------------------------------------------------------------------------------------------------------------------
+// register type with the factory
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  bool registered
+    = cedar::aux::conv::EngineManagerSingleton::getInstance()->registerType<cedar::aux::conv::AutoPtr>();
+
+  //! Number of timed convolutions per candidate; the fastest one counts. An untimed warm-up run precedes them.
+  const unsigned int AUTO_BENCHMARK_REPETITIONS = 3;
+
+  std::string joinSizes(const std::vector<int>& sizes)
+  {
+    std::string joined;
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+      if (i > 0)
+      {
+        joined += "x";
+      }
+      joined += cedar::aux::toString(sizes.at(i));
+    }
+    return joined;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::aux::conv::Auto::Auto()
+{
+  this->mCandidates.push_back(Candidate("OpenCV", cedar::aux::conv::EnginePtr(new cedar::aux::conv::OpenCV())));
+#ifdef CEDAR_USE_FFTW
+  this->mCandidates.push_back(Candidate("FFTW", cedar::aux::conv::EnginePtr(new cedar::aux::conv::FFTW())));
+#endif // CEDAR_USE_FFTW
+}
+
+cedar::aux::conv::Auto::~Auto()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::aux::conv::Auto::setKernelList(cedar::aux::conv::KernelListPtr kernelList)
+{
+  for (const auto& candidate : this->mCandidates)
+  {
+    candidate.second->setKernelList(kernelList);
+  }
+  this->cedar::aux::conv::Engine::setKernelList(kernelList);
+}
+
+cv::Mat cedar::aux::conv::Auto::convolve
+(
+  const cv::Mat& matrix,
+  cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode,
+  bool alternateEvenCenter
+) const
+{
+  cedar::aux::conv::ConstKernelListPtr kernel_list = this->getKernelList();
+  std::vector<std::vector<int> > kernel_sizes;
+  if (kernel_list)
+  {
+    for (size_t i = 0; i < kernel_list->size(); ++i)
+    {
+      kernel_sizes.push_back(cedar::aux::conv::Auto::getSizes(kernel_list->getKernel(i)));
+    }
+  }
+
+  std::string signature
+    = cedar::aux::conv::Auto::makeSignature("list", matrix, kernel_sizes, borderType, mode, alternateEvenCenter);
+
+  size_t matrix_dim = cedar::aux::math::getDimensionalityOf(matrix);
+  Capability capable = [&](const cedar::aux::conv::Engine& engine)
+  {
+    if (kernel_list)
+    {
+      return engine.checkKernelListCapability(matrix_dim, kernel_list, borderType, mode);
+    }
+    return engine.checkCapability(matrix_dim, matrix_dim, borderType, mode);
+  };
+  Call call = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.convolve(matrix, borderType, mode, alternateEvenCenter);
+  };
+  return this->dispatch(signature, capable, call);
+}
+
+cv::Mat cedar::aux::conv::Auto::convolve
+(
+  const cv::Mat& matrix,
+  const cv::Mat& kernel,
+  cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode,
+  const std::vector<int>& anchor,
+  bool alternateEvenCenter
+) const
+{
+  std::vector<std::vector<int> > kernel_sizes(1, cedar::aux::conv::Auto::getSizes(kernel));
+  std::string signature
+    = cedar::aux::conv::Auto::makeSignature("matrix", matrix, kernel_sizes, borderType, mode, alternateEvenCenter);
+
+  Capability capable = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.checkCapability(matrix, kernel, borderType, mode);
+  };
+  Call call = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.convolve(matrix, kernel, borderType, mode, anchor, alternateEvenCenter);
+  };
+  return this->dispatch(signature, capable, call);
+}
+
+cv::Mat cedar::aux::conv::Auto::convolve
+(
+  const cv::Mat& matrix,
+  cedar::aux::kernel::ConstKernelPtr kernel,
+  cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode,
+  bool alternateEvenCenter
+) const
+{
+  std::vector<std::vector<int> > kernel_sizes(1, cedar::aux::conv::Auto::getSizes(kernel));
+  std::string signature
+    = cedar::aux::conv::Auto::makeSignature("kernel", matrix, kernel_sizes, borderType, mode, alternateEvenCenter);
+
+  Capability capable = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.checkKernelCapability(cedar::aux::math::getDimensionalityOf(matrix), kernel, borderType, mode);
+  };
+  Call call = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.convolve(matrix, kernel, borderType, mode, alternateEvenCenter);
+  };
+  return this->dispatch(signature, capable, call);
+}
+
+cv::Mat cedar::aux::conv::Auto::convolveSeparable
+(
+  const cv::Mat& matrix,
+  cedar::aux::kernel::ConstSeparablePtr kernel,
+  cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode,
+  bool alternateEvenCenter
+) const
+{
+  std::vector<std::vector<int> > kernel_sizes(1, cedar::aux::conv::Auto::getSizes(kernel));
+  std::string signature
+    = cedar::aux::conv::Auto::makeSignature("separable", matrix, kernel_sizes, borderType, mode, alternateEvenCenter);
+
+  Capability capable = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.checkKernelCapability(cedar::aux::math::getDimensionalityOf(matrix), kernel, borderType, mode);
+  };
+  Call call = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.convolveSeparable(matrix, kernel, borderType, mode, alternateEvenCenter);
+  };
+  return this->dispatch(signature, capable, call);
+}
+
+cv::Mat cedar::aux::conv::Auto::convolve
+(
+  const cv::Mat& matrix,
+  cedar::aux::conv::ConstKernelListPtr kernelList,
+  cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode,
+  bool alternateEvenCenter
+) const
+{
+  std::vector<std::vector<int> > kernel_sizes;
+  for (size_t i = 0; i < kernelList->size(); ++i)
+  {
+    kernel_sizes.push_back(cedar::aux::conv::Auto::getSizes(kernelList->getKernel(i)));
+  }
+  std::string signature
+    = cedar::aux::conv::Auto::makeSignature("list", matrix, kernel_sizes, borderType, mode, alternateEvenCenter);
+
+  Capability capable = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.checkKernelListCapability
+                  (
+                    cedar::aux::math::getDimensionalityOf(matrix),
+                    kernelList,
+                    borderType,
+                    mode
+                  );
+  };
+  Call call = [&](const cedar::aux::conv::Engine& engine)
+  {
+    return engine.convolve(matrix, kernelList, borderType, mode, alternateEvenCenter);
+  };
+  return this->dispatch(signature, capable, call);
+}
+
+cv::Mat cedar::aux::conv::Auto::dispatch
+(
+  const std::string& signature,
+  const Capability& capable,
+  const Call& call
+) const
+{
+  std::string selected = cedar::aux::conv::Auto::lookUp(signature);
+  if (!selected.empty())
+  {
+    // winners stored by earlier versions may not be capable of the configuration
+    cedar::aux::conv::EnginePtr engine = this->findCandidate(selected);
+    if (engine && capable(*engine))
+    {
+      try
+      {
+        return call(*engine);
+      }
+      catch (const std::exception&)
+      {
+        // the stored winner can no longer handle this configuration (e.g., a kernel stopped being separable)
+        cedar::aux::conv::Auto::forget(signature);
+      }
+    }
+  }
+
+  return this->benchmark(signature, capable, call);
+}
+
+cv::Mat cedar::aux::conv::Auto::benchmark
+(
+  const std::string& signature,
+  const Capability& capable,
+  const Call& call
+) const
+{
+  QMutexLocker locker(&this->mBenchmarkLock);
+
+  std::vector<Candidate> candidates;
+  for (const auto& candidate : this->mCandidates)
+  {
+    if (capable(*candidate.second))
+    {
+      candidates.push_back(candidate);
+    }
+  }
+
+  // an engine that does not claim a configuration may still run without error, but give wrong results (e.g., FFTW
+  // with a border type other than cyclic), so it must never be used
+  if (candidates.empty())
+  {
+    CEDAR_THROW(cedar::aux::UnhandledValueException, "No convolution engine is capable of " + signature + ".");
+  }
+
+  std::string best_engine;
+  cv::Mat best_result;
+  double best_time = std::numeric_limits<double>::max();
+  std::exception_ptr first_error;
+
+  for (const auto& candidate : candidates)
+  {
+    try
+    {
+      // the first call prepares plans and buffers, so it is not timed
+      cv::Mat result = call(*candidate.second);
+
+      double fastest = std::numeric_limits<double>::max();
+      for (unsigned int repetition = 0; repetition < AUTO_BENCHMARK_REPETITIONS; ++repetition)
+      {
+        auto start = std::chrono::steady_clock::now();
+        result = call(*candidate.second);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        fastest = std::min(fastest, elapsed.count());
+      }
+
+      if (fastest < best_time)
+      {
+        best_time = fastest;
+        best_engine = candidate.first;
+        best_result = result;
+      }
+    }
+    catch (const std::exception&)
+    {
+      if (!first_error)
+      {
+        first_error = std::current_exception();
+      }
+    }
+  }
+
+  if (best_engine.empty())
+  {
+    if (first_error)
+    {
+      std::rethrow_exception(first_error);
+    }
+    CEDAR_THROW(cedar::aux::UnhandledValueException, "No convolution engine is available for " + signature + ".");
+  }
+
+  cedar::aux::conv::Auto::store(signature, best_engine);
+  return best_result;
+}
+
+cedar::aux::conv::EnginePtr cedar::aux::conv::Auto::findCandidate(const std::string& name) const
+{
+  for (const auto& candidate : this->mCandidates)
+  {
+    if (candidate.first == name)
+    {
+      return candidate.second;
+    }
+  }
+  return cedar::aux::conv::EnginePtr();
+}
+
+std::string cedar::aux::conv::Auto::getSelectedEngine
+(
+  const cv::Mat& matrix,
+  const cv::Mat& kernel,
+  cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode
+) const
+{
+  std::vector<std::vector<int> > kernel_sizes(1, cedar::aux::conv::Auto::getSizes(kernel));
+  return cedar::aux::conv::Auto::lookUp
+         (
+           cedar::aux::conv::Auto::makeSignature("matrix", matrix, kernel_sizes, borderType, mode, false)
+         );
+}
+
+std::string cedar::aux::conv::Auto::makeSignature
+(
+  const std::string& operation,
+  const cv::Mat& matrix,
+  const std::vector<std::vector<int> >& kernelSizes,
+  cedar::aux::conv::BorderType::Id borderType,
+  cedar::aux::conv::Mode::Id mode,
+  bool alternateEvenCenter
+)
+{
+  std::string kernels;
+  for (size_t i = 0; i < kernelSizes.size(); ++i)
+  {
+    if (i > 0)
+    {
+      kernels += ",";
+    }
+    kernels += joinSizes(kernelSizes.at(i));
+  }
+
+  // signatures are stored in a whitespace-separated file, so they must not contain any whitespace themselves
+  return operation
+         + ";type=" + cedar::aux::toString(matrix.type())
+         + ";matrix=" + joinSizes(cedar::aux::conv::Auto::getSizes(matrix))
+         + ";kernels=" + kernels
+         + ";border=" + cedar::aux::conv::BorderType::type().get(borderType).name()
+         + ";mode=" + cedar::aux::conv::Mode::type().get(mode).name()
+         + ";alternate=" + (alternateEvenCenter ? "1" : "0");
+}
+
+std::vector<int> cedar::aux::conv::Auto::getSizes(const cv::Mat& matrix)
+{
+  std::vector<int> sizes;
+  for (int d = 0; d < matrix.dims; ++d)
+  {
+    sizes.push_back(matrix.size[d]);
+  }
+  return sizes;
+}
+
+std::vector<int> cedar::aux::conv::Auto::getSizes(cedar::aux::kernel::ConstKernelPtr kernel)
+{
+  std::vector<int> sizes;
+  for (unsigned int d = 0; d < kernel->getDimensionality(); ++d)
+  {
+    sizes.push_back(static_cast<int>(kernel->getSize(d)));
+  }
+  return sizes;
+}
+
+std::string cedar::aux::conv::Auto::getCachePath()
+{
+  // the timings depend on the same settings as the fftw wisdom, so the file is named in the same way
+  return cedar::aux::getUserApplicationDataDirectory()
+           + "/.cedar/fftw/autotune."
+           + CEDAR_BUILT_ON_MACHINE + "."
+           + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
+           + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
+           + "cache";
+}
+
+std::string cedar::aux::conv::Auto::lookUp(const std::string& signature)
+{
+  std::call_once(mLoadCacheFlag, cedar::aux::conv::Auto::loadCache);
+
+  QMutexLocker locker(&cedar::aux::conv::Auto::mSelectedEnginesLock);
+  auto entry = cedar::aux::conv::Auto::mSelectedEngines.find(signature);
+  if (entry == cedar::aux::conv::Auto::mSelectedEngines.end())
+  {
+    return std::string();
+  }
+  return entry->second;
+}
+
+void cedar::aux::conv::Auto::store(const std::string& signature, const std::string& engine)
+{
+  QMutexLocker locker(&cedar::aux::conv::Auto::mSelectedEnginesLock);
+  cedar::aux::conv::Auto::mSelectedEngines[signature] = engine;
+  cedar::aux::conv::Auto::saveCache();
+}
+
+void cedar::aux::conv::Auto::forget(const std::string& signature)
+{
+  QMutexLocker locker(&cedar::aux::conv::Auto::mSelectedEnginesLock);
+  cedar::aux::conv::Auto::mSelectedEngines.erase(signature);
+  cedar::aux::conv::Auto::saveCache();
+}
+
+void cedar::aux::conv::Auto::loadCache()
+{
+  QMutexLocker locker(&cedar::aux::conv::Auto::mSelectedEnginesLock);
+  std::ifstream file(cedar::aux::conv::Auto::getCachePath().c_str());
+  std::string line;
+  while (std::getline(file, line))
+  {
+    std::istringstream stream(line);
+    std::string signature, engine;
+    if (stream >> signature >> engine)
+    {
+      cedar::aux::conv::Auto::mSelectedEngines[signature] = engine;
+    }
+  }
+}
+
+void cedar::aux::conv::Auto::saveCache()
+{
+  // expects mSelectedEnginesLock to be held by the caller
+  cedar::aux::Path path = cedar::aux::conv::Auto::getCachePath();
+  path.createDirectories();
+
+  std::ofstream file(path.toString().c_str());
+  for (const auto& entry : cedar::aux::conv::Auto::mSelectedEngines)
+  {
+    file << entry.first << " " << entry.second << std::endl;
+  }
+}
+
+bool cedar::aux::conv::Auto::checkCapability
+     (
+       size_t matrixDim,
+       size_t kernelDim,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  for (const auto& candidate : this->mCandidates)
+  {
+    if (candidate.second->checkCapability(matrixDim, kernelDim, borderType, mode))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool cedar::aux::conv::Auto::checkCapability
+     (
+       cv::Mat matrix,
+       cv::Mat kernel,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  for (const auto& candidate : this->mCandidates)
+  {
+    if (candidate.second->checkCapability(matrix, kernel, borderType, mode))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool cedar::aux::conv::Auto::checkKernelCapability
+     (
+       size_t matrixDim,
+       cedar::aux::kernel::ConstKernelPtr kernel,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  for (const auto& candidate : this->mCandidates)
+  {
+    if (candidate.second->checkKernelCapability(matrixDim, kernel, borderType, mode))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool cedar::aux::conv::Auto::checkBorderTypeCapability
+     (
+       cedar::aux::conv::BorderType::Id borderType
+     ) const
+{
+  for (const auto& candidate : this->mCandidates)
+  {
+    if (candidate.second->checkBorderTypeCapability(borderType))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool cedar::aux::conv::Auto::checkModeCapability
+     (
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  for (const auto& candidate : this->mCandidates)
+  {
+    if (candidate.second->checkModeCapability(mode))
+    {
+      return true;
+    }
+  }
+  return false;
+}
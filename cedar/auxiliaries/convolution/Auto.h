@@ -0,0 +1,275 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Auto.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::aux::conv::Auto.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_AUX_CONV_AUTO_H
+#define CEDAR_AUX_CONV_AUTO_H
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/convolution/Engine.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/auxiliaries/convolution/Auto.fwd.h"
+
+// SYSTEM INCLUDES
+#ifndef Q_MOC_RUN
+  #include <boost/function.hpp>
+#endif // Q_MOC_RUN
+#include <QMutex>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+/*!@brief A convolution engine that dispatches to the fastest of the other engines.
+ *
+ *        The first time a configuration (matrix sizes and type, kernel sizes, border type and mode) is convolved, every
+ *        candidate engine that is capable of it is timed and the fastest one is remembered. Subsequent calls with the
+ *        same configuration are forwarded to the winner directly. The winners are stored in a cache file next to the
+ *        FFTW wisdom, so the benchmark only runs once per machine.
+ *
+ *        Candidates that do not claim to be capable of a configuration are never used; if there are none, an exception
+ *        is thrown.
+ */
+class cedar::aux::conv::Auto : public cedar::aux::conv::Engine
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! A candidate engine, along with the name under which it is stored in the cache.
+  typedef std::pair<std::string, cedar::aux::conv::EnginePtr> Candidate;
+
+  //! A call to one of the convolve methods of a candidate.
+  typedef boost::function<cv::Mat (const cedar::aux::conv::Engine&)> Call;
+
+  //! Checks whether a candidate is capable of the configuration of a call.
+  typedef boost::function<bool (const cedar::aux::conv::Engine&)> Capability;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  Auto();
+
+  ~Auto();
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  cv::Mat convolve
+  (
+    const cv::Mat& matrix,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  cv::Mat convolve
+  (
+    const cv::Mat& matrix,
+    const cv::Mat& kernel,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    const std::vector<int>& anchor = std::vector<int>(),
+    bool alternateEvenCenter = false
+  ) const;
+
+  cv::Mat convolve
+  (
+    const cv::Mat& matrix,
+    cedar::aux::kernel::ConstKernelPtr kernel,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  cv::Mat convolveSeparable
+  (
+    const cv::Mat& matrix,
+    cedar::aux::kernel::ConstSeparablePtr kernel,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  cv::Mat convolve
+  (
+    const cv::Mat& matrix,
+    cedar::aux::conv::ConstKernelListPtr kernelList,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same,
+    bool alternateEvenCenter = false
+  ) const;
+
+  //!@brief Sets the kernel list of this engine and of all candidate engines.
+  void setKernelList(cedar::aux::conv::KernelListPtr kernelList);
+
+  //!@brief Returns true if any of the candidate engines is capable of the given configuration.
+  bool checkCapability
+  (
+    size_t matrixDim,
+    size_t kernelDim,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  //!@brief Returns true if any of the candidate engines can convolve the given matrices.
+  bool checkCapability
+  (
+    cv::Mat matrix,
+    cv::Mat kernel,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  //!@brief Returns true if any of the candidate engines can convolve with the given kernel.
+  bool checkKernelCapability
+  (
+    size_t matrixDim,
+    cedar::aux::kernel::ConstKernelPtr kernel,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  bool checkBorderTypeCapability
+  (
+    cedar::aux::conv::BorderType::Id borderType
+  ) const;
+
+  bool checkModeCapability
+  (
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
+  /*!@brief Returns the name of the engine that was chosen for the given configuration.
+   *
+   * @returns The name of the engine, or an empty string if the configuration has not been benchmarked yet.
+   */
+  std::string getSelectedEngine
+  (
+    const cv::Mat& matrix,
+    const cv::Mat& kernel,
+    cedar::aux::conv::BorderType::Id borderType = cedar::aux::conv::BorderType::Replicate,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same
+  ) const;
+
+  //!@brief Returns the path of the file in which the benchmark results are stored.
+  static std::string getCachePath();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  /*!@brief Forwards the call to the engine chosen for the signature, benchmarking the candidates if necessary.
+   *
+   * @param signature   Describes the configuration; the results are cached under this string.
+   * @param capable     Selects the candidates that are benchmarked.
+   */
+  cv::Mat dispatch
+  (
+    const std::string& signature,
+    const Capability& capable,
+    const Call& call
+  ) const;
+
+  /*!@brief Times all capable candidates, stores the winner under the signature and returns its result.
+   *
+   * @throws cedar::aux::UnhandledValueException if no candidate is capable of the configuration.
+   */
+  cv::Mat benchmark
+  (
+    const std::string& signature,
+    const Capability& capable,
+    const Call& call
+  ) const;
+
+  //!@brief Returns the candidate with the given name, or a null pointer if there is none.
+  cedar::aux::conv::EnginePtr findCandidate(const std::string& name) const;
+
+  //!@brief Builds the signature of a convolution call.
+  static std::string makeSignature
+  (
+    const std::string& operation,
+    const cv::Mat& matrix,
+    const std::vector<std::vector<int> >& kernelSizes,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode,
+    bool alternateEvenCenter
+  );
+
+  //!@brief Returns the sizes of the given matrix along each of its dimensions.
+  static std::vector<int> getSizes(const cv::Mat& matrix);
+
+  //!@brief Returns the sizes of the given kernel along each of its dimensions.
+  static std::vector<int> getSizes(cedar::aux::kernel::ConstKernelPtr kernel);
+
+  static std::string lookUp(const std::string& signature);
+  static void store(const std::string& signature, const std::string& engine);
+  static void forget(const std::string& signature);
+  static void loadCache();
+  static void saveCache();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! The engines between which this engine chooses.
+  std::vector<Candidate> mCandidates;
+
+  //! Serializes benchmarks so that candidates are not timed while they compete with each other.
+  mutable QMutex mBenchmarkLock;
+
+  //! Benchmark results of all instances, indexed by the signature of the configuration.
+  static std::map<std::string, std::string> mSelectedEngines;
+
+  //! Locks the benchmark results.
+  static QMutex mSelectedEnginesLock;
+
+  //! Makes sure the cache file is only read once.
+  static std::once_flag mLoadCacheFlag;
+}; // cedar::aux::conv::Auto
+
+#endif // CEDAR_AUX_CONV_AUTO_H
@@ -62,6 +62,35 @@ cv::Mat cedar::aux::conv::Engine::convolveSeparable
   return this->convolve(matrix, cedar::aux::kernel::ConstKernelPtr(kernel), borderType, mode, alternateEvenCenter);
 }
 
+bool cedar::aux::conv::Engine::checkKernelCapability
+     (
+       size_t matrixDim,
+       cedar::aux::kernel::ConstKernelPtr kernel,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  return this->checkCapability(matrixDim, kernel->getDimensionality(), borderType, mode);
+}
+
+bool cedar::aux::conv::Engine::checkKernelListCapability
+     (
+       size_t matrixDim,
+       cedar::aux::conv::ConstKernelListPtr kernelList,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  for (size_t i = 0; i < kernelList->size(); ++i)
+  {
+    if (!this->checkKernelCapability(matrixDim, kernelList->getKernel(i), borderType, mode))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 void cedar::aux::conv::Engine::setKernelList(cedar::aux::conv::KernelListPtr kernelList)
 {
   CEDAR_DEBUG_ASSERT(kernelList.get() != nullptr);
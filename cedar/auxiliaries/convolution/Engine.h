@@ -172,6 +172,28 @@ public:
     cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same
   ) const = 0;
 
+  /*!@brief Checks if the engine can convolve a matrix of the given dimensionality with the given kernel.
+   *
+   *        Unlike the checks above, this one knows the kind of kernel, so engines can accept configurations that they
+   *        only support for some kernels. The default implementation checks the dimensionality of the kernel.
+   */
+  virtual bool checkKernelCapability
+  (
+    size_t matrixDim,
+    cedar::aux::kernel::ConstKernelPtr kernel,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same
+  ) const;
+
+  //!@brief Checks if the engine can convolve a matrix of the given dimensionality with every kernel of the list.
+  bool checkKernelListCapability
+  (
+    size_t matrixDim,
+    cedar::aux::conv::ConstKernelListPtr kernelList,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode = cedar::aux::conv::Mode::Same
+  ) const;
+
   //!@brief Checks if a matrix is capable of a certain type of convolution.
   virtual bool checkBorderTypeCapability
   (
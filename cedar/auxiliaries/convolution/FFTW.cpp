@@ -65,6 +65,10 @@ std::atomic_bool cedar::aux::conv::FFTW::mMultiThreadActivated = ATOMIC_VAR_INIT
 std::set<std::string> cedar::aux::conv::FFTW::mLoadedWisdoms;
 std::map<std::string, fftw_plan> cedar::aux::conv::FFTW::mForwardPlans;
 std::map<std::string, fftw_plan> cedar::aux::conv::FFTW::mBackwardPlans;
+#ifdef CEDAR_USE_FFTW_FLOAT
+std::map<std::string, fftwf_plan> cedar::aux::conv::FFTW::mForwardPlansFloat;
+std::map<std::string, fftwf_plan> cedar::aux::conv::FFTW::mBackwardPlansFloat;
+#endif // CEDAR_USE_FFTW_FLOAT
 
 //----------------------------------------------------------------------------------------------------------------------
 // register type with the factory
@@ -84,11 +88,51 @@ mAllocatedSize(0),
 mMatrixBuffer(nullptr),
 mKernelBuffer(nullptr),
 mResultBuffer(nullptr),
+mTransformedAlternateEvenCenter(false),
 mRetransformKernel(true)
+#ifdef CEDAR_USE_FFTW_FLOAT
+,
+mAllocatedSizeFloat(0),
+mMatrixBufferFloat(nullptr),
+mKernelBufferFloat(nullptr),
+mResultBufferFloat(nullptr),
+mTransformedAlternateEvenCenterFloat(false),
+mRetransformKernelFloat(true)
+#endif // CEDAR_USE_FFTW_FLOAT
 {
  this->connect(this, SIGNAL(kernelListChanged()), SLOT(kernelListChanged()));
 }
 
+cedar::aux::conv::FFTW::~FFTW()
+{
+  if (mMatrixBuffer)
+  {
+    fftw_free(mMatrixBuffer);
+  }
+  if (mKernelBuffer)
+  {
+    fftw_free(mKernelBuffer);
+  }
+  if (mResultBuffer)
+  {
+    fftw_free(mResultBuffer);
+  }
+#ifdef CEDAR_USE_FFTW_FLOAT
+  if (mMatrixBufferFloat)
+  {
+    fftwf_free(mMatrixBufferFloat);
+  }
+  if (mKernelBufferFloat)
+  {
+    fftwf_free(mKernelBufferFloat);
+  }
+  if (mResultBufferFloat)
+  {
+    fftwf_free(mResultBufferFloat);
+  }
+#endif // CEDAR_USE_FFTW_FLOAT
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // methods
 //----------------------------------------------------------------------------------------------------------------------
@@ -160,35 +204,33 @@ cv::Mat cedar::aux::conv::FFTW::convolve
 cv::Mat cedar::aux::conv::FFTW::convolveInternal
         (
           const cv::Mat& matrixIn,
-          const cv::Mat& kernelIn,
+          const cv::Mat& kernel,
           cedar::aux::conv::BorderType::Id /* borderType */,
           bool alternateEvenCenter
         ) const
 {
-  cv::Mat matrix, kernel;
+  // the kernel is only flipped when it is actually (re-)transformed, see convolve*Precision
+  std::vector<bool> flipped;
+  cv::Mat matrix;
   if (alternateEvenCenter)
   {
     // to alternate the kernel center, we flip all inputs and then flip the result back
-    std::vector<bool> flipped;
     flipped.assign(cedar::aux::math::getDimensionalityOf(matrixIn), true);
 
-    // preallocate the flipped matrices (cedar::aux::math::flip expects this)
+    // preallocate the flipped matrix (cedar::aux::math::flip expects this)
     matrix = 0.0 * matrixIn.clone();
-    kernel = 0.0 * kernelIn.clone();
 
-    // flip the matrices
+    // flip the matrix
     cedar::aux::math::flip(matrixIn, matrix, flipped);
-    cedar::aux::math::flip(kernelIn, kernel, flipped);
   }
   else
   {
     matrix = matrixIn;
-    kernel = kernelIn;
   }
 
   if (cedar::aux::math::getDimensionalityOf(kernel) == 0)
   {
-    return matrix * cedar::aux::math::getMatrixEntry<double>(kernel, 0, 0);
+    return matrixIn * cedar::aux::math::getMatrixEntry<double>(kernel, 0, 0);
   }
   else if (cedar::aux::math::getDimensionalityOf(matrix) == 0)
   {
@@ -209,31 +251,53 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     }
   }
 
-  cv::Mat matrix_64;
-  cv::Mat kernel_64;
-  if (matrix.type() != CV_64F)
+  cv::Mat returned;
+#ifdef CEDAR_USE_FFTW_FLOAT
+  if (matrix.type() == CV_32F)
   {
-    matrix.convertTo(matrix_64, CV_64F);
+    returned = this->convolveSinglePrecision(matrix, kernel, alternateEvenCenter);
   }
   else
+#endif // CEDAR_USE_FFTW_FLOAT
   {
-    CEDAR_ASSERT(matrix.type() == CV_64F);
-    matrix_64 = matrix;
+    returned = this->convolveDoublePrecision(matrix, kernel, alternateEvenCenter);
   }
 
-  if (kernel.type() != CV_64F)
+  if (alternateEvenCenter)
   {
-    kernel.convertTo(kernel_64, CV_64F);
+    // to alternate the kernel center, we flip all inputs and then flip the result back
+    cv::Mat tmp_returned = returned.clone() * 0.0;
+    cedar::aux::math::flip(returned, tmp_returned, flipped);
+    returned = tmp_returned;
+  }
+
+  return returned;
+}
+
+cv::Mat cedar::aux::conv::FFTW::convolveDoublePrecision
+        (
+          const cv::Mat& matrix,
+          const cv::Mat& kernel,
+          bool alternateEvenCenter
+        ) const
+{
+  cv::Mat matrix_64;
+  if (matrix.type() != CV_64F)
+  {
+    matrix.convertTo(matrix_64, CV_64F);
+  }
+  else if (!matrix.isContinuous())
+  {
+    matrix_64 = matrix.clone();
   }
   else
   {
-    CEDAR_ASSERT(kernel.type() == CV_64F);
-    kernel_64 = kernel;
+    CEDAR_ASSERT(matrix.type() == CV_64F);
+    matrix_64 = matrix;
   }
 
-  cv::Mat output = matrix_64.clone();
-  output = 0.0;
-  cv::Mat padded_kernel = this->padKernel(matrix_64, kernel_64);
+  // every element is written by the backward transform, so the output does not need to be initialized
+  cv::Mat output(matrix_64.dims, matrix_64.size, CV_64F);
 
   unsigned int transformed_elements = 1;
   double number_of_elements = 1.0;
@@ -245,6 +309,13 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
   transformed_elements *= matrix_64.size[cedar::aux::math::getDimensionalityOf(matrix_64) -1] / 2 + 1;
   number_of_elements *= matrix_64.size[cedar::aux::math::getDimensionalityOf(matrix_64) -1];
 
+  std::vector<unsigned int> mat_sizes(cedar::aux::math::getDimensionalityOf(matrix_64));
+  for (unsigned int dim = 0; dim < mat_sizes.size(); ++dim)
+  {
+   mat_sizes.at(dim) = static_cast<unsigned int>(matrix.size[dim]);
+  }
+
+  QWriteLocker write_lock(&this->mKernelTransformLock);
   if (transformed_elements != mAllocatedSize)
   {
     if (mMatrixBuffer)
@@ -266,43 +337,64 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     mResultBuffer = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
     mKernelBuffer = (fftw_complex*) fftw_malloc(sizeof(fftw_complex) * transformed_elements);
     mAllocatedSize = transformed_elements;
-    QWriteLocker write_lock(&this->mKernelTransformLock);
-    this->mRetransformKernel = true;
   }
 
-//  fftw_execute(matrix_plan_forward);
-  std::vector<unsigned int> mat_sizes(cedar::aux::math::getDimensionalityOf(matrix_64));
-  for (unsigned int dim = 0; dim < mat_sizes.size(); ++dim)
+  // the cached kernel spectrum is only valid for the matrix size it was padded to
+  if (mat_sizes != this->mTransformedSizes || alternateEvenCenter != this->mTransformedAlternateEvenCenter)
   {
-   mat_sizes.at(dim) = static_cast<unsigned int>(matrix.size[dim]);
+    this->mRetransformKernel = true;
   }
 
-  fftw_execute_dft_r2c
-  (
-    cedar::aux::conv::FFTW::getForwardPlan(cedar::aux::math::getDimensionalityOf(matrix_64), mat_sizes),
-    const_cast<double*>(matrix_64.ptr<double>()),
-    mMatrixBuffer
-  );
-
-  QWriteLocker write_lock(&this->mKernelTransformLock);
   if (this->mRetransformKernel)
   {
+    cv::Mat kernel_64;
+    if (alternateEvenCenter)
+    {
+      std::vector<bool> flipped;
+      flipped.assign(cedar::aux::math::getDimensionalityOf(kernel), true);
+      cv::Mat flipped_kernel = 0.0 * kernel.clone();
+      cedar::aux::math::flip(kernel, flipped_kernel, flipped);
+      flipped_kernel.convertTo(kernel_64, CV_64F);
+    }
+    else
+    {
+      kernel.convertTo(kernel_64, CV_64F);
+    }
+
+    cv::Mat padded_kernel = this->padKernel(matrix_64, kernel_64);
     fftw_execute_dft_r2c
     (
       cedar::aux::conv::FFTW::getForwardPlan(cedar::aux::math::getDimensionalityOf(padded_kernel), mat_sizes),
       const_cast<double*>(padded_kernel.ptr<double>()),
       mKernelBuffer
     );
+
+    // the normalization of the inverse transform is folded into the cached kernel spectrum
+    const double scale = 1.0 / number_of_elements;
+    for (unsigned int xyz = 0; xyz < transformed_elements; ++xyz)
+    {
+      mKernelBuffer[xyz][0] *= scale;
+      mKernelBuffer[xyz][1] *= scale;
+    }
+
+    this->mTransformedSizes = mat_sizes;
+    this->mTransformedAlternateEvenCenter = alternateEvenCenter;
     this->mRetransformKernel = false;
   }
-  write_lock.unlock();
+
+  fftw_execute_dft_r2c
+  (
+    cedar::aux::conv::FFTW::getForwardPlan(cedar::aux::math::getDimensionalityOf(matrix_64), mat_sizes),
+    const_cast<double*>(matrix_64.ptr<double>()),
+    mMatrixBuffer
+  );
 
   // go trough all data points
   for (unsigned int xyz = 0; xyz < transformed_elements; ++xyz)
   {
     // complex multiplication (lateral)
-    mResultBuffer[xyz][0] = (mKernelBuffer[xyz][0] * mMatrixBuffer[xyz][0] - mKernelBuffer[xyz][1] * mMatrixBuffer[xyz][1]) / number_of_elements;
-    mResultBuffer[xyz][1] = (mKernelBuffer[xyz][1] * mMatrixBuffer[xyz][0] + mKernelBuffer[xyz][0] * mMatrixBuffer[xyz][1]) / number_of_elements;
+    mResultBuffer[xyz][0] = mKernelBuffer[xyz][0] * mMatrixBuffer[xyz][0] - mKernelBuffer[xyz][1] * mMatrixBuffer[xyz][1];
+    mResultBuffer[xyz][1] = mKernelBuffer[xyz][1] * mMatrixBuffer[xyz][0] + mKernelBuffer[xyz][0] * mMatrixBuffer[xyz][1];
   }
 
   // transform interaction back to time domain (ifft)
@@ -312,29 +404,145 @@ cv::Mat cedar::aux::conv::FFTW::convolveInternal
     mResultBuffer,
     const_cast<double*>(output.ptr<double>())
   );
+  write_lock.unlock();
 
-  cv::Mat returned;
   if (matrix.type() != CV_64F)
   {
+    cv::Mat returned;
     output.convertTo(returned, matrix.type());
+    return returned;
   }
-  else
+  return output;
+}
+
+#ifdef CEDAR_USE_FFTW_FLOAT
+cv::Mat cedar::aux::conv::FFTW::convolveSinglePrecision
+        (
+          const cv::Mat& matrixIn,
+          const cv::Mat& kernel,
+          bool alternateEvenCenter
+        ) const
+{
+  CEDAR_DEBUG_ASSERT(matrixIn.type() == CV_32F);
+
+  // fftw expects one contiguous block of memory
+  cv::Mat matrix = matrixIn.isContinuous() ? matrixIn : matrixIn.clone();
+
+  // every element is written by the backward transform, so the output does not need to be initialized
+  cv::Mat output(matrix.dims, matrix.size, CV_32F);
+
+  unsigned int dimensionality = cedar::aux::math::getDimensionalityOf(matrix);
+  unsigned int transformed_elements = 1;
+  double number_of_elements = 1.0;
+  for (unsigned int dim = 0 ; dim < dimensionality - 1; ++dim)
   {
-    returned = output;
+    transformed_elements *= matrix.size[dim];
+    number_of_elements *= matrix.size[dim];
   }
+  transformed_elements *= matrix.size[dimensionality - 1] / 2 + 1;
+  number_of_elements *= matrix.size[dimensionality - 1];
 
-  if (alternateEvenCenter)
+  std::vector<unsigned int> mat_sizes(dimensionality);
+  for (unsigned int dim = 0; dim < mat_sizes.size(); ++dim)
   {
-    // to alternate the kernel center, we flip all inputs and then flip the result back
-    std::vector<bool> flipped;
-    flipped.assign(cedar::aux::math::getDimensionalityOf(matrixIn), true);
-    cv::Mat tmp_returned = returned.clone() * 0.0;
-    cedar::aux::math::flip(returned, tmp_returned, flipped);
-    returned = tmp_returned;
+    mat_sizes.at(dim) = static_cast<unsigned int>(matrix.size[dim]);
   }
 
-  return returned;
+  QWriteLocker write_lock(&this->mKernelTransformLock);
+  if (transformed_elements != mAllocatedSizeFloat)
+  {
+    if (mMatrixBufferFloat)
+    {
+      fftwf_free(mMatrixBufferFloat);
+    }
+
+    if (mResultBufferFloat)
+    {
+      fftwf_free(mResultBufferFloat);
+    }
+
+    if (mKernelBufferFloat)
+    {
+      fftwf_free(mKernelBufferFloat);
+    }
+
+    mMatrixBufferFloat = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+    mResultBufferFloat = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+    mKernelBufferFloat = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+    mAllocatedSizeFloat = transformed_elements;
+  }
+
+  // the cached kernel spectrum is only valid for the matrix size it was padded to
+  if (mat_sizes != this->mTransformedSizesFloat || alternateEvenCenter != this->mTransformedAlternateEvenCenterFloat)
+  {
+    this->mRetransformKernelFloat = true;
+  }
+
+  if (this->mRetransformKernelFloat)
+  {
+    cv::Mat kernel_32;
+    if (alternateEvenCenter)
+    {
+      std::vector<bool> flipped;
+      flipped.assign(cedar::aux::math::getDimensionalityOf(kernel), true);
+      cv::Mat flipped_kernel = 0.0 * kernel.clone();
+      cedar::aux::math::flip(kernel, flipped_kernel, flipped);
+      flipped_kernel.convertTo(kernel_32, CV_32F);
+    }
+    else
+    {
+      kernel.convertTo(kernel_32, CV_32F);
+    }
+
+    cv::Mat padded_kernel = this->padKernel(matrix, kernel_32);
+    fftwf_execute_dft_r2c
+    (
+      cedar::aux::conv::FFTW::getForwardPlanFloat(dimensionality, mat_sizes),
+      padded_kernel.ptr<float>(),
+      mKernelBufferFloat
+    );
+
+    // the normalization of the inverse transform is folded into the cached kernel spectrum
+    const float scale = static_cast<float>(1.0 / number_of_elements);
+    for (unsigned int xyz = 0; xyz < transformed_elements; ++xyz)
+    {
+      mKernelBufferFloat[xyz][0] *= scale;
+      mKernelBufferFloat[xyz][1] *= scale;
+    }
+
+    this->mTransformedSizesFloat = mat_sizes;
+    this->mTransformedAlternateEvenCenterFloat = alternateEvenCenter;
+    this->mRetransformKernelFloat = false;
+  }
+
+  fftwf_execute_dft_r2c
+  (
+    cedar::aux::conv::FFTW::getForwardPlanFloat(dimensionality, mat_sizes),
+    const_cast<float*>(matrix.ptr<float>()),
+    mMatrixBufferFloat
+  );
+
+  const fftwf_complex* kernel_buffer = mKernelBufferFloat;
+  const fftwf_complex* matrix_buffer = mMatrixBufferFloat;
+  fftwf_complex* result_buffer = mResultBufferFloat;
+  for (unsigned int xyz = 0; xyz < transformed_elements; ++xyz)
+  {
+    // complex multiplication (lateral)
+    result_buffer[xyz][0] = kernel_buffer[xyz][0] * matrix_buffer[xyz][0] - kernel_buffer[xyz][1] * matrix_buffer[xyz][1];
+    result_buffer[xyz][1] = kernel_buffer[xyz][1] * matrix_buffer[xyz][0] + kernel_buffer[xyz][0] * matrix_buffer[xyz][1];
+  }
+
+  // transform interaction back to time domain (ifft)
+  fftwf_execute_dft_c2r
+  (
+    cedar::aux::conv::FFTW::getBackwardPlanFloat(dimensionality, mat_sizes),
+    mResultBufferFloat,
+    output.ptr<float>()
+  );
+
+  return output;
 }
+#endif // CEDAR_USE_FFTW_FLOAT
 
 cv::Mat cedar::aux::conv::FFTW::padKernel(const cv::Mat& matrix, const cv::Mat& kernel) const
 {
@@ -499,33 +707,51 @@ bool cedar::aux::conv::FFTW::checkModeCapability
   return mode == cedar::aux::conv::Mode::Same;
 }
 
-void cedar::aux::conv::FFTW::loadWisdom(const std::string& uniqueIdentifier)
+std::string cedar::aux::conv::FFTW::getWisdomPath(const std::string& uniqueIdentifier, bool singlePrecision)
+{
+  // fftw and fftwf keep separate wisdom, so they must not share a file
+  return cedar::aux::getUserApplicationDataDirectory()
+           + "/.cedar/fftw/fftw"
+           + (singlePrecision ? "f." : ".")
+           + CEDAR_BUILT_ON_MACHINE + "."
+           + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
+           + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
+           + uniqueIdentifier + "."
+           + "wisdom";
+}
+
+void cedar::aux::conv::FFTW::loadWisdom(const std::string& uniqueIdentifier, bool singlePrecision)
 {
-  if (cedar::aux::conv::FFTW::mLoadedWisdoms.find(uniqueIdentifier) == cedar::aux::conv::FFTW::mLoadedWisdoms.end())
-  {
-    std::string path = cedar::aux::getUserApplicationDataDirectory()
-                         + "/.cedar/fftw/fftw."
-                         + CEDAR_BUILT_ON_MACHINE + "."
-                         + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
-                         + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
-                         + uniqueIdentifier + "."
-                         + "wisdom";
-    fftw_import_wisdom_from_filename(path.c_str());
-    cedar::aux::conv::FFTW::mLoadedWisdoms.insert(uniqueIdentifier);
+  std::string wisdom_key = (singlePrecision ? "f." : "") + uniqueIdentifier;
+  if (cedar::aux::conv::FFTW::mLoadedWisdoms.find(wisdom_key) == cedar::aux::conv::FFTW::mLoadedWisdoms.end())
+  {
+    std::string path = cedar::aux::conv::FFTW::getWisdomPath(uniqueIdentifier, singlePrecision);
+#ifdef CEDAR_USE_FFTW_FLOAT
+    if (singlePrecision)
+    {
+      fftwf_import_wisdom_from_filename(path.c_str());
+    }
+    else
+#endif // CEDAR_USE_FFTW_FLOAT
+    {
+      fftw_import_wisdom_from_filename(path.c_str());
+    }
+    cedar::aux::conv::FFTW::mLoadedWisdoms.insert(wisdom_key);
   }
 }
 
-void cedar::aux::conv::FFTW::saveWisdom(const std::string& uniqueIdentifier)
+void cedar::aux::conv::FFTW::saveWisdom(const std::string& uniqueIdentifier, bool singlePrecision)
 {
-  cedar::aux::Path path = cedar::aux::getUserApplicationDataDirectory()
-                          + "/.cedar/fftw/fftw."
-                          + CEDAR_BUILT_ON_MACHINE + "."
-                          + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads()) + "."
-                          + cedar::aux::toString(cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategyString()) + "."
-                          + uniqueIdentifier + "."
-                          + "wisdom";
+  cedar::aux::Path path = cedar::aux::conv::FFTW::getWisdomPath(uniqueIdentifier, singlePrecision);
   path.createDirectories();
-                       
+
+#ifdef CEDAR_USE_FFTW_FLOAT
+  if (singlePrecision)
+  {
+    fftwf_export_wisdom_to_filename(path.toString().c_str());
+    return;
+  }
+#endif // CEDAR_USE_FFTW_FLOAT
   fftw_export_wisdom_to_filename(path.toString().c_str());
 }
 
@@ -667,6 +893,141 @@ fftw_plan cedar::aux::conv::FFTW::getBackwardPlan(unsigned int dimensionality, s
   }
 }
 
+#ifdef CEDAR_USE_FFTW_FLOAT
+fftwf_plan cedar::aux::conv::FFTW::getForwardPlanFloat(unsigned int dimensionality, std::vector<unsigned int> sizes)
+{
+  CEDAR_ASSERT(sizes.size() == dimensionality);
+  std::string unique_identifier = cedar::aux::toString(sizes.at(0));
+  for (unsigned int i = 1; i < sizes.size(); ++i)
+  {
+    unique_identifier += "." + cedar::aux::toString(sizes.at(i));
+  }
+  auto entry = cedar::aux::conv::FFTW::mForwardPlansFloat.find(unique_identifier);
+  if (entry != cedar::aux::conv::FFTW::mForwardPlansFloat.end())
+  {
+    return entry->second;
+  }
+  else
+  {
+#ifdef CEDAR_USE_FFTW_THREADED
+    std::call_once(mInitThreadFlag,cedar::aux::conv::FFTW::initThreads);
+#endif
+    QWriteLocker plan_locker(&cedar::aux::conv::FFTW::mPlanLock);
+    cedar::aux::conv::FFTW::loadWisdom(unique_identifier, true);
+    std::vector<int> sizes_signed(sizes.size());
+    for (unsigned int i = 0; i < sizes_signed.size(); ++i)
+    {
+      sizes_signed.at(i) = static_cast<int>(sizes.at(i));
+    }
+
+    cv::Mat matrix(dimensionality, &(sizes_signed.front()), CV_32F);
+
+    unsigned int transformed_elements = 1;
+    for (unsigned int dim = 0 ; dim < dimensionality - 1; ++dim)
+    {
+      transformed_elements *= matrix.size[dim];
+    }
+    transformed_elements *= matrix.size[dimensionality - 1] / 2 + 1;
+
+    // planning may overwrite the arrays, so plan on scratch memory
+    fftwf_complex* matrix_fourier = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+    fftwf_plan matrix_plan_forward
+      = fftwf_plan_dft_r2c
+        (
+          static_cast<int>(dimensionality),
+          &(sizes_signed.front()),
+          matrix.ptr<float>(),
+          matrix_fourier,
+          cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategy()
+        );
+    fftwf_free(matrix_fourier);
+    if (matrix_plan_forward)
+    {
+      cedar::aux::conv::FFTW::mForwardPlansFloat[unique_identifier] = matrix_plan_forward;
+      cedar::aux::conv::FFTW::saveWisdom(unique_identifier, true);
+      plan_locker.unlock();
+      return matrix_plan_forward;
+    }
+    else
+    {
+      plan_locker.unlock();
+      CEDAR_THROW
+      (
+        cedar::aux::NotFoundException,
+        "FFTW could not find a single-precision forward transformation plan for a matrix with sizes " + unique_identifier
+        + ". You can try to alter the planning strategy."
+      );
+    }
+  }
+}
+
+fftwf_plan cedar::aux::conv::FFTW::getBackwardPlanFloat(unsigned int dimensionality, std::vector<unsigned int> sizes)
+{
+  CEDAR_ASSERT(sizes.size() == dimensionality);
+  std::string unique_identifier = cedar::aux::toString(sizes.at(0));
+  for (unsigned int i = 1; i < sizes.size(); ++i)
+  {
+    unique_identifier += "." + cedar::aux::toString(sizes.at(i));
+  }
+  auto entry = cedar::aux::conv::FFTW::mBackwardPlansFloat.find(unique_identifier);
+  if (entry != cedar::aux::conv::FFTW::mBackwardPlansFloat.end())
+  {
+    return entry->second;
+  }
+  else
+  {
+#ifdef CEDAR_USE_FFTW_THREADED
+    std::call_once(mInitThreadFlag,cedar::aux::conv::FFTW::initThreads);
+#endif
+    QWriteLocker plan_locker(&cedar::aux::conv::FFTW::mPlanLock);
+    cedar::aux::conv::FFTW::loadWisdom(unique_identifier, true);
+    std::vector<int> sizes_signed(sizes.size());
+    for (unsigned int i = 0; i < sizes_signed.size(); ++i)
+    {
+      sizes_signed.at(i) = static_cast<int>(sizes.at(i));
+    }
+
+    cv::Mat matrix(dimensionality, &(sizes_signed.front()), CV_32F);
+
+    unsigned int transformed_elements = 1;
+    for (unsigned int dim = 0 ; dim < dimensionality - 1; ++dim)
+    {
+      transformed_elements *= matrix.size[dim];
+    }
+    transformed_elements *= matrix.size[dimensionality - 1] / 2 + 1;
+
+    fftwf_complex* matrix_fourier = (fftwf_complex*) fftwf_malloc(sizeof(fftwf_complex) * transformed_elements);
+    fftwf_plan matrix_plan_backward
+      = fftwf_plan_dft_c2r
+        (
+          static_cast<int>(dimensionality),
+          &(sizes_signed.front()),
+          matrix_fourier,
+          matrix.ptr<float>(),
+          cedar::aux::SettingsSingleton::getInstance()->getFFTWPlanningStrategy()
+        );
+    fftwf_free(matrix_fourier);
+    if (matrix_plan_backward)
+    {
+      cedar::aux::conv::FFTW::mBackwardPlansFloat[unique_identifier] = matrix_plan_backward;
+      cedar::aux::conv::FFTW::saveWisdom(unique_identifier, true);
+      plan_locker.unlock();
+      return matrix_plan_backward;
+    }
+    else
+    {
+      plan_locker.unlock();
+      CEDAR_THROW
+      (
+        cedar::aux::NotFoundException,
+        "FFTW could not find a single-precision backward transformation plan for a matrix with sizes "
+        + unique_identifier + ". You can try to alter the planning strategy."
+      );
+    }
+  }
+}
+#endif // CEDAR_USE_FFTW_FLOAT
+
 void cedar::aux::conv::FFTW::initThreads()
 {
 #ifdef CEDAR_USE_FFTW_THREADED
@@ -679,6 +1040,11 @@ void cedar::aux::conv::FFTW::initThreads()
     fftw_set_timelimit(30.0);
     // from now on, all plans are generated for n threads
     fftw_plan_with_nthreads(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads());
+#ifdef CEDAR_USE_FFTW_FLOAT
+    fftwf_init_threads();
+    fftwf_set_timelimit(30.0);
+    fftwf_plan_with_nthreads(cedar::aux::SettingsSingleton::getInstance()->getFFTWNumberOfThreads());
+#endif // CEDAR_USE_FFTW_FLOAT
     // make sure that we do not initialize this again
     mMultiThreadActivated.store(true);
   }
@@ -689,6 +1055,9 @@ void cedar::aux::conv::FFTW::kernelChanged() const
 {
   QWriteLocker write_lock(&this->mKernelTransformLock);
   this->mRetransformKernel = true;
+#ifdef CEDAR_USE_FFTW_FLOAT
+  this->mRetransformKernelFloat = true;
+#endif // CEDAR_USE_FFTW_FLOAT
 }
 
 void cedar::aux::conv::FFTW::kernelListChanged()
@@ -57,6 +57,11 @@
 #include <mutex>
 
 /*!@brief A convolution engine based on the FFTW library.
+ *
+ *        If cedar was built with the single-precision variant of FFTW (CEDAR_USE_FFTW_FLOAT), CV_32F matrices are
+ *        transformed with fftwf plans directly; all other types are converted to and processed in double precision.
+ *        The transformed kernel is cached per precision and only recomputed when the kernel (list) or the size of the
+ *        convolved matrix changes.
  */
 class cedar::aux::conv::FFTW : public cedar::aux::conv::Engine
 {
@@ -69,6 +74,9 @@ class cedar::aux::conv::FFTW : public cedar::aux::conv::Engine
   //--------------------------------------------------------------------------------------------------------------------
 public:
   FFTW();
+
+  //!@brief Destructor.
+  ~FFTW();
   //--------------------------------------------------------------------------------------------------------------------
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -151,14 +159,27 @@ protected:
   //!@brief adjusts the size of the kernel (to matrix size) and flips sectors
   cv::Mat padKernel(const cv::Mat& matrix, const cv::Mat& kernel) const;
 
+  //!@brief convolves (non-flipped) matrices in double precision, converting them if necessary
+  cv::Mat convolveDoublePrecision(const cv::Mat& matrix, const cv::Mat& kernel, bool alternateEvenCenter) const;
+
+#ifdef CEDAR_USE_FFTW_FLOAT
+  //!@brief convolves (non-flipped) CV_32F matrices in single precision
+  cv::Mat convolveSinglePrecision(const cv::Mat& matrix, const cv::Mat& kernel, bool alternateEvenCenter) const;
+#endif // CEDAR_USE_FFTW_FLOAT
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
   static fftw_plan getForwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes);
   static fftw_plan getBackwardPlan(unsigned int dimensionality, std::vector<unsigned int> sizes);
-  static void loadWisdom(const std::string& uniqueIdentifier);
-  static void saveWisdom(const std::string& uniqueIdentifier);
+#ifdef CEDAR_USE_FFTW_FLOAT
+  static fftwf_plan getForwardPlanFloat(unsigned int dimensionality, std::vector<unsigned int> sizes);
+  static fftwf_plan getBackwardPlanFloat(unsigned int dimensionality, std::vector<unsigned int> sizes);
+#endif // CEDAR_USE_FFTW_FLOAT
+  static std::string getWisdomPath(const std::string& uniqueIdentifier, bool singlePrecision);
+  static void loadWisdom(const std::string& uniqueIdentifier, bool singlePrecision = false);
+  static void saveWisdom(const std::string& uniqueIdentifier, bool singlePrecision = false);
   static void initThreads();
 
 private slots:
@@ -182,8 +203,26 @@ private:
   mutable fftw_complex* mMatrixBuffer;
   mutable fftw_complex* mKernelBuffer;
   mutable fftw_complex* mResultBuffer;
+  //! sizes of the matrix the buffers (and the transformed kernel) were last prepared for
+  mutable std::vector<unsigned int> mTransformedSizes;
+  //! value of alternateEvenCenter the kernel was last transformed with
+  mutable bool mTransformedAlternateEvenCenter;
   // dirty flag if kernel has changed since last time
   mutable bool mRetransformKernel;
+#ifdef CEDAR_USE_FFTW_FLOAT
+  static std::map<std::string, fftwf_plan> mForwardPlansFloat;
+  static std::map<std::string, fftwf_plan> mBackwardPlansFloat;
+  mutable unsigned int mAllocatedSizeFloat;
+  mutable fftwf_complex* mMatrixBufferFloat;
+  mutable fftwf_complex* mKernelBufferFloat;
+  mutable fftwf_complex* mResultBufferFloat;
+  //! sizes of the matrix the single-precision buffers (and the transformed kernel) were last prepared for
+  mutable std::vector<unsigned int> mTransformedSizesFloat;
+  //! value of alternateEvenCenter the single-precision kernel was last transformed with
+  mutable bool mTransformedAlternateEvenCenterFloat;
+  //! dirty flag for the single-precision kernel spectrum
+  mutable bool mRetransformKernelFloat;
+#endif // CEDAR_USE_FFTW_FLOAT
   mutable QReadWriteLock mKernelTransformLock;
 }; // cedar::aux::conv::FFTW
 
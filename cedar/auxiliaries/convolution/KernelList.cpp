@@ -38,6 +38,7 @@
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/convolution/KernelList.h"
 #include "cedar/auxiliaries/kernel/Kernel.h"
+#include "cedar/auxiliaries/kernel/Separable.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/exceptions.h"
@@ -45,6 +46,10 @@
 // SYSTEM INCLUDES
 #include <QReadLocker>
 #include <QWriteLocker>
+#ifndef Q_MOC_RUN
+  #include <boost/pointer_cast.hpp>
+#endif
+#include <cmath>
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -95,6 +100,7 @@ void cedar::aux::conv::KernelList::calculateCombinedKernel()
       if (dim != this->getKernel(i)->getDimensionality())
       {
         // inconsistency, happens while kernels are being updated, ignore
+        this->mFusedKernel.clear();
         return;
       }
     }
@@ -174,10 +180,118 @@ void cedar::aux::conv::KernelList::calculateCombinedKernel()
     }
   }
   mCombinedKernel->setData(new_combined_kernel);
+  this->calculateFusedKernel(new_combined_kernel);
   write_lock.unlock();
   emit combinedKernelUpdated();
 }
 
+std::vector<cedar::aux::conv::KernelList::FusedTerm> cedar::aux::conv::KernelList::getFusedKernel() const
+{
+  QReadLocker read_lock(&this->mCombinedKernel->getLock());
+  std::vector<FusedTerm> copy = this->mFusedKernel;
+  return copy;
+}
+
+void cedar::aux::conv::KernelList::calculateFusedKernel(const cv::Mat& combinedKernel)
+{
+  this->mFusedKernel.clear();
+
+  if (this->size() < 1 || combinedKernel.empty() || combinedKernel.dims > 2)
+  {
+    return;
+  }
+
+  unsigned int dim = this->getKernel(0)->getDimensionality();
+  if (dim < 1 || dim > 2)
+  {
+    return;
+  }
+
+  // the combined kernel centers all kernels; this is only where the engines would put them if all anchors are
+  // centered and all sizes have the same parity
+  size_t single_cost = 0;
+  for (size_t i = 0; i < this->size(); ++i)
+  {
+    cedar::aux::kernel::ConstKernelPtr kernel = this->getKernel(i);
+    const std::vector<int>& anchor = kernel->getAnchor();
+    for (size_t d = 0; d < anchor.size(); ++d)
+    {
+      if (anchor.at(d) != 0)
+      {
+        return;
+      }
+    }
+
+    // separable kernels cost the sum of their sizes per element, full kernels the product
+    bool separable = dim == 1
+                     || static_cast<bool>(boost::dynamic_pointer_cast<const cedar::aux::kernel::Separable>(kernel));
+    size_t kernel_cost = separable ? 0 : 1;
+    for (unsigned int d = 0; d < dim; ++d)
+    {
+      unsigned int size = kernel->getSize(d);
+      if (size % 2 != this->getKernel(0)->getSize(d) % 2)
+      {
+        return;
+      }
+      if (separable)
+      {
+        kernel_cost += size;
+      }
+      else
+      {
+        kernel_cost *= size;
+      }
+    }
+    // every kernel also costs one pass over the matrix to sum up the results
+    single_cost += kernel_cost + 1;
+  }
+
+  if (dim == 1 && combinedKernel.rows != 1 && combinedKernel.cols != 1)
+  {
+    return;
+  }
+
+  // convolving with the combined kernel costs as much as with one full kernel
+  size_t combined_cost = combinedKernel.total() + 1;
+
+  // the singular values tell how many rank-1 terms are needed to represent a 2D combined kernel
+  int rank = 0;
+  cv::SVD svd;
+  if (dim == 2)
+  {
+    cv::Mat kernel_64;
+    combinedKernel.convertTo(kernel_64, CV_64F);
+    svd(kernel_64);
+
+    const double tolerance = 1e-6;
+    while (rank < svd.w.rows && svd.w.at<double>(rank) > tolerance * svd.w.at<double>(0))
+    {
+      ++rank;
+    }
+  }
+  size_t decomposed_cost = static_cast<size_t>(rank) * (combinedKernel.rows + combinedKernel.cols + 1);
+
+  if (rank > 0 && decomposed_cost < combined_cost && decomposed_cost < single_cost)
+  {
+    for (int r = 0; r < rank; ++r)
+    {
+      double scale = std::sqrt(svd.w.at<double>(r));
+      FusedTerm term;
+      cv::Mat column = svd.u.col(r) * scale;
+      cv::Mat row = svd.vt.row(r) * scale;
+      column.convertTo(term.mColumn, combinedKernel.type());
+      row.convertTo(term.mRow, combinedKernel.type());
+      this->mFusedKernel.push_back(term);
+    }
+  }
+  else if (combined_cost < single_cost)
+  {
+    FusedTerm term;
+    term.mKernel = combinedKernel.clone();
+    this->mFusedKernel.push_back(term);
+  }
+}
+
 bool cedar::aux::conv::KernelList::checkForSameKernelSize() const
 {
   if (this->size() == 0)  // nothing to to
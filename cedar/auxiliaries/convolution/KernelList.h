@@ -61,6 +61,22 @@ class cedar::aux::conv::KernelList : public QObject
   //--------------------------------------------------------------------------------------------------------------------
   Q_OBJECT
 
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief One term of the fused kernel.
+   *
+   *        If mKernel is set, the term is this (1D or 2D) kernel. Otherwise, it is the rank-1 kernel given by the outer
+   *        product of the column vector mColumn and the row vector mRow.
+   */
+  struct FusedTerm
+  {
+    cv::Mat mKernel;
+    cv::Mat mColumn;
+    cv::Mat mRow;
+  };
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
@@ -148,6 +164,14 @@ public:
   //!@brief returns true if all kernels in list have same dimensionality and size
   bool checkForSameKernelSize() const;
 
+  /*!@brief Returns the combined kernel of all kernels in this list in the form that is cheapest to convolve with.
+   *
+   *        This is either the combined kernel itself or its singular value decomposition into rank-1 terms. The vector
+   *        is empty if convolving with each kernel is cheaper, or if the kernels cannot be fused (more than two
+   *        dimensions, anchors that are not centered or kernel sizes of different parity).
+   */
+  std::vector<FusedTerm> getFusedKernel() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -161,7 +185,8 @@ signals:
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  // none yet
+  //! Updates mFusedKernel from the combined kernel. Called with the lock of mCombinedKernel held.
+  void calculateFusedKernel(const cv::Mat& combinedKernel);
 
 private slots:
   void calculateCombinedKernel();
@@ -183,6 +208,9 @@ private:
 
   cedar::aux::MatDataPtr mCombinedKernel;
 
+  //! The fused form of mCombinedKernel; also locked by the lock of mCombinedKernel.
+  std::vector<FusedTerm> mFusedKernel;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
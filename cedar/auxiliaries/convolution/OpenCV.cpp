@@ -42,9 +42,11 @@
 #include "cedar/auxiliaries/kernel/Separable.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/casts.h"
+#include "cedar/auxiliaries/ThreadPool.h"
 
 
 // SYSTEM INCLUDES
+#include <algorithm>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register type with the factory
@@ -55,6 +57,225 @@ namespace
     = cedar::aux::conv::EngineManagerSingleton::getInstance()->registerType<cedar::aux::conv::OpenCVPtr>();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// n-dimensional separable convolution
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  //! Minimal number of multiply-adds per task when a pass is split across the thread pool.
+  const size_t SEPARABLE_MIN_WORK_PER_TASK = 65536;
+
+  //! Number of contiguous elements processed together, so that the rows summed up in one pass stay in the cache.
+  const int SEPARABLE_BLOCK_SIZE = 512;
+
+  /*!@brief Maps an index that lies outside of [0, size) into this range according to the border type.
+   *
+   * @returns The mapped index, or -1 if the value at the index is zero.
+   */
+  inline int mapBorderIndex(int index, int size, cedar::aux::conv::BorderType::Id borderType)
+  {
+    if (index >= 0 && index < size)
+    {
+      return index;
+    }
+
+    switch (borderType)
+    {
+      case cedar::aux::conv::BorderType::Cyclic:
+        index %= size;
+        return index < 0 ? index + size : index;
+
+      case cedar::aux::conv::BorderType::Replicate:
+        return index < 0 ? 0 : size - 1;
+
+      case cedar::aux::conv::BorderType::Reflect:
+      {
+        // fedcba|abcdef|fedcba, continued periodically for kernels that are larger than the matrix
+        int period = 2 * size;
+        index %= period;
+        if (index < 0)
+        {
+          index += period;
+        }
+        return index < size ? index : period - 1 - index;
+      }
+
+      default:
+        return -1;
+    }
+  }
+
+  /*!@brief Convolves the lines [lineBegin, lineEnd) along one axis of a continuous matrix.
+   *
+   *        The matrix is viewed as an (outer x length x inner) block, where length is the size of the convolved axis.
+   *        Each line is a pair of an outer index and a block of SEPARABLE_BLOCK_SIZE inner elements. The innermost
+   *        loops run over contiguous memory so that the compiler can vectorize them.
+   *
+   * @param weights The flipped kernel, i.e., out[i] = sum_k weights[k] * in[i + k - anchor].
+   */
+  template <typename T>
+  void convolveAxis
+  (
+    const T* in,
+    T* out,
+    int length,
+    int inner,
+    const std::vector<T>& weights,
+    int anchor,
+    cedar::aux::conv::BorderType::Id borderType,
+    size_t lineBegin,
+    size_t lineEnd
+  )
+  {
+    const int kernel_size = static_cast<int>(weights.size());
+
+    if (inner == 1)
+    {
+      // the axis is contiguous: copy each line with its borders into a buffer, then slide the kernel along it
+      std::vector<T> padded(length + kernel_size - 1);
+      for (size_t line = lineBegin; line < lineEnd; ++line)
+      {
+        const T* in_line = in + line * length;
+        T* out_line = out + line * length;
+
+        for (int j = 0; j < static_cast<int>(padded.size()); ++j)
+        {
+          int source = mapBorderIndex(j - anchor, length, borderType);
+          padded[j] = source < 0 ? T(0) : in_line[source];
+        }
+
+        std::fill(out_line, out_line + length, T(0));
+        for (int k = 0; k < kernel_size; ++k)
+        {
+          const T weight = weights[k];
+          const T* shifted = padded.data() + k;
+          for (int i = 0; i < length; ++i)
+          {
+            out_line[i] += weight * shifted[i];
+          }
+        }
+      }
+    }
+    else
+    {
+      // the axis is strided: add up whole rows of inner elements, block by block
+      const size_t blocks = (inner + SEPARABLE_BLOCK_SIZE - 1) / SEPARABLE_BLOCK_SIZE;
+      for (size_t line = lineBegin; line < lineEnd; ++line)
+      {
+        const size_t outer = line / blocks;
+        const int block_begin = static_cast<int>(line % blocks) * SEPARABLE_BLOCK_SIZE;
+        const int block_end = std::min(block_begin + SEPARABLE_BLOCK_SIZE, inner);
+        const T* in_slice = in + outer * length * inner;
+        T* out_slice = out + outer * length * inner;
+
+        for (int i = 0; i < length; ++i)
+        {
+          T* out_row = out_slice + static_cast<size_t>(i) * inner;
+          std::fill(out_row + block_begin, out_row + block_end, T(0));
+          for (int k = 0; k < kernel_size; ++k)
+          {
+            int source = mapBorderIndex(i + k - anchor, length, borderType);
+            if (source < 0)
+            {
+              continue;
+            }
+            const T weight = weights[k];
+            const T* in_row = in_slice + static_cast<size_t>(source) * inner;
+            for (int j = block_begin; j < block_end; ++j)
+            {
+              out_row[j] += weight * in_row[j];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  //!@brief Convolves a continuous matrix with one kernel part per axis, one pass per axis.
+  template <typename T>
+  cv::Mat convolveSeparableTyped
+  (
+    const cv::Mat& matrix,
+    const std::vector<cv::Mat>& kernelParts,
+    const std::vector<int>& anchors,
+    cedar::aux::conv::BorderType::Id borderType
+  )
+  {
+    const int dims = matrix.dims;
+    auto thread_pool = cedar::aux::ThreadPoolSingleton::getInstance();
+
+    // each pass reads from the result of the previous one; the last pass writes the result
+    cv::Mat buffers[2];
+    cv::Mat source = matrix;
+    for (int axis = 0; axis < dims; ++axis)
+    {
+      cv::Mat& target = buffers[axis % 2];
+      target.create(dims, matrix.size, matrix.type());
+
+      const cv::Mat& part = kernelParts.at(axis);
+      std::vector<T> weights(part.total());
+      for (size_t k = 0; k < weights.size(); ++k)
+      {
+        // flipped, because OpenCV's conventions (and thus the anchors) are those of a correlation
+        weights[k] = static_cast<T>(part.at<double>(static_cast<int>(weights.size() - 1 - k)));
+      }
+
+      int length = matrix.size[axis];
+      size_t outer = 1;
+      for (int d = 0; d < axis; ++d)
+      {
+        outer *= static_cast<size_t>(matrix.size[d]);
+      }
+      int inner = 1;
+      for (int d = axis + 1; d < dims; ++d)
+      {
+        inner *= matrix.size[d];
+      }
+      size_t lines = outer;
+      if (inner > 1)
+      {
+        lines *= (inner + SEPARABLE_BLOCK_SIZE - 1) / SEPARABLE_BLOCK_SIZE;
+      }
+
+      const T* in = source.ptr<T>();
+      T* out = target.ptr<T>();
+      int anchor = anchors.at(axis);
+
+      size_t chunks = 1;
+      if (thread_pool->getNumberOfThreads() > 0)
+      {
+        size_t work = matrix.total() * weights.size();
+        chunks = std::min(std::min(static_cast<size_t>(thread_pool->getNumberOfThreads()) + 1, lines),
+                          work / SEPARABLE_MIN_WORK_PER_TASK);
+      }
+
+      if (chunks <= 1)
+      {
+        convolveAxis<T>(in, out, length, inner, weights, anchor, borderType, 0, lines);
+      }
+      else
+      {
+        std::vector<cedar::aux::ThreadPool::Task> tasks;
+        tasks.reserve(chunks);
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+          size_t begin = (lines * chunk) / chunks;
+          size_t end = (lines * (chunk + 1)) / chunks;
+          tasks.push_back([=, &weights]()
+          {
+            convolveAxis<T>(in, out, length, inner, weights, anchor, borderType, begin, end);
+          });
+        }
+        thread_pool->run(tasks);
+      }
+
+      source = target;
+    }
+
+    return source;
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -112,6 +333,27 @@ bool cedar::aux::conv::OpenCV::checkCapability
   return true;
 }
 
+bool cedar::aux::conv::OpenCV::checkKernelCapability
+     (
+       size_t matrixDim,
+       cedar::aux::kernel::ConstKernelPtr kernel,
+       cedar::aux::conv::BorderType::Id borderType,
+       cedar::aux::conv::Mode::Id mode
+     ) const
+{
+  size_t kernel_dim = kernel->getDimensionality();
+  if (matrixDim <= 2 && kernel_dim <= 2)
+  {
+    return this->checkCapability(matrixDim, kernel_dim, borderType, mode);
+  }
+
+  // the same conditions as in convolveND; a 0d kernel is a factor
+  return mode == cedar::aux::conv::Mode::Same
+         && this->checkBorderTypeCapability(borderType)
+         && boost::dynamic_pointer_cast<const cedar::aux::kernel::Separable>(kernel)
+         && (kernel_dim == matrixDim || kernel_dim == 0);
+}
+
 bool cedar::aux::conv::OpenCV::checkBorderTypeCapability
      (
        cedar::aux::conv::BorderType::Id borderType
@@ -546,6 +788,11 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
   switch(mode)
   {
     case cedar::aux::conv::Mode::Same:
+      if (cedar::aux::math::getDimensionalityOf(matrix) > 2)
+      {
+        result = this->convolveND(matrix, kernel, borderType, alternateEvenCenter);
+      }
+      else
       {
         cv::Point anchor = cv::Point(-1, -1);
         this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
@@ -614,6 +861,11 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
       for (size_t i = 0; i < kernelList->size(); ++i)
       {
         cedar::aux::kernel::ConstKernelPtr kernel = kernelList->getKernel(i);
+        if (cedar::aux::math::getDimensionalityOf(matrix) > 2)
+        {
+          result += this->convolveND(matrix, kernel, borderType, alternateEvenCenter);
+          continue;
+        }
         cv::Point anchor = cv::Point(-1, -1);
         this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
         result += this->cvConvolve(matrix, kernel, border_type, anchor);
@@ -712,6 +964,11 @@ cv::Mat cedar::aux::conv::OpenCV::convolveSeparable
   {
     case cedar::aux::conv::Mode::Same:
       {
+        if (cedar::aux::math::getDimensionalityOf(matrix) > 2)
+        {
+          return this->convolveND(matrix, kernel, borderType, alternateEvenCenter);
+        }
+
         int border_type = cedar::aux::conv::BorderType::toCvConstant(borderType);
 
         this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
@@ -752,6 +1009,88 @@ cv::Mat cedar::aux::conv::OpenCV::convolveSeparable
   }
 }
 
+cv::Mat cedar::aux::conv::OpenCV::convolveND
+        (
+          const cv::Mat& matrix,
+          cedar::aux::kernel::ConstKernelPtr kernel,
+          cedar::aux::conv::BorderType::Id borderType,
+          bool alternateEvenCenter
+        ) const
+{
+  cedar::aux::kernel::ConstSeparablePtr separable
+    = boost::dynamic_pointer_cast<const cedar::aux::kernel::Separable>(kernel);
+  if (!separable)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::UnhandledValueException,
+      "The OpenCV engine can only convolve matrices of more than two dimensions with separable kernels."
+    );
+  }
+
+  if (matrix.type() != CV_32F && matrix.type() != CV_64F)
+  {
+    CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot convolve matrices of the given type.");
+  }
+
+  QReadLocker locker(separable->getReadWriteLock());
+  const int dims = matrix.dims;
+  const size_t kernel_dim = separable->getDimensionality();
+
+  if (kernel_dim == 0)
+  {
+    // as in the lower-dimensional case, a 0d kernel is a factor
+    double factor = cedar::aux::math::getMatrixEntry<double>(separable->getKernelPart(0), 0, 0);
+    locker.unlock();
+    return matrix * factor;
+  }
+
+  if (kernel_dim != static_cast<size_t>(dims))
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::DimensionalityMismatchException,
+      "The dimensionality of the kernel does not match that of the matrix."
+    );
+  }
+
+  // the same anchor conventions as in translateAnchor, extended to all dimensions
+  const std::vector<int>& anchor_vector = separable->getAnchor();
+  std::vector<cv::Mat> parts(dims);
+  std::vector<int> anchors(dims);
+  for (int d = 0; d < dims; ++d)
+  {
+    separable->getKernelPart(d).convertTo(parts[d], CV_64F);
+    parts[d] = parts[d].reshape(1, static_cast<int>(parts[d].total()));
+
+    int size = static_cast<int>(parts[d].total());
+    if (static_cast<size_t>(d) < anchor_vector.size() || alternateEvenCenter)
+    {
+      int offset = static_cast<size_t>(d) < anchor_vector.size() ? anchor_vector.at(d) : 0;
+      anchors[d] = cedar::aux::math::saturate(size / 2 + offset, 0, size - 1);
+      if (alternateEvenCenter && size % 2 == 0 && anchors[d] > 0)
+      {
+        anchors[d] -= 1;
+      }
+    }
+    else
+    {
+      anchors[d] = size / 2;
+    }
+  }
+  locker.unlock();
+
+  cv::Mat continuous = matrix.isContinuous() ? matrix : matrix.clone();
+  if (matrix.type() == CV_32F)
+  {
+    return convolveSeparableTyped<float>(continuous, parts, anchors, borderType);
+  }
+  else
+  {
+    return convolveSeparableTyped<double>(continuous, parts, anchors, borderType);
+  }
+}
+
 cv::Mat cedar::aux::conv::OpenCV::cvConvolve
 (
   const cv::Mat& matrix,
@@ -818,53 +1157,14 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
     case 2:
     {
       CEDAR_DEBUG_ASSERT(kernel->kernelPartCount() == 2);
-      const cv::Mat& kernel_mat_x = kernel->getKernelPart(1);
-      const cv::Mat& kernel_mat_y = kernel->getKernelPart(0);
-
-      cv::Mat flipped_kernel_mat_x, flipped_kernel_mat_y;
-      cv::flip(kernel_mat_x, flipped_kernel_mat_x, -1);
-      cv::flip(kernel_mat_y, flipped_kernel_mat_y, -1);
-
-
-      if (cvBorderType != cv::BORDER_WRAP)
-      {
-        cv::sepFilter2D
-        (
-          matrix,
-          convolved,
-          -1,
-          flipped_kernel_mat_x,
-          flipped_kernel_mat_y,
-          anchor,
-          0,
-          cvBorderType
-        );
-      }
-      else
-      {
-        cv::Mat modified;
-        int height = static_cast<int>(cedar::aux::math::get1DMatrixSize(flipped_kernel_mat_x));
-        int width = static_cast<int>(cedar::aux::math::get1DMatrixSize(flipped_kernel_mat_y));
-        int dh = height / 2;
-        int dw = width / 2;
-
-        // height - dh makes sure that in uneven cases, padding is not too small or too large
-        cv::copyMakeBorder(matrix, modified, dh, height - dh, dw, width - dw, cv::BORDER_WRAP);
-        cv::sepFilter2D
-        (
-          modified,
-          convolved,
-          -1,
-          flipped_kernel_mat_x,
-          flipped_kernel_mat_y,
-          anchor,
-          0,
-          cv::BORDER_DEFAULT
-        );
-        convolved = convolved(cv::Range(dh, dh + matrix.rows), cv::Range(dw, dw + matrix.cols));
-      }
-
-
+      convolved = this->cvConvolveSeparable
+                  (
+                    matrix,
+                    kernel->getKernelPart(0),
+                    kernel->getKernelPart(1),
+                    cvBorderType,
+                    anchor
+                  );
       break;
     }
 
@@ -877,6 +1177,117 @@ cv::Mat cedar::aux::conv::OpenCV::cvConvolve
   return convolved;
 }
 
+cv::Mat cedar::aux::conv::OpenCV::cvConvolveSeparable
+        (
+          const cv::Mat& matrix,
+          const cv::Mat& kernelY,
+          const cv::Mat& kernelX,
+          int cvBorderType,
+          const cv::Point& anchor
+        ) const
+{
+  cv::Mat convolved;
+  cv::Mat flipped_kernel_mat_x, flipped_kernel_mat_y;
+  cv::flip(kernelX, flipped_kernel_mat_x, -1);
+  cv::flip(kernelY, flipped_kernel_mat_y, -1);
+
+  if (cvBorderType != cv::BORDER_WRAP)
+  {
+    cv::sepFilter2D
+    (
+      matrix,
+      convolved,
+      -1,
+      flipped_kernel_mat_x,
+      flipped_kernel_mat_y,
+      anchor,
+      0,
+      cvBorderType
+    );
+  }
+  else
+  {
+    cv::Mat modified;
+    int height = static_cast<int>(cedar::aux::math::get1DMatrixSize(flipped_kernel_mat_y));
+    int width = static_cast<int>(cedar::aux::math::get1DMatrixSize(flipped_kernel_mat_x));
+    int dh = height / 2;
+    int dw = width / 2;
+
+    // height - dh makes sure that in uneven cases, padding is not too small or too large
+    cv::copyMakeBorder(matrix, modified, dh, height - dh, dw, width - dw, cv::BORDER_WRAP);
+    cv::sepFilter2D
+    (
+      modified,
+      convolved,
+      -1,
+      flipped_kernel_mat_x,
+      flipped_kernel_mat_y,
+      anchor,
+      0,
+      cv::BORDER_DEFAULT
+    );
+    convolved = convolved(cv::Range(dh, dh + matrix.rows), cv::Range(dw, dw + matrix.cols));
+  }
+
+  return convolved;
+}
+
+cv::Mat cedar::aux::conv::OpenCV::convolveFused
+        (
+          const cv::Mat& matrix,
+          const std::vector<cedar::aux::conv::KernelList::FusedTerm>& terms,
+          int cvBorderType,
+          bool alternateEvenCenter
+        ) const
+{
+  cv::Mat result;
+  for (const auto& term : terms)
+  {
+    cv::Mat convolved;
+    cv::Point anchor = cv::Point(-1, -1);
+    if (term.mKernel.empty())
+    {
+      std::vector<int> sizes(2);
+      sizes[0] = static_cast<int>(term.mColumn.total());
+      sizes[1] = static_cast<int>(term.mRow.total());
+      this->translateAnchor(anchor, std::vector<int>(), sizes, alternateEvenCenter);
+      convolved = this->cvConvolveSeparable(matrix, term.mColumn, term.mRow, cvBorderType, anchor);
+    }
+    else if (cedar::aux::math::getDimensionalityOf(term.mKernel) == 1)
+    {
+      // the same anchor and orientation handling as for 1d separable kernels
+      cv::Mat kernel_mat = term.mKernel;
+      std::vector<int> sizes(1, static_cast<int>(kernel_mat.total()));
+      this->translateAnchor(anchor, std::vector<int>(), sizes, alternateEvenCenter);
+      if (kernel_mat.rows == 1)
+      {
+        std::swap(anchor.x, anchor.y);
+      }
+      if ((matrix.rows == 1 && kernel_mat.rows != 1) || (matrix.cols == 1 && kernel_mat.cols != 1))
+      {
+        kernel_mat = kernel_mat.t();
+        std::swap(anchor.x, anchor.y);
+      }
+      convolved = this->cvConvolve(matrix, kernel_mat, cvBorderType, anchor);
+    }
+    else
+    {
+      this->translateAnchor(anchor, std::vector<int>(), term.mKernel.size, alternateEvenCenter);
+      convolved = this->cvConvolve(matrix, term.mKernel, cvBorderType, anchor);
+    }
+
+    if (result.empty())
+    {
+      result = convolved;
+    }
+    else
+    {
+      result += convolved;
+    }
+  }
+  return result;
+}
+
 cv::Mat cedar::aux::conv::OpenCV::convolve
         (
           const cv::Mat& matrix,
@@ -900,6 +1311,21 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
   {
     case cedar::aux::conv::Mode::Same:
       {
+        // if the kernels can be fused into fewer separable terms, convolve with those instead of each kernel
+        if (cedar::aux::math::getDimensionalityOf(matrix) <= 2)
+        {
+          std::vector<cedar::aux::conv::KernelList::FusedTerm> fused = this->getKernelList()->getFusedKernel();
+          if
+          (
+            !fused.empty()
+            && (fused.front().mKernel.empty() ? 2u : cedar::aux::math::getDimensionalityOf(fused.front().mKernel))
+               == cedar::aux::math::getDimensionalityOf(matrix)
+          )
+          {
+            return this->convolveFused(matrix, fused, cv_border_type, alternateEvenCenter);
+          }
+        }
+
         cv::Mat result = 0.0 * matrix;
         for (size_t i = 0; i < this->getKernelList()->size(); ++i)
         {
@@ -917,6 +1343,12 @@ cv::Mat cedar::aux::conv::OpenCV::convolve
                     this->getKernelList()->getKernel(i)
                   );
 
+              if (cedar::aux::math::getDimensionalityOf(matrix) > 2)
+              {
+                convolved = this->convolveND(matrix, kernel, borderType, alternateEvenCenter);
+                break;
+              }
+
               cv::Point anchor = cv::Point(-1, -1);
               this->translateAnchor(anchor, kernel, matrix, alternateEvenCenter);
 
@@ -135,6 +135,18 @@ public:
     cedar::aux::conv::Mode::Id mode
   ) const;
 
+  /*!@brief Also accepts matrices of more than two dimensions if the kernel is separable.
+   *
+   *        Such matrices are convolved axis by axis, which is only implemented for the same mode.
+   */
+  bool checkKernelCapability
+  (
+    size_t matrixDim,
+    cedar::aux::kernel::ConstKernelPtr kernel,
+    cedar::aux::conv::BorderType::Id borderType,
+    cedar::aux::conv::Mode::Id mode
+  ) const;
+
   bool checkBorderTypeCapability
   (
     cedar::aux::conv::BorderType::Id borderType
@@ -248,6 +260,39 @@ private:
 
   cv::Mat cutOutResult(const cv::Mat& result, const cedar::aux::kernel::ConstKernelPtr kernel) const;
 
+  /*!@brief Convolves a matrix with a 2D separable kernel given by its column part (kernelY) and row part (kernelX).
+   */
+  cv::Mat cvConvolveSeparable
+  (
+    const cv::Mat& matrix,
+    const cv::Mat& kernelY,
+    const cv::Mat& kernelX,
+    int cvBorderType,
+    const cv::Point& anchor
+  ) const;
+
+  //!@brief Convolves a matrix with the sum of the given terms of a fused kernel in Same mode.
+  cv::Mat convolveFused
+  (
+    const cv::Mat& matrix,
+    const std::vector<cedar::aux::conv::KernelList::FusedTerm>& terms,
+    int cvBorderType,
+    bool alternateEvenCenter
+  ) const;
+
+  /*!@brief Convolves a matrix of more than two dimensions with a separable kernel in Same mode.
+   *
+   *        The matrix is convolved with one kernel part per axis; each of these passes is split across the global
+   *        thread pool for large matrices.
+   */
+  cv::Mat convolveND
+  (
+    const cv::Mat& matrix,
+    cedar::aux::kernel::ConstKernelPtr kernel,
+    cedar::aux::conv::BorderType::Id borderType,
+    bool alternateEvenCenter
+  ) const;
+
   cv::Mat cvConvolve
   (
     const cv::Mat& matrix,
@@ -48,6 +48,156 @@
 #include <algorithm>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/posix_time/posix_time_io.hpp>
+#ifdef CEDAR_OS_LINUX
+  #include <pthread.h>
+  #include <sched.h>
+  #include <time.h>
+  #include <cerrno>
+  #include <cstring>
+#endif // CEDAR_OS_LINUX
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+#ifndef CEDAR_COMPILER_MSVC
+const unsigned int cedar::aux::detail::LoopedThreadWorker::WAKEUP_LATENCY_BINS;
+const long long cedar::aux::detail::LoopedThreadWorker::WAKEUP_LATENCY_BIN_WIDTH_NS;
+#endif // CEDAR_COMPILER_MSVC
+
+//----------------------------------------------------------------------------------------------------------------------
+// local helpers
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+#ifdef CEDAR_OS_LINUX
+  //! Returns the current time of the monotonic clock in nanoseconds.
+  inline long long monotonicNanoseconds()
+  {
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<long long>(now.tv_sec) * 1000000000LL + static_cast<long long>(now.tv_nsec);
+  }
+
+  //! Sleeps until the monotonic clock reaches the given time; returns immediately if it already passed.
+  inline void sleepUntil(long long deadline)
+  {
+    timespec wakeup;
+    wakeup.tv_sec = static_cast<time_t>(deadline / 1000000000LL);
+    wakeup.tv_nsec = static_cast<long>(deadline % 1000000000LL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeup, nullptr) == EINTR)
+    {
+    }
+  }
+#endif // CEDAR_OS_LINUX
+
+  /*! Pins the calling thread to a CPU and/or gives it a SCHED_FIFO priority for its lifetime and restores the previous
+   *  settings afterwards, as the worker's thread may be reused.
+   */
+  class SchedulingGuard
+  {
+  public:
+    SchedulingGuard(int cpu, unsigned int priority)
+    :
+    mAffinityChanged(false),
+    mPolicyChanged(false)
+    {
+      if (cpu < 0 && priority == 0)
+      {
+        return;
+      }
+
+#ifdef CEDAR_OS_LINUX
+      pthread_t thread = pthread_self();
+
+      if (cpu >= 0)
+      {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        int result = pthread_getaffinity_np(thread, sizeof(cpu_set_t), &mPreviousAffinity);
+        if (result == 0)
+        {
+          result = pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpus);
+        }
+
+        if (result == 0)
+        {
+          mAffinityChanged = true;
+        }
+        else
+        {
+          cedar::aux::LogSingleton::getInstance()->warning
+          (
+            "Could not pin the thread to CPU " + cedar::aux::toString(cpu) + ": " + std::strerror(result),
+            "cedar::aux::LoopedThread::run()"
+          );
+        }
+      }
+
+      if (priority > 0)
+      {
+        sched_param parameters;
+        parameters.sched_priority = static_cast<int>(priority);
+        int result = pthread_getschedparam(thread, &mPreviousPolicy, &mPreviousParameters);
+        if (result == 0)
+        {
+          result = pthread_setschedparam(thread, SCHED_FIFO, &parameters);
+        }
+
+        if (result == 0)
+        {
+          mPolicyChanged = true;
+        }
+        else
+        {
+          cedar::aux::LogSingleton::getInstance()->warning
+          (
+            "Could not set the real-time priority " + cedar::aux::toString(priority) + ": " + std::strerror(result)
+              + ". The thread runs with its normal priority; real-time priorities usually require an rtprio limit.",
+            "cedar::aux::LoopedThread::run()"
+          );
+        }
+      }
+#else
+      cedar::aux::LogSingleton::getInstance()->warning
+      (
+        "CPU affinity and real-time priorities of looped threads are only supported on Linux; ignoring them.",
+        "cedar::aux::LoopedThread::run()"
+      );
+#endif // CEDAR_OS_LINUX
+    }
+
+    ~SchedulingGuard()
+    {
+#ifdef CEDAR_OS_LINUX
+      pthread_t thread = pthread_self();
+      if (mPolicyChanged)
+      {
+        pthread_setschedparam(thread, mPreviousPolicy, &mPreviousParameters);
+      }
+      if (mAffinityChanged)
+      {
+        pthread_setaffinity_np(thread, sizeof(cpu_set_t), &mPreviousAffinity);
+      }
+#endif // CEDAR_OS_LINUX
+    }
+
+  private:
+    bool mAffinityChanged;
+    bool mPolicyChanged;
+#ifdef CEDAR_OS_LINUX
+    cpu_set_t mPreviousAffinity;
+    int mPreviousPolicy;
+    sched_param mPreviousParameters;
+#endif // CEDAR_OS_LINUX
+  };
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
 
 
 cedar::aux::detail::LoopedThreadWorker::LoopedThreadWorker(cedar::aux::LoopedThread *wrapper) 
@@ -83,6 +233,9 @@ void cedar::aux::detail::LoopedThreadWorker::work()
     = boost::posix_time::microseconds(static_cast<unsigned int>(1000.0 * (mpWrapper->getStepSize()/cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second)) + 0.5));//mStepSize;
   initStatistics();
 
+  // pin the thread and raise its priority until the loop ends
+  SchedulingGuard scheduling(mpWrapper->getCPUAffinity(), mpWrapper->getRealTimePriority());
+
   // which mode?
   const auto loop_mode= mpWrapper->getLoopModeParameter(); 
   switch (loop_mode)
@@ -284,6 +437,21 @@ void cedar::aux::detail::LoopedThreadWorker::work()
     {
       // ALL NEW LOOP MODES HERE, share as much code as possible:
 
+      // a step size of zero means "as fast as possible", so there are no deadlines to keep
+      if (mpWrapper->usesPreciseTiming() && orig_step_size > boost::posix_time::time_duration())
+      {
+#ifdef CEDAR_OS_LINUX
+        this->workPrecise(loop_mode, orig_step_size);
+        break;
+#else
+        cedar::aux::LogSingleton::getInstance()->warning
+        (
+          "Precise timing is only supported on Linux; using the normal timing instead.",
+          "cedar::aux::LoopedThread::run()"
+        );
+#endif // CEDAR_OS_LINUX
+      }
+
       this->initRngs();
 
       QWriteLocker locker(&mLastTimeStepEndLock); // lock once for loop, only
@@ -373,6 +541,8 @@ void cedar::aux::detail::LoopedThreadWorker::work()
 
         auto current_time_after_sleep= boost::posix_time::microsec_clock::universal_time();
 
+        this->recordWakeupLatency(1000LL * (current_time_after_sleep - scheduled_wakeup).total_microseconds());
+
         mLastTimeStepStart= mLastTimeStepEnd;
         mLastTimeStepEnd= current_time_after_sleep;
 
@@ -482,6 +652,113 @@ void cedar::aux::detail::LoopedThreadWorker::work()
   return;
 }
 
+#ifdef CEDAR_OS_LINUX
+void cedar::aux::detail::LoopedThreadWorker::workPrecise
+(
+  const cedar::aux::Enum& loopMode,
+  const boost::posix_time::time_duration& stepSize
+)
+{
+  this->initRngs();
+
+  const long long period = 1000LL * stepSize.total_microseconds();
+  CEDAR_ASSERT(period > 0);
+  const long long spin_time = static_cast<long long>
+                              (
+                                mpWrapper->getSpinTime() / cedar::unit::Time(1.0 * cedar::unit::nano * cedar::unit::seconds)
+                                + 0.5
+                              );
+  auto fake_step_size = mpWrapper->getFakeStepSize();
+
+  long long last_wakeup = monotonicNanoseconds();
+  long long scheduled_wakeup = last_wakeup + period;
+  long long last_time_locked_vars_checked = last_wakeup;
+
+  setLastTimeStepStart(boost::posix_time::microsec_clock::universal_time());
+  setLastTimeStepEnd(getLastTimeStepStart());
+
+  while (!safeStopRequested())
+  {
+    // sleep until shortly before the deadline, then spin for the rest
+    sleepUntil(scheduled_wakeup - spin_time);
+    long long now = monotonicNanoseconds();
+    while (now < scheduled_wakeup)
+    {
+      now = monotonicNanoseconds();
+    }
+
+    if (safeStopRequested())
+    {
+      break;
+    }
+
+    this->recordWakeupLatency(now - scheduled_wakeup);
+
+    setLastTimeStepStart(getLastTimeStepEnd());
+    setLastTimeStepEnd(boost::posix_time::microsec_clock::universal_time());
+
+    if (loopMode == cedar::aux::LoopMode::FakeDT)
+    {
+      // the fake step size may change while running; checking it twice a second is enough
+      if (now - last_time_locked_vars_checked > 500000000LL)
+      {
+        fake_step_size = mpWrapper->getFakeStepSize();
+        last_time_locked_vars_checked = now;
+      }
+      mpWrapper->step(fake_step_size);
+    }
+    else
+    {
+      mpWrapper->step(cedar::unit::Time(static_cast<double>(now - last_wakeup) * cedar::unit::nano * cedar::unit::seconds));
+    }
+    last_wakeup = now;
+
+    if (safeStopRequested())
+    {
+      break;
+    }
+
+    // stay on the grid of the first deadline so that the phase of the loop does not drift; deadlines that already
+    // passed while stepping are skipped
+    scheduled_wakeup += period;
+    long long steps_missed = 0;
+    long long after_step = monotonicNanoseconds();
+    if (scheduled_wakeup < after_step)
+    {
+      steps_missed = (after_step - scheduled_wakeup) / period + 1;
+      scheduled_wakeup += steps_missed * period;
+    }
+
+    updateStatistics(static_cast<double>(steps_missed + 1));
+  }
+}
+#endif // CEDAR_OS_LINUX
+
+void cedar::aux::detail::LoopedThreadWorker::recordWakeupLatency(long long latency)
+{
+  latency = std::max<long long>(0, latency);
+  size_t bin = static_cast<size_t>
+               (
+                 std::min<long long>(latency / WAKEUP_LATENCY_BIN_WIDTH_NS, WAKEUP_LATENCY_BINS - 1)
+               );
+
+  QWriteLocker locker(&mWakeupLatencyLock);
+  ++mWakeupLatencyHistogram[bin];
+  mMaxWakeupLatency = std::max(mMaxWakeupLatency, latency);
+}
+
+std::vector<unsigned long> cedar::aux::detail::LoopedThreadWorker::getWakeupLatencyHistogram() const
+{
+  QReadLocker locker(&mWakeupLatencyLock);
+  return mWakeupLatencyHistogram;
+}
+
+long long cedar::aux::detail::LoopedThreadWorker::getMaximumWakeupLatency() const
+{
+  QReadLocker locker(&mWakeupLatencyLock);
+  return mMaxWakeupLatency;
+}
+
 void cedar::aux::detail::LoopedThreadWorker::initRngs()
 {
   auto seed = boost::posix_time::microsec_clock::universal_time().time_of_day().total_milliseconds();
@@ -498,6 +775,10 @@ void cedar::aux::detail::LoopedThreadWorker::initStatistics()
   mNumberOfSteps = 0;
   mSumOfStepsTaken = 0.0;
   mMaxStepsTaken = 0.0;
+
+  QWriteLocker locker4(&mWakeupLatencyLock);
+  mWakeupLatencyHistogram.assign(WAKEUP_LATENCY_BINS, 0);
+  mMaxWakeupLatency = 0;
 }
 
 void cedar::aux::detail::LoopedThreadWorker::updateStatistics(double stepsTaken)
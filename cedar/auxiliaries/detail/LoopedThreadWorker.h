@@ -58,6 +58,7 @@
 #include <string>
 #include <iostream>
 #include <QThread>
+#include <vector>
 #ifndef Q_MOC_RUN
   #include <boost/date_time/posix_time/posix_time_types.hpp>
 #endif
@@ -65,6 +66,12 @@
 //! the corresponding worker class for the LoopedThread class
 class cedar::aux::detail::LoopedThreadWorker : public cedar::aux::detail::ThreadWorker
 {
+  public:
+    //! number of bins of the wakeup latency histogram
+    static const unsigned int WAKEUP_LATENCY_BINS = 100;
+    //! width of one bin of the wakeup latency histogram, in nanoseconds
+    static const long long WAKEUP_LATENCY_BIN_WIDTH_NS = 10000;
+
   public: 
     //! constructor
     explicit LoopedThreadWorker(cedar::aux::LoopedThread* wrapper);
@@ -94,6 +101,12 @@ class cedar::aux::detail::LoopedThreadWorker : public cedar::aux::detail::Thread
     //! initializes the rngs
     void initRngs();
 
+    //! adds a wakeup that was the given number of nanoseconds late to the latency histogram
+    void recordWakeupLatency(long long latency);
+
+    //! loop of the real and fake deltaT modes that sleeps until absolute deadlines on the monotonic clock
+    void workPrecise(const cedar::aux::Enum& loopMode, const boost::posix_time::time_duration& stepSize);
+
 
   public:
     //! overwritten method that does the actual work
@@ -127,6 +140,12 @@ class cedar::aux::detail::LoopedThreadWorker : public cedar::aux::detail::Thread
     //! Return the number of steps missed
     double getSumOfStepsMissed();
 
+    //! Return the number of wakeups per latency bin
+    std::vector<unsigned long> getWakeupLatencyHistogram() const;
+
+    //! Return the largest wakeup latency in nanoseconds
+    long long getMaximumWakeupLatency() const;
+
   private:
     void globalTimeFactorChanged(double newFactor);
 
@@ -160,6 +179,13 @@ class cedar::aux::detail::LoopedThreadWorker : public cedar::aux::detail::Thread
     //! lock for mLastTimeStepEnd
     mutable QReadWriteLock mLastTimeStepEndLock;
 
+    //!@brief number of wakeups per latency bin since start()
+    std::vector<unsigned long> mWakeupLatencyHistogram;
+    //!@brief the largest wakeup latency since start(), in nanoseconds
+    long long mMaxWakeupLatency;
+    //! lock for mWakeupLatencyHistogram and mMaxWakeupLatency
+    mutable QReadWriteLock mWakeupLatencyLock;
+
     boost::signals2::scoped_connection mGlobalTimeFactorConnection;
 
     bool mDebugMe;
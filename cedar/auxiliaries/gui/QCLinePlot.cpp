@@ -307,8 +307,10 @@ void cedar::aux::gui::QCLinePlot::timerEvent(QTimerEvent * /* pEvent */)
   {
     if(auto matData = boost::dynamic_pointer_cast<const cedar::aux::MatData>(PlotSeriesDataVector.at(i)))
     {
-      QReadLocker locker2(&matData->getLock());
-      const cv::Mat& plotMat = matData->getData();
+      // double-buffered data is read from its front buffer, which needs no lock
+      cedar::aux::MatData::ConstMatPtr front = matData->getFront();
+      QReadLocker locker2(front ? nullptr : &matData->getLock());
+      const cv::Mat& plotMat = front ? *front : matData->getData();
 
       auto dim = cedar::aux::math::getDimensionalityOf(plotMat);
       if (dim != 1) // plot is no longer capable of displaying the data
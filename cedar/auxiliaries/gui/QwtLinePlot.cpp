@@ -736,8 +736,10 @@ void cedar::aux::gui::detail::QwtLinePlotWorker::convert()
   {
     cedar::aux::gui::QwtLinePlot::PlotSeriesPtr series = this->mpPlot->mPlotSeriesVector.at(series_index);
 
-    QReadLocker locker(&series->mMatData->getLock());
-    const cv::Mat& mat = series->mMatData->getData();
+    // double-buffered data is read from its front buffer, which needs no lock
+    cedar::aux::MatData::ConstMatPtr front = series->mMatData->getFront();
+    QReadLocker locker(front ? nullptr : &series->mMatData->getLock());
+    const cv::Mat& mat = front ? *front : series->mMatData->getData();
     auto dim = cedar::aux::math::getDimensionalityOf(mat);
     if (dim != 1) // plot is no longer capable of displaying the data
     {
@@ -39,11 +39,13 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/Configurable.h"
+#include "cedar/auxiliaries/exceptions.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/math/TransferFunction.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
 
 /*!@brief Basic interface for all TransferFunction functions.
  */
@@ -99,22 +101,82 @@ public:
 
   /*!@brief Computes the transfer function for each element in the matrix.
    *
-   * @remarks The default implementation iterates over the matrix and calls the other compute function. Override this in
-   *          the child classes to increase performance.
+   * @remarks The default implementation allocates a new matrix and passes it to compute(const cv::Mat&, cv::Mat&).
    */
   virtual cv::Mat compute(const cv::Mat& values) const;
 
+  /*!@brief Computes the transfer function for each element of in and writes the results to out.
+   *
+   *        out is only reallocated if its size or type differs from that of in, i.e., passing the same output matrix in
+   *        every call does not allocate any memory. in and out may be the same matrix.
+   *
+   * @remarks The default implementation iterates over the matrix and calls compute(double) for each element. Override
+   *          this in the child classes to increase performance.
+   */
+  virtual void compute(const cv::Mat& in, cv::Mat& out) const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  // none yet
+  /*!@brief Applies function to each element of in and writes the results to out.
+   *
+   *        The function is called with float values for CV_32F and with double values for CV_64F matrices and should
+   *        return the same type. It is applied in tight loops over the contiguous planes of the matrices, so a
+   *        branch-free function that does not call any virtual methods gets vectorized by the compiler.
+   */
+  template <typename Function>
+  static void applyElementwise(const cv::Mat& in, cv::Mat& out, const Function& function)
+  {
+    if (in.empty())
+    {
+      out = cv::Mat();
+      return;
+    }
+
+    switch (in.type())
+    {
+      case CV_32F:
+        applyElementwiseTyped<float>(in, out, function);
+        break;
+
+      case CV_64F:
+        applyElementwiseTyped<double>(in, out, function);
+        break;
+
+      default:
+        CEDAR_THROW
+        (
+          cedar::aux::NotImplementedException,
+          "This transfer function is not implemented for non-floating data types."
+        );
+    }
+  }
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  // none yet
+  //! Applies the function to each element, assuming that the matrix has the element type T.
+  template <typename T, typename Function>
+  static void applyElementwiseTyped(const cv::Mat& in, cv::Mat& out, const Function& function)
+  {
+    out.create(in.dims, in.size, in.type());
+
+    const cv::Mat* arrays[] = {&in, &out, nullptr};
+    uchar* planes[2];
+    cv::NAryMatIterator iterator(arrays, planes, 2);
+    const size_t plane_size = static_cast<size_t>(iterator.size);
+    for (size_t plane = 0; plane < iterator.nplanes; ++plane, ++iterator)
+    {
+      const T* source = reinterpret_cast<const T*>(planes[0]);
+      T* destination = reinterpret_cast<T*>(planes[1]);
+      for (size_t i = 0; i < plane_size; ++i)
+      {
+        destination[i] = function(source[i]);
+      }
+    }
+  }
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
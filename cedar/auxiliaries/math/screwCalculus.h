@@ -49,6 +49,7 @@
 
 // SYSTEM INCLUDES
 #include <opencv2/opencv.hpp>
+#include <cmath>
 
 namespace cedar
 {
@@ -754,6 +755,129 @@ namespace cedar
             CEDAR_THROW(cedar::aux::UnhandledTypeException, "This function can only be called with CV_32F or CV_64F matrices.");
         }
       }
+
+      //----------------------------------------------------------------------------------------------------------------
+      // fixed-size versions
+      //----------------------------------------------------------------------------------------------------------------
+
+      // The following functions work on stack-allocated matrices and never allocate memory. Twist coordinates are
+      // stored as (v, omega), like in the cv::Mat versions above.
+
+      /*! @brief wedge-operator for twists, fixed-size version of wedgeTwist(const cv::Mat&, cv::Mat&)
+       * @param[in] rTwist twist coordinates
+       * @param[out] rResult twist matrix
+       */
+      template<typename T>
+      inline void wedgeTwist(const cv::Vec<T, 6>& rTwist, cv::Matx<T, 4, 4>& rResult)
+      {
+        rResult = cv::Matx<T, 4, 4>
+                  (
+                    0, -rTwist[5], rTwist[4], rTwist[0],
+                    rTwist[5], 0, -rTwist[3], rTwist[1],
+                    -rTwist[4], rTwist[3], 0, rTwist[2],
+                    0, 0, 0, 0
+                  );
+      }
+
+      /*! @brief vee-operator for twists, fixed-size version of veeTwist(const cv::Mat&, cv::Mat&)
+       * @param[in] rMatrix twist matrix
+       * @param[out] rResult twist coordinates
+       */
+      template<typename T>
+      inline void veeTwist(const cv::Matx<T, 4, 4>& rMatrix, cv::Vec<T, 6>& rResult)
+      {
+        rResult = cv::Vec<T, 6>(rMatrix(0, 3), rMatrix(1, 3), rMatrix(2, 3), rMatrix(2, 1), rMatrix(0, 2), rMatrix(1, 0));
+      }
+
+      /*! @brief exponential map exp: se(3) -> SE(3), fixed-size version of expTwist(const cv::Mat&, double, cv::Mat&)
+       * @param[in] rXi twist coordinates
+       * @param[in] theta angle of rotation
+       * @param[out] rResult rigid transformation matrix
+       */
+      template<typename T>
+      inline void expTwist(const cv::Vec<T, 6>& rXi, T theta, cv::Matx<T, 4, 4>& rResult)
+      {
+        const cv::Vec<T, 3> v(rXi[0], rXi[1], rXi[2]);
+        const cv::Vec<T, 3> omega(rXi[3], rXi[4], rXi[5]);
+
+        // rotation (Rodrigues' formula)
+        const cv::Matx<T, 3, 3> omega_wedge(0, -omega[2], omega[1], omega[2], 0, -omega[0], -omega[1], omega[0], 0);
+        const cv::Matx<T, 3, 3> R = cv::Matx<T, 3, 3>::eye()
+                                    + omega_wedge * static_cast<T>(std::sin(theta))
+                                    + omega_wedge * omega_wedge * static_cast<T>(1 - std::cos(theta));
+
+        // translation
+        cv::Vec<T, 3> p;
+        if (omega.dot(omega) == 0) // pure translation
+        {
+          p = v * theta;
+        }
+        else // translation and rotation
+        {
+          p = (cv::Matx<T, 3, 3>::eye() - R) * omega.cross(v) + omega * (omega.dot(v) * theta);
+        }
+
+        rResult = cv::Matx<T, 4, 4>
+                  (
+                    R(0, 0), R(0, 1), R(0, 2), p[0],
+                    R(1, 0), R(1, 1), R(1, 2), p[1],
+                    R(2, 0), R(2, 1), R(2, 2), p[2],
+                    0, 0, 0, 1
+                  );
+      }
+
+      /*! @brief creates the adjoint transformation corresponding to a rigid transformation, fixed-size version of
+       * rigidToAdjointTransformation(const cv::Mat&, cv::Mat&)
+       * @param[in] rRigidTransformation rigid transformation matrix
+       * @param[out] rAdjointTransformation adjoint transformation matrix
+       */
+      template<typename T>
+      inline void rigidToAdjointTransformation
+      (
+        const cv::Matx<T, 4, 4>& rRigidTransformation,
+        cv::Matx<T, 6, 6>& rAdjointTransformation
+      )
+      {
+        const cv::Matx<T, 3, 3> rot = rRigidTransformation.template get_minor<3, 3>(0, 0);
+        const T x = rRigidTransformation(0, 3);
+        const T y = rRigidTransformation(1, 3);
+        const T z = rRigidTransformation(2, 3);
+        const cv::Matx<T, 3, 3> pos_wedge_times_rot = cv::Matx<T, 3, 3>(0, -z, y, z, 0, -x, -y, x, 0) * rot;
+
+        rAdjointTransformation = cv::Matx<T, 6, 6>::zeros();
+        for (int row = 0; row < 3; ++row)
+        {
+          for (int col = 0; col < 3; ++col)
+          {
+            rAdjointTransformation(row, col) = rot(row, col);
+            rAdjointTransformation(row, col + 3) = pos_wedge_times_rot(row, col);
+            rAdjointTransformation(row + 3, col + 3) = rot(row, col);
+          }
+        }
+      }
+
+      /*! @brief applies the adjoint of a rigid transformation to a twist without forming the adjoint matrix
+       *
+       * Equivalent to rigidToAdjointTransformation(rRigidTransformation) * rTwist.
+       * @param[in] rRigidTransformation rigid transformation matrix
+       * @param[in] rTwist twist coordinates
+       * @param[out] rResult transformed twist coordinates
+       */
+      template<typename T>
+      inline void transformTwist
+      (
+        const cv::Matx<T, 4, 4>& rRigidTransformation,
+        const cv::Vec<T, 6>& rTwist,
+        cv::Vec<T, 6>& rResult
+      )
+      {
+        const cv::Matx<T, 3, 3> rot = rRigidTransformation.template get_minor<3, 3>(0, 0);
+        const cv::Vec<T, 3> pos(rRigidTransformation(0, 3), rRigidTransformation(1, 3), rRigidTransformation(2, 3));
+        const cv::Vec<T, 3> rot_v = rot * cv::Vec<T, 3>(rTwist[0], rTwist[1], rTwist[2]);
+        const cv::Vec<T, 3> rot_omega = rot * cv::Vec<T, 3>(rTwist[3], rTwist[4], rTwist[5]);
+        const cv::Vec<T, 3> v = rot_v + pos.cross(rot_omega);
+        rResult = cv::Vec<T, 6>(v[0], v[1], v[2], rot_omega[0], rot_omega[1], rot_omega[2]);
+      }
     }
   }
 }
@@ -41,6 +41,7 @@
 #include "cedar/auxiliaries/Singleton.h"
 
 // SYSTEM INCLUDES
+#include <cmath>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register class with the sigmoid factory manager
@@ -73,7 +74,14 @@ double cedar::aux::math::AbsSigmoid::compute(double value) const
   return cedar::aux::math::sigmoidAbs(value, _mBeta->getValue(), this->mThreshold->getValue());
 }
 
-cv::Mat cedar::aux::math::AbsSigmoid::compute(const cv::Mat& values) const
+void cedar::aux::math::AbsSigmoid::compute(const cv::Mat& in, cv::Mat& out) const
 {
-  return sigmoidAbs(values, this->_mBeta->getValue(), this->mThreshold->getValue());
+  const double beta = this->getBeta();
+  const double threshold = this->getThreshold();
+  applyElementwise(in, out, [beta, threshold](auto value)
+  {
+    typedef decltype(value) T;
+    T shifted = static_cast<T>(beta) * (value - static_cast<T>(threshold));
+    return static_cast<T>(0.5) * (static_cast<T>(1) + shifted / (static_cast<T>(1) + std::abs(shifted)));
+  });
 }
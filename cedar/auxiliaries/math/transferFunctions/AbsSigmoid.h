@@ -76,12 +76,14 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
+  using cedar::aux::math::TransferFunction::compute;
+
   /*!@brief this function calculates the abs-based sigmoid function for a given double value.
    */
   virtual double compute(double value) const;
 
-  //! Overriden for efficiency.
-  virtual cv::Mat compute(const cv::Mat& values) const;
+  //! Overridden for efficiency.
+  virtual void compute(const cv::Mat& in, cv::Mat& out) const;
 
   //! Returns the beta (slope) of the sigmoid.
   inline double getBeta() const
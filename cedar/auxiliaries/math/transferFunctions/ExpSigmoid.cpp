@@ -41,6 +41,7 @@
 #include "cedar/auxiliaries/Singleton.h"
 
 // SYSTEM INCLUDES
+#include <cmath>
 
 //----------------------------------------------------------------------------------------------------------------------
 // register class with the sigmoid factory manager
@@ -70,3 +71,14 @@ double cedar::aux::math::ExpSigmoid::compute(double value) const
 {
   return cedar::aux::math::sigmoidExp(value, _mBeta->getValue(), this->getThreshold());
 }
+
+void cedar::aux::math::ExpSigmoid::compute(const cv::Mat& in, cv::Mat& out) const
+{
+  const double beta = this->_mBeta->getValue();
+  const double threshold = this->getThreshold();
+  applyElementwise(in, out, [beta, threshold](auto value)
+  {
+    typedef decltype(value) T;
+    return static_cast<T>(1) / (static_cast<T>(1) + std::exp(-static_cast<T>(beta) * (value - static_cast<T>(threshold))));
+  });
+}
@@ -63,3 +63,14 @@ double cedar::aux::math::HeavisideSigmoid::compute(double value) const
 {
   return cedar::aux::math::sigmoidHeaviside(value, this->getThreshold());
 }
+
+void cedar::aux::math::HeavisideSigmoid::compute(const cv::Mat& in, cv::Mat& out) const
+{
+  const double threshold = this->getThreshold();
+  applyElementwise(in, out, [threshold](auto value)
+  {
+    typedef decltype(value) T;
+    // same as sigmoidHeaviside: values equal to the threshold are mapped to 0
+    return static_cast<T>(static_cast<double>(value) > threshold);
+  });
+}
@@ -85,10 +85,15 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
+  using cedar::aux::math::TransferFunction::compute;
+
   /*!@brief this function calculates the Heaviside function for a given double value.
    */
   virtual double compute(double value) const;
 
+  //! Overridden for efficiency.
+  virtual void compute(const cv::Mat& in, cv::Mat& out) const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
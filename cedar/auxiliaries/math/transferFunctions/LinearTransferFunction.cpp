@@ -81,3 +81,14 @@ double cedar::aux::math::LinearTransferFunction::compute(double value) const
 {
   return this->getFactor() * value + this->getOffset();
 }
+
+void cedar::aux::math::LinearTransferFunction::compute(const cv::Mat& in, cv::Mat& out) const
+{
+  const double factor = this->getFactor();
+  const double offset = this->getOffset();
+  applyElementwise(in, out, [factor, offset](auto value)
+  {
+    typedef decltype(value) T;
+    return static_cast<T>(factor) * value + static_cast<T>(offset);
+  });
+}
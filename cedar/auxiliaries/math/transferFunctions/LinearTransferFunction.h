@@ -71,10 +71,15 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
+  using cedar::aux::math::TransferFunction::compute;
+
   /*!@brief this function calculates the abs-based sigmoid function for a given double value.
    */
   virtual double compute(double value) const;
 
+  //! Overridden for efficiency.
+  virtual void compute(const cv::Mat& in, cv::Mat& out) const;
+
   //! Returns the offset of the linear function, i.e., \f$ m \f$ in \f$ f(x) = m \cdot x + b \f$.
   inline double getFactor() const
   {
@@ -79,11 +79,15 @@ double cedar::aux::math::SemiLinearTransferFunction::compute(double value) const
   return cedar::aux::math::sigmoidSemiLinear(value, this->getThreshold(), this->getBeta());
 }
 
-cv::Mat cedar::aux::math::SemiLinearTransferFunction::compute(const cv::Mat& values) const
+void cedar::aux::math::SemiLinearTransferFunction::compute(const cv::Mat& in, cv::Mat& out) const
 {
-  double beta = this->getBeta();
-  double threshold = this->getThreshold();
-  cv::Mat result = threshold + beta * values;
-  result.setTo(threshold, values < threshold);
-  return result;
+  const double beta = this->getBeta();
+  const double threshold = this->getThreshold();
+  // same results as the former matrix version, i.e., threshold + beta * value above the threshold
+  applyElementwise(in, out, [beta, threshold](auto value)
+  {
+    typedef decltype(value) T;
+    T linear = static_cast<T>(threshold) + static_cast<T>(beta) * value;
+    return value < static_cast<T>(threshold) ? static_cast<T>(threshold) : linear;
+  });
 }
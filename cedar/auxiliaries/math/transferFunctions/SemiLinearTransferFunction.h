@@ -77,11 +77,14 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
+  using cedar::aux::math::TransferFunction::compute;
+
   /*!@brief this function calculates the abs-based sigmoid function for a given double value.
    */
   virtual double compute(double value) const;
 
-  cv::Mat compute(const cv::Mat& values) const;
+  //! Overridden for efficiency.
+  virtual void compute(const cv::Mat& in, cv::Mat& out) const;
 
   /*!@brief Returns the current beta value.
    */
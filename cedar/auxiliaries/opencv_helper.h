@@ -57,4 +57,20 @@
 #define CEDAR_OPENCV_CONSTANT(CONSTANT_NAME) CV_ ## CONSTANT_NAME
 #endif
 
+namespace cedar
+{
+  namespace aux
+  {
+    //! Returns true if other matrices refer to the data of the given one, so that writing into it changes them, too.
+    inline bool sharesData(const cv::Mat& matrix)
+    {
+#if CEDAR_OPENCV_MAJOR_VERSION >= 3
+      return matrix.u != nullptr && matrix.u->refcount > 1;
+#else
+      return matrix.refcount != nullptr && *matrix.refcount > 1;
+#endif
+    }
+  }
+}
+
 #endif // CEDAR_AUX_OPENCV_HELPER_H
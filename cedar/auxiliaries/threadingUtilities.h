@@ -130,8 +130,12 @@ namespace cedar
     }
 
     /*!@brief Alternative to the cedar::aux::lock(cedar::aux::LockSet&) method.
+     *
+     *        Locks can be any container of QReadWriteLock pointers that is sorted in the canonical order, e.g., a
+     *        std::set or a std::vector copied from one.
      */
-    inline void lock(const std::set<QReadWriteLock*>& locks, cedar::aux::LOCK_TYPE type)
+    template <typename Locks>
+    inline void lock(const Locks& locks, cedar::aux::LOCK_TYPE type)
     {
       if (type == cedar::aux::LOCK_TYPE_DONT_LOCK)
       {
@@ -160,7 +164,8 @@ namespace cedar
 
     /*!@brief Alternative to the cedar::aux::unlock(cedar::aux::LockSet&) method.
      */
-    inline void unlock(const std::set<QReadWriteLock*>& locks, cedar::aux::LOCK_TYPE type)
+    template <typename Locks>
+    inline void unlock(const Locks& locks, cedar::aux::LOCK_TYPE type)
     {
       if (type == cedar::aux::LOCK_TYPE_DONT_LOCK)
       {
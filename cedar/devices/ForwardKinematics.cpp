@@ -42,8 +42,19 @@
 #include "cedar/auxiliaries/LocalCoordinateFrame.h"
 #include "cedar/auxiliaries/math/screwCalculus.h"
 #include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/ThreadPool.h"
 
 // SYSTEM INCLUDES
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  //! Configurations below this number are not split across the thread pool.
+  const size_t BATCH_MIN_CHUNK_SIZE = 64;
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -74,6 +85,9 @@ void cedar::dev::ForwardKinematics::initializeFromJointList()
   mProductsOfExponentials.clear();
   mJointTransformations.clear();
   mJointTwists.clear();
+  mReferenceJointTwistsFixed.clear();
+  mReferenceJointTransformationsFixed.clear();
+  mJointTwistsFixed.clear();
 
   // transform joint geometry into twist coordinates
   cv::Mat xi;
@@ -107,10 +121,16 @@ void cedar::dev::ForwardKinematics::initializeFromJointList()
     mProductsOfExponentials.push_back(cv::Mat::eye(4, 4, CV_32FC1));
     mJointTransformations.push_back(cv::Mat::eye(4, 4, CV_32FC1));
     mJointTwists.push_back(cv::Mat::eye(6, 1, CV_32FC1));
+
+    // fixed-size copies for the allocation-free computations
+    mReferenceJointTwistsFixed.push_back(xi);
+    mReferenceJointTransformationsFixed.push_back(T);
+    mJointTwistsFixed.push_back(xi);
   }
 
   // end-effector
   mReferenceEndEffectorTransformation = getEndEffectorCoordinateFrame()->getTransformation();
+  mReferenceEndEffectorTransformationFixed = mReferenceEndEffectorTransformation;
 }
 
 cv::Mat cedar::dev::ForwardKinematics::getJointTransformation(unsigned int index)
@@ -496,7 +516,9 @@ void cedar::dev::ForwardKinematics::setEndEffector(cedar::aux::LocalCoordinateFr
 
 cv::Mat cedar::dev::ForwardKinematics::getProductOfExponentials(unsigned int jointIndex)
 {
-  return mProductsOfExponentials[jointIndex];
+  // the products are updated in place, so hand out a copy
+  QReadLocker locker(&mTransformationsLock);
+  return mProductsOfExponentials[jointIndex].clone();
 }
 
 cv::Mat cedar::dev::ForwardKinematics::getEndEffectorTransformation()
@@ -506,8 +528,159 @@ cv::Mat cedar::dev::ForwardKinematics::getEndEffectorTransformation()
 
 cv::Mat cedar::dev::ForwardKinematics::calculateEndEffectorJacobian()
 {
-  cv::Mat p = calculateEndEffectorPosition();
-  return calculateCartesianJacobian(p, mpKinematicChain->getNumberOfJoints()-1, cedar::dev::KinematicChain::WORLD_COORDINATES);
+  cv::Mat jacobian;
+  this->calculateEndEffectorJacobian(jacobian);
+  return jacobian;
+}
+
+void cedar::dev::ForwardKinematics::calculateEndEffectorJacobian(cv::Mat& result)
+{
+  const int number_of_joints = static_cast<int>(mpKinematicChain->getNumberOfJoints());
+  result.create(3, number_of_joints, CV_32F);
+
+  cv::Matx44f root;
+  cv::Mat root_header(4, 4, CV_32F, root.val);
+  mpRootCoordinateFrame->getTransformation(root_header);
+  cv::Matx44f end_effector;
+  cv::Mat end_effector_header(4, 4, CV_32F, end_effector.val);
+  mpEndEffectorCoordinateFrame->getTransformation(end_effector_header);
+  const cv::Vec3f p(end_effector(0, 3), end_effector(1, 3), end_effector(2, 3));
+
+  // column j is the velocity of the end-effector induced by the j-th joint twist in world coordinates
+  QReadLocker locker(&mTransformationsLock);
+  cv::Vec6f twist;
+  for (int j = 0; j < number_of_joints; ++j)
+  {
+    cedar::aux::math::transformTwist(root, mJointTwistsFixed[j], twist);
+    const cv::Vec3f column = cv::Vec3f(twist[0], twist[1], twist[2]) + cv::Vec3f(twist[3], twist[4], twist[5]).cross(p);
+    result.at<float>(0, j) = column[0];
+    result.at<float>(1, j) = column[1];
+    result.at<float>(2, j) = column[2];
+  }
+}
+
+void cedar::dev::ForwardKinematics::calculateEndEffectorTransformations
+(
+  const cv::Mat& jointAngles,
+  cv::Mat& transformations
+) const
+{
+  this->evaluateConfigurations(jointAngles, &transformations, nullptr);
+}
+
+void cedar::dev::ForwardKinematics::calculateEndEffectorJacobians(const cv::Mat& jointAngles, cv::Mat& jacobians) const
+{
+  this->evaluateConfigurations(jointAngles, nullptr, &jacobians);
+}
+
+void cedar::dev::ForwardKinematics::evaluate
+(
+  const float* jointAngles,
+  const cv::Matx44f& root,
+  cv::Matx44f& endEffector,
+  float* jacobian,
+  cv::Vec6f* twists
+) const
+{
+  const size_t number_of_joints = mReferenceJointTwistsFixed.size();
+  cv::Matx44f product = cv::Matx44f::eye();
+  cv::Matx44f exponential;
+  for (size_t j = 0; j < number_of_joints; ++j)
+  {
+    cedar::aux::math::expTwist(mReferenceJointTwistsFixed[j], jointAngles[j], exponential);
+    product = product * exponential;
+    if (jacobian != nullptr)
+    {
+      cedar::aux::math::transformTwist(cv::Matx44f(root * product), mReferenceJointTwistsFixed[j], twists[j]);
+    }
+  }
+  endEffector = root * product * mReferenceEndEffectorTransformationFixed;
+
+  if (jacobian != nullptr)
+  {
+    const cv::Vec3f p(endEffector(0, 3), endEffector(1, 3), endEffector(2, 3));
+    for (size_t j = 0; j < number_of_joints; ++j)
+    {
+      const cv::Vec6f& twist = twists[j];
+      const cv::Vec3f column = cv::Vec3f(twist[0], twist[1], twist[2]) + cv::Vec3f(twist[3], twist[4], twist[5]).cross(p);
+      jacobian[j] = column[0];
+      jacobian[number_of_joints + j] = column[1];
+      jacobian[2 * number_of_joints + j] = column[2];
+    }
+  }
+}
+
+void cedar::dev::ForwardKinematics::evaluateConfigurations
+(
+  const cv::Mat& jointAngles,
+  cv::Mat* transformations,
+  cv::Mat* jacobians
+) const
+{
+  // the reference geometry only changes when the joint list changes
+  QReadLocker locker(&mTransformationsLock);
+  const size_t number_of_joints = mReferenceJointTwistsFixed.size();
+  CEDAR_ASSERT(jointAngles.channels() == 1 && jointAngles.cols == static_cast<int>(number_of_joints));
+
+  cv::Mat angles = jointAngles;
+  if (angles.type() != CV_32F)
+  {
+    jointAngles.convertTo(angles, CV_32F);
+  }
+  const size_t count = static_cast<size_t>(angles.rows);
+  if (transformations != nullptr)
+  {
+    transformations->create(static_cast<int>(count), 16, CV_32F);
+  }
+  if (jacobians != nullptr)
+  {
+    jacobians->create(static_cast<int>(count), static_cast<int>(3 * number_of_joints), CV_32F);
+  }
+
+  cv::Matx44f root;
+  cv::Mat root_header(4, 4, CV_32F, root.val);
+  mpRootCoordinateFrame->getTransformation(root_header);
+
+  auto evaluate_range = [&](size_t begin, size_t end)
+  {
+    std::vector<cv::Vec6f> twists(number_of_joints);
+    cv::Matx44f end_effector;
+    for (size_t i = begin; i < end; ++i)
+    {
+      float* jacobian = (jacobians != nullptr) ? jacobians->ptr<float>(static_cast<int>(i)) : nullptr;
+      this->evaluate(angles.ptr<float>(static_cast<int>(i)), root, end_effector, jacobian, twists.data());
+      if (transformations != nullptr)
+      {
+        std::copy(end_effector.val, end_effector.val + 16, transformations->ptr<float>(static_cast<int>(i)));
+      }
+    }
+  };
+
+  auto thread_pool = cedar::aux::ThreadPoolSingleton::getInstance();
+  size_t chunks = 1;
+  if (thread_pool->getNumberOfThreads() > 0)
+  {
+    chunks = std::min(static_cast<size_t>(thread_pool->getNumberOfThreads()) + 1, count / BATCH_MIN_CHUNK_SIZE);
+  }
+
+  if (chunks <= 1)
+  {
+    evaluate_range(0, count);
+    return;
+  }
+
+  std::vector<cedar::aux::ThreadPool::Task> tasks;
+  tasks.reserve(chunks);
+  for (size_t chunk = 0; chunk < chunks; ++chunk)
+  {
+    size_t begin = (count * chunk) / chunks;
+    size_t end = (count * (chunk + 1)) / chunks;
+    tasks.push_back([&evaluate_range, begin, end]()
+    {
+      evaluate_range(begin, end);
+    });
+  }
+  thread_pool->run(tasks);
 }
 
 cv::Mat cedar::dev::ForwardKinematics::calculateEndEffectorVelocity()
@@ -524,42 +697,30 @@ cv::Mat cedar::dev::ForwardKinematics::calculateEndEffectorAcceleration()
 
 void cedar::dev::ForwardKinematics::calculateTransformations()
 {
-  mTransformationsLock.lockForWrite();
-  // first joint
-  cedar::aux::math::expTwist<float>
-  (
-    mReferenceJointTwists[0],
-    mpKinematicChain->getJointAngle(0),
-    mTwistExponentials[0]
-  );
-  mProductsOfExponentials[0] = mTwistExponentials[0].clone();
-  mJointTransformations[0] = mProductsOfExponentials[0] * mReferenceJointTransformations[0];
-  mJointTwists[0] = mReferenceJointTwists[0];
-  // other joints
-  for (unsigned int i = 1; i < mpKinematicChain->getNumberOfJoints(); i++)
+  // all intermediate results are fixed-size matrices on the stack that are copied into the preallocated members, so
+  // updating the kinematics does not allocate memory
+  const unsigned int number_of_joints = mpKinematicChain->getNumberOfJoints();
+  cv::Matx44f root;
+  cv::Mat root_header(4, 4, CV_32F, root.val);
+  mpRootCoordinateFrame->getTransformation(root_header);
+
+  QWriteLocker locker(&mTransformationsLock);
+  cv::Matx44f exponential;
+  cv::Matx44f product = cv::Matx44f::eye();
+  cv::Matx44f joint_transformation;
+  for (unsigned int i = 0; i < number_of_joints; i++)
   {
-    cedar::aux::math::expTwist<float>
-    (
-      mReferenceJointTwists[i],
-      mpKinematicChain->getJointAngle(i),
-      mTwistExponentials[i]
-    );
-    mProductsOfExponentials[i] = mProductsOfExponentials[i - 1] * mTwistExponentials[i];
-    mJointTransformations[i] = mProductsOfExponentials[i] * mReferenceJointTransformations[i];
-    mJointTwists[i] = cedar::aux::math::rigidToAdjointTransformation<float>
-                      (
-                        mProductsOfExponentials[i]
-                      )
-                      * mReferenceJointTwists[i];
+    cedar::aux::math::expTwist(mReferenceJointTwistsFixed[i], mpKinematicChain->getJointAngle(i), exponential);
+    product = product * exponential;
+    joint_transformation = product * mReferenceJointTransformationsFixed[i];
+    cedar::aux::math::transformTwist(product, mReferenceJointTwistsFixed[i], mJointTwistsFixed[i]);
+
+    cv::Mat(4, 4, CV_32F, exponential.val).copyTo(mTwistExponentials[i]);
+    cv::Mat(4, 4, CV_32F, product.val).copyTo(mProductsOfExponentials[i]);
+    cv::Mat(4, 4, CV_32F, joint_transformation.val).copyTo(mJointTransformations[i]);
+    cv::Mat(6, 1, CV_32F, mJointTwistsFixed[i].val).copyTo(mJointTwists[i]);
   }
-// end-effector
-  mpEndEffectorCoordinateFrame->setTransformation
-  (
-    mpRootCoordinateFrame->getTransformation()
-    * mProductsOfExponentials[mpKinematicChain->getNumberOfJoints()-1]
-    * mReferenceEndEffectorTransformation
-  );
-  mTransformationsLock.unlock();
+  // end-effector
+  cv::Matx44f end_effector = root * product * mReferenceEndEffectorTransformationFixed;
+  mpEndEffectorCoordinateFrame->setTransformation(cv::Mat(4, 4, CV_32F, end_effector.val));
 }
-
-
@@ -99,6 +99,30 @@ public:
   cv::Mat getProductOfExponentials(unsigned int jointIndex);
   cv::Mat getEndEffectorTransformation();
   cv::Mat calculateEndEffectorJacobian();
+
+  /*!@brief Writes the cartesian end-effector Jacobian (3 x N) into result.
+   *
+   * Does not allocate memory if result already is a 3 x N CV_32F matrix.
+   */
+  void calculateEndEffectorJacobian(cv::Mat& result);
+
+  /*!@brief Computes the end-effector transformations for many joint configurations at once.
+   *
+   * @param jointAngles     M x N matrix, one configuration of the N joints per row.
+   * @param transformations Receives an M x 16 CV_32F matrix; each row is a row-major 4 x 4 transformation.
+   *
+   * The state of the chain is not changed. The configurations are split across the global thread pool.
+   */
+  void calculateEndEffectorTransformations(const cv::Mat& jointAngles, cv::Mat& transformations) const;
+
+  /*!@brief Computes the cartesian end-effector Jacobians for many joint configurations at once.
+   *
+   * @param jointAngles M x N matrix, one configuration of the N joints per row.
+   * @param jacobians   Receives an M x 3N CV_32F matrix; each row is a row-major 3 x N Jacobian.
+   *
+   * The state of the chain is not changed. The configurations are split across the global thread pool.
+   */
+  void calculateEndEffectorJacobians(const cv::Mat& jointAngles, cv::Mat& jacobians) const;
   cv::Mat calculateEndEffectorVelocity();
   cv::Mat calculateEndEffectorAcceleration();
   void calculateTransformations();
@@ -119,7 +143,20 @@ protected:
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  // none yet
+  /*!@brief Computes the end-effector transformation and, if jacobian is not null, the row-major 3 x N end-effector
+   *        Jacobian for one joint configuration. Only uses fixed-size matrices and the given scratch space for N twists.
+   */
+  void evaluate
+  (
+    const float* jointAngles,
+    const cv::Matx44f& root,
+    cv::Matx44f& endEffector,
+    float* jacobian,
+    cv::Vec6f* twists
+  ) const;
+
+  //! Evaluates many configurations; either of the outputs may be null.
+  void evaluateConfigurations(const cv::Mat& jointAngles, cv::Mat* transformations, cv::Mat* jacobians) const;
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -134,7 +171,7 @@ private:
   //!@brief pointer to the local coordinate frame of the end-effector
   cedar::aux::LocalCoordinateFramePtr mpEndEffectorCoordinateFrame;
   // locking for thread safety
-  QReadWriteLock mTransformationsLock;
+  mutable QReadWriteLock mTransformationsLock;
 
   //! twist coordinates for the transformations induced by rotating the joints (assuming reference configurations)
   std::vector<cv::Mat> mReferenceJointTwists;
@@ -151,6 +188,15 @@ private:
   //! twist coordinates for the transformations induced by rotating the joints in the curent configuration
   std::vector<cv::Mat> mJointTwists;
 
+  //! fixed-size copies of mReferenceJointTwists
+  std::vector<cv::Vec6f> mReferenceJointTwistsFixed;
+  //! fixed-size copies of mReferenceJointTransformations
+  std::vector<cv::Matx44f> mReferenceJointTransformationsFixed;
+  //! fixed-size copy of mReferenceEndEffectorTransformation
+  cv::Matx44f mReferenceEndEffectorTransformationFixed;
+  //! fixed-size copies of mJointTwists
+  std::vector<cv::Vec6f> mJointTwistsFixed;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -941,6 +941,25 @@ cv::Mat cedar::dev::KinematicChain::calculateEndEffectorJacobian()
   return mForwardKinematics->calculateEndEffectorJacobian();
 }
 
+void cedar::dev::KinematicChain::calculateEndEffectorJacobian(cv::Mat& result)
+{
+  mForwardKinematics->calculateEndEffectorJacobian(result);
+}
+
+void cedar::dev::KinematicChain::calculateEndEffectorTransformations
+(
+  const cv::Mat& jointAngles,
+  cv::Mat& transformations
+) const
+{
+  mForwardKinematics->calculateEndEffectorTransformations(jointAngles, transformations);
+}
+
+void cedar::dev::KinematicChain::calculateEndEffectorJacobians(const cv::Mat& jointAngles, cv::Mat& jacobians) const
+{
+  mForwardKinematics->calculateEndEffectorJacobians(jointAngles, jacobians);
+}
+
 cv::Mat cedar::dev::KinematicChain::calculateEndEffectorVelocity()
 {
   return mForwardKinematics->calculateEndEffectorVelocity();
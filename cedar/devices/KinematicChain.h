@@ -505,6 +505,30 @@ public:
    */
   cv::Mat calculateEndEffectorJacobian();
 
+  /*!@brief writes the cartesian end-effector Jacobian in the current configuration into result
+   *
+   * Does not allocate memory if result already is a 3 \f$\times\f$ N CV_32F matrix, which makes this suitable for
+   * control loops.
+   * @param result    end effector Jacobian, 3 \f$\times\f$ N matrix, where N = number of joints
+   */
+  void calculateEndEffectorJacobian(cv::Mat& result);
+
+  /*!@brief computes the end-effector transformations for many joint configurations at once, e.g., for workspace maps
+   *
+   * The configurations are evaluated in parallel on the global thread pool; the state of the chain is not changed.
+   * @param jointAngles       M \f$\times\f$ N matrix, one joint configuration per row
+   * @param transformations   M \f$\times\f$ 16 matrix, one row-major 4 \f$\times\f$ 4 transformation per row
+   */
+  void calculateEndEffectorTransformations(const cv::Mat& jointAngles, cv::Mat& transformations) const;
+
+  /*!@brief computes the cartesian end-effector Jacobians for many joint configurations at once
+   *
+   * The configurations are evaluated in parallel on the global thread pool; the state of the chain is not changed.
+   * @param jointAngles M \f$\times\f$ N matrix, one joint configuration per row
+   * @param jacobians   M \f$\times\f$ 3N matrix, one row-major 3 \f$\times\f$ N Jacobian per row
+   */
+  void calculateEndEffectorJacobians(const cv::Mat& jointAngles, cv::Mat& jacobians) const;
+
   /*!@brief gives the cartesian end-effector velocity
    *
    * @return    end effector velocity, 4 \f$\times\f$ 1 matrix (homogeneous coordinates)
@@ -0,0 +1,279 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        FrameRecorder.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Writes the frames of one grabber channel to a video file on a separate encoder thread.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/devices/sensors/visual/FrameRecorder.h"
+#include "cedar/devices/sensors/visual/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dev::sensors::visual::FrameRecorder::FrameRecorder
+(
+  const std::string& fileName,
+  int fourcc,
+  double fps,
+  const cv::Mat& prototype,
+  bool color,
+  unsigned int queueSize
+)
+:
+mWriter(fileName, fourcc, fps, prototype.size(), color),
+mQueue(std::max(queueSize, 1u)),
+mStopRequested(false),
+mAccepting(false),
+mActiveRecords(0),
+mFramePeriod(std::chrono::steady_clock::duration::zero()),
+mRecordedFrames(0),
+mDroppedFrames(0),
+mLateFrames(0),
+mFailed(false)
+{
+  if (this->mWriter.isOpened())
+  {
+    cv::VideoWriter* writer = &this->mWriter;
+    this->mWrite = [writer](const cv::Mat& frame)
+    {
+      writer->write(frame);
+    };
+  }
+  this->start(fps, prototype);
+}
+
+cedar::dev::sensors::visual::FrameRecorder::FrameRecorder
+(
+  const WriteFunction& write,
+  double fps,
+  const cv::Mat& prototype,
+  unsigned int queueSize
+)
+:
+mWrite(write),
+mQueue(std::max(queueSize, 1u)),
+mStopRequested(false),
+mAccepting(false),
+mActiveRecords(0),
+mFramePeriod(std::chrono::steady_clock::duration::zero()),
+mRecordedFrames(0),
+mDroppedFrames(0),
+mLateFrames(0),
+mFailed(false)
+{
+  this->start(fps, prototype);
+}
+
+cedar::dev::sensors::visual::FrameRecorder::~FrameRecorder()
+{
+  this->stop();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dev::sensors::visual::FrameRecorder::start(double fps, const cv::Mat& prototype)
+{
+  if (fps > 0.0)
+  {
+    this->mFramePeriod = std::chrono::duration_cast<std::chrono::steady_clock::duration>
+                         (
+                           std::chrono::duration<double>(1.0 / fps)
+                         );
+  }
+
+  if (!this->isOpened())
+  {
+    return;
+  }
+
+  // allocate all buffers now so that record() only copies into existing memory
+  std::vector<Frame>& frames = this->mQueue.slots();
+  for (auto& frame : frames)
+  {
+    frame.mImage.create(prototype.size(), prototype.type());
+  }
+
+  this->mEncoder = std::thread(&cedar::dev::sensors::visual::FrameRecorder::encode, this);
+  this->mAccepting.store(true);
+}
+
+bool cedar::dev::sensors::visual::FrameRecorder::isOpened() const
+{
+  return !this->mWrite.empty();
+}
+
+void cedar::dev::sensors::visual::FrameRecorder::record(const cv::Mat& frame)
+{
+  if (this->mFailed.load(std::memory_order_acquire))
+  {
+    CEDAR_THROW(cedar::dev::sensors::visual::GrabberRecordingException, this->mError);
+  }
+
+  // announce the call before checking the flag, so that stop() either sees it and waits or this call sees the flag
+  ++this->mActiveRecords;
+  struct ActiveRecord
+  {
+    ~ActiveRecord()
+    {
+      --mCount;
+    }
+    std::atomic<unsigned int>& mCount;
+  } active_record{this->mActiveRecords};
+
+  if (!this->mAccepting.load())
+  {
+    return;
+  }
+
+  Frame* slot = this->mQueue.beginWrite();
+  if (slot == nullptr)
+  {
+    ++this->mDroppedFrames;
+    return;
+  }
+
+  // reuses the slot's memory as long as the frame keeps its size and type
+  frame.copyTo(slot->mImage);
+  slot->mRecordTime = std::chrono::steady_clock::now();
+  this->mQueue.commitWrite();
+
+  // taking the mutex makes sure the encoder is either waiting or will see the new frame before it waits
+  {
+    std::lock_guard<std::mutex> lock(this->mWakeMutex);
+  }
+  this->mWake.notify_one();
+}
+
+void cedar::dev::sensors::visual::FrameRecorder::stop()
+{
+  std::lock_guard<std::mutex> stop_lock(this->mStopMutex);
+
+  // no new frames are taken; frames that are being queued right now are still written
+  this->mAccepting.store(false);
+  while (this->mActiveRecords.load() > 0)
+  {
+    std::this_thread::yield();
+  }
+
+  if (this->mEncoder.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->mWakeMutex);
+      this->mStopRequested.store(true);
+    }
+    this->mWake.notify_one();
+    this->mEncoder.join();
+  }
+  this->mStopRequested.store(true);
+  this->mWriter.release();
+}
+
+void cedar::dev::sensors::visual::FrameRecorder::encode()
+{
+  while (true)
+  {
+    if (Frame* frame = this->mQueue.beginRead())
+    {
+      this->write(*frame);
+      this->mQueue.commitRead();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(this->mWakeMutex);
+    if (this->mStopRequested.load() && this->mQueue.size() == 0)
+    {
+      return;
+    }
+    this->mWake.wait(lock, [this] { return this->mStopRequested.load() || this->mQueue.size() > 0; });
+  }
+}
+
+void cedar::dev::sensors::visual::FrameRecorder::write(const Frame& frame)
+{
+  // after a failure, the remaining frames are discarded
+  if (this->mFailed.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+
+  if
+  (
+    this->mFramePeriod > std::chrono::steady_clock::duration::zero()
+    && std::chrono::steady_clock::now() - frame.mRecordTime > this->mFramePeriod
+  )
+  {
+    ++this->mLateFrames;
+  }
+
+  try
+  {
+    this->mWrite(frame.mImage);
+    ++this->mRecordedFrames;
+  }
+  catch (const std::exception& e)
+  {
+    this->mError = "Error while writing a frame: " + std::string(e.what());
+    this->mFailed.store(true, std::memory_order_release);
+  }
+}
+
+unsigned int cedar::dev::sensors::visual::FrameRecorder::getNumberOfRecordedFrames() const
+{
+  return this->mRecordedFrames.load();
+}
+
+unsigned int cedar::dev::sensors::visual::FrameRecorder::getNumberOfDroppedFrames() const
+{
+  return this->mDroppedFrames.load();
+}
+
+unsigned int cedar::dev::sensors::visual::FrameRecorder::getNumberOfLateFrames() const
+{
+  return this->mLateFrames.load();
+}
+
+unsigned int cedar::dev::sensors::visual::FrameRecorder::getQueueSize() const
+{
+  return static_cast<unsigned int>(this->mQueue.capacity());
+}
@@ -0,0 +1,236 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        FrameRecorder.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Writes the frames of one grabber channel to a video file on a separate encoder thread.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DEV_SENSORS_VISUAL_FRAME_RECORDER_H
+#define CEDAR_DEV_SENSORS_VISUAL_FRAME_RECORDER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/devices/sensors/visual/namespace.h"
+#include "cedar/auxiliaries/RingBuffer.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#ifndef Q_MOC_RUN
+  #include <boost/function.hpp>
+#endif
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+
+/*!@brief Writes the frames of one grabber channel to a video file on a separate encoder thread.
+ *
+ *        The grabbing thread hands each frame to record(), which copies it into a bounded queue of preallocated
+ *        frame buffers and returns immediately. A dedicated encoder thread takes the frames from the queue and writes
+ *        them to the video file, so encoding neither throttles nor delays grabbing.
+ *
+ *        If the encoder falls behind and the queue is full, the new frame is dropped rather than blocking the
+ *        grabbing thread. Frames that waited longer than one frame period of the recording in the queue are counted
+ *        as late.
+ */
+class cedar::dev::sensors::visual::FrameRecorder
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Writes one frame; called on the encoder thread. Failures are reported by throwing.
+  typedef boost::function<void (const cv::Mat&)> WriteFunction;
+
+private:
+  //! One recycled buffer of the queue.
+  struct Frame
+  {
+    //! The copy of the grabbed image.
+    cv::Mat mImage;
+
+    //! The time at which the frame was handed to record().
+    std::chrono::steady_clock::time_point mRecordTime;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Opens the video file and, if that succeeded, starts the encoder thread.
+   *
+   * @param fileName   Path of the video file.
+   * @param fourcc     Codec of the video file (see cedar::dev::sensors::visual::RecordingFormat).
+   * @param fps        Framerate of the video file.
+   * @param prototype  A frame of the channel; the queue's buffers are preallocated with its size and type.
+   * @param color      Whether the video is recorded in color.
+   * @param queueSize  Number of frames that can wait for the encoder.
+   */
+  FrameRecorder
+  (
+    const std::string& fileName,
+    int fourcc,
+    double fps,
+    const cv::Mat& prototype,
+    bool color,
+    unsigned int queueSize
+  );
+
+  /*!@brief Starts the encoder thread, which hands the frames to the given function instead of a video file.
+   *
+   * @param write      Called on the encoder thread for every frame that is not dropped.
+   * @param fps        Framerate of the recording; frames that wait longer than one period are counted as late.
+   * @param prototype  A frame of the channel; the queue's buffers are preallocated with its size and type.
+   * @param queueSize  Number of frames that can wait for the encoder.
+   */
+  FrameRecorder
+  (
+    const WriteFunction& write,
+    double fps,
+    const cv::Mat& prototype,
+    unsigned int queueSize
+  );
+
+  //!@brief Destructor. Writes the remaining frames and closes the file.
+  ~FrameRecorder();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief Returns whether the video file could be opened.
+  bool isOpened() const;
+
+  /*!@brief Queues a copy of the frame for writing. Never blocks; drops the frame if the queue is full.
+   *
+   *        Must always be called from the same thread, but may run concurrently with stop(); frames handed in after
+   *        stop() was called are ignored.
+   *
+   * @throw cedar::dev::sensors::visual::GrabberRecordingException if the encoder thread failed to write a frame.
+   */
+  void record(const cv::Mat& frame);
+
+  /*!@brief Writes all queued frames, stops the encoder thread and closes the file. Statistics remain available.
+   *
+   *        Safe to call from any thread, also while record() runs.
+   */
+  void stop();
+
+  //!@brief Returns the number of frames written to the file.
+  unsigned int getNumberOfRecordedFrames() const;
+
+  //!@brief Returns the number of frames that were dropped because the queue was full.
+  unsigned int getNumberOfDroppedFrames() const;
+
+  //!@brief Returns the number of frames that waited longer than one frame period before being written.
+  unsigned int getNumberOfLateFrames() const;
+
+  //!@brief Returns the number of frames that can wait for the encoder.
+  unsigned int getQueueSize() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Preallocates the queue and starts the encoder thread.
+  void start(double fps, const cv::Mat& prototype);
+
+  //! Main loop of the encoder thread.
+  void encode();
+
+  //! Writes one queued frame to the file.
+  void write(const Frame& frame);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  cv::VideoWriter mWriter;
+
+  //! Writes the frames; empty if the video file could not be opened.
+  WriteFunction mWrite;
+
+  //! The queue between the grabbing and the encoder thread.
+  cedar::aux::RingBuffer<Frame> mQueue;
+
+  std::thread mEncoder;
+
+  //! Used by the encoder thread to wait for frames.
+  std::mutex mWakeMutex;
+
+  //! Signals the encoder thread that frames are queued or that it should stop.
+  std::condition_variable mWake;
+
+  std::atomic<bool> mStopRequested;
+
+  //! Whether record() still queues frames; cleared first by stop().
+  std::atomic<bool> mAccepting;
+
+  //! Number of record() calls that are past announcing themselves; stop() waits until it is zero.
+  std::atomic<unsigned int> mActiveRecords;
+
+  //! Serializes calls of stop(), e.g., from the destructor and the grabber.
+  std::mutex mStopMutex;
+
+  //! A frame that waited longer than this is counted as late; zero disables the check.
+  std::chrono::steady_clock::duration mFramePeriod;
+
+  std::atomic<unsigned int> mRecordedFrames;
+
+  std::atomic<unsigned int> mDroppedFrames;
+
+  std::atomic<unsigned int> mLateFrames;
+
+  //! Set by the encoder thread when writing fails; reported to the grabbing thread by record().
+  std::atomic<bool> mFailed;
+
+  //! Description of the failure; written once by the encoder thread before mFailed is set.
+  std::string mError;
+
+}; // class cedar::dev::sensors::visual::FrameRecorder
+
+#endif // CEDAR_DEV_SENSORS_VISUAL_FRAME_RECORDER_H
+
@@ -251,6 +251,7 @@ void cedar::dev::sensors::visual::Grabber::init
   // initialize local member
   mpReadWriteLock = new QReadWriteLock();
   mGrabberThreadStartedOnRecording = false;
+  mRecordingQueueSize = 30;
   mCleanUpAlreadyDone = false;
   mFpsMeasureStart = boost::posix_time::microsec_clock::local_time();
   mFpsMeasureStop = boost::posix_time::microsec_clock::local_time();
@@ -554,6 +555,7 @@ void cedar::dev::sensors::visual::Grabber::grab()
   }
 
   // check if recording is on
+  // the frames are only copied into the recorders' queues here, encoding is done on the recorders' threads
   if (mRecording)
   {
     unsigned int num_channels = getNumChannels();
@@ -561,7 +563,12 @@ void cedar::dev::sensors::visual::Grabber::grab()
     {
       try
       {
-        getGrabberChannel(channel)->mVideoWriter << getGrabberChannel(channel)->mImageMat;
+        // the copy keeps the recorder alive even if recording is restarted meanwhile
+        cedar::dev::sensors::visual::FrameRecorderPtr recorder = getRecorder(channel);
+        if (recorder)
+        {
+          recorder->record(getGrabberChannel(channel)->mImageMat);
+        }
       }
       catch (std::exception& e)
       {
@@ -569,7 +576,7 @@ void cedar::dev::sensors::visual::Grabber::grab()
         info << "[Grabber::grab] Error recording channel" << channel << ": " << e.what();
         cedar::aux::LogSingleton::getInstance()->error
                                                  (
-                                                   this->getName() + ": info ",
+                                                   this->getName() + ": " + info.str(),
                                                    "cedar::dev::sensors::visual::Grabber::grab()"
                                                  );
         this->closeGrabber();
@@ -824,8 +831,6 @@ void cedar::dev::sensors::visual::Grabber::startRecording
     return;
   }
 
-  // set the record-flag
-  mRecording = true;
   unsigned int recording_channels = 0;
 
   // write the video-file with the actual grabbing-speed
@@ -834,21 +839,26 @@ void cedar::dev::sensors::visual::Grabber::startRecording
   unsigned int num_channels = getNumChannels();
   for(unsigned int channel = 0; channel < num_channels; ++channel)
   {
-    // create writer
+    // create recorder
     std::string record_name = getGrabberChannel(channel)->_mRecordName->getPath(true);
-    cv::VideoWriter writer
-                    (
-                      record_name,
-                      static_cast<unsigned int>(recFormat),
-                      fps,
-                      getGrabberChannel(channel)->mImageMat.size(),
-                      color
-                    );
-
-    if (writer.isOpened())
+    cedar::dev::sensors::visual::FrameRecorderPtr recorder
+    (
+      new cedar::dev::sensors::visual::FrameRecorder
+      (
+        record_name,
+        static_cast<int>(recFormat),
+        fps,
+        getGrabberChannel(channel)->mImageMat,
+        color,
+        mRecordingQueueSize
+      )
+    );
+
+    // save it in channel-struct
+    setRecorder(channel, recorder);
+
+    if (recorder->isOpened())
     {
-      // save it in channel-struct
-      getGrabberChannel(channel)->mVideoWriter = writer;
 
       std::string info = ": Channel " + cedar::aux::toString(channel) + " recording to " + record_name;
 
@@ -863,11 +873,18 @@ void cedar::dev::sensors::visual::Grabber::startRecording
 
   if (recording_channels != num_channels)
   {
+    for(unsigned int channel = 0; channel < num_channels; ++channel)
+    {
+      getRecorder(channel)->stop();
+    }
     std::string msg = "Start recording: only " + cedar::aux::toString(recording_channels)
                         + " of " + cedar::aux::toString(num_channels) + " recording!";
     CEDAR_THROW(cedar::dev::sensors::visual::GrabberRecordingException,msg);
   }
 
+  // set the record-flag
+  mRecording = true;
+
   // start the grabberthread if needed
   if (!mIsGrabbing)
   {
@@ -900,20 +917,109 @@ void cedar::dev::sensors::visual::Grabber::stopRecording()
                                                );
     }
 
-    // delete the videowriter
+    // write the queued frames and close the files; the recorders are kept for their statistics
     unsigned int num_channels = getNumChannels();
     for(unsigned int channel = 0; channel < num_channels; ++channel)
     {
-      getGrabberChannel(channel)->mVideoWriter = cv::VideoWriter();
+      cedar::dev::sensors::visual::FrameRecorderPtr recorder = getRecorder(channel);
+      if (!recorder)
+      {
+        continue;
+      }
+      recorder->stop();
+
+      std::string info = ": Channel " + cedar::aux::toString(channel) + " recorded "
+                           + cedar::aux::toString(recorder->getNumberOfRecordedFrames()) + " frames ("
+                           + cedar::aux::toString(recorder->getNumberOfDroppedFrames()) + " dropped, "
+                           + cedar::aux::toString(recorder->getNumberOfLateFrames()) + " late)";
+      if (recorder->getNumberOfDroppedFrames() > 0)
+      {
+        cedar::aux::LogSingleton::getInstance()->warning
+                                                 (
+                                                   this->getName() + info,
+                                                   "cedar::dev::sensors::visual::Grabber::stopRecording()"
+                                                 );
+      }
+      else
+      {
+        cedar::aux::LogSingleton::getInstance()->message
+                                                 (
+                                                   this->getName() + info,
+                                                   "cedar::dev::sensors::visual::Grabber::stopRecording()"
+                                                 );
+      }
     }
   }
 }
 
+cedar::dev::sensors::visual::FrameRecorderPtr cedar::dev::sensors::visual::Grabber::getRecorder
+(
+  unsigned int channel
+) const
+{
+  QReadLocker locker(mpReadWriteLock);
+  return getGrabberChannel(channel)->mRecorder;
+}
+
+void cedar::dev::sensors::visual::Grabber::setRecorder
+(
+  unsigned int channel,
+  cedar::dev::sensors::visual::FrameRecorderPtr recorder
+)
+{
+  QWriteLocker locker(mpReadWriteLock);
+  getGrabberChannel(channel)->mRecorder = recorder;
+}
+
 bool cedar::dev::sensors::visual::Grabber::isRecording() const
 {
   return mRecording;
 }
 
+void cedar::dev::sensors::visual::Grabber::setRecordingQueueSize(unsigned int queueSize)
+{
+  if (queueSize == 0)
+  {
+    CEDAR_THROW(cedar::dev::sensors::visual::InvalidParameterException, "The recording queue needs at least one frame.");
+  }
+  mRecordingQueueSize = queueSize;
+}
+
+unsigned int cedar::dev::sensors::visual::Grabber::getRecordingQueueSize() const
+{
+  return mRecordingQueueSize;
+}
+
+unsigned int cedar::dev::sensors::visual::Grabber::getNumberOfRecordedFrames(unsigned int channel) const
+{
+  if (channel >= getNumChannels())
+  {
+    CEDAR_THROW(cedar::aux::IndexOutOfRangeException,buildChannelErrorMessage(channel));
+  }
+  cedar::dev::sensors::visual::ConstFrameRecorderPtr recorder = getRecorder(channel);
+  return recorder ? recorder->getNumberOfRecordedFrames() : 0;
+}
+
+unsigned int cedar::dev::sensors::visual::Grabber::getNumberOfDroppedFrames(unsigned int channel) const
+{
+  if (channel >= getNumChannels())
+  {
+    CEDAR_THROW(cedar::aux::IndexOutOfRangeException,buildChannelErrorMessage(channel));
+  }
+  cedar::dev::sensors::visual::ConstFrameRecorderPtr recorder = getRecorder(channel);
+  return recorder ? recorder->getNumberOfDroppedFrames() : 0;
+}
+
+unsigned int cedar::dev::sensors::visual::Grabber::getNumberOfLateFrames(unsigned int channel) const
+{
+  if (channel >= getNumChannels())
+  {
+    CEDAR_THROW(cedar::aux::IndexOutOfRangeException,buildChannelErrorMessage(channel));
+  }
+  cedar::dev::sensors::visual::ConstFrameRecorderPtr recorder = getRecorder(channel);
+  return recorder ? recorder->getNumberOfLateFrames() : 0;
+}
+
 void cedar::dev::sensors::visual::Grabber::step(cedar::unit::Time)
 {
   // if something went wrong on grabbing,
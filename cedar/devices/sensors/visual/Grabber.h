@@ -58,6 +58,7 @@
 #include <QReadWriteLock>
 #include <vector>
 #include <string>
+#include <atomic>
 
 /*! @class cedar::dev::sensors::visual::Grabber
  *  @brief This is the base class for all grabber.
@@ -75,7 +76,7 @@
  *     - grabbing: <br>
  *             => grab manually a new image: grab()  <br>
  *             => get the image from the internal buffer: getImage() <br>
- *     - recording: startRecording(), stopRecording()  <br>
+ *     - recording: startRecording(), stopRecording(), getNumberOfDroppedFrames()  <br>
  *     - snapshots: saveSnapshot(), saveSnapshotAllCams(), getSnapshotName()<br>
  *
  *    @remarks For grabber developers <br>
@@ -429,7 +430,8 @@ public:
    *      If the grabbing thread isn't running, startRecording will start the Thread
    *      and stopRecording will stop it.
    *
-   * Create the VideoWriter structures and set the record flag.
+   * Create a FrameRecorder for every channel and set the record flag. Each recorder encodes on its own thread; the
+   * grabbing thread only copies the frames into the recorder's queue (see setRecordingQueueSize()).
    *  @param
    *      fps Defines the framerate of the recorded avi-file. It is independent from the speed of
    *      the grabbing thread. But the number of pictures will be the same. So if you grab on a slower speed than
@@ -476,6 +478,25 @@ public:
   /*! @brief Get the state of the recording-flag */
   bool isRecording() const;
 
+  /*! @brief Set the number of frames per channel that can wait for the encoder thread.
+   *
+   *    If the encoder falls behind and the queue is full, new frames are dropped instead of slowing down grabbing.
+   *    Takes effect with the next call of startRecording().
+   */
+  void setRecordingQueueSize(unsigned int queueSize);
+
+  /*! @brief Get the number of frames per channel that can wait for the encoder thread */
+  unsigned int getRecordingQueueSize() const;
+
+  /*! @brief Get the number of frames of the current or last recording written to the file of the given channel */
+  unsigned int getNumberOfRecordedFrames(unsigned int channel = 0) const;
+
+  /*! @brief Get the number of frames of the current or last recording dropped because the queue was full */
+  unsigned int getNumberOfDroppedFrames(unsigned int channel = 0) const;
+
+  /*! @brief Get the number of frames of the current or last recording that waited longer than one frame period */
+  unsigned int getNumberOfLateFrames(unsigned int channel = 0) const;
+
   /*! @brief Defines the additions to the filename.
    *
    *   This method will be used in a stereo-grabber if you use setSnapshotName("SnapshotFilename")
@@ -653,6 +674,17 @@ private:
     return _mChannels->at(channel);
   }
 
+  /*! Get the recorder of the specified channel; it is guarded by mpReadWriteLock because the grabbing thread uses it
+   *  @param channel The channel number of the wanted recorder
+   */
+  cedar::dev::sensors::visual::FrameRecorderPtr getRecorder(unsigned int channel) const;
+
+  /*! Set the recorder of the specified channel while holding mpReadWriteLock
+   *  @param channel The channel number
+   *  @param recorder The new recorder of the channel
+   */
+  void setRecorder(unsigned int channel, cedar::dev::sensors::visual::FrameRecorderPtr recorder);
+
   /*! @brief  Called when the grabbing thread is started.
    *
    *          This method invokes internally LoopedThread::start() and does
@@ -681,8 +713,8 @@ protected:
     //! @brief The actual measured fps of grabbing
     double mFpsMeasured;
     
-    /*! @brief  Flag if recording is on     */
-    bool mRecording;
+    /*! @brief  Flag if recording is on; read by the grabbing thread     */
+    std::atomic<bool> mRecording;
 
 private:
 
@@ -704,6 +736,9 @@ private:
     //! @brief Flag which indicates if the GrabberThread was started during startRecording
     bool mGrabberThreadStartedOnRecording;
 
+    //! @brief The number of frames per channel that can wait for the encoder thread
+    unsigned int mRecordingQueueSize;
+
     //! @brief Flag which indicates if the CleanUp was already done (perhaps due to an error)
     bool mCleanUpAlreadyDone;
     
@@ -43,6 +43,7 @@
 // CEDAR INCLUDES
 #include "cedar/devices/sensors/visual/namespace.h"
 #include "cedar/auxiliaries/Configurable.h"
+#include "cedar/devices/sensors/visual/FrameRecorder.h"
 #include "cedar/auxiliaries/FileParameter.h"
 
 // SYSTEM INCLUDES
@@ -105,8 +106,8 @@ protected:
   //! @brief The picture frame
   cv::Mat mImageMat;
 
-  //! @brief Needed to to the recordings
-  cv::VideoWriter mVideoWriter;
+  //! @brief Writes the recording of this channel; kept after recording stopped for its statistics
+  cedar::dev::sensors::visual::FrameRecorderPtr mRecorder;
 
   //! @brief The channel information
   std::string mChannelInfo;
@@ -73,6 +73,7 @@ namespace cedar
         // common base classes for all grabbers
         CEDAR_DECLARE_DEV_CLASS(Grabber);
         CEDAR_DECLARE_DEV_CLASS(GrabberChannel);
+        CEDAR_DECLARE_DEV_CLASS(FrameRecorder);
         
         // grabber
         CEDAR_DECLARE_DEV_CLASS(VideoGrabber);
@@ -40,17 +40,27 @@
 
 // CEDAR INCLUDES
 #include "cedar/dynamics/Dynamics.h"
+#include "cedar/dynamics/integrators/Euler.h"
 #include "cedar/processing/StepTime.h"
 #include "cedar/processing/exceptions.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/auxiliaries/assert.h"
+#include "cedar/units/prefixes.h"
 
 // SYSTEM INCLUDES
+#include <boost/bind.hpp>
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
 cedar::dyn::Dynamics::Dynamics()
 :
-cedar::proc::Step(true)
+cedar::proc::Step(true),
+mUpdateRatio(1),
+mPendingSteps(0),
+mPendingTime(0.0 * cedar::unit::seconds)
 {
   this->mTimestepMeasurementId = this->registerTimeMeasurement("time step");
 }
@@ -64,12 +74,154 @@ void cedar::dyn::Dynamics::compute(const cedar::proc::Arguments& arguments)
   {
     const cedar::proc::StepTime& step_time = dynamic_cast<const cedar::proc::StepTime&>(arguments);
 
-    this->setTimeMeasurement(this->mTimestepMeasurementId, step_time.getStepTime());
-
-    this->eulerStep(step_time.getStepTime());
+    // in multi-rate simulation, slow dynamics accumulate the time of several steps and hold their outputs meanwhile
+    unsigned int update_ratio = cedar::aux::GlobalClockSingleton::getInstance()->getUpdateRatio(this->getTimeScale());
+    this->mUpdateRatio.store(update_ratio);
+
+    this->mPendingTime += step_time.getStepTime();
+    if (++this->mPendingSteps < update_ratio)
+    {
+      // the outputs hold their last value, so steps downstream don't have to recompute
+      this->setOutputsUnchanged();
+      return;
+    }
+    cedar::unit::Time time = this->mPendingTime;
+    this->mPendingTime = 0.0 * cedar::unit::seconds;
+    this->mPendingSteps = 0;
+
+    this->setTimeMeasurement(this->mTimestepMeasurementId, time);
+
+    // hand-written euler steps are used whenever the forward Euler integrator is selected
+    cedar::dyn::IntegratorPtr integrator = this->getIntegrator();
+    if (integrator && !boost::dynamic_pointer_cast<cedar::dyn::integrators::Euler>(integrator))
+    {
+      this->integrationStep(time);
+    }
+    else
+    {
+      this->eulerStep(time);
+    }
   }
   catch (const std::bad_cast& e)
   {
     CEDAR_THROW(cedar::proc::InvalidArgumentsException, "Bad arguments passed to dynamics. Expected StepTime.");
   }
 }
+
+void cedar::dyn::Dynamics::resetComputationState()
+{
+  cedar::proc::Step::resetComputationState();
+
+  // time accumulated before a reset or a restored checkpoint must not be integrated afterwards
+  this->mPendingSteps = 0;
+  this->mPendingTime = 0.0 * cedar::unit::seconds;
+}
+
+void cedar::dyn::Dynamics::eulerStep(const cedar::unit::Time& time)
+{
+  this->integrateStateVariables(time);
+}
+
+void cedar::dyn::Dynamics::integrationStep(const cedar::unit::Time& time)
+{
+  this->integrateStateVariables(time);
+}
+
+void cedar::dyn::Dynamics::computeDerivative(const std::vector<cv::Mat>&, std::vector<cv::Mat>&)
+{
+  CEDAR_THROW
+  (
+    cedar::aux::NotImplementedException,
+    "Dynamics that declare state variables have to implement computeDerivative."
+  );
+}
+
+double cedar::dyn::Dynamics::getLinearDecayRate() const
+{
+  return 0.0;
+}
+
+cedar::unit::Time cedar::dyn::Dynamics::getTimeScale() const
+{
+  return cedar::unit::Time(0.0 * cedar::unit::seconds);
+}
+
+unsigned int cedar::dyn::Dynamics::getUpdateRatio() const
+{
+  return this->mUpdateRatio.load();
+}
+
+void cedar::dyn::Dynamics::declareStateVariable(cedar::aux::MatDataPtr stateVariable)
+{
+  CEDAR_ASSERT(stateVariable);
+
+  if (!this->_mIntegrator)
+  {
+    this->_mIntegrator = IntegratorParameterPtr
+                         (
+                           new IntegratorParameter
+                           (
+                             this,
+                             "integrator",
+                             cedar::dyn::IntegratorPtr(new cedar::dyn::integrators::Euler())
+                           )
+                         );
+    this->_mIntegrator->markAdvanced();
+  }
+
+  this->mStateVariables.push_back(stateVariable);
+}
+
+bool cedar::dyn::Dynamics::hasStateVariables() const
+{
+  return !this->mStateVariables.empty();
+}
+
+cedar::dyn::IntegratorPtr cedar::dyn::Dynamics::getIntegrator() const
+{
+  if (!this->_mIntegrator)
+  {
+    return cedar::dyn::IntegratorPtr();
+  }
+  return this->_mIntegrator->getValue();
+}
+
+void cedar::dyn::Dynamics::setIntegrator(cedar::dyn::IntegratorPtr integrator)
+{
+  if (!this->_mIntegrator)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::NotImplementedException,
+      "This step does not declare any state variables and can only be simulated by its own euler step."
+    );
+  }
+  this->_mIntegrator->setValue(integrator);
+}
+
+void cedar::dyn::Dynamics::integrateStateVariables(const cedar::unit::Time& time)
+{
+  if (!this->_mIntegrator)
+  {
+    CEDAR_THROW
+    (
+      cedar::aux::NotImplementedException,
+      "Dynamics that do not declare any state variables have to implement eulerStep."
+    );
+  }
+
+  // the headers share their data with the state variables, so the integrator updates them in place
+  this->mIntegratedState.resize(this->mStateVariables.size());
+  for (size_t i = 0; i < this->mStateVariables.size(); ++i)
+  {
+    this->mIntegratedState[i] = this->mStateVariables[i]->getData();
+  }
+
+  this->_mIntegrator->getValue()->integrate
+  (
+    this->mIntegratedState,
+    time,
+    this->getLinearDecayRate(),
+    boost::bind(&cedar::dyn::Dynamics::computeDerivative, this, _1, _2)
+  );
+}
@@ -43,15 +43,27 @@
 
 // CEDAR INCLUDES
 #include "cedar/processing/Step.h"
+#include "cedar/dynamics/Integrator.h"
+#include "cedar/auxiliaries/ObjectParameterTemplate.h"
 #include "cedar/units/Time.h"
 
 // FORWARD DECLARATIONS
+#include "cedar/auxiliaries/MatData.fwd.h"
 #include "cedar/dynamics/Dynamics.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <vector>
 
 
 /*!@brief A cedar::proc::Step that approximates the solution of some dynamical system.
+ *
+ *        There are two ways of implementing a dynamical system. The classic one is to override eulerStep and advance
+ *        the system by hand. Alternatively, a step declares the matrices that make up its state (declareStateVariable)
+ *        and implements computeDerivative; it can then be simulated with any cedar::dyn::Integrator, selected through
+ *        the "integrator" parameter. Steps may do both, in which case their eulerStep is used whenever the forward
+ *        Euler integrator is selected.
  */
 class cedar::dyn::Dynamics : public cedar::proc::Step
 {
@@ -59,6 +71,17 @@ class cedar::dyn::Dynamics : public cedar::proc::Step
   // macros
   //--------------------------------------------------------------------------------------------------------------------
 
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief a parameter for integrator objects
+  typedef cedar::aux::ObjectParameterTemplate<cedar::dyn::Integrator> IntegratorParameter;
+
+  //!@cond SKIPPED_DOCUMENTATION
+  CEDAR_GENERATE_POINTER_TYPES_INTRUSIVE(IntegratorParameter);
+  //!@endcond
+
   //--------------------------------------------------------------------------------------------------------------------
   // constructors and destructor
   //--------------------------------------------------------------------------------------------------------------------
@@ -70,25 +93,95 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  // none yet
+  //!@brief Whether this step declares state variables, i.e., can be simulated with different integrators.
+  bool hasStateVariables() const;
+
+  //!@brief Returns the integrator of this step, or a null pointer if it does not declare any state variables.
+  cedar::dyn::IntegratorPtr getIntegrator() const;
+
+  /*!@brief Sets the integrator used by this step.
+   *
+   * @remarks Only steps that declare state variables can use a different integrator.
+   */
+  void setIntegrator(cedar::dyn::IntegratorPtr integrator);
+
+  /*!@brief Returns after how many trigger steps the dynamics were last updated.
+   *
+   *        In multi-rate simulation, dynamics with a time scale (see getTimeScale) that is slow compared to the fastest
+   *        field are only updated every few steps, with the time of all steps since their last update. In between,
+   *        their outputs hold their last value.
+   */
+  unsigned int getUpdateRatio() const;
 
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
 protected:
-  // none yet
+  /*!@brief Declares a matrix as part of the state of the dynamical system.
+   *
+   *        State variables have to be floating point matrices. The first call of this method adds the "integrator"
+   *        parameter to the step, so it should only be called in the constructor.
+   */
+  void declareStateVariable(cedar::aux::MatDataPtr stateVariable);
+
+  /*!@brief Computes the time derivative of the state, in units per second.
+   *
+   *        state and derivative hold one matrix for each state variable, in the order in which they were declared. The
+   *        state matrices are not necessarily the ones held by the declared data, as the integrators also evaluate the
+   *        derivative at intermediate states; the derivative matrices are already allocated. This method must be
+   *        overridden by all steps that declare state variables.
+   */
+  virtual void computeDerivative(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& derivative);
+
+  /*!@brief Returns the rate (per second) of a linear decay that is part of the derivative of all state variables.
+   *
+   *        If the derivative can be written as \f$\dot{x} = -\lambda x + N(x)\f$, exponential integrators solve the
+   *        linear part exactly. The default is zero, i.e., no linear decay is known.
+   */
+  virtual double getLinearDecayRate() const;
+
+  /*!@brief Returns the time scale of the dynamics, i.e., their time constant.
+   *
+   *        This determines how often the dynamics are updated in multi-rate simulation. The default is zero, i.e., the
+   *        time scale is unknown and the dynamics are updated in every step.
+   */
+  virtual cedar::unit::Time getTimeScale() const;
+
+  /*!@brief Advances the declared state variables by the given time with the selected integrator.
+   *
+   *        The state variables are accessed without locking them; steps that do not lock their data automatically
+   *        (see setAutoLockInputsAndOutputs) have to lock them before calling this method.
+   */
+  void integrateStateVariables(const cedar::unit::Time& time);
+
+  //!@brief Also discards the time that has accumulated since the last update in multi-rate simulation.
+  void resetComputationState() override;
 
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
 private:
-  //!@brief compute calls eulerStep
+  /*!@brief compute calls eulerStep, or integrationStep if an integrator other than forward Euler is selected
+   *
+   *        In multi-rate simulation, the call is skipped until as many steps have passed as given by the update ratio.
+   */
   void compute(const cedar::proc::Arguments& arguments);
 
   /*!@brief this is the core method of dynamics - here, an euler step is executed with a given Time interval time
+   *
+   *        The default implementation integrates the declared state variables with the forward Euler integrator.
+   *
    * @param time the time that has passed since the last call to this method
    */
-  virtual void eulerStep(const cedar::unit::Time& time) = 0;
+  virtual void eulerStep(const cedar::unit::Time& time);
+
+  /*!@brief Advances the dynamics by the given time with the selected integrator.
+   *
+   *        The default implementation calls integrateStateVariables. Override this to do work that is needed once per
+   *        time step rather than once per evaluation of the derivative, e.g., reading inputs or updating outputs that
+   *        are not part of the state.
+   */
+  virtual void integrationStep(const cedar::unit::Time& time);
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -98,6 +191,28 @@ protected:
 private:
   unsigned int mTimestepMeasurementId;
 
+  //! The data holding the state variables of the dynamical system.
+  std::vector<cedar::aux::MatDataPtr> mStateVariables;
+
+  //! Headers of the state variable matrices handed to the integrator; kept to avoid reallocating them in every step.
+  std::vector<cv::Mat> mIntegratedState;
+
+  //! The number of trigger steps between two updates of the dynamics.
+  std::atomic<unsigned int> mUpdateRatio;
+
+  //! Trigger steps that have passed since the last update.
+  unsigned int mPendingSteps;
+
+  //! Time that has passed since the last update.
+  cedar::unit::Time mPendingTime;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // parameters
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! The integrator used to advance the state variables; only present if there are state variables.
+  IntegratorParameterPtr _mIntegrator;
+
 }; // class cedar::dyn::Dynamics
 
 #endif // CEDAR_DYN_DYNAMICS_H
@@ -0,0 +1,116 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Integrator.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Base class for the integration schemes of cedar::dyn::Dynamics.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Integrator.h"
+#include "cedar/auxiliaries/assert.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::Integrator::Integrator()
+{
+}
+
+cedar::dyn::Integrator::~Integrator()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::Integrator::integrate
+     (
+       std::vector<cv::Mat>& state,
+       const cedar::unit::Time& time,
+       double decayRate,
+       const DerivativeFunction& derivative
+     )
+{
+  for (const auto& variable : state)
+  {
+    CEDAR_ASSERT(variable.depth() == CV_32F || variable.depth() == CV_64F);
+  }
+
+  double step_size = time / cedar::unit::Time(1.0 * cedar::unit::second);
+  if (step_size <= 0.0 || state.empty())
+  {
+    return;
+  }
+
+  this->step(state, step_size, decayRate, derivative);
+}
+
+void cedar::dyn::Integrator::allocateLike(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& buffers)
+{
+  buffers.resize(state.size());
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    // create does nothing if the buffer already has the right size and type
+    buffers[i].create(state[i].dims, state[i].size, state[i].type());
+  }
+}
+
+void cedar::dyn::Integrator::linearCombination
+     (
+       const std::vector<cv::Mat>& base,
+       std::initializer_list<std::pair<double, const std::vector<cv::Mat>*> > terms,
+       std::vector<cv::Mat>& result
+     )
+{
+  CEDAR_DEBUG_ASSERT(base.size() == result.size());
+
+  for (size_t i = 0; i < base.size(); ++i)
+  {
+    if (&result != &base)
+    {
+      base[i].copyTo(result[i]);
+    }
+
+    for (const auto& term : terms)
+    {
+      if (term.first != 0.0)
+      {
+        cv::scaleAdd((*term.second)[i], term.first, result[i], result[i]);
+      }
+    }
+  }
+}
@@ -0,0 +1,171 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        Integrator.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Base class for the integration schemes of cedar::dyn::Dynamics.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATOR_H
+#define CEDAR_DYN_INTEGRATOR_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/Configurable.h"
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/Integrator.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#ifndef Q_MOC_RUN
+  #include <boost/function.hpp>
+#endif // Q_MOC_RUN
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+
+/*!@brief Base class for all numerical schemes that advance the state of a cedar::dyn::Dynamics step in time.
+ *
+ *        An integrator only sees the state of the dynamical system as a list of floating point matrices and a function
+ *        that computes the time derivative of the state. It is selected per step through the "integrator" parameter of
+ *        cedar::dyn::Dynamics; new integrators are made available by registering them at the
+ *        cedar::dyn::IntegratorManagerSingleton.
+ */
+class cedar::dyn::Integrator : public cedar::aux::Configurable
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Function that writes the time derivative (per second) of the first argument into the second argument.
+   *
+   *        The matrices in the second argument already have the size and type of the corresponding state variables.
+   */
+  typedef boost::function<void (const std::vector<cv::Mat>&, std::vector<cv::Mat>&)> DerivativeFunction;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  Integrator();
+
+  //!@brief Destructor
+  virtual ~Integrator();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Advances the state by the given time.
+   *
+   * @param state      The state variables of the system. They are updated in place and are never reallocated.
+   * @param time       The time to simulate.
+   * @param decayRate  Rate (per second) of a linear decay -decayRate * x that is part of the derivative of all state
+   *                   variables, or zero. It is only used by exponential integrators, all others just need the
+   *                   derivative.
+   * @param derivative Computes the time derivative of a state.
+   */
+  void integrate
+       (
+         std::vector<cv::Mat>& state,
+         const cedar::unit::Time& time,
+         double decayRate,
+         const DerivativeFunction& derivative
+       );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  /*!@brief Advances the state by stepSize seconds; see integrate for the meaning of the other parameters.
+   */
+  virtual void step
+               (
+                 std::vector<cv::Mat>& state,
+                 double stepSize,
+                 double decayRate,
+                 const DerivativeFunction& derivative
+               ) = 0;
+
+  //!@brief Makes sure that each matrix in buffers has the size and type of the corresponding state variable.
+  static void allocateLike(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& buffers);
+
+  /*!@brief Computes result = base + sum of factor * term over all (factor, term) pairs for each state variable.
+   *
+   *        result may be the same as base; terms with a factor of zero are skipped.
+   */
+  static void linearCombination
+              (
+                const std::vector<cv::Mat>& base,
+                std::initializer_list<std::pair<double, const std::vector<cv::Mat>*> > terms,
+                std::vector<cv::Mat>& result
+              );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  // none yet
+
+}; // class cedar::dyn::Integrator
+
+#include "cedar/auxiliaries/FactoryManager.h"
+#include "cedar/auxiliaries/Singleton.h"
+
+CEDAR_DYN_EXPORT_SINGLETON(cedar::aux::FactoryManager<cedar::dyn::IntegratorPtr>);
+
+namespace cedar
+{
+  namespace dyn
+  {
+    //!@brief The manager of all integrator types.
+    typedef cedar::aux::FactoryManager<IntegratorPtr> IntegratorManager;
+
+    //!@brief The singleton object of the IntegratorManager.
+    typedef cedar::aux::Singleton<IntegratorManager> IntegratorManagerSingleton;
+  }
+}
+
+#endif // CEDAR_DYN_INTEGRATOR_H
@@ -69,6 +69,9 @@
 #include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/processing/Group.h"
 #include "cedar/auxiliaries/kernel/Box.h"
+#include "cedar/auxiliaries/ThreadPool.h"
+#include "cedar/dynamics/integrators/Euler.h"
+#include "cedar/processing/LoopedTrigger.h"
 
 // SYSTEM INCLUDES
 #include <iostream>
@@ -80,6 +83,8 @@
 #include <vector>
 #include <set>
 #include <string>
+#include <algorithm>
+#include <cmath>
 
 //----------------------------------------------------------------------------------------------------------------------
 // internal class: icon view for DNFs
@@ -143,6 +148,259 @@ namespace
   bool declared = declare();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// fused euler step kernels
+//----------------------------------------------------------------------------------------------------------------------
+namespace
+{
+  //! Fields with fewer elements than this (per thread) are updated on the calling thread.
+  const size_t FUSED_KERNEL_MIN_CHUNK_SIZE = 32768;
+
+  //! The kernels process the matrices in blocks of this many elements so that the block sums stay in the cache.
+  const size_t FUSED_KERNEL_BLOCK_SIZE = 1024;
+
+  //! How the input noise of a field is scaled before it is added to the activation.
+  enum class NoiseScaling
+  {
+    Additive,
+    MultiplicativeInput,
+    MultiplicativeActivation
+  };
+
+  /*!@brief Sums up a block of floats.
+   *
+   *        Uses independent partial sums so that the compiler can vectorize the loop without reordering a single sum.
+   */
+  inline double sumBlock(const float* values, size_t count)
+  {
+    float partial[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+      partial[0] += values[i];
+      partial[1] += values[i + 1];
+      partial[2] += values[i + 2];
+      partial[3] += values[i + 3];
+    }
+    double sum = static_cast<double>(partial[0]) + partial[1] + partial[2] + partial[3];
+    for (; i < count; ++i)
+    {
+      sum += values[i];
+    }
+    return sum;
+  }
+
+  /*!@brief Runs kernel(begin, end) over [0, count), split across the global thread pool for large matrices.
+   *
+   * @returns The sum of the values returned by the kernel for each chunk.
+   */
+  template <typename Kernel>
+  double runFusedKernel(size_t count, const Kernel& kernel)
+  {
+    auto thread_pool = cedar::aux::ThreadPoolSingleton::getInstance();
+    size_t chunks = 1;
+    if (thread_pool->getNumberOfThreads() > 0)
+    {
+      chunks = std::min(static_cast<size_t>(thread_pool->getNumberOfThreads()) + 1, count / FUSED_KERNEL_MIN_CHUNK_SIZE);
+    }
+
+    if (chunks <= 1)
+    {
+      return kernel(0, count);
+    }
+
+    std::vector<double> partial_sums(chunks, 0.0);
+    std::vector<cedar::aux::ThreadPool::Task> tasks;
+    tasks.reserve(chunks);
+    for (size_t chunk = 0; chunk < chunks; ++chunk)
+    {
+      size_t begin = (count * chunk) / chunks;
+      size_t end = (count * (chunk + 1)) / chunks;
+      tasks.push_back([&kernel, &partial_sums, chunk, begin, end]()
+      {
+        partial_sums[chunk] = kernel(begin, end);
+      });
+    }
+    thread_pool->run(tasks);
+
+    // the partial sums are added up in a fixed order so the result does not depend on the scheduling
+    double sum = 0.0;
+    for (double partial_sum : partial_sums)
+    {
+      sum += partial_sum;
+    }
+    return sum;
+  }
+
+  /*!@brief Writes sigma(u + noiseFactor * neuralNoise) into sigmoidU for all elements in [begin, end).
+   *
+   *        neuralNoise may be null, in which case no noise is added.
+   *
+   * @returns The sum over the written sigmoid values.
+   */
+  template <typename SigmoidFunction>
+  double fusedSigmoid
+  (
+    const SigmoidFunction& sigmoid,
+    const float* u,
+    const float* neuralNoise,
+    float noiseFactor,
+    float* sigmoidU,
+    size_t begin,
+    size_t end
+  )
+  {
+    double sum = 0.0;
+    for (size_t block_begin = begin; block_begin < end; block_begin += FUSED_KERNEL_BLOCK_SIZE)
+    {
+      size_t block_end = std::min(block_begin + FUSED_KERNEL_BLOCK_SIZE, end);
+      if (neuralNoise != nullptr)
+      {
+        for (size_t i = block_begin; i < block_end; ++i)
+        {
+          sigmoidU[i] = sigmoid(u[i] + noiseFactor * neuralNoise[i]);
+        }
+      }
+      else
+      {
+        for (size_t i = block_begin; i < block_end; ++i)
+        {
+          sigmoidU[i] = sigmoid(u[i]);
+        }
+      }
+      sum += sumBlock(sigmoidU + block_begin, block_end - block_begin);
+    }
+    return sum;
+  }
+
+  //! Branch-free single precision version of cedar::aux::math::sigmoidAbs.
+  struct AbsSigmoidFunction
+  {
+    AbsSigmoidFunction(const cedar::aux::math::AbsSigmoid& sigmoid)
+    :
+    mBeta(static_cast<float>(sigmoid.getBeta())),
+    mThreshold(static_cast<float>(sigmoid.getThreshold()))
+    {
+    }
+
+    inline float operator()(float value) const
+    {
+      float shifted = mBeta * (value - mThreshold);
+      return 0.5f * (1.0f + shifted / (1.0f + std::abs(shifted)));
+    }
+
+    float mBeta;
+    float mThreshold;
+  };
+
+  /*!@brief Integrates one euler step of the field equation in place for all elements in [begin, end).
+   *
+   *        u += dt/tau * (-u + constantInput + lateral + input) + noiseFactor * scaled noise
+   *
+   *        In the multiplicative noise modes, the scaled noise is written back to noise.
+   */
+  template <NoiseScaling scaling>
+  double fusedEulerUpdate
+  (
+    float* u,
+    const float* lateral,
+    const float* input,
+    float* noise,
+    float constantInput,
+    float timeFactor,
+    float noiseFactor,
+    size_t begin,
+    size_t end
+  )
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      float d_u = constantInput - u[i] + lateral[i] + input[i];
+      float n = noise[i];
+      switch (scaling)
+      {
+        case NoiseScaling::MultiplicativeInput:
+          n *= input[i];
+          noise[i] = n;
+          break;
+
+        case NoiseScaling::MultiplicativeActivation:
+          n *= u[i];
+          noise[i] = n;
+          break;
+
+        case NoiseScaling::Additive:
+          break;
+      }
+      u[i] += timeFactor * d_u + noiseFactor * n;
+    }
+    return 0.0;
+  }
+
+  /*!@brief Writes the time derivative of the field equation for all elements in [begin, end).
+   *
+   *        dU = rate * (-u + constantInput + lateral + input)
+   */
+  double fusedDerivative
+  (
+    const float* u,
+    const float* lateral,
+    const float* input,
+    float constantInput,
+    float rate,
+    float* dU,
+    size_t begin,
+    size_t end
+  )
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      dU[i] = rate * (constantInput - u[i] + lateral[i] + input[i]);
+    }
+    return 0.0;
+  }
+
+  /*!@brief Adds the scaled input noise to u for all elements in [begin, end).
+   *
+   *        This is the stochastic part of fusedEulerUpdate for integrators that handle the deterministic part.
+   */
+  template <NoiseScaling scaling>
+  double fusedNoiseUpdate(float* u, const float* input, float* noise, float noiseFactor, size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      float n = noise[i];
+      switch (scaling)
+      {
+        case NoiseScaling::MultiplicativeInput:
+          n *= input[i];
+          noise[i] = n;
+          break;
+
+        case NoiseScaling::MultiplicativeActivation:
+          n *= u[i];
+          noise[i] = n;
+          break;
+
+        case NoiseScaling::Additive:
+          break;
+      }
+      u[i] += noiseFactor * n;
+    }
+    return 0.0;
+  }
+
+  //! Returns the matrix if it is continuous, otherwise a continuous copy of it.
+  inline cv::Mat continuous(const cv::Mat& matrix)
+  {
+    if (matrix.isContinuous())
+    {
+      return matrix;
+    }
+    return matrix.clone();
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -158,6 +416,7 @@ mMaximumLocation(new cedar::aux::MatData(cv::Mat::zeros(2, 1, CV_32F))),
 mCurrentDeltaT(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F))),
 mLateralKernelEducational(new cedar::aux::MatData(cv::Mat::zeros(50,50,CV_32F))),
 mIsActive(false),
+mStepNeuralNoiseFactor(0.0f),
 // parameters
 _mOutputActivation(new cedar::aux::BoolParameter(this, "activation as output", false)),
 _mDiscreteMetric(new cedar::aux::BoolParameter(this, "discrete metric (workaround)", false)),
@@ -250,12 +509,16 @@ mGlobalInhibition
 _mLateralKernelConvolution(new cedar::aux::conv::Convolution()),
 _mNoiseCorrelationKernelConvolution(new cedar::aux::conv::Convolution())
 {
+  this->mLateralWeight = 0.0f;
+  this->mLateralWeightValid = false;
+
   this->mXMLExportable = true;
   this->mXMLParameterWhitelist = {"time scale", "resting level", "global inhibition", "input noise gain"};
 
   this->setAutoLockInputsAndOutputs(false);
 
   this->declareBuffer("activation", mActivation);
+  this->declareStateVariable(mActivation);
   this->declareBuffer("lateral interaction", mLateralInteraction);
   this->declareBuffer("lateral kernel", this->_mLateralKernelConvolution->getCombinedKernel());
   this->declareBuffer("neural noise kernel", this->_mNoiseCorrelationKernelConvolution->getCombinedKernel());
@@ -275,12 +538,20 @@ _mNoiseCorrelationKernelConvolution(new cedar::aux::conv::Convolution())
   this->updateSizesRange();
 
   this->declareInputCollection("input");
+  // the input is only ever read through Sum::sumSlot, which adds broadcast views via their source
+  this->getInputSlot("input")->setAcceptsBroadcastViews(true);
 
   this->_mOutputActivation->markAdvanced();
   this->_mDiscreteMetric->markAdvanced();
   this->_mUpdateStepGui->markAdvanced();
   this->_mUpdateStepGuiThreshold->markAdvanced();
 
+  this->_mPopulationBackend = cedar::aux::BoolParameterPtr
+                              (
+                                new cedar::aux::BoolParameter(this, "population backend", false)
+                              );
+  this->_mPopulationBackend->markAdvanced();
+
   // setup default kernels
   std::vector<cedar::aux::kernel::KernelPtr> kernel_defaults;
   for (unsigned int i = 0; i < 1; i++)
@@ -328,6 +599,22 @@ _mNoiseCorrelationKernelConvolution(new cedar::aux::conv::Convolution())
   QObject::connect(mGlobalInhibition.get(),SIGNAL(valueChanged()),this , SLOT(updateEducationalKernel()));
   QObject::connect(_mLateralKernelConvolution.get(),SIGNAL(combinedKernelUpdated()),this , SLOT(updateEducationalKernel())); //,Qt::DirectConnection
   QObject::connect(mTau.get(),SIGNAL(valueChanged()),this,SLOT(timescaleChanged()));
+  QObject::connect
+  (
+    _mLateralKernelConvolution.get(),
+    SIGNAL(combinedKernelUpdated()),
+    this,
+    SLOT(invalidateLateralWeight()),
+    Qt::DirectConnection
+  );
+  QObject::connect
+  (
+    _mLateralKernelConvolution.get(),
+    SIGNAL(configurationChanged()),
+    this,
+    SLOT(invalidateLateralWeight()),
+    Qt::DirectConnection
+  );
 
 
 
@@ -347,6 +634,8 @@ _mNoiseCorrelationKernelConvolution(new cedar::aux::conv::Convolution())
 
 cedar::dyn::NeuralField::~NeuralField()
 {
+    this->leavePopulation();
+
     if(auto clockSingleton = cedar::aux::GlobalClockSingleton::getInstance())
     {
         clockSingleton->updateCurrentMinTau();
@@ -418,6 +707,7 @@ void cedar::dyn::NeuralField::slotKernelAdded(size_t kernelIndex)
   cedar::aux::kernel::KernelPtr kernel = this->_mKernels->at(kernelIndex);
 
   this->addKernelToConvolution(kernel);
+  this->invalidateLateralWeight();
 }
 
 void cedar::dyn::NeuralField::transferKernelsToConvolution()
@@ -438,6 +728,12 @@ void cedar::dyn::NeuralField::addKernelToConvolution(cedar::aux::kernel::KernelP
 void cedar::dyn::NeuralField::removeKernelFromConvolution(size_t index)
 {
   this->getConvolution()->getKernelList()->remove(index);
+  this->invalidateLateralWeight();
+}
+
+void cedar::dyn::NeuralField::invalidateLateralWeight()
+{
+  this->mLateralWeightValid = false;
 }
 
 void cedar::dyn::NeuralField::readConfiguration(const cedar::aux::ConfigurationNode& node)
@@ -568,10 +864,19 @@ cedar::proc::DataSlot::VALIDITY cedar::dyn::NeuralField::determineInputValidity
 
 void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
 {
+  if (auto population = boost::atomic_load(&this->mPopulation))
+  {
+    cedar::dyn::NeuralFieldPopulation::MemberResult result;
+    if (population->step(this, time, result))
+    {
+      this->applyPopulationResult(time, result);
+      return;
+    }
+  }
+
   // get all members needed for the Euler step
   cv::Mat& lateral_interaction = this->mLateralInteraction->getData();
   cv::Mat& input_noise = this->mInputNoise->getData();
-  cv::Mat& neural_noise = this->mNeuralNoise->getData();
   cv::Mat& u = this->mActivation->getData();
   cv::Mat& input_sum = this->mInputSum->getData();
   const double& h = mRestingLevel->getValue();
@@ -586,25 +891,278 @@ void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
 
   QWriteLocker sigmoid_u_lock(&this->mSigmoidalActivation->getLock());
   cv::Mat& sigmoid_u = this->mSigmoidalActivation->getData();
+  CEDAR_ASSERT(u.type() == CV_32F && u.isContinuous());
+  const size_t num_elements = u.total();
+
+  float neural_noise_factor;
+  cv::Mat neural_noise_sample = this->sampleNeuralNoise(time, neural_noise_factor);
+
+  // calculate output and its sum (needed for the global inhibition) in one pass
+  double sigmoid_sum = this->computeSigmoid(u, neural_noise_sample, neural_noise_factor, sigmoid_u);
+  this->updateStepIconState(sigmoid_u);
+  sigmoid_u_lock.unlock();
+
+  QReadLocker sigmoid_u_readlock(&this->mSigmoidalActivation->getLock());
+  lateral_interaction = this->_mLateralKernelConvolution->convolve(sigmoid_u);
+
+  this->updateInputSum();
+
+  CEDAR_ASSERT(u.size == sigmoid_u.size);
+  CEDAR_ASSERT(u.size == lateral_interaction.size);
+  CEDAR_ASSERT(u.size == input_sum.size);
+
+  boost::shared_ptr<QWriteLocker> activation_write_locker;
+  if (this->activationIsOutput())
+  {
+    activation_read_locker->unlock();
+    activation_write_locker = boost::shared_ptr<QWriteLocker>(new QWriteLocker(&this->mActivation->getLock()));
+  }
+
+  cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+
+  const cv::Mat lateral = continuous(lateral_interaction);
+  const cv::Mat input = continuous(input_sum);
+  CEDAR_ASSERT(input_noise.isContinuous());
+
+  // the field equation is integrated in a single pass over all matrices; the terms that are constant across the field
+  // are added up in double precision first
+  float constant_input = static_cast<float>(h + global_inhibition * sigmoid_sum);
+  float time_factor
+    = static_cast<float>(time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds));
+  float noise_factor
+    = static_cast<float>
+      (
+        (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
+        * _mInputNoiseGain->getValue()
+      );
+
+  float* u_data = u.ptr<float>();
+  const float* lateral_data = lateral.ptr<float>();
+  const float* input_data = input.ptr<float>();
+  float* noise_data = input_noise.ptr<float>();
+
+  if (_mMultiplicativeNoiseInput->getValue() != 0)
+  {
+    runFusedKernel(num_elements, [&](size_t begin, size_t end)
+    {
+      return fusedEulerUpdate<NoiseScaling::MultiplicativeInput>
+             (
+               u_data, lateral_data, input_data, noise_data, constant_input, time_factor, noise_factor, begin, end
+             );
+    });
+  }
+  else if (_mMultiplicativeNoiseActivation->getValue() != 0)
+  {
+    runFusedKernel(num_elements, [&](size_t begin, size_t end)
+    {
+      return fusedEulerUpdate<NoiseScaling::MultiplicativeActivation>
+             (
+               u_data, lateral_data, input_data, noise_data, constant_input, time_factor, noise_factor, begin, end
+             );
+    });
+  }
+  else
+  {
+    runFusedKernel(num_elements, [&](size_t begin, size_t end)
+    {
+      return fusedEulerUpdate<NoiseScaling::Additive>
+             (
+               u_data, lateral_data, input_data, noise_data, constant_input, time_factor, noise_factor, begin, end
+             );
+    });
+  }
+
+  mCurrentDeltaT->getData().at<float>(0,0)= time / cedar::unit::seconds;
+}
+
+bool cedar::dyn::NeuralField::gatherPopulationState
+     (
+       const cedar::unit::Time& time,
+       cedar::dyn::NeuralFieldPopulation::MemberState& state
+     )
+{
+  if
+  (
+    !this->_mPopulationBackend->getValue()
+    || this->getDimensionality() != 0
+    || this->getUpdateRatio() != 1
+    || this->mNoiseCorrelationKernel->getAmplitude() != 0.0
+  )
+  {
+    return false;
+  }
+
+  cedar::dyn::IntegratorPtr integrator = this->getIntegrator();
+  if (integrator && !boost::dynamic_pointer_cast<cedar::dyn::integrators::Euler>(integrator))
+  {
+    return false;
+  }
+
+  cedar::aux::math::TransferFunctionPtr transfer_function = this->_mSigmoid->getValue();
+  auto abs_sigmoid = dynamic_cast<cedar::aux::math::AbsSigmoid*>(transfer_function.get());
+  if (abs_sigmoid == nullptr)
+  {
+    return false;
+  }
+
+  {
+    // as in eulerStep, the activation is only locked here if it is an output; buffers are locked by the computing step
+    boost::shared_ptr<QReadLocker> activation_read_locker;
+    if (this->activationIsOutput())
+    {
+      activation_read_locker = boost::shared_ptr<QReadLocker>(new QReadLocker(&this->mActivation->getLock()));
+    }
+    const cv::Mat& u = this->mActivation->getData();
+    if (u.type() != CV_32F || u.total() != 1)
+    {
+      return false;
+    }
+    state.activation = u.at<float>(0, 0);
+  }
+
+  // for a single node, the lateral interaction is the combined kernel convolved with the output
+  if (!this->mLateralWeightValid)
+  {
+    this->mLateralWeightValid = true;
+    cv::Mat lateral = this->_mLateralKernelConvolution->convolve(cv::Mat::ones(1, 1, CV_32F));
+    this->mLateralWeight = lateral.empty() ? 0.0f : lateral.at<float>(0, 0);
+  }
+
+  const double tau = this->mTau->getValue();
+  state.restingLevel = static_cast<float>(this->mRestingLevel->getValue());
+  state.lateralWeight = this->mLateralWeight;
+  state.globalInhibition = static_cast<float>(this->mGlobalInhibition->getValue());
+  state.beta = static_cast<float>(abs_sigmoid->getBeta());
+  state.threshold = static_cast<float>(abs_sigmoid->getThreshold());
+  state.timeFactor
+    = static_cast<float>(time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds));
+  state.noiseFactor
+    = static_cast<float>
+      (
+        (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
+        * this->_mInputNoiseGain->getValue()
+      );
+  state.multiplicativeNoiseInput = this->_mMultiplicativeNoiseInput->getValue();
+  state.multiplicativeNoiseActivation = this->_mMultiplicativeNoiseActivation->getValue();
+  return true;
+}
+
+void cedar::dyn::NeuralField::setPopulationSigmoid(float sigmoid)
+{
+  QWriteLocker sigmoid_u_lock(&this->mSigmoidalActivation->getLock());
+  cv::Mat& sigmoid_u = this->mSigmoidalActivation->getData();
+  if (sigmoid_u.type() != CV_32F || sigmoid_u.total() != 1)
+  {
+    sigmoid_u = cv::Mat(1, 1, CV_32F);
+  }
+  sigmoid_u.at<float>(0, 0) = sigmoid;
+
+  // the output is written outside of this field's compute call, so steps downstream must not reuse their results
+  this->mSigmoidalActivation->markChanged();
+  this->mSigmoidalActivation->publish();
+}
+
+void cedar::dyn::NeuralField::applyPopulationResult
+     (
+       const cedar::unit::Time& time,
+       const cedar::dyn::NeuralFieldPopulation::MemberResult& result
+     )
+{
+  // the input is summed only now so that steps between this field and its inputs have been computed, just as for the
+  // field's own euler step
+  this->updateInputSum();
+  float input = this->mInputSum->getData().at<float>(0, 0);
+  float noise = result.noiseScaledByInput ? result.noise * input : result.noise;
+
+  {
+    boost::shared_ptr<QWriteLocker> activation_write_locker;
+    if (this->activationIsOutput())
+    {
+      activation_write_locker = boost::shared_ptr<QWriteLocker>(new QWriteLocker(&this->mActivation->getLock()));
+    }
+    this->mActivation->getData().at<float>(0, 0)
+      = result.activation + result.timeFactor * input + result.noiseFactor * noise;
+  }
+
+  {
+    QReadLocker sigmoid_u_readlock(&this->mSigmoidalActivation->getLock());
+    this->updateStepIconState(this->mSigmoidalActivation->getData());
+  }
+
+  this->mLateralInteraction->getData().at<float>(0, 0) = result.lateral;
+  this->mInputNoise->getData().at<float>(0, 0) = noise;
+  mCurrentDeltaT->getData().at<float>(0,0)= time / cedar::unit::seconds;
+}
+
+void cedar::dyn::NeuralField::leavePopulation()
+{
+  if (auto population = boost::atomic_exchange(&this->mPopulation, cedar::dyn::NeuralFieldPopulationPtr()))
+  {
+    population->leave(this);
+  }
+}
+
+cv::Mat cedar::dyn::NeuralField::sampleNeuralNoise(const cedar::unit::Time& time, float& noiseFactor)
+{
+  noiseFactor = 0.0f;
+
   // if the neural noise correlation kernel has an amplitude != 0, create new random values and convolve
-  if (mNoiseCorrelationKernel->getAmplitude() != 0.0)
+  if (mNoiseCorrelationKernel->getAmplitude() == 0.0)
   {
-    cv::randn(neural_noise, cv::Scalar(0), cv::Scalar(1));
-    neural_noise = this->_mNoiseCorrelationKernelConvolution->convolve(neural_noise);
+    return cv::Mat();
+  }
 
-    //!@todo document why this has to use sqrt(time) for noise
-    sigmoid_u = _mSigmoid->getValue()->compute
-                (
-                  u
-                  + sqrt(time / (1.0 * cedar::unit::second)) * neural_noise
-                );
+  cv::Mat& neural_noise = this->mNeuralNoise->getData();
+  cv::randn(neural_noise, cv::Scalar(0), cv::Scalar(1));
+  neural_noise = continuous(this->_mNoiseCorrelationKernelConvolution->convolve(neural_noise));
+
+  //!@todo document why this has to use sqrt(time) for noise
+  noiseFactor = static_cast<float>(sqrt(time / (1.0 * cedar::unit::second)));
+  return neural_noise;
+}
+
+double cedar::dyn::NeuralField::computeSigmoid
+       (
+         const cv::Mat& u,
+         const cv::Mat& neuralNoise,
+         float neuralNoiseFactor,
+         cv::Mat& sigmoidU
+       ) const
+{
+  // the sigmoid is written into the existing buffer; it only has to be reallocated when the field's size changes
+  if (sigmoidU.type() != CV_32F || sigmoidU.size != u.size || !sigmoidU.isContinuous())
+  {
+    sigmoidU.create(u.dims, u.size, CV_32F);
+  }
+
+  cedar::aux::math::TransferFunctionPtr transfer_function = _mSigmoid->getValue();
+  if (auto abs_sigmoid = dynamic_cast<cedar::aux::math::AbsSigmoid*>(transfer_function.get()))
+  {
+    CEDAR_ASSERT(u.type() == CV_32F && u.isContinuous());
+    AbsSigmoidFunction sigmoid(*abs_sigmoid);
+    const float* u_data = u.ptr<float>();
+    const float* neural_noise_data = neuralNoise.empty() ? nullptr : neuralNoise.ptr<float>();
+    float* sigmoid_u_data = sigmoidU.ptr<float>();
+    return runFusedKernel(u.total(), [&](size_t begin, size_t end)
+    {
+      return fusedSigmoid(sigmoid, u_data, neural_noise_data, neuralNoiseFactor, sigmoid_u_data, begin, end);
+    });
+  }
+
+  if (!neuralNoise.empty())
+  {
+    cv::scaleAdd(neuralNoise, neuralNoiseFactor, u, sigmoidU);
+    transfer_function->compute(sigmoidU, sigmoidU);
   }
   else
   {
-    // calculate output
-    sigmoid_u = _mSigmoid->getValue()->compute(u);
+    transfer_function->compute(u, sigmoidU);
   }
-//  //Experimental Part to Update the GUI
+  return cv::sum(sigmoidU)[0];
+}
+
+void cedar::dyn::NeuralField::updateStepIconState(const cv::Mat& sigmoid_u)
+{
   if(_mUpdateStepGui->getValue() && cedar::proc::gui::SettingsSingleton::getInstance()->getUseDynamicFieldIcons() )
   {
     double maximum =std::numeric_limits<double>::min();
@@ -668,48 +1226,119 @@ void cedar::dyn::NeuralField::eulerStep(const cedar::unit::Time& time)
       emit outPutValueChanged(mIsActive);
     }
   }
-  //End of Experimental Part
-  sigmoid_u_lock.unlock();
+}
 
-  QReadLocker sigmoid_u_readlock(&this->mSigmoidalActivation->getLock());
-  lateral_interaction = this->_mLateralKernelConvolution->convolve(sigmoid_u);
+double cedar::dyn::NeuralField::getLinearDecayRate() const
+{
+  // tau is given in milliseconds, the rate is per second
+  return 1000.0 / this->mTau->getValue();
+}
 
-  this->updateInputSum();
+cedar::unit::Time cedar::dyn::NeuralField::getTimeScale() const
+{
+  return cedar::unit::Time(this->mTau->getValue() * cedar::unit::milli * cedar::unit::seconds);
+}
 
-  CEDAR_ASSERT(u.size == sigmoid_u.size);
-  CEDAR_ASSERT(u.size == lateral_interaction.size);
-  CEDAR_ASSERT(u.size == input_sum.size);
+void cedar::dyn::NeuralField::computeDerivative(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& derivative)
+{
+  const cv::Mat& u = state.at(0);
+  cv::Mat& d_u = derivative.at(0);
+  CEDAR_ASSERT(u.type() == CV_32F && u.isContinuous());
+  CEDAR_ASSERT(d_u.type() == CV_32F && d_u.isContinuous());
+
+  // the sigmoid of intermediate states is not an output of the field, so it goes into a separate buffer
+  double sigmoid_sum
+    = this->computeSigmoid(u, this->mStepNeuralNoise, this->mStepNeuralNoiseFactor, this->mStageSigmoidalActivation);
+
+  cv::Mat& lateral_interaction = this->mLateralInteraction->getData();
+  lateral_interaction = this->_mLateralKernelConvolution->convolve(this->mStageSigmoidalActivation);
 
-  // the field equation (split up into four separate computations as putting them all in one sum results in strange
-  // behaviour, probably due to rounding problems or float inaccuracies)
-  cv::Mat d_u = -u + h;
-  d_u += lateral_interaction;
-  d_u += global_inhibition * cv::sum(sigmoid_u)[0];
-  d_u += input_sum;
+  CEDAR_ASSERT(u.size == lateral_interaction.size);
+  CEDAR_ASSERT(u.size == this->mInputSum->getData().size);
+
+  const cv::Mat lateral = continuous(lateral_interaction);
+  const cv::Mat input = continuous(this->mInputSum->getData());
+  float constant_input
+    = static_cast<float>(this->mRestingLevel->getValue() + this->mGlobalInhibition->getValue() * sigmoid_sum);
+  float rate = static_cast<float>(this->getLinearDecayRate());
+
+  const float* u_data = u.ptr<float>();
+  const float* lateral_data = lateral.ptr<float>();
+  const float* input_data = input.ptr<float>();
+  float* d_u_data = d_u.ptr<float>();
+  runFusedKernel(u.total(), [&](size_t begin, size_t end)
+  {
+    return fusedDerivative(u_data, lateral_data, input_data, constant_input, rate, d_u_data, begin, end);
+  });
+}
 
+void cedar::dyn::NeuralField::integrationStep(const cedar::unit::Time& time)
+{
+  // the activation is locked automatically only while it is a buffer
   boost::shared_ptr<QWriteLocker> activation_write_locker;
   if (this->activationIsOutput())
   {
-    activation_read_locker->unlock();
     activation_write_locker = boost::shared_ptr<QWriteLocker>(new QWriteLocker(&this->mActivation->getLock()));
   }
 
-  cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+  cv::Mat& u = this->mActivation->getData();
+  CEDAR_ASSERT(u.type() == CV_32F && u.isContinuous());
 
+  // neural noise and inputs are sampled once per time step and stay the same for all evaluations of the derivative
+  this->mStepNeuralNoise = this->sampleNeuralNoise(time, this->mStepNeuralNoiseFactor);
+  this->updateInputSum();
 
-    if(_mMultiplicativeNoiseInput->getValue() != 0)
+  this->integrateStateVariables(time);
+
+  // the input noise is added after the deterministic part of the step, just as in the euler step
+  cv::Mat& input_noise = this->mInputNoise->getData();
+  cv::randn(input_noise, cv::Scalar(0), cv::Scalar(1));
+  CEDAR_ASSERT(input_noise.isContinuous());
+  const cv::Mat input = continuous(this->mInputSum->getData());
+  float noise_factor
+    = static_cast<float>
+      (
+        (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / mTau->getValue())
+        * _mInputNoiseGain->getValue()
+      );
+
+  float* u_data = u.ptr<float>();
+  const float* input_data = input.ptr<float>();
+  float* noise_data = input_noise.ptr<float>();
+  if (_mMultiplicativeNoiseInput->getValue() != 0)
+  {
+    runFusedKernel(u.total(), [&](size_t begin, size_t end)
     {
-        input_noise = input_noise.mul(this->mInputSum->getData()); //cv::sum(input_sum)[0];
-    }
-    else if(_mMultiplicativeNoiseActivation->getValue() != 0)
+      return fusedNoiseUpdate<NoiseScaling::MultiplicativeInput>
+             (
+               u_data, input_data, noise_data, noise_factor, begin, end
+             );
+    });
+  }
+  else if (_mMultiplicativeNoiseActivation->getValue() != 0)
+  {
+    runFusedKernel(u.total(), [&](size_t begin, size_t end)
     {
-        input_noise = input_noise.mul(this->mActivation->getData()); //cv::sum(input_sum)[0];
-    }
+      return fusedNoiseUpdate<NoiseScaling::MultiplicativeActivation>
+             (
+               u_data, input_data, noise_data, noise_factor, begin, end
+             );
+    });
+  }
+  else
+  {
+    runFusedKernel(u.total(), [&](size_t begin, size_t end)
+    {
+      return fusedNoiseUpdate<NoiseScaling::Additive>(u_data, input_data, noise_data, noise_factor, begin, end);
+    });
+  }
 
-    // integrate one time step
-    u += time / cedar::unit::Time(tau * cedar::unit::milli * cedar::unit::seconds) * d_u
-         + (sqrt(time / (cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::seconds))) / tau)
-           * _mInputNoiseGain->getValue() * input_noise;
+  // unlike in the euler step, the output is the sigmoid of the new activation
+  QWriteLocker sigmoid_u_lock(&this->mSigmoidalActivation->getLock());
+  cv::Mat& sigmoid_u = this->mSigmoidalActivation->getData();
+  this->computeSigmoid(u, this->mStepNeuralNoise, this->mStepNeuralNoiseFactor, sigmoid_u);
+  this->updateStepIconState(sigmoid_u);
+  sigmoid_u_lock.unlock();
 
   mCurrentDeltaT->getData().at<float>(0,0)= time / cedar::unit::seconds;
 }
@@ -870,10 +1499,21 @@ void cedar::dyn::NeuralField::onStart()
 {
   this->_mDimensionality->setConstant(true);
   this->_mSizes->setConstant(true);
+
+  // nodes of the same looped trigger are integrated together
+  if (this->_mPopulationBackend->getValue() && this->getDimensionality() == 0)
+  {
+    if (cedar::proc::LoopedTriggerPtr trigger = this->getLoopedTrigger())
+    {
+      this->mLateralWeightValid = false;
+      boost::atomic_store(&this->mPopulation, cedar::dyn::NeuralFieldPopulation::join(trigger, this));
+    }
+  }
 }
 
 void cedar::dyn::NeuralField::onStop()
 {
+  this->leavePopulation();
   this->_mDimensionality->setConstant(false);
   this->_mSizes->setConstant(false);
 }
@@ -52,6 +52,7 @@
 #include "cedar/auxiliaries/ObjectParameterTemplate.h"
 #include "cedar/auxiliaries/ObjectListParameterTemplate.h"
 #include "cedar/auxiliaries/kernel/Kernel.h"
+#include "cedar/dynamics/fields/NeuralFieldPopulation.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/MatData.fwd.h"
@@ -60,6 +61,7 @@
 #include "cedar/dynamics/fields/NeuralField.fwd.h"
 
 // SYSTEM INCLUDES
+#include <atomic>
 
 
 /*!@brief An implementation of Neural Fields for the processing framework.
@@ -71,6 +73,11 @@ class cedar::dyn::NeuralField : public cedar::dyn::Dynamics
   //--------------------------------------------------------------------------------------------------------------------
   Q_OBJECT
 
+  //--------------------------------------------------------------------------------------------------------------------
+  // friends
+  //--------------------------------------------------------------------------------------------------------------------
+  friend class cedar::dyn::NeuralFieldPopulation;
+
   //--------------------------------------------------------------------------------------------------------------------
   // nested types
   //--------------------------------------------------------------------------------------------------------------------
@@ -210,6 +217,22 @@ protected:
    */
   void eulerStep(const cedar::unit::Time& time);
 
+  /*!@brief Advances the field with the selected integrator.
+   *
+   *        Noise and inputs are sampled once per time step; the input noise is added after the deterministic part of
+   *        the field equation has been integrated.
+   */
+  void integrationStep(const cedar::unit::Time& time);
+
+  //!@brief The deterministic part of the field equation (see eulerStep), divided by tau.
+  void computeDerivative(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& derivative);
+
+  //!@brief Returns 1 / tau.
+  double getLinearDecayRate() const;
+
+  //!@brief Returns tau.
+  cedar::unit::Time getTimeScale() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // private methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -253,12 +276,47 @@ private:
 
   void updateSizesRange();
 
+  /*!@brief Draws new neural noise, which is added to the activation before it is passed through the sigmoid.
+   *
+   * @returns The (correlated) noise, or an empty matrix if the noise correlation kernel has an amplitude of zero.
+   */
+  cv::Mat sampleNeuralNoise(const cedar::unit::Time& time, float& noiseFactor);
+
+  /*!@brief Writes sigma(u + noiseFactor * neuralNoise) into sigmoidU, reallocating it only if its size changed.
+   *
+   * @returns The sum over all entries of sigmoidU.
+   */
+  double computeSigmoid(const cv::Mat& u, const cv::Mat& neuralNoise, float neuralNoiseFactor, cv::Mat& sigmoidU) const;
+
+  //!@brief Updates the location of the maximum and the active state of the step icon.
+  void updateStepIconState(const cv::Mat& sigmoid_u);
+
+  /*!@brief Reads the parameters and the activation of the field for cedar::dyn::NeuralFieldPopulation.
+   *
+   * @returns false if the field cannot currently be integrated by the population.
+   */
+  bool gatherPopulationState(const cedar::unit::Time& time, cedar::dyn::NeuralFieldPopulation::MemberState& state);
+
+  //!@brief Writes the output computed by the population.
+  void setPopulationSigmoid(float sigmoid);
+
+  //!@brief Adds the input to the result of the population's euler step and writes it into the buffers of the field.
+  void applyPopulationResult
+       (
+         const cedar::unit::Time& time,
+         const cedar::dyn::NeuralFieldPopulation::MemberResult& result
+       );
+
+  //!@brief Leaves the population the field is part of, if any.
+  void leavePopulation();
+
 
 private slots:
   void activationAsOutputChanged();
   void discreteMetricChanged();
   void updateEducationalKernel();
   void timescaleChanged();
+  void invalidateLateralWeight();
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -298,6 +356,24 @@ private:
   boost::signals2::connection mKernelRemovedConnection;
   bool mIsActive;
 
+  //! Neural noise of the current integration step, shared by all evaluations of the derivative.
+  cv::Mat mStepNeuralNoise;
+
+  //! Factor of the neural noise of the current integration step.
+  float mStepNeuralNoiseFactor;
+
+  //! Sigmoid of intermediate states of the integrators.
+  cv::Mat mStageSigmoidalActivation;
+
+  //! The population this field is integrated by, if any.
+  cedar::dyn::NeuralFieldPopulationPtr mPopulation;
+
+  //! Weight of the lateral interaction of a zero-dimensional field, i.e., the combined kernel convolved with one.
+  float mLateralWeight;
+
+  //! Whether mLateralWeight is up to date with the lateral kernels.
+  std::atomic<bool> mLateralWeightValid;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -349,6 +425,9 @@ protected:
   //!@brief Parameter that determines the convolution engine used by the field.
   cedar::aux::conv::ConvolutionPtr _mNoiseCorrelationKernelConvolution;
 
+  //!@brief Whether a zero-dimensional field is integrated together with the other nodes of its looped trigger.
+  cedar::aux::BoolParameterPtr _mPopulationBackend;
+
 private:
   // none yet
 
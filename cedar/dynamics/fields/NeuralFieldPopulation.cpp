@@ -0,0 +1,303 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        NeuralFieldPopulation.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::dyn::NeuralFieldPopulation.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/fields/NeuralFieldPopulation.h"
+#include "cedar/dynamics/fields/NeuralField.h"
+#include "cedar/processing/LoopedTrigger.h"
+#include "cedar/auxiliaries/assert.h"
+
+// SYSTEM INCLUDES
+#include <boost/weak_ptr.hpp>
+#include <QMutexLocker>
+#include <map>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  typedef std::map<const cedar::proc::LoopedTrigger*, cedar::dyn::NeuralFieldPopulationWeakPtr> PopulationRegistry;
+
+  //! The populations of all looped triggers that have members.
+  PopulationRegistry& populationRegistry()
+  {
+    static PopulationRegistry registry;
+    return registry;
+  }
+
+  QMutex& populationRegistryMutex()
+  {
+    static QMutex mutex;
+    return mutex;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::NeuralFieldPopulation::NeuralFieldPopulation()
+:
+mGeneration(0)
+{
+}
+
+cedar::dyn::NeuralFieldPopulation::~NeuralFieldPopulation()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::NeuralFieldPopulationPtr cedar::dyn::NeuralFieldPopulation::join
+                                     (
+                                       cedar::proc::LoopedTriggerPtr trigger,
+                                       cedar::dyn::NeuralField* field
+                                     )
+{
+  CEDAR_ASSERT(trigger);
+  CEDAR_ASSERT(field != nullptr);
+
+  cedar::dyn::NeuralFieldPopulationPtr population;
+  {
+    QMutexLocker registry_locker(&populationRegistryMutex());
+    PopulationRegistry& registry = populationRegistry();
+
+    // drop the entries of populations whose members have all left
+    for (auto iter = registry.begin(); iter != registry.end(); )
+    {
+      if (iter->second.expired())
+      {
+        iter = registry.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+
+    population = registry[trigger.get()].lock();
+    if (!population)
+    {
+      population = cedar::dyn::NeuralFieldPopulationPtr(new cedar::dyn::NeuralFieldPopulation());
+      registry[trigger.get()] = population;
+    }
+  }
+
+  QMutexLocker locker(&population->mMutex);
+  if (population->mMemberIndices.find(field) == population->mMemberIndices.end())
+  {
+    Member member;
+    member.mpField = field;
+    member.mConsumedGeneration = population->mGeneration;
+    member.mSlot = -1;
+    population->mMemberIndices[field] = population->mMembers.size();
+    population->mMembers.push_back(member);
+  }
+
+  return population;
+}
+
+void cedar::dyn::NeuralFieldPopulation::leave(cedar::dyn::NeuralField* field)
+{
+  QMutexLocker locker(&this->mMutex);
+  auto iter = this->mMemberIndices.find(field);
+  if (iter == this->mMemberIndices.end())
+  {
+    return;
+  }
+
+  this->mMembers.erase(this->mMembers.begin() + iter->second);
+  this->mMemberIndices.clear();
+  for (size_t i = 0; i < this->mMembers.size(); ++i)
+  {
+    this->mMemberIndices[this->mMembers.at(i).mpField] = i;
+  }
+
+  // the results of the last pass refer to the old members
+  for (auto& member : this->mMembers)
+  {
+    member.mSlot = -1;
+  }
+}
+
+size_t cedar::dyn::NeuralFieldPopulation::getNumberOfMembers() const
+{
+  QMutexLocker locker(&this->mMutex);
+  return this->mMembers.size();
+}
+
+bool cedar::dyn::NeuralFieldPopulation::step
+     (
+       cedar::dyn::NeuralField* field,
+       const cedar::unit::Time& time,
+       cedar::dyn::NeuralFieldPopulation::MemberResult& result
+     )
+{
+  QMutexLocker locker(&this->mMutex);
+  auto iter = this->mMemberIndices.find(field);
+  if (iter == this->mMemberIndices.end())
+  {
+    return false;
+  }
+
+  // a member that already received the result of the current pass starts the next time step
+  if (this->mMembers.at(iter->second).mConsumedGeneration == this->mGeneration)
+  {
+    this->integrate(time);
+    ++this->mGeneration;
+  }
+
+  Member& member = this->mMembers.at(iter->second);
+  member.mConsumedGeneration = this->mGeneration;
+  if (member.mSlot < 0)
+  {
+    return false;
+  }
+
+  size_t slot = static_cast<size_t>(member.mSlot);
+  result.activation = this->mActivation.at(slot);
+  result.lateral = this->mLateral.at(slot);
+  result.noise = this->mNoise.at<float>(0, static_cast<int>(slot));
+  result.timeFactor = this->mTimeFactor.at(slot);
+  result.noiseFactor = this->mNoiseFactor.at(slot);
+  result.noiseScaledByInput = this->mMultiplicativeInput.at(slot) != 0;
+  return true;
+}
+
+void cedar::dyn::NeuralFieldPopulation::resizeArrays(size_t size)
+{
+  this->mActivation.resize(size);
+  this->mRestingLevel.resize(size);
+  this->mLateralWeight.resize(size);
+  this->mGlobalInhibition.resize(size);
+  this->mBeta.resize(size);
+  this->mThreshold.resize(size);
+  this->mTimeFactor.resize(size);
+  this->mNoiseFactor.resize(size);
+  this->mNoiseScale.resize(size);
+  this->mMultiplicativeInput.resize(size);
+  this->mSigmoid.resize(size);
+  this->mLateral.resize(size);
+  this->mFields.resize(size);
+}
+
+void cedar::dyn::NeuralFieldPopulation::integrate(const cedar::unit::Time& time)
+{
+  this->resizeArrays(this->mMembers.size());
+
+  // gather the state of all members that can currently be integrated by the population
+  size_t count = 0;
+  for (auto& member : this->mMembers)
+  {
+    cedar::dyn::NeuralFieldPopulation::MemberState state;
+    if (!member.mpField->gatherPopulationState(time, state))
+    {
+      member.mSlot = -1;
+      continue;
+    }
+
+    member.mSlot = static_cast<int>(count);
+    this->mFields[count] = member.mpField;
+    this->mActivation[count] = state.activation;
+    this->mRestingLevel[count] = state.restingLevel;
+    this->mLateralWeight[count] = state.lateralWeight;
+    this->mGlobalInhibition[count] = state.globalInhibition;
+    this->mBeta[count] = state.beta;
+    this->mThreshold[count] = state.threshold;
+    this->mTimeFactor[count] = state.timeFactor;
+    this->mNoiseFactor[count] = state.noiseFactor;
+    this->mMultiplicativeInput[count] = state.multiplicativeNoiseInput;
+    // noise that is scaled by the input is scaled by each member once it has summed its input
+    this->mNoiseScale[count]
+      = (!state.multiplicativeNoiseInput && state.multiplicativeNoiseActivation) ? state.activation : 1.0f;
+    ++count;
+  }
+
+  if (count == 0)
+  {
+    return;
+  }
+
+  const float* beta = this->mBeta.data();
+  const float* threshold = this->mThreshold.data();
+  float* u = this->mActivation.data();
+  float* sigmoid = this->mSigmoid.data();
+
+  // outputs of all members, see cedar::aux::math::sigmoidAbs
+  for (size_t i = 0; i < count; ++i)
+  {
+    float shifted = beta[i] * (u[i] - threshold[i]);
+    sigmoid[i] = 0.5f * (1.0f + shifted / (1.0f + std::abs(shifted)));
+  }
+
+  // publish the outputs first so that members connected to each other receive the outputs of this time step
+  for (size_t i = 0; i < count; ++i)
+  {
+    this->mFields[i]->setPopulationSigmoid(sigmoid[i]);
+  }
+
+  if (this->mNoise.cols != static_cast<int>(count))
+  {
+    this->mNoise.create(1, static_cast<int>(count), CV_32F);
+  }
+  cv::randn(this->mNoise, cv::Scalar(0), cv::Scalar(1));
+
+  const float* h = this->mRestingLevel.data();
+  const float* lateral_weight = this->mLateralWeight.data();
+  const float* global_inhibition = this->mGlobalInhibition.data();
+  const float* time_factor = this->mTimeFactor.data();
+  const float* noise_scale = this->mNoiseScale.data();
+  float* lateral = this->mLateral.data();
+  float* noise = this->mNoise.ptr<float>();
+
+  // the field equation of all members without the input and the noise in one branch-free pass, see
+  // cedar::dyn::NeuralField::eulerStep; each member adds these terms when it is computed
+  for (size_t i = 0; i < count; ++i)
+  {
+    lateral[i] = lateral_weight[i] * sigmoid[i];
+    noise[i] *= noise_scale[i];
+    float d_u = h[i] + global_inhibition[i] * sigmoid[i] + lateral[i] - u[i];
+    u[i] += time_factor[i] * d_u;
+  }
+}
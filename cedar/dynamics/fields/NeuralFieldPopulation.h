@@ -0,0 +1,233 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        NeuralFieldPopulation.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::NeuralFieldPopulation.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_NEURAL_FIELD_POPULATION_H
+#define CEDAR_DYN_NEURAL_FIELD_POPULATION_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/fields/NeuralField.fwd.h"
+#include "cedar/dynamics/fields/NeuralFieldPopulation.fwd.h"
+#include "cedar/processing/LoopedTrigger.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <QMutex>
+#include <unordered_map>
+#include <vector>
+
+
+/*!@brief Integrates the zero-dimensional neural fields of one looped trigger together.
+ *
+ *        Zero-dimensional fields that have the "population backend" option set join the population of their looped
+ *        trigger when the trigger is started. The first member that is computed in a time step integrates all members:
+ *        their parameters and activations are gathered into contiguous arrays, the outputs of all members are computed
+ *        in one loop and published, then everything in the field equation but the input is evaluated in a single loop
+ *        over the arrays, with the input noise of all nodes drawn at once. Each member sums its input and adds it to
+ *        its result only when it is computed itself, so inputs that reach a member through other steps (e.g., a static
+ *        gain between two nodes) are read at the same point of the time step as without the population. The fields
+ *        stay normal steps, so their slots can be connected and plotted as before.
+ *
+ *        Because the outputs of all members are published at once, members that are connected to each other directly
+ *        see each other's outputs of the current time step, regardless of the order in which the trigger calls them.
+ *
+ *        Members that cannot be integrated by the population at the time of the pass, e.g., because they use a sigmoid
+ *        other than cedar::aux::math::AbsSigmoid, another integrator, correlated neural noise, or are updated less
+ *        often in multi-rate simulation, are skipped and compute their own euler step.
+ */
+class cedar::dyn::NeuralFieldPopulation
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! The state and parameters of a member, gathered before the population is integrated.
+  struct MemberState
+  {
+    //! The current activation u.
+    float activation;
+    //! The resting level h.
+    float restingLevel;
+    //! The weight of the lateral interaction of the node with itself.
+    float lateralWeight;
+    //! The global inhibition.
+    float globalInhibition;
+    //! Steepness of the absolute sigmoid.
+    float beta;
+    //! Threshold of the absolute sigmoid.
+    float threshold;
+    //! dt / tau
+    float timeFactor;
+    //! Factor of the input noise.
+    float noiseFactor;
+    //! Whether the input noise is multiplied by the input.
+    bool multiplicativeNoiseInput;
+    //! Whether the input noise is multiplied by the activation.
+    bool multiplicativeNoiseActivation;
+  };
+
+  /*! The values of a member after the population was integrated.
+   *
+   *  The new activation is activation + timeFactor * input + noiseFactor * noise, where the noise is multiplied by the
+   *  input first if noiseScaledByInput is set.
+   */
+  struct MemberResult
+  {
+    //! The new activation without the input and the noise.
+    float activation;
+    //! The lateral interaction.
+    float lateral;
+    //! The input noise, scaled by the activation if necessary.
+    float noise;
+    //! dt / tau
+    float timeFactor;
+    //! Factor of the input noise.
+    float noiseFactor;
+    //! Whether the noise still has to be multiplied by the input.
+    bool noiseScaledByInput;
+  };
+
+private:
+  //! Bookkeeping for a single member.
+  struct Member
+  {
+    //! The field.
+    cedar::dyn::NeuralField* mpField;
+
+    //! The last generation whose result was handed to the field.
+    unsigned long mConsumedGeneration;
+
+    //! Index of the member in the arrays of the last pass, or -1 if the population did not integrate it.
+    int mSlot;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //!@brief Populations are only created through join.
+  NeuralFieldPopulation();
+
+public:
+  //!@brief Destructor
+  ~NeuralFieldPopulation();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Adds the field to the population of the given trigger, creating the population if necessary.
+   *
+   *        The field has to leave the population before it is destroyed.
+   */
+  static cedar::dyn::NeuralFieldPopulationPtr join
+                                              (
+                                                cedar::proc::LoopedTriggerPtr trigger,
+                                                cedar::dyn::NeuralField* field
+                                              );
+
+  //!@brief Removes the field from the population.
+  void leave(cedar::dyn::NeuralField* field);
+
+  /*!@brief Advances the population, if necessary, and returns the result of the given member.
+   *
+   *        The population is integrated by the first member that asks for its result in a time step.
+   *
+   * @returns false if the field was not integrated by the population, i.e., has to compute its own euler step.
+   */
+  bool step(cedar::dyn::NeuralField* field, const cedar::unit::Time& time, MemberResult& result);
+
+  //!@brief Returns the number of fields in this population.
+  size_t getNumberOfMembers() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //!@brief Gathers the state of all compatible members and integrates them in one pass.
+  void integrate(const cedar::unit::Time& time);
+
+  //!@brief Resizes the arrays that hold the state of the members.
+  void resizeArrays(size_t size);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  //! Protects the members and arrays.
+  mutable QMutex mMutex;
+
+  //! The fields of the population.
+  std::vector<Member> mMembers;
+
+  //! Index of each field in mMembers.
+  std::unordered_map<const cedar::dyn::NeuralField*, size_t> mMemberIndices;
+
+  //! Counts the passes over the population.
+  unsigned long mGeneration;
+
+  //!@name arrays holding the state of all members that are integrated by the population
+  //!@{
+  std::vector<float> mActivation;
+  std::vector<float> mRestingLevel;
+  std::vector<float> mLateralWeight;
+  std::vector<float> mGlobalInhibition;
+  std::vector<float> mBeta;
+  std::vector<float> mThreshold;
+  std::vector<float> mTimeFactor;
+  std::vector<float> mNoiseFactor;
+  std::vector<float> mNoiseScale;
+  std::vector<char> mMultiplicativeInput;
+  std::vector<float> mSigmoid;
+  std::vector<float> mLateral;
+  std::vector<cedar::dyn::NeuralField*> mFields;
+  //!@}
+
+  //! Random numbers for the input noise of all members, drawn at once.
+  cv::Mat mNoise;
+
+}; // class cedar::dyn::NeuralFieldPopulation
+
+#endif // CEDAR_DYN_NEURAL_FIELD_POPULATION_H
+
@@ -187,7 +187,8 @@ void cedar::dyn::Preshape::eulerStep(const cedar::unit::Time& time)
   const cv::Mat& input_mat = input->getData<cv::Mat>();
   const double& tau_build_up = this->_mTimeScaleBuildUp->getValue();
   const double& tau_decay = this->_mTimeScaleDecay->getValue();
-  cv::Mat sigmoided_input = this->_mSigmoid->getValue()->compute(input_mat);
+  this->_mSigmoid->getValue()->compute(input_mat, this->mSigmoidedInput);
+  const cv::Mat& sigmoided_input = this->mSigmoidedInput;
   double peak = 1.0;
   if (auto peak_detector = boost::dynamic_pointer_cast<cedar::aux::ConstMatData>(this->getInput("peak detector")))
   {
@@ -137,7 +137,8 @@ protected:
   cedar::aux::MatDataPtr mActivation;
 
 private:
-  // none yet
+  //! Buffer for the sigmoided input, reused across euler steps.
+  cv::Mat mSigmoidedInput;
 
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
@@ -0,0 +1,325 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        AdaptiveRungeKutta45.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::dyn::integrators::AdaptiveRungeKutta45.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrators/AdaptiveRungeKutta45.h"
+#include "cedar/auxiliaries/assert.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------------------------
+// register the class
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  bool registered
+    = cedar::dyn::IntegratorManagerSingleton::getInstance()
+        ->registerType<cedar::dyn::integrators::AdaptiveRungeKutta45Ptr>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// Dormand-Prince coefficients
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  // stage coefficients; the nodes c_i are not needed because the derivative does not depend on time explicitly
+  const double A21 = 1.0 / 5.0;
+  const double A31 = 3.0 / 40.0, A32 = 9.0 / 40.0;
+  const double A41 = 44.0 / 45.0, A42 = -56.0 / 15.0, A43 = 32.0 / 9.0;
+  const double A51 = 19372.0 / 6561.0, A52 = -25360.0 / 2187.0, A53 = 64448.0 / 6561.0, A54 = -212.0 / 729.0;
+  const double A61 = 9017.0 / 3168.0, A62 = -355.0 / 33.0, A63 = 46732.0 / 5247.0, A64 = 49.0 / 176.0;
+  const double A65 = -5103.0 / 18656.0;
+
+  // weights of the fifth order solution; the seventh stage is evaluated at this solution
+  const double B1 = 35.0 / 384.0, B3 = 500.0 / 1113.0, B4 = 125.0 / 192.0, B5 = -2187.0 / 6784.0, B6 = 11.0 / 84.0;
+
+  // differences between the weights of the fifth and fourth order solutions
+  const double E1 = 71.0 / 57600.0, E3 = -71.0 / 16695.0, E4 = 71.0 / 1920.0, E5 = -17253.0 / 339200.0;
+  const double E6 = 22.0 / 525.0, E7 = -1.0 / 40.0;
+
+  // limits for changing the step size from one substep to the next
+  const double SAFETY_FACTOR = 0.9;
+  const double MIN_STEP_FACTOR = 0.2;
+  const double MAX_STEP_FACTOR = 5.0;
+
+  template <typename T>
+  double maxScaledError
+  (
+    const cv::Mat& error,
+    const cv::Mat& state,
+    const cv::Mat& candidate,
+    double absoluteTolerance,
+    double relativeTolerance
+  )
+  {
+    double norm = 0.0;
+    const cv::Mat* arrays[] = {&error, &state, &candidate, nullptr};
+    uchar* planes[3];
+    cv::NAryMatIterator iterator(arrays, planes, 3);
+    const size_t plane_size = static_cast<size_t>(iterator.size) * error.channels();
+    for (size_t plane = 0; plane < iterator.nplanes; ++plane, ++iterator)
+    {
+      const T* error_data = reinterpret_cast<const T*>(planes[0]);
+      const T* state_data = reinterpret_cast<const T*>(planes[1]);
+      const T* candidate_data = reinterpret_cast<const T*>(planes[2]);
+      for (size_t i = 0; i < plane_size; ++i)
+      {
+        double magnitude
+          = std::max(std::abs(static_cast<double>(state_data[i])), std::abs(static_cast<double>(candidate_data[i])));
+        double scale = absoluteTolerance + relativeTolerance * magnitude;
+        double scaled = std::abs(static_cast<double>(error_data[i])) / scale;
+        // written so that NaN errors propagate into the norm
+        if (!(scaled <= norm))
+        {
+          norm = scaled;
+        }
+      }
+    }
+    return norm;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::integrators::AdaptiveRungeKutta45::AdaptiveRungeKutta45()
+:
+mK(7),
+mSuggestedStepSize(0.0),
+mNumberOfSubsteps(0),
+_mAbsoluteTolerance
+(
+  new cedar::aux::DoubleParameter
+  (
+    this,
+    "absolute tolerance",
+    1e-3,
+    cedar::aux::DoubleParameter::LimitType::positive()
+  )
+),
+_mRelativeTolerance
+(
+  new cedar::aux::DoubleParameter
+  (
+    this,
+    "relative tolerance",
+    1e-3,
+    cedar::aux::DoubleParameter::LimitType::positiveZero()
+  )
+),
+_mMinimumStepSize
+(
+  new cedar::aux::TimeParameter
+  (
+    this,
+    "minimum step size",
+    cedar::unit::Time(0.01 * cedar::unit::milli * cedar::unit::seconds),
+    cedar::aux::TimeParameter::LimitType::positive()
+  )
+)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+double cedar::dyn::integrators::AdaptiveRungeKutta45::errorNorm(const std::vector<cv::Mat>& state) const
+{
+  const double absolute_tolerance = this->_mAbsoluteTolerance->getValue();
+  const double relative_tolerance = this->_mRelativeTolerance->getValue();
+
+  double norm = 0.0;
+  for (size_t i = 0; i < state.size(); ++i)
+  {
+    const cv::Mat& error = this->mError[i];
+    const cv::Mat& candidate = this->mCandidate[i];
+    double variable_norm;
+    if (state[i].depth() == CV_32F)
+    {
+      variable_norm = maxScaledError<float>(error, state[i], candidate, absolute_tolerance, relative_tolerance);
+    }
+    else
+    {
+      variable_norm = maxScaledError<double>(error, state[i], candidate, absolute_tolerance, relative_tolerance);
+    }
+
+    if (!(variable_norm <= norm))
+    {
+      norm = variable_norm;
+    }
+  }
+  return norm;
+}
+
+void cedar::dyn::integrators::AdaptiveRungeKutta45::step
+     (
+       std::vector<cv::Mat>& state,
+       double stepSize,
+       double,
+       const cedar::dyn::Integrator::DerivativeFunction& derivative
+     )
+{
+  for (auto& k : this->mK)
+  {
+    allocateLike(state, k);
+  }
+  allocateLike(state, this->mStage);
+  allocateLike(state, this->mCandidate);
+  allocateLike(state, this->mError);
+
+  std::vector<cv::Mat>& k1 = this->mK[0];
+  std::vector<cv::Mat>& k2 = this->mK[1];
+  std::vector<cv::Mat>& k3 = this->mK[2];
+  std::vector<cv::Mat>& k4 = this->mK[3];
+  std::vector<cv::Mat>& k5 = this->mK[4];
+  std::vector<cv::Mat>& k6 = this->mK[5];
+  std::vector<cv::Mat>& k7 = this->mK[6];
+
+  const double min_step_size = this->_mMinimumStepSize->getValue() / cedar::unit::Time(1.0 * cedar::unit::second);
+
+  double h = stepSize;
+  if (this->mSuggestedStepSize > 0.0)
+  {
+    h = std::min(this->mSuggestedStepSize, stepSize);
+  }
+
+  this->mNumberOfSubsteps = 0;
+  double time = 0.0;
+  bool k1_valid = false;
+  bool done = false;
+  while (!done)
+  {
+    ++this->mNumberOfSubsteps;
+
+    // the last substep ends exactly at the end of the time step
+    double proposed_h = h;
+    bool last = (h >= stepSize - time);
+    if (last)
+    {
+      h = stepSize - time;
+    }
+
+    if (!k1_valid)
+    {
+      derivative(state, k1);
+      k1_valid = true;
+    }
+
+    linearCombination(state, {{h * A21, &k1}}, this->mStage);
+    derivative(this->mStage, k2);
+    linearCombination(state, {{h * A31, &k1}, {h * A32, &k2}}, this->mStage);
+    derivative(this->mStage, k3);
+    linearCombination(state, {{h * A41, &k1}, {h * A42, &k2}, {h * A43, &k3}}, this->mStage);
+    derivative(this->mStage, k4);
+    linearCombination
+    (
+      state,
+      {{h * A51, &k1}, {h * A52, &k2}, {h * A53, &k3}, {h * A54, &k4}},
+      this->mStage
+    );
+    derivative(this->mStage, k5);
+    linearCombination
+    (
+      state,
+      {{h * A61, &k1}, {h * A62, &k2}, {h * A63, &k3}, {h * A64, &k4}, {h * A65, &k5}},
+      this->mStage
+    );
+    derivative(this->mStage, k6);
+    linearCombination
+    (
+      state,
+      {{h * B1, &k1}, {h * B3, &k3}, {h * B4, &k4}, {h * B5, &k5}, {h * B6, &k6}},
+      this->mCandidate
+    );
+    derivative(this->mCandidate, k7);
+
+    for (auto& error : this->mError)
+    {
+      error = cv::Scalar(0);
+    }
+    linearCombination
+    (
+      this->mError,
+      {{h * E1, &k1}, {h * E3, &k3}, {h * E4, &k4}, {h * E5, &k5}, {h * E6, &k6}, {h * E7, &k7}},
+      this->mError
+    );
+
+    double norm = this->errorNorm(state);
+    double factor = MIN_STEP_FACTOR;
+    if (norm == 0.0)
+    {
+      factor = MAX_STEP_FACTOR;
+    }
+    else if (norm > 0.0)
+    {
+      factor = std::min(MAX_STEP_FACTOR, std::max(MIN_STEP_FACTOR, SAFETY_FACTOR * std::pow(norm, -0.2)));
+    }
+
+    if (norm <= 1.0 || h <= min_step_size)
+    {
+      for (size_t i = 0; i < state.size(); ++i)
+      {
+        this->mCandidate[i].copyTo(state[i]);
+      }
+      // the last stage was evaluated at the new state, so it is the first stage of the next substep
+      std::swap(k1, k7);
+      time += h;
+      done = last;
+
+      double next_h = std::max(min_step_size, h * factor);
+      // a substep that was shortened to hit the end of the time step does not make the next one shorter
+      if (last && factor >= 1.0)
+      {
+        next_h = std::max(next_h, proposed_h);
+      }
+      h = next_h;
+    }
+    else
+    {
+      // the state is unchanged, so k1 stays valid
+      h = std::max(min_step_size, h * factor);
+    }
+  }
+
+  this->mSuggestedStepSize = h;
+}
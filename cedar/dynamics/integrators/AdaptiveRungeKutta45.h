@@ -0,0 +1,162 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        AdaptiveRungeKutta45.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::integrators::AdaptiveRungeKutta45.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATORS_ADAPTIVE_RUNGE_KUTTA_45_H
+#define CEDAR_DYN_INTEGRATORS_ADAPTIVE_RUNGE_KUTTA_45_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Integrator.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/TimeParameter.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/integrators/AdaptiveRungeKutta45.fwd.h"
+
+// SYSTEM INCLUDES
+#include <vector>
+
+
+/*!@brief The embedded Runge-Kutta method of Dormand and Prince with adaptive step size control.
+ *
+ *        Each time step of the dynamics is split into as many substeps as are needed to keep the local error estimate
+ *        of every state entry below absolute tolerance + relative tolerance * |x|. The substep size is carried over to
+ *        the next time step, so slowly changing dynamics are simulated in a single substep of six derivative
+ *        evaluations (the seventh is reused as the first one of the next substep). Substeps never get shorter than the
+ *        minimum step size; such steps are accepted regardless of their error.
+ */
+class cedar::dyn::integrators::AdaptiveRungeKutta45 : public cedar::dyn::Integrator
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // macros
+  //--------------------------------------------------------------------------------------------------------------------
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  AdaptiveRungeKutta45();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //! Sets the absolute error tolerance per substep.
+  inline void setAbsoluteTolerance(double tolerance)
+  {
+    this->_mAbsoluteTolerance->setValue(tolerance);
+  }
+
+  //! Sets the relative error tolerance per substep.
+  inline void setRelativeTolerance(double tolerance)
+  {
+    this->_mRelativeTolerance->setValue(tolerance);
+  }
+
+  //! Sets the minimum length of a substep.
+  inline void setMinimumStepSize(const cedar::unit::Time& stepSize)
+  {
+    this->_mMinimumStepSize->setValue(stepSize);
+  }
+
+  //! Returns the number of substeps taken (including rejected ones) during the last call of integrate.
+  inline unsigned int getNumberOfSubsteps() const
+  {
+    return this->mNumberOfSubsteps;
+  }
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  void step
+       (
+         std::vector<cv::Mat>& state,
+         double stepSize,
+         double decayRate,
+         const cedar::dyn::Integrator::DerivativeFunction& derivative
+       );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Returns the largest error of all entries relative to their tolerance; the substep is accepted if this is <= 1.
+  double errorNorm(const std::vector<cv::Mat>& state) const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! Derivatives at the seven stages of the method.
+  std::vector<std::vector<cv::Mat> > mK;
+
+  //! Buffer for the intermediate states.
+  std::vector<cv::Mat> mStage;
+
+  //! The fifth order solution of the current substep.
+  std::vector<cv::Mat> mCandidate;
+
+  //! Difference between the fifth and fourth order solutions of the current substep.
+  std::vector<cv::Mat> mError;
+
+  //! Substep size (in seconds) suggested by the error control in the last call; zero if there was none yet.
+  double mSuggestedStepSize;
+
+  //! Number of substeps in the last call.
+  unsigned int mNumberOfSubsteps;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // parameters
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Absolute error tolerance per substep.
+  cedar::aux::DoubleParameterPtr _mAbsoluteTolerance;
+
+  //! Relative error tolerance per substep.
+  cedar::aux::DoubleParameterPtr _mRelativeTolerance;
+
+  //! Lower bound for the length of a substep.
+  cedar::aux::TimeParameterPtr _mMinimumStepSize;
+
+}; // class cedar::dyn::integrators::AdaptiveRungeKutta45
+
+#endif // CEDAR_DYN_INTEGRATORS_ADAPTIVE_RUNGE_KUTTA_45_H
@@ -0,0 +1,84 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        ExponentialEuler.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::dyn::integrators::ExponentialEuler.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrators/ExponentialEuler.h"
+
+// SYSTEM INCLUDES
+#include <cmath>
+
+//----------------------------------------------------------------------------------------------------------------------
+// register the class
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  bool registered
+    = cedar::dyn::IntegratorManagerSingleton::getInstance()
+        ->registerType<cedar::dyn::integrators::ExponentialEulerPtr>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::integrators::ExponentialEuler::ExponentialEuler()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::integrators::ExponentialEuler::step
+     (
+       std::vector<cv::Mat>& state,
+       double stepSize,
+       double decayRate,
+       const cedar::dyn::Integrator::DerivativeFunction& derivative
+     )
+{
+  // -expm1(-x) = 1 - exp(-x), without cancellation for small decay rates
+  double factor = stepSize;
+  if (decayRate != 0.0)
+  {
+    factor = -std::expm1(-decayRate * stepSize) / decayRate;
+  }
+
+  allocateLike(state, this->mDerivative);
+  derivative(state, this->mDerivative);
+  linearCombination(state, {{factor, &this->mDerivative}}, state);
+}
@@ -0,0 +1,111 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        ExponentialEuler.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::integrators::ExponentialEuler.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATORS_EXPONENTIAL_EULER_H
+#define CEDAR_DYN_INTEGRATORS_EXPONENTIAL_EULER_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Integrator.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/integrators/ExponentialEuler.fwd.h"
+
+// SYSTEM INCLUDES
+#include <vector>
+
+
+/*!@brief The exponential Euler method.
+ *
+ *        Splits the derivative into a linear decay and the rest, \f$\dot{x} = -\lambda x + N(x)\f$, and integrates the
+ *        linear part exactly while keeping N constant over the step:
+ *        @f[
+ *          x_{t + dt} = x_t + \frac{1 - e^{-\lambda dt}}{\lambda} \dot{x}_t
+ *        @f]
+ *        For the -u + h part of Amari fields, \f$\lambda = 1 / \tau\f$ and the step stays stable for any dt, at the
+ *        cost of a single derivative evaluation just like forward Euler. Without a decay rate, this is forward Euler.
+ */
+class cedar::dyn::integrators::ExponentialEuler : public cedar::dyn::Integrator
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // macros
+  //--------------------------------------------------------------------------------------------------------------------
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  ExponentialEuler();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  void step
+       (
+         std::vector<cv::Mat>& state,
+         double stepSize,
+         double decayRate,
+         const cedar::dyn::Integrator::DerivativeFunction& derivative
+       );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! Buffer for the derivative.
+  std::vector<cv::Mat> mDerivative;
+
+}; // class cedar::dyn::integrators::ExponentialEuler
+
+#endif // CEDAR_DYN_INTEGRATORS_EXPONENTIAL_EULER_H
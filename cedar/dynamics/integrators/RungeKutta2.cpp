@@ -0,0 +1,81 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        RungeKutta2.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Source file for the class cedar::dyn::integrators::RungeKutta2.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/integrators/RungeKutta2.h"
+
+// SYSTEM INCLUDES
+
+//----------------------------------------------------------------------------------------------------------------------
+// register the class
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+  bool registered
+    = cedar::dyn::IntegratorManagerSingleton::getInstance()->registerType<cedar::dyn::integrators::RungeKutta2Ptr>();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::dyn::integrators::RungeKutta2::RungeKutta2()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+void cedar::dyn::integrators::RungeKutta2::step
+     (
+       std::vector<cv::Mat>& state,
+       double stepSize,
+       double,
+       const cedar::dyn::Integrator::DerivativeFunction& derivative
+     )
+{
+  allocateLike(state, this->mK1);
+  allocateLike(state, this->mK2);
+  allocateLike(state, this->mStage);
+
+  derivative(state, this->mK1);
+  linearCombination(state, {{stepSize, &this->mK1}}, this->mStage);
+  derivative(this->mStage, this->mK2);
+
+  linearCombination(state, {{0.5 * stepSize, &this->mK1}, {0.5 * stepSize, &this->mK2}}, state);
+}
@@ -0,0 +1,109 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        RungeKutta2.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Header file for the class cedar::dyn::integrators::RungeKutta2.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_DYN_INTEGRATORS_RUNGE_KUTTA_2_H
+#define CEDAR_DYN_INTEGRATORS_RUNGE_KUTTA_2_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Integrator.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/dynamics/integrators/RungeKutta2.fwd.h"
+
+// SYSTEM INCLUDES
+#include <vector>
+
+
+/*!@brief Heun's method, a second order Runge-Kutta method with two derivative evaluations per step.
+ */
+class cedar::dyn::integrators::RungeKutta2 : public cedar::dyn::Integrator
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // macros
+  //--------------------------------------------------------------------------------------------------------------------
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief The standard constructor.
+  RungeKutta2();
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  void step
+       (
+         std::vector<cv::Mat>& state,
+         double stepSize,
+         double decayRate,
+         const cedar::dyn::Integrator::DerivativeFunction& derivative
+       );
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+private:
+  //! Derivative at the start of the step.
+  std::vector<cv::Mat> mK1;
+
+  //! Derivative at the Euler prediction of the end of the step.
+  std::vector<cv::Mat> mK2;
+
+  //! Buffer for the intermediate state.
+  std::vector<cv::Mat> mStage;
+
+}; // class cedar::dyn::integrators::RungeKutta2
+
+#endif // CEDAR_DYN_INTEGRATORS_RUNGE_KUTTA_2_H
@@ -73,107 +73,150 @@ cedar::dyn::steps::HarmonicOscillator::HarmonicOscillator()
   QObject::connect(_B.get(), SIGNAL(valueChanged()), this, SLOT(updateDampingB()));
   QObject::connect(_mDimensionality.get(), SIGNAL(valueChanged()), this, SLOT(updateDimensionality()));
 
+  // position and velocity make up the state of the oscillator
+  this->declareStateVariable(_mPData);
+  this->declareStateVariable(_mPDotData);
+
 }
 
 cedar::dyn::steps::HarmonicOscillator::~HarmonicOscillator()
 {
 }
 
-void cedar::dyn::steps::HarmonicOscillator::eulerStep(const cedar::unit::Time& time)
+bool cedar::dyn::steps::HarmonicOscillator::updateTarget()
 {
-
   cedar::aux::ConstDataPtr lambda = this->getInputSlot("lambda")->getData();
+  if (!boost::dynamic_pointer_cast<const cedar::aux::MatData>(lambda))
+  {
+    return false;
+  }
 
-  cv::Mat& output = mOutput->getData();
+  this->mTarget = lambda->getData<cv::Mat>().clone();
 
-  cv::Mat& outputDot = mOutputDot->getData();
+  cedar::aux::ConstDataPtr overWriteInput = this->getInputSlot("overwriteInput")->getData();
+  cedar::aux::ConstDataPtr overWritePeakDetector = this->getInputSlot("overwritePeakDetector")->getData();
+  if (boost::dynamic_pointer_cast<const cedar::aux::MatData>(overWriteInput) && boost::dynamic_pointer_cast<const cedar::aux::MatData>(overWritePeakDetector))
+  {
+    auto overWriteMat = overWriteInput->getData<cv::Mat>().clone();
+    auto overWritePeak = overWritePeakDetector->getData<cv::Mat>().clone();
+    if (overWritePeak.at<float>(0, 0) > 0.5)
+    {
+      _mPData->getData() = overWriteMat;
+      this->mTarget = overWriteMat;
+    }
+  }
 
-  cv::Mat& outputDotDot = mOutputDotDot->getData();
+  return true;
+}
 
-  cv::Mat& pDot = _mPDotData->getData();
-  cv::Mat& p = _mPData->getData();
+cv::Mat cedar::dyn::steps::HarmonicOscillator::computeAcceleration(const cv::Mat& p, const cv::Mat& pDot) const
+{
+  const cv::Mat& lambdaMat = this->mTarget;
 
-  if (boost::dynamic_pointer_cast<const cedar::aux::MatData>(lambda))
+  cv::Mat K = cv::Mat::zeros(_mDimensionality->getValue(), _mDimensionality->getValue(), CV_32F);
+  cv::Mat B = cv::Mat::zeros(_mDimensionality->getValue(), _mDimensionality->getValue(), CV_32F);
+  for (unsigned int d = 0; d < _mDimensionality->getValue(); d++)
   {
-    cv::Mat lambdaMat = lambda->getData<cv::Mat>().clone();
-    cv::Mat pDotDot = cv::Mat::zeros(_mDimensionality->getValue(), 1, CV_32F);
+    float newK = _K->getValue().at(d);
+    K.at<float>(d, d) = newK;
+    B.at<float>(d, d) = sqrt(newK) * 2 * _D->getValue();
+  }
 
-    cedar::aux::ConstDataPtr overWriteInput = this->getInputSlot("overwriteInput")->getData();
-    cedar::aux::ConstDataPtr overWritePeakDetector = this->getInputSlot("overwritePeakDetector")->getData();
-    if (boost::dynamic_pointer_cast<const cedar::aux::MatData>(overWriteInput) && boost::dynamic_pointer_cast<const cedar::aux::MatData>(overWritePeakDetector))
+  cv::Mat difMat = p - lambdaMat;
+  if (_cyclicRestrictions->getValue())
+  {
+    for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
     {
-      auto overWriteMat = overWriteInput->getData<cv::Mat>().clone();
-      auto overWritePeak = overWritePeakDetector->getData<cv::Mat>().clone();
-      if (overWritePeak.at<float>(0, 0) > 0.5)
+      if (abs(p.at<float>(i, 0) - lambdaMat.at<float>(i, 0)) > ((_upperRestrictions->getValue().at(i) + _lowerRestrictions->getValue().at(i)) / 2.0))
       {
-        p = overWriteMat;
-        lambdaMat = overWriteMat;
+        if (p.at<float>(i, 0) < lambdaMat.at<float>(i, 0))
+          difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0) + _upperRestrictions->getValue().at(i);
+        else
+          difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0) - _upperRestrictions->getValue().at(i);
+      }
+      else
+      {
+        difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0);
       }
     }
 
-    cv::Mat K = cv::Mat::zeros(_mDimensionality->getValue(), _mDimensionality->getValue(), CV_32F);
-    cv::Mat B = cv::Mat::zeros(_mDimensionality->getValue(), _mDimensionality->getValue(), CV_32F);
-    for (unsigned int d = 0; d < _mDimensionality->getValue(); d++)
-    {
-      float newK = _K->getValue().at(d);
-      K.at<float>(d, d) = newK;
-      B.at<float>(d, d) = sqrt(newK) * 2 * _D->getValue();
-    }
+  }
+
+  return (-1 * (K) * (difMat)) - ((B) * pDot);
+}
 
-    cv::Mat difMat = p - lambdaMat;
-    if (_cyclicRestrictions->getValue())
+void cedar::dyn::steps::HarmonicOscillator::applyCyclicRestrictions(cv::Mat& p) const
+{
+  if (_cyclicRestrictions->getValue())
+  {
+    for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
     {
-      for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
+      if (p.at<float>(i, 0) > _upperRestrictions->getValue().at(i))
       {
-        if (abs(p.at<float>(i, 0) - lambdaMat.at<float>(i, 0)) > ((_upperRestrictions->getValue().at(i) + _lowerRestrictions->getValue().at(i)) / 2.0))
-        {
-          if (p.at<float>(i, 0) < lambdaMat.at<float>(i, 0))
-            difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0) + _upperRestrictions->getValue().at(i);
-          else
-            difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0) - _upperRestrictions->getValue().at(i);
-        }
-        else
-        {
-          difMat.at<float>(i, 0) = p.at<float>(i, 0) - lambdaMat.at<float>(i, 0);
-        }
+        double dif = p.at<float>(i, 0) - _upperRestrictions->getValue().at(i);
+        p.at<float>(i, 0) = _lowerRestrictions->getValue().at(i) + dif;
       }
 
+      if (p.at<float>(i, 0) < _lowerRestrictions->getValue().at(i))
+      {
+        double dif = p.at<float>(i, 0) - _lowerRestrictions->getValue().at(i);
+        p.at<float>(i, 0) = _upperRestrictions->getValue().at(i) + dif;
+      }
     }
+  }
+}
 
-//    std::cout << "Lambda: " << lambdaMat << std::endl;
-    pDotDot = (-1 * (K) * (difMat)) - ((B) * pDot);
+void cedar::dyn::steps::HarmonicOscillator::eulerStep(const cedar::unit::Time& time)
+{
+  if (!this->updateTarget())
+  {
+    return;
+  }
 
-//    std::cout << "PDotDot: " << pDotDot << std::endl;
+  cv::Mat& pDot = _mPDotData->getData();
+  cv::Mat& p = _mPData->getData();
 
-    pDot += (time / cedar::unit::Time(1.0 * cedar::unit::second)) * pDotDot;
-//    std::cout << "PDot: " << pDot << std::endl;
+  cv::Mat pDotDot = this->computeAcceleration(p, pDot);
 
-    p += (time / cedar::unit::Time(1.0 * cedar::unit::second)) * pDot;
+  // semi-implicit: the position is updated with the new velocity
+  pDot += (time / cedar::unit::Time(1.0 * cedar::unit::second)) * pDotDot;
+  p += (time / cedar::unit::Time(1.0 * cedar::unit::second)) * pDot;
 
-//    std::cout << "P: " << p << std::endl;
+  this->applyCyclicRestrictions(p);
 
-    if (_cyclicRestrictions->getValue())
-    {
-      for (unsigned int i = 0; i < _mDimensionality->getValue(); i++)
-      {
-        if (p.at<float>(i, 0) > _upperRestrictions->getValue().at(i))
-        {
-          double dif = p.at<float>(i, 0) - _upperRestrictions->getValue().at(i);
-          p.at<float>(i, 0) = _lowerRestrictions->getValue().at(i) + dif;
-        }
-
-        if (p.at<float>(i, 0) < _lowerRestrictions->getValue().at(i))
-        {
-          double dif = p.at<float>(i, 0) - _lowerRestrictions->getValue().at(i);
-          p.at<float>(i, 0) = _upperRestrictions->getValue().at(i) + dif;
-        }
-      }
-    }
+  mOutput->getData() = p;
+  mOutputDot->getData() = pDot;
+  mOutputDotDot->getData() = pDotDot;
+}
 
-    output = p;
-    outputDot = pDot;
-    outputDotDot = pDotDot;
+void cedar::dyn::steps::HarmonicOscillator::integrationStep(const cedar::unit::Time& time)
+{
+  if (!this->updateTarget())
+  {
+    return;
   }
+
+  this->integrateStateVariables(time);
+
+  cv::Mat& pDot = _mPDotData->getData();
+  cv::Mat& p = _mPData->getData();
+  this->applyCyclicRestrictions(p);
+
+  mOutput->getData() = p;
+  mOutputDot->getData() = pDot;
+  mOutputDotDot->getData() = this->computeAcceleration(p, pDot);
+}
+
+void cedar::dyn::steps::HarmonicOscillator::computeDerivative
+     (
+       const std::vector<cv::Mat>& state,
+       std::vector<cv::Mat>& derivative
+     )
+{
+  const cv::Mat& p = state.at(0);
+  const cv::Mat& pDot = state.at(1);
+  pDot.copyTo(derivative.at(0));
+  this->computeAcceleration(p, pDot).copyTo(derivative.at(1));
 }
 
 cedar::aux::MatDataPtr cedar::dyn::steps::HarmonicOscillator::getCurrentPosition()
@@ -40,6 +40,7 @@ public:
 	HarmonicOscillator();
 	virtual ~HarmonicOscillator();
 	void eulerStep(const cedar::unit::Time& time);
+	void integrationStep(const cedar::unit::Time& time);
 
 	cedar::aux::MatDataPtr getCurrentPosition();
 	cedar::aux::MatDataPtr getCurrentVelocity();
@@ -66,6 +67,14 @@ public:
 	cedar::proc::DataSlot::VALIDITY determineInputValidity(cedar::proc::ConstDataSlotPtr slot,cedar::aux::ConstDataPtr data) const;
 	//!@brief Resets the field.
 	void reset();
+	//!@brief reads the attractor (lambda) and applies the overwrite inputs; returns false if there is no lambda
+	bool updateTarget();
+	//!@brief the acceleration at the given position and velocity
+	cv::Mat computeAcceleration(const cv::Mat& p, const cv::Mat& pDot) const;
+	//!@brief wraps the position around if cyclic restrictions are enabled
+	void applyCyclicRestrictions(cv::Mat& p) const;
+	//!@brief the derivative of position and velocity
+	void computeDerivative(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& derivative);
 	private :
 
 
@@ -89,6 +98,9 @@ public:
 	cedar::aux::MatDataPtr _mPData;
 	cedar::aux::MatDataPtr _mPDotData;
 
+	//!@brief the attractor of the current time step
+	cv::Mat mTarget;
+
 };
 
 #endif /* CEDAR_DYN_HARMONIC_OSCILLATOR_H */
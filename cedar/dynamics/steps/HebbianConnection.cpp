@@ -963,9 +963,12 @@ cv::Mat cedar::dyn::steps::HebbianConnection::calculateWeightChange(const cedar:
   float learnRate = (float) mLearnRatePositive->getValue();
   cv::Mat currentWeights = mConnectionWeights->getData();
 
-  auto targetSigmoid = this->mSigmoidH->getValue()->compute(associationActivation);
-  auto rewardSigValue = this->mSigmoidG->getValue()->compute(rewardValue);
-  cv::Mat inputSigmoid = this->mSigmoidF->getValue()->compute(inputActivation);
+  this->mSigmoidH->getValue()->compute(associationActivation, this->mTargetSigmoid);
+  this->mSigmoidG->getValue()->compute(rewardValue, this->mRewardSigmoid);
+  this->mSigmoidF->getValue()->compute(inputActivation, this->mInputSigmoid);
+  const cv::Mat& targetSigmoid = this->mTargetSigmoid;
+  const cv::Mat& rewardSigValue = this->mRewardSigmoid;
+  const cv::Mat& inputSigmoid = this->mInputSigmoid;
 
   switch(this->mLearningRule->getValue())
   {
@@ -1136,7 +1139,8 @@ cv::Mat cedar::dyn::steps::HebbianConnection::calculateWeightChange(const cedar:
 
       if (mAssociationDimension->getValue() == 0) // The reverse case
       {
-        cv::Mat overlap = currentWeights.mul(mSigmoidF->getValue()->compute(inputMatrix));
+        mSigmoidF->getValue()->compute(inputMatrix, this->mInputSigmoid);
+        cv::Mat overlap = currentWeights.mul(this->mInputSigmoid);
         cv::Mat outputMat = cv::Mat::zeros(1, 1, CV_32F);
         double overlapDouble = cv::sum(overlap)[0];
         outputMat.at<float>(0, 0) = (float) overlapDouble; //TODO: The output might get very large
@@ -263,6 +263,11 @@ private:
   unsigned int mWeightSizeX;
   unsigned int mWeightSizeY;
 
+  //! Buffers for the sigmoided inputs, reused across steps so computing the sigmoids does not allocate memory.
+  cv::Mat mInputSigmoid;
+  cv::Mat mTargetSigmoid;
+  cv::Mat mRewardSigmoid;
+
 
 };// class cedar::dyn::steps::ImprintHebb
 
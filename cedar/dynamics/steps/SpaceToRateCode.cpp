@@ -93,6 +93,8 @@ cedar::dyn::SpaceToRateCode::SpaceToRateCode()
 // outputs
 mOutput(new cedar::aux::MatData(cv::Mat(1,1, CV_32F))),
 mFixPoint(new cedar::aux::MatData(cv::Mat(1,1, CV_32F))),
+mInputMass(0.0),
+mWeightedInputMass(0.0),
 // parameters
 _mTau(new cedar::aux::TimeParameter
           (
@@ -111,6 +113,7 @@ mNaNIfNoPeak(new cedar::aux::BoolParameter(this, "NaN if no peak", false))
   // declare all data
   this->declareInput("input");
   this->declareOutput("output", mOutput);
+  this->declareStateVariable(mOutput);
   this->declareBuffer("fix point", mFixPoint);
   this->mOutput->getData().at<float>(0,0) = 0.0;
   this->limitsChanged();
@@ -222,11 +225,8 @@ mNaNIfNoPeak(new cedar::aux::BoolParameter(this, "NaN if no peak", false))
  *    h < \frac{2 \tau}{s}.
  * \f]
  */
-void cedar::dyn::SpaceToRateCode::eulerStep(const cedar::unit::Time& time)
+bool cedar::dyn::SpaceToRateCode::updateMoments(double& s, double& o)
 {
-  double s;
-  double o;
-
   s = cv::sum(this->mInput->getData()).val[0];
 
   if (s <= 0.0
@@ -235,7 +235,7 @@ void cedar::dyn::SpaceToRateCode::eulerStep(const cedar::unit::Time& time)
     double mynan= std::numeric_limits<double>::quiet_NaN();
     this->mOutput->getData().at<float>(0,0) = mynan;
     this->mFixPoint->getData().at<float>(0,0) = mynan;
-    return;
+    return false;
   }
 
   if (!mMakeCyclic->getValue()) // the default case (weighted mean):
@@ -278,46 +278,83 @@ void cedar::dyn::SpaceToRateCode::eulerStep(const cedar::unit::Time& time)
   {
     fixed_point= o / s;
   }
+  this->mFixPoint->getData().at<float>(0,0) = fixed_point;
 
-  if (!mJumpToFixPoint->getValue())
+  if (mJumpToFixPoint->getValue())
   {
-    double dt = time / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second);
-    //!@todo use the time unit throughout the computation
-    double tau = this->getTau() / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second);
+    // directly jump to the fixed point. useful for debugging
+    this->mOutput->getData().at<float>(0,0) = fixed_point;
+    return false;
+  }
 
-    // the result is simply input * gain; see explanation above for variable names
-    double h = dt;
-    if (h / tau * s >= 2) // stability criterion
-    {
-      h = tau / s; // select a value that is very stable, i.e., is far from the point of instability
-    }
+  return true;
+}
 
-    // again, see above for the meaning of the variables
-    double T = floor(dt / h);
-    double h_r = dt - h * T;
-    double v = 1.0 - h * s / tau;
-    double v_rest = 1.0 - h_r * s / tau; // defined just like v, just with h_r instead of h
+void cedar::dyn::SpaceToRateCode::eulerStep(const cedar::unit::Time& time)
+{
+  double s;
+  double o;
+  if (!this->updateMoments(s, o))
+  {
+    return;
+  }
 
-    double v_pow_T = pow(v, T);
+  double x_0 = this->mOutput->getData().at<float>(0,0);
 
-    double s_T;
-    if (v != 1.0)
-    {
-      s_T = (1 - v_pow_T) / (1 - v);
-    }
-    else
-    {
-      s_T = T;
-    }
-    this->mOutput->getData().at<float>(0,0) = v_rest * (v_pow_T * x_0 + h * o / tau * s_T) + h_r * o / tau;
+  double dt = time / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second);
+  //!@todo use the time unit throughout the computation
+  double tau = this->getTau() / cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second);
+
+  // the result is simply input * gain; see explanation above for variable names
+  double h = dt;
+  if (h / tau * s >= 2) // stability criterion
+  {
+    h = tau / s; // select a value that is very stable, i.e., is far from the point of instability
+  }
+
+  // again, see above for the meaning of the variables
+  double T = floor(dt / h);
+  double h_r = dt - h * T;
+  double v = 1.0 - h * s / tau;
+  double v_rest = 1.0 - h_r * s / tau; // defined just like v, just with h_r instead of h
+
+  double v_pow_T = pow(v, T);
+
+  double s_T;
+  if (v != 1.0)
+  {
+    s_T = (1 - v_pow_T) / (1 - v);
   }
   else
   {
-    // directly jump to the fixed point. useful for debugging
-    this->mOutput->getData().at<float>(0,0) = fixed_point;
+    s_T = T;
   }
+  this->mOutput->getData().at<float>(0,0) = v_rest * (v_pow_T * x_0 + h * o / tau * s_T) + h_r * o / tau;
+}
 
-  this->mFixPoint->getData().at<float>(0,0) = fixed_point;
+void cedar::dyn::SpaceToRateCode::integrationStep(const cedar::unit::Time& time)
+{
+  if (this->updateMoments(this->mInputMass, this->mWeightedInputMass))
+  {
+    this->integrateStateVariables(time);
+  }
+}
+
+double cedar::dyn::SpaceToRateCode::getLinearDecayRate() const
+{
+  return this->mInputMass / (this->getTau() / cedar::unit::Time(1.0 * cedar::unit::second));
+}
+
+cedar::unit::Time cedar::dyn::SpaceToRateCode::getTimeScale() const
+{
+  return this->getTau();
+}
+
+void cedar::dyn::SpaceToRateCode::computeDerivative(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& derivative)
+{
+  double tau = this->getTau() / cedar::unit::Time(1.0 * cedar::unit::second);
+  double x = state.at(0).at<float>(0, 0);
+  derivative.at(0).at<float>(0, 0) = static_cast<float>((-this->mInputMass * x + this->mWeightedInputMass) / tau);
 }
 
 void cedar::dyn::SpaceToRateCode::reset()
@@ -130,6 +130,24 @@ private:
   //!@brief Updates the output matrix.
   void eulerStep(const cedar::unit::Time& time);
 
+  //!@brief Updates the output matrix with the selected integrator.
+  void integrationStep(const cedar::unit::Time& time);
+
+  //!@brief The derivative of the output, (-s x + o) / tau (see the class documentation).
+  void computeDerivative(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& derivative);
+
+  //!@brief Returns s / tau.
+  double getLinearDecayRate() const;
+
+  //!@brief Returns tau.
+  cedar::unit::Time getTimeScale() const;
+
+  /*!@brief Computes s and o from the input and updates the fix point.
+   *
+   * @returns False if the output was already set without integration, i.e., to NaN or to the fix point.
+   */
+  bool updateMoments(double& s, double& o);
+
   //!@brief Resets the step.
   void reset();
 
@@ -148,6 +166,12 @@ protected:
 private:
   cv::Mat mRamp;
 
+  //! The integral s over the input in the current time step.
+  double mInputMass;
+
+  //! The integral o over the input weighted by position in the current time step.
+  double mWeightedInputMass;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -44,16 +44,21 @@
 #include "cedar/processing/Group.h"
 #include "cedar/auxiliaries/Data.h"
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/opencv_helper.h"
 #include "cedar/auxiliaries/Path.h"
 #include "cedar/auxiliaries/utilities.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/casts.h"
 #include "cedar/auxiliaries/Recorder.h"
+#include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/MatArchive.h"
+#include "cedar/auxiliaries/Log.h"
 
 // SYSTEM INCLUDES
 #ifndef Q_MOC_RUN
   #include <boost/property_tree/json_parser.hpp>
   #include <boost/scoped_ptr.hpp>
+  #include <boost/filesystem.hpp>
 #endif
 #include <string>
 #include <iostream>
@@ -107,7 +112,29 @@ void cedar::proc::Connectable::readConfiguration(const cedar::aux::Configuration
   this->readData(stored_data);
 }
 
-void cedar::proc::Connectable::writeData(cedar::aux::ConfigurationNode& stored_data) const
+namespace
+{
+  //! Matrices with at least this many bytes are written to the binary archive rather than the json file.
+  const size_t binary_data_threshold = 64 * 1024;
+
+  //! Checks whether any slot of the stored data refers to an entry of the binary archive.
+  bool hasBinaryEntries(const cedar::aux::ConfigurationNode& storedData)
+  {
+    for (const auto& role_iter : storedData)
+    {
+      for (const auto& slot_iter : role_iter.second)
+      {
+        if (slot_iter.second.get_optional<std::string>("binary"))
+        {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+}
+
+void cedar::proc::Connectable::writeData(cedar::aux::ConfigurationNode& stored_data, cedar::aux::MatArchive* archive) const
 {
   for (auto role_enum : cedar::proc::DataRole::type().list())
   {
@@ -120,12 +147,28 @@ void cedar::proc::Connectable::writeData(cedar::aux::ConfigurationNode& stored_d
 
     for (auto slot : this->getOrderedDataSlots(role_enum.id()))
     {
-      std::stringstream stream;
       if (slot->isSerializable())
       {
-        slot->getData()->serialize(stream);
         cedar::aux::ConfigurationNode data_node;
-        data_node.put_value(stream.str());
+        auto mat_data = boost::dynamic_pointer_cast<const cedar::aux::MatData>(slot->getData());
+        QReadLocker locker(mat_data ? &mat_data->getLock() : nullptr);
+        if
+        (
+          archive != nullptr && mat_data
+          && mat_data->getData().total() * mat_data->getData().elemSize() >= binary_data_threshold
+        )
+        {
+          std::string key = this->getFullPath() + "." + role_enum.name() + "." + slot->getName();
+          archive->add(key, mat_data->getData().clone());
+          data_node.put("binary", key);
+        }
+        else
+        {
+          locker.unlock();
+          std::stringstream stream;
+          slot->getData()->serialize(stream);
+          data_node.put_value(stream.str());
+        }
         role_stored_data.push_back(cedar::aux::ConfigurationNode::value_type(slot->getName(), data_node));
       }
     }
@@ -140,21 +183,44 @@ void cedar::proc::Connectable::writeData(cedar::aux::ConfigurationNode& stored_d
 void cedar::proc::Connectable::writeDataFile(const cedar::aux::Path& file) const
 {
   cedar::aux::ConfigurationNode data;
-  this->writeData(data);
+  cedar::aux::MatArchive archive;
+  this->writeData(data, &archive);
   if (!data.empty())
   {
     boost::property_tree::write_json(file.toString(false), data);
   }
+  std::string archive_path = file.toString(false) + ".bin";
+  if (!archive.listEntries().empty())
+  {
+    archive.write(archive_path);
+  }
+  else
+  {
+    // a sidecar left over from an earlier save no longer belongs to this file
+    boost::system::error_code error;
+    boost::filesystem::remove(archive_path, error);
+  }
 }
 
 void cedar::proc::Connectable::readDataFile(const cedar::aux::Path& file)
 {
   cedar::aux::ConfigurationNode configuration;
   boost::property_tree::read_json(file.toString(false), configuration);
-  this->readData(configuration);
+
+  // text-only files do not need the archive, even if a stale one lies next to them
+  cedar::aux::MatArchive archive;
+  if (hasBinaryEntries(configuration))
+  {
+    cedar::aux::Path archive_path(file.toString(false) + ".bin");
+    if (archive_path.exists())
+    {
+      archive.open(archive_path.toString(false));
+    }
+  }
+  this->readData(configuration, &archive);
 }
 
-void cedar::proc::Connectable::readData(const cedar::aux::ConfigurationNode& stored_data)
+void cedar::proc::Connectable::readData(const cedar::aux::ConfigurationNode& stored_data, const cedar::aux::MatArchive* archive)
 {
   for (auto role_enum : cedar::proc::DataRole::type().list())
   {
@@ -170,13 +236,42 @@ void cedar::proc::Connectable::readData(const cedar::aux::ConfigurationNode& sto
     for (const auto& subnode_iter : role_node)
     {
       const auto& slot_name = subnode_iter.first;
-      const auto& slot_data = subnode_iter.second.get_value<std::string>();
 
-      if (this->hasSlot(role_enum.id(), slot_name))
+      if (!this->hasSlot(role_enum.id(), slot_name))
+      {
+        continue;
+      }
+
+      auto slot = this->getSlot(role_enum.id(), slot_name);
+      CEDAR_ASSERT(slot->getData());
+
+      if (auto key = subnode_iter.second.get_optional<std::string>("binary"))
+      {
+        auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(slot->getData());
+        if (archive == nullptr || !mat_data || !archive->hasEntry(key.get()))
+        {
+          cedar::aux::LogSingleton::getInstance()->warning
+          (
+            "Could not read the data of slot \"" + slot_name + "\" of \"" + this->getName()
+              + "\": binary data \"" + key.get() + "\" is missing.",
+            "cedar::proc::Connectable::readData(const cedar::aux::ConfigurationNode&, const cedar::aux::MatArchive*)"
+          );
+          continue;
+        }
+
+        // reuses the memory of the slot if size and type match and no other matrix shares it
+        QWriteLocker locker(&mat_data->getLock());
+        if (cedar::aux::sharesData(mat_data->getData()))
+        {
+          mat_data->getData() = cv::Mat();
+        }
+        archive->getEntry(key.get()).copyTo(mat_data->getData());
+        mat_data->markChanged();
+        mat_data->publish();
+      }
+      else
       {
-        auto slot = this->getSlot(role_enum.id(), slot_name);
-        CEDAR_ASSERT(slot->getData());
-        std::stringstream stream(slot_data);
+        std::stringstream stream(subnode_iter.second.get_value<std::string>());
         slot->getData()->deserialize(stream);
       }
     }
@@ -194,6 +289,11 @@ void cedar::proc::Connectable::callInputConnectionChanged(const std::string& slo
   this->revalidateInputSlot(slot);
 }
 
+void cedar::proc::Connectable::callOutputConnectionAdded(cedar::proc::DataSlotPtr slot)
+{
+  this->outputConnectionAdded(slot);
+}
+
 void cedar::proc::Connectable::callOutputConnectionRemoved(cedar::proc::DataSlotPtr slot)
 {
   this->outputConnectionRemoved(slot);
@@ -483,6 +583,11 @@ void cedar::proc::Connectable::inputConnectionChanged(const std::string& /*input
 {
 }
 
+void cedar::proc::Connectable::outputConnectionAdded(cedar::proc::DataSlotPtr /* slot */)
+{
+  // empty by default -- override in derived classes if you want to react to changes in output connectivity
+}
+
 void cedar::proc::Connectable::outputConnectionRemoved(cedar::proc::DataSlotPtr /* slot */)
 {
   // empty by default -- override in derived classes if you want to react to changes in output connectivity
@@ -862,6 +967,14 @@ cedar::proc::DataSlotPtr cedar::proc::Connectable::declareOutput(const std::stri
   cedar::proc::DataSlotPtr slot = this->declareData(cedar::proc::DataRole::OUTPUT, name);
   this->setData(cedar::proc::DataRole::OUTPUT, name, data);
 
+  if (cedar::aux::SettingsSingleton::getInstance()->getDoubleBufferedOutputs())
+  {
+    if (auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(data))
+    {
+      mat_data->setDoubleBuffered(true);
+    }
+  }
+
   return slot;
 }
 
@@ -54,6 +54,7 @@
 #include "cedar/processing/Step.fwd.h"
 #include "cedar/processing/sources/GroupSource.fwd.h"
 #include "cedar/processing/InputSlotHelper.fwd.h"
+#include "cedar/auxiliaries/MatArchive.fwd.h"
 
 // SYSTEM INCLUDES
 #include <vector>
@@ -191,17 +192,21 @@ public:
 
   void readConfiguration(const cedar::aux::ConfigurationNode& node);
 
-  //! Writes data to a configuration tree node
-  virtual void writeData(cedar::aux::ConfigurationNode& stored_data) const;
+  /*! Writes data to a configuration tree node. If an archive is given, large matrices are added to it and the node only
+   *  refers to them.
+   */
+  virtual void writeData(cedar::aux::ConfigurationNode& stored_data, cedar::aux::MatArchive* archive = nullptr) const;
 
-  //! Writes data marked as serializable to the given file.
+  /*! Writes data marked as serializable to the given file. Large matrices are written to a binary archive next to it
+   *  (the file name with ".bin" appended).
+   */
   void writeDataFile(const cedar::aux::Path& file) const;
 
-  //! Writes data marked as serializable to the given file.
+  //! Reads data marked as serializable from the given file and, if it exists, the binary archive next to it.
   void readDataFile(const cedar::aux::Path& file);
 
-  //! Writes data marked as serializable to the configuration node.
-  virtual void readData(const cedar::aux::ConfigurationNode& root);
+  //! Reads data marked as serializable from the configuration node; matrices stored in an archive are read from it.
+  virtual void readData(const cedar::aux::ConfigurationNode& root, const cedar::aux::MatArchive* archive = nullptr);
 
   //!@brief Parses a data and Connectable name without specifying a role.
   static void parseDataNameNoRole
@@ -486,8 +491,12 @@ private:
    */
   void callInputConnectionChanged(const std::string& slot);
 
+  void callOutputConnectionAdded(cedar::proc::DataSlotPtr slot);
+
   void callOutputConnectionRemoved(cedar::proc::DataSlotPtr slot);
 
+  virtual void outputConnectionAdded(cedar::proc::DataSlotPtr slot);
+
   virtual void outputConnectionRemoved(cedar::proc::DataSlotPtr slot);
 
   /*!@brief Declares an output slot that contains data that is not owned by this connectable.
@@ -115,7 +115,8 @@ public:
   //! Constructor that takes a category and an (optional) class name to use for the element.
   ElementDeclaration(const std::string& category, const std::string& className = "")
   :
-  cedar::aux::PluginDeclarationBaseTemplate<cedar::proc::ElementPtr>(category, className)
+  cedar::aux::PluginDeclarationBaseTemplate<cedar::proc::ElementPtr>(category, className),
+  mIsPure(false)
   {
   }
 
@@ -166,6 +167,23 @@ public:
     return this->mPlots;
   }
 
+  /*!@brief Declares that the element is pure, i.e., its outputs depend on nothing but its inputs and parameters.
+   *
+   *        Steps of pure elements are not computed when they are triggered by a trigger chain while none of their
+   *        inputs and parameters have changed since their last computation; their previous outputs are reused. Do not
+   *        declare elements pure that depend on time, randomness, hardware or any other internal state.
+   */
+  void setPure(bool pure)
+  {
+    this->mIsPure = pure;
+  }
+
+  //!@brief Returns whether the element is declared pure.
+  bool isPure() const
+  {
+    return this->mIsPure;
+  }
+
   //! Overriden in the templated version by the super class implementation.
   virtual void declare() const = 0;
 
@@ -224,6 +242,9 @@ private:
 
   //! Default plot to open (if empty, all data is plotted).
   std::string mDefaultPlot;
+
+  //! Whether the element is pure, see setPure().
+  bool mIsPure;
 };
 
 
@@ -53,7 +53,8 @@ cedar::proc::ExternalData::ExternalData(
                                        )
 :
 cedar::proc::DataSlot(role, name, pParent, isMandatory),
-mIsCollection(false)
+mIsCollection(false),
+mAcceptsBroadcastViews(false)
 {
 }
 
@@ -81,6 +82,17 @@ bool cedar::proc::ExternalData::isCollection() const
   return this->mIsCollection;
 }
 
+void cedar::proc::ExternalData::setAcceptsBroadcastViews(bool accepts)
+{
+  CEDAR_ASSERT(this->getRole() == cedar::proc::DataRole::INPUT);
+  this->mAcceptsBroadcastViews = accepts;
+}
+
+bool cedar::proc::ExternalData::acceptsBroadcastViews() const
+{
+  return this->mAcceptsBroadcastViews;
+}
+
 bool cedar::proc::ExternalData::hasData(cedar::aux::ConstDataPtr data) const
 {
   std::vector<cedar::aux::DataWeakPtr>::const_iterator iter;
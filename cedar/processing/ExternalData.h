@@ -123,6 +123,15 @@ public:
   //!@brief   Returns whether this slot is a collection of multiple data pointers.
   bool isCollection() const;
 
+  /*!@brief   Sets whether the owner of this slot reads matrices annotated with a cedar::aux::annotation::BroadcastView
+   *          via their broadcast source rather than via the (unfilled) matrix itself.
+   * @remarks This function throws unless the role of this slot is input.
+   */
+  void setAcceptsBroadcastViews(bool accepts);
+
+  //!@brief   Returns whether the owner of this slot understands cedar::aux::annotation::BroadcastView annotations.
+  bool acceptsBroadcastViews() const;
+
   //!@brief Clears all data from the slot.
   void clearInternal();
 
@@ -177,6 +186,9 @@ private:
 
   //!@brief Whether this slot can have multiple data items.
   bool mIsCollection;
+
+  //!@brief Whether the owner of this slot understands broadcast views.
+  bool mAcceptsBroadcastViews;
 }; // class cedar::proc::ExternalData
 
 #endif // CEDAR_PROC_EXTERNAL_DATA_H
@@ -40,6 +40,7 @@
 
 // CEDAR INCLUDES
 #include "cedar/processing/Group.h"
+#include "cedar/processing/GroupCheckpoint.h"
 #include "cedar/processing/GroupDeclarationManager.h"
 #include "cedar/processing/GroupDeclaration.h"
 #include "cedar/processing/CppScript.h"
@@ -182,7 +183,9 @@ _mTimeFactor(new cedar::aux::DoubleParameter(this, "time factor", 1.0, cedar::au
 _mLoopMode(new cedar::aux::EnumParameter(this,"loop mode", cedar::aux::LoopMode::typePtr(),cedar::aux::LoopMode::FakeDT)),
 _mSimulationTimeStep(new cedar::aux::TimeParameter(this,"simulation euler step",cedar::unit::Time(20 * cedar::unit::milli * cedar::unit::seconds), cedar::aux::TimeParameter::LimitType::positive())),
 _mDefaultCPUStep(new cedar::aux::TimeParameter(this,"default CPU step",cedar::unit::Time(20 * cedar::unit::milli * cedar::unit::seconds), cedar::aux::TimeParameter::LimitType::positive())),
-_mMinimumComputationTime(new cedar::aux::TimeParameter(this,"min computation time",cedar::unit::Time(20 * cedar::unit::milli * cedar::unit::seconds), cedar::aux::TimeParameter::LimitType::positive()))
+_mMinimumComputationTime(new cedar::aux::TimeParameter(this,"min computation time",cedar::unit::Time(20 * cedar::unit::milli * cedar::unit::seconds), cedar::aux::TimeParameter::LimitType::positive())),
+_mMultiRate(new cedar::aux::BoolParameter(this, "multi-rate", false)),
+_mMaximumUpdateRatio(new cedar::aux::UIntParameter(this, "maximum update ratio", 16, cedar::aux::UIntParameter::LimitType::positive(1024)))
 {
   cedar::aux::LogSingleton::getInstance()->allocating(this);
   this->_mConnectors->setHidden(true);
@@ -192,6 +195,8 @@ _mMinimumComputationTime(new cedar::aux::TimeParameter(this,"min computation tim
   this->_mSimulationTimeStep->setHidden(true);
   this->_mDefaultCPUStep->setHidden(true);
   this->_mMinimumComputationTime->setHidden(true);
+  this->_mMultiRate->setHidden(true);
+  this->_mMaximumUpdateRatio->setHidden(true);
 
 
 //  mTriggerStepper = cedar::proc::TriggerStepper(cedar::aux::asserted_pointer_cast<cedar::proc::Group>(this->shared_from_this()));
@@ -454,6 +459,52 @@ cedar::unit::Time cedar::proc::Group::getMinimumComputationTime() const
   return value;
 }
 
+void cedar::proc::Group::applyMultiRate()
+{
+  QReadLocker locker(this->_mMultiRate->getLock());
+  bool enabled = this->_mMultiRate->getValue();
+  locker.unlock();
+
+  QReadLocker ratio_locker(this->_mMaximumUpdateRatio->getLock());
+  unsigned int ratio = this->_mMaximumUpdateRatio->getValue();
+  ratio_locker.unlock();
+
+  cedar::aux::GlobalClockSingleton::getInstance()->setMaximumUpdateRatio(ratio);
+  cedar::aux::GlobalClockSingleton::getInstance()->setMultiRateEnabled(enabled);
+}
+
+void cedar::proc::Group::setMultiRateEnabled(bool enabled)
+{
+  this->_mMultiRate->setValue(enabled, true);
+
+  this->applyMultiRate();
+}
+
+bool cedar::proc::Group::isMultiRateEnabled() const
+{
+  QReadLocker locker(this->_mMultiRate->getLock());
+  bool value = this->_mMultiRate->getValue();
+  locker.unlock();
+
+  return value;
+}
+
+void cedar::proc::Group::setMaximumUpdateRatio(unsigned int ratio)
+{
+  this->_mMaximumUpdateRatio->setValue(ratio, true);
+
+  this->applyMultiRate();
+}
+
+unsigned int cedar::proc::Group::getMaximumUpdateRatio() const
+{
+  QReadLocker locker(this->_mMaximumUpdateRatio->getLock());
+  unsigned int value = this->_mMaximumUpdateRatio->getValue();
+  locker.unlock();
+
+  return value;
+}
+
 std::set<std::string> cedar::proc::Group::listRequiredPlugins() const
 {
   std::set<std::string> required_plugins;
@@ -1014,6 +1065,13 @@ void cedar::proc::Group::stepTriggers(cedar::unit::Time timeStep)
 {
   cedar::aux::GlobalClockSingleton::getInstance()->addTime(timeStep);
   std::vector<cedar::proc::LoopedTriggerPtr> triggers = this->listLoopedTriggers();
+
+  if (cedar::aux::SettingsSingleton::getInstance()->getParallelTriggerStepping())
+  {
+    cedar::proc::TriggerStepper::stepInParallel(triggers, timeStep);
+    return;
+  }
+
   // step all triggers with this time step
   for (auto trigger : triggers)
   {
@@ -1198,6 +1256,34 @@ void cedar::proc::Group::reset()
 
 }
 
+cedar::proc::GroupCheckpointPtr cedar::proc::Group::createCheckpoint() const
+{
+  auto self = boost::dynamic_pointer_cast<cedar::proc::ConstGroup>(this->shared_from_this());
+  return cedar::proc::GroupCheckpointPtr(new cedar::proc::GroupCheckpoint(self));
+}
+
+void cedar::proc::Group::restoreCheckpoint(cedar::proc::ConstGroupCheckpointPtr checkpoint)
+{
+  bool was_running = this->isAnyTriggerRunning();
+  if (was_running)
+  {
+    this->stopTriggers(true);
+  }
+
+  // the clock goes back to the time of the checkpoint; steps that remember a later time would not compute until then
+  for (const auto& step : this->findAll<cedar::proc::Step>(true))
+  {
+    step->callResetComputationState();
+  }
+
+  checkpoint->restore();
+
+  if (was_running)
+  {
+    this->startTriggers();
+  }
+}
+
 const cedar::proc::Group::ElementMap& cedar::proc::Group::getElements() const
 {
   return this->mElements;
@@ -2250,7 +2336,7 @@ void cedar::proc::Group::writeConfigurationXML(cedar::aux::ConfigurationNode& ro
   format.write(boost::dynamic_pointer_cast<cedar::proc::ConstGroup>(this->shared_from_this()), root);
 }
 
-void cedar::proc::Group::writeData(cedar::aux::ConfigurationNode& root) const
+void cedar::proc::Group::writeData(cedar::aux::ConfigurationNode& root, cedar::aux::MatArchive* archive) const
 {
   for (auto name_element_pair : this->getElements())
   {
@@ -2258,7 +2344,7 @@ void cedar::proc::Group::writeData(cedar::aux::ConfigurationNode& root) const
     if (auto connectable = boost::dynamic_pointer_cast<cedar::proc::Connectable>(element))
     {
       cedar::aux::ConfigurationNode data;
-      connectable->writeData(data);
+      connectable->writeData(data, archive);
       if (!data.empty())
       {
         root.push_back(cedar::aux::ConfigurationNode::value_type(connectable->getName(), data));
@@ -2267,7 +2353,7 @@ void cedar::proc::Group::writeData(cedar::aux::ConfigurationNode& root) const
   }
 }
 
-void cedar::proc::Group::readData(const cedar::aux::ConfigurationNode& root)
+void cedar::proc::Group::readData(const cedar::aux::ConfigurationNode& root, const cedar::aux::MatArchive* archive)
 {
   for (auto assoc_pair : root)
   {
@@ -2280,7 +2366,7 @@ void cedar::proc::Group::readData(const cedar::aux::ConfigurationNode& root)
     auto element = this->getElement(element_name);
     if (auto connectable = boost::dynamic_pointer_cast<cedar::proc::Connectable>(element))
     {
-      connectable->readData(assoc_pair.second);
+      connectable->readData(assoc_pair.second, archive);
     }
   }
 }
@@ -2777,7 +2863,7 @@ void cedar::proc::Group::removeAllConnectors()
   }
 }
 
-void cedar::proc::Group::onTrigger(cedar::proc::ArgumentsPtr args, cedar::proc::TriggerPtr trigger)
+void cedar::proc::Group::onTrigger(const cedar::proc::ArgumentsPtr& args, const cedar::proc::TriggerPtr& trigger)
 {
   if (this->isLooped())
   {
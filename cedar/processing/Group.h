@@ -50,11 +50,13 @@
 #include "cedar/auxiliaries/DoubleParameter.h"
 #include "cedar/auxiliaries/EnumParameter.h"
 #include "cedar/auxiliaries/TimeParameter.h"
+#include "cedar/auxiliaries/UIntParameter.h"
 #include "cedar/auxiliaries/Path.h"
 #include "cedar/auxiliaries/boostSignalsHelper.h"
 #include "cedar/units/Time.h"
 #include "cedar/auxiliaries/LoopMode.h"
 #include "cedar/processing/TriggerStepper.fwd.h"
+#include "cedar/processing/GroupCheckpoint.fwd.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/BoolParameter.h"
@@ -217,7 +219,7 @@ public:
   */
   void readConfigurationXML(const cedar::aux::ConfigurationNode& root);
 
-  void readData(const cedar::aux::ConfigurationNode& root);
+  void readData(const cedar::aux::ConfigurationNode& root, const cedar::aux::MatArchive* archive = nullptr);
 
   /*!@brief Writes the group to a configuration node.
    */
@@ -229,7 +231,7 @@ public:
 
   /*!@brief Writes data marked as serializable to the given configuration node.
    */
-  void writeData(cedar::aux::ConfigurationNode& root) const;
+  void writeData(cedar::aux::ConfigurationNode& root, cedar::aux::MatArchive* archive = nullptr) const;
 
   /*!@brief Removes an element from the group.
    *
@@ -458,6 +460,16 @@ public:
    */
   void reset();
 
+  /*!@brief Captures the outputs and buffers of all elements in this group and its subgroups in memory.
+   *
+   * @see cedar::proc::GroupCheckpoint for what is part of a checkpoint.
+   */
+  cedar::proc::GroupCheckpointPtr createCheckpoint() const;
+
+  /*!@brief Restores a checkpoint created by createCheckpoint. Running triggers are stopped and restarted afterwards.
+   */
+  void restoreCheckpoint(cedar::proc::ConstGroupCheckpointPtr checkpoint);
+
   /*!@brief Find the complete path of an element, if it exists in the tree structure
    * @returns returns the dot-separated path to the element, or empty string if element is not found in tree
    */
@@ -560,8 +572,8 @@ public:
 
   void onTrigger
        (
-         cedar::proc::ArgumentsPtr args = cedar::proc::ArgumentsPtr(),
-         cedar::proc::TriggerPtr = cedar::proc::TriggerPtr()
+         const cedar::proc::ArgumentsPtr& args = cedar::proc::ArgumentsPtr(),
+         const cedar::proc::TriggerPtr& = cedar::proc::TriggerPtr()
        );
 
   /*!@brief The wait method.
@@ -754,6 +766,21 @@ public:
   //! Applies the group's minimum simulation time, i.e., sets it at the cedar::aux::GlobalClockSingleton.
   void applyMinimumComputationTime();
 
+  //! Enables or disables multi-rate simulation of dynamics for this group. Only applied by the root group.
+  void setMultiRateEnabled(bool enabled);
+
+  //! Returns whether multi-rate simulation is enabled for this architecture.
+  bool isMultiRateEnabled() const;
+
+  //! Sets the largest number of steps between two updates of slow dynamics. Only applied by the root group.
+  void setMaximumUpdateRatio(unsigned int ratio);
+
+  //! Returns the largest number of steps between two updates of slow dynamics.
+  unsigned int getMaximumUpdateRatio() const;
+
+  //! Applies the group's multi-rate settings, i.e., sets them at the cedar::aux::GlobalClockSingleton.
+  void applyMultiRate();
+
   //! Returns the number of triggerables in this group that are in a warning state
   unsigned int getTriggerablesInWarningStateCount() const;
 
@@ -1013,6 +1040,10 @@ protected:
 
   cedar::aux::TimeParameterPtr _mMinimumComputationTime;
 
+  cedar::aux::BoolParameterPtr _mMultiRate;
+
+  cedar::aux::UIntParameterPtr _mMaximumUpdateRatio;
+
 }; // class cedar::proc::Group
 
 Q_DECLARE_METATYPE(cedar::proc::Group::ConnectionChange)
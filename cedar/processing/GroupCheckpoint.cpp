@@ -0,0 +1,180 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        GroupCheckpoint.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: In-memory snapshot of the data of a group.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/processing/GroupCheckpoint.h"
+#include "cedar/processing/Group.h"
+#include "cedar/processing/Connectable.h"
+#include "cedar/processing/DataSlot.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/opencv_helper.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <cstring>
+#include <set>
+
+//----------------------------------------------------------------------------------------------------------------------
+// constructors and destructor
+//----------------------------------------------------------------------------------------------------------------------
+
+cedar::proc::GroupCheckpoint::GroupCheckpoint(cedar::proc::ConstGroupPtr group)
+{
+  this->capture(group);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+// methods
+//----------------------------------------------------------------------------------------------------------------------
+
+size_t cedar::proc::GroupCheckpoint::getSize() const
+{
+  return this->mMemory.size();
+}
+
+void cedar::proc::GroupCheckpoint::capture(cedar::proc::ConstGroupPtr group)
+{
+  // collect all data that carries state; buffers and outputs may be shared between slots, so each is visited once
+  std::vector<cedar::aux::DataPtr> data_list;
+  std::set<cedar::aux::Data*> visited;
+  for (const auto& connectable : group->findAll<cedar::proc::Connectable>(true))
+  {
+    for (auto role : {cedar::proc::DataRole::BUFFER, cedar::proc::DataRole::OUTPUT})
+    {
+      if (!connectable->hasSlotForRole(role))
+      {
+        continue;
+      }
+
+      for (const auto& slot : connectable->getOrderedDataSlots(role))
+      {
+        auto data = slot->getData();
+        if (data && visited.insert(data.get()).second)
+        {
+          data_list.push_back(data);
+        }
+      }
+    }
+  }
+
+  // copy the matrices; the memory is only allocated once all sizes are known, so the stored headers stay valid
+  std::vector<cv::Mat> copies;
+  size_t total_size = 0;
+  for (const auto& data : data_list)
+  {
+    if (auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(data))
+    {
+      QReadLocker locker(&mat_data->getLock());
+      cv::Mat copy = mat_data->getData().clone();
+      locker.unlock();
+
+      MatEntry entry;
+      entry.mData = mat_data;
+      this->mMatEntries.push_back(entry);
+      total_size += copy.total() * copy.elemSize();
+      copies.push_back(copy);
+    }
+    else
+    {
+      DataEntry entry;
+      entry.mData = data;
+      try
+      {
+        QReadLocker locker(&data->getLock());
+        entry.mClone = data->clone();
+      }
+      catch (const cedar::aux::NotImplementedException&)
+      {
+        // data that cannot be cloned is not part of the checkpoint
+        continue;
+      }
+      this->mDataEntries.push_back(entry);
+    }
+  }
+
+  this->mMemory.resize(total_size);
+  size_t offset = 0;
+  for (size_t i = 0; i < copies.size(); ++i)
+  {
+    const cv::Mat& copy = copies.at(i);
+    size_t size = copy.total() * copy.elemSize();
+    this->mMatEntries.at(i).mStored = cv::Mat(copy.dims, copy.size.p, copy.type(), this->mMemory.data() + offset);
+    if (size > 0)
+    {
+      std::memcpy(this->mMemory.data() + offset, copy.data, size);
+    }
+    offset += size;
+  }
+
+  auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+  this->mTime = clock->getTime();
+  this->mSeed = clock->getSeed();
+}
+
+void cedar::proc::GroupCheckpoint::restore() const
+{
+  for (const auto& entry : this->mMatEntries)
+  {
+    const cv::Mat& stored = entry.mStored;
+    QWriteLocker locker(&entry.mData->getLock());
+    cv::Mat& mat = entry.mData->getData();
+    // memory that is shared with other matrices (e.g., by a local reader) must not be written to
+    if (cedar::aux::sharesData(mat))
+    {
+      mat = cv::Mat();
+    }
+    // create is a no-op if size and type are unchanged, so the data keeps its memory
+    mat.create(stored.dims, stored.size.p, stored.type());
+    stored.copyTo(mat);
+    entry.mData->markChanged();
+    entry.mData->publish();
+  }
+
+  for (const auto& entry : this->mDataEntries)
+  {
+    QWriteLocker locker(&entry.mData->getLock());
+    entry.mData->copyValueFrom(entry.mClone);
+    entry.mData->markChanged();
+  }
+
+  auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+  clock->reset();
+  clock->addTime(this->mTime);
+  clock->setSeed(this->mSeed);
+}
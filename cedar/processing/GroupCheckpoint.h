@@ -0,0 +1,152 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        GroupCheckpoint.h
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: In-memory snapshot of the data of a group.
+
+    Credits:
+
+======================================================================================================================*/
+
+#ifndef CEDAR_PROC_GROUP_CHECKPOINT_H
+#define CEDAR_PROC_GROUP_CHECKPOINT_H
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/units/Time.h"
+
+// FORWARD DECLARATIONS
+#include "cedar/processing/GroupCheckpoint.fwd.h"
+#include "cedar/processing/Group.fwd.h"
+#include "cedar/auxiliaries/Data.fwd.h"
+#include "cedar/auxiliaries/MatData.fwd.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+
+/*!@brief An in-memory snapshot of the data of a group and all its subgroups.
+ *
+ *        A checkpoint holds the outputs and buffers of all connectables (which includes the state of dynamics, e.g.,
+ *        field activations and learned weights), the seed of the global clock and its time. All matrices are stored in
+ *        one contiguous block of memory, so both capturing and restoring a checkpoint amount to one memcpy per matrix.
+ *        Data of other types is cloned and restored via cedar::aux::Data::copyValueFrom.
+ *
+ *        State that steps keep outside of their data slots is not part of the checkpoint. Neither are the states of
+ *        the random number generators; they are thread-local, and looped triggers reseed them from the global clock's
+ *        seed in every step.
+ *
+ *        The triggers of the group should be stopped while a checkpoint is captured or restored.
+ */
+class cedar::proc::GroupCheckpoint
+{
+  //--------------------------------------------------------------------------------------------------------------------
+  // nested types
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! A matrix stored in the checkpoint's memory.
+  struct MatEntry
+  {
+    //! The data the matrix belongs to.
+    cedar::aux::MatDataPtr mData;
+    //! Header of the stored matrix; points into mMemory.
+    cv::Mat mStored;
+  };
+
+  //! Data of other types, stored as a clone.
+  struct DataEntry
+  {
+    //! The data the clone belongs to.
+    cedar::aux::DataPtr mData;
+    //! Clone of the data at the time of capturing.
+    cedar::aux::DataPtr mClone;
+  };
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // constructors and destructor
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  //!@brief Captures the current state of the given group.
+  GroupCheckpoint(cedar::proc::ConstGroupPtr group);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // public methods
+  //--------------------------------------------------------------------------------------------------------------------
+public:
+  /*!@brief Writes the captured state back into the data it was captured from.
+   *
+   *        Matrices whose size or type has changed since are reallocated. Data that has been removed from the group
+   *        since is still written to, but this has no effect on the group.
+   */
+  void restore() const;
+
+  //!@brief Returns the number of bytes of matrix data held by the checkpoint.
+  size_t getSize() const;
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // protected methods
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // private methods
+  //--------------------------------------------------------------------------------------------------------------------
+private:
+  //! Captures the state of the group.
+  void capture(cedar::proc::ConstGroupPtr group);
+
+  //--------------------------------------------------------------------------------------------------------------------
+  // members
+  //--------------------------------------------------------------------------------------------------------------------
+protected:
+  // none yet
+
+private:
+  //! Holds all stored matrices back to back.
+  std::vector<uchar> mMemory;
+
+  //! The matrices in the checkpoint.
+  std::vector<MatEntry> mMatEntries;
+
+  //! Data of other types in the checkpoint.
+  std::vector<DataEntry> mDataEntries;
+
+  //! Seed of the global clock at the time of capturing.
+  uint64 mSeed;
+
+  //! Time of the global clock at the time of capturing.
+  cedar::unit::Time mTime;
+
+}; // class cedar::proc::GroupCheckpoint
+
+#endif // CEDAR_PROC_GROUP_CHECKPOINT_H
@@ -221,8 +221,15 @@ void cedar::proc::LoopedTrigger::processQuit()
 
 void cedar::proc::LoopedTrigger::step(cedar::unit::Time time)
 {
-  srand(cedar::aux::GlobalClockSingleton ::getInstance()->getSeed());
-  cv::theRNG().state = cedar::aux::GlobalClockSingleton ::getInstance()->getSeed();
+  this->stepWithSeed(time, cedar::aux::GlobalClockSingleton ::getInstance()->getSeed());
+
+  cedar::aux::GlobalClockSingleton ::getInstance()->setSeed(cv::theRNG().state);
+}
+
+void cedar::proc::LoopedTrigger::stepWithSeed(cedar::unit::Time time, uint64 seed)
+{
+  srand(seed);
+  cv::theRNG().state = seed;
 
   cedar::proc::ArgumentsPtr arguments(new cedar::proc::StepTime(time,cedar::aux::GlobalClockSingleton::getInstance()->getTime()));
 
@@ -234,8 +241,6 @@ void cedar::proc::LoopedTrigger::step(cedar::unit::Time time)
   }
   this->mStatistics->append(time);
 
-  cedar::aux::GlobalClockSingleton ::getInstance()->setSeed(cv::theRNG().state);
-
 //  unsigned long stepsTaken = this->getNumberOfSteps();
 //  std::cout<<this->getName() << " has taken " << stepsTaken << " steps. In LoopMode: "<< this->getLoopModeParameter() <<std::endl;
 //  if(this->getLoopModeParameter() == cedar::aux::LoopMode::FakeDT)
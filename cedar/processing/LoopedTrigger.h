@@ -98,6 +98,14 @@ public:
    */
   void step(cedar::unit::Time time);
 
+  /*!@brief Steps the trigger once, with the given random seed instead of the one of the global clock.
+   *
+   *        Unlike step(), this does not hand the random state back to the global clock, so several triggers can be
+   *        stepped concurrently, each with a seed of its own. Only cv::theRNG() is thread-local; steps that use rand()
+   *        are not reproducible when stepped concurrently.
+   */
+  void stepWithSeed(cedar::unit::Time time, uint64 seed);
+
   //! Returns the current time measurement statistics
   ConstTimeAveragePtr getStatistics() const;
 
@@ -134,6 +134,11 @@ bool cedar::proc::OwnedData::isShared() const
 void cedar::proc::OwnedData::addOutgoingConnection(cedar::proc::DataConnectionPtr newConnection)
 {
   this->addConnection(newConnection);
+  auto parent = this->getParentPtr();
+  if (parent)
+  {
+    parent->callOutputConnectionAdded(this->shared_from_this());
+  }
 }
 
 void cedar::proc::OwnedData::removeOutgoingConnection(cedar::proc::DataConnectionPtr removedConnection)
@@ -41,11 +41,406 @@
 #include "cedar/processing/ProjectionFunctions.h"
 
 // CEDAR INCLUDES
+#include "cedar/auxiliaries/annotation/BroadcastView.h"
+#include "cedar/auxiliaries/math/tools.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/MatData.h"
-#include "cedar/auxiliaries/MatrixIterator.h"
+#include "cedar/auxiliaries/opencv_helper.h"
+#include "cedar/auxiliaries/ThreadPool.h"
 #include "cedar/processing/ProjectionMapping.h"
 
 // SYSTEM INCLUDES
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+	//! Projections touching fewer elements than this per task are not worth handing to the thread pool.
+	const size_t PROJECTION_MIN_CHUNK_SIZE = 32768;
+
+	//! Marks an input dimension that is dropped (compressed) in a lookup of input to output dimensions.
+	const unsigned int DROPPED_DIMENSION = std::numeric_limits<unsigned int>::max();
+
+	/*!@brief Logical sizes and element strides of a matrix.
+	 *
+	 *        1D matrices are described as vectors regardless of whether they are stored as a row or a column, 0D
+	 *        matrices have no dimensions at all. The number of logical dimensions is passed in explicitly because
+	 *        matrices with singleton dimensions cannot be told apart otherwise (e.g., a 1 x n matrix may be 1D or 2D).
+	 */
+	struct Layout
+	{
+		Layout(const cv::Mat& matrix, unsigned int dimensionality)
+		:
+		dims(dimensionality)
+		{
+			size_t element_size = matrix.elemSize();
+			if (this->dims == 1)
+			{
+				CEDAR_DEBUG_ASSERT(matrix.rows == 1 || matrix.cols == 1);
+				this->sizes[0] = static_cast<int>(matrix.total());
+				this->strides[0] = (matrix.rows == 1 ? matrix.step[1] : matrix.step[0]) / element_size;
+			}
+			else if (this->dims > 1)
+			{
+				CEDAR_ASSERT(matrix.dims == static_cast<int>(this->dims));
+				for (unsigned int d = 0; d < this->dims; ++d)
+				{
+					this->sizes[d] = matrix.size[d];
+					this->strides[d] = matrix.step[d] / element_size;
+				}
+			}
+		}
+
+		unsigned int dims;
+		int sizes[CV_MAX_DIM];
+		size_t strides[CV_MAX_DIM];
+	};
+
+	/*!@brief Calls kernel(begin, end) for consecutive ranges covering [0, count), in parallel if worthwhile.
+	 *
+	 *        The kernel must only write to locations that belong to its own range.
+	 */
+	template <typename Kernel>
+	void runChunked(size_t count, size_t elementsPerItem, const Kernel& kernel)
+	{
+		auto thread_pool = cedar::aux::ThreadPoolSingleton::getInstance();
+		size_t chunks = 1;
+		if (thread_pool->getNumberOfThreads() > 0)
+		{
+			chunks = std::min(static_cast<size_t>(thread_pool->getNumberOfThreads()) + 1, count);
+			chunks = std::min(chunks, (count * elementsPerItem) / PROJECTION_MIN_CHUNK_SIZE);
+		}
+
+		if (chunks <= 1)
+		{
+			kernel(0, count);
+			return;
+		}
+
+		std::vector<cedar::aux::ThreadPool::Task> tasks;
+		tasks.reserve(chunks);
+		for (size_t chunk = 0; chunk < chunks; ++chunk)
+		{
+			size_t begin = (count * chunk) / chunks;
+			size_t end = (count * (chunk + 1)) / chunks;
+			tasks.push_back([&kernel, begin, end]()
+			{
+				kernel(begin, end);
+			});
+		}
+		thread_pool->run(tasks);
+	}
+
+	/*!@brief Writes (or, if Accumulate is set, adds) the expansion of source into target.
+	 *
+	 *        Dimension i of source corresponds to dimension mapping.at(i) of target; target is filled with copies of source
+	 *        along all other dimensions. The target is processed row by row (a row being its innermost dimension), so the
+	 *        inner loop is a plain fill, copy or add that the compiler can vectorize.
+	 */
+	template <typename T, bool Accumulate>
+	void broadcast(const cv::Mat& source, const std::vector<unsigned int>& mapping, cv::Mat& target)
+	{
+		Layout in(source, static_cast<unsigned int>(mapping.size()));
+		Layout out(target, cedar::aux::math::getDimensionalityOf(target));
+		CEDAR_ASSERT(out.dims > 0);
+
+		// stride in the source for each target dimension; expanded dimensions do not advance in the source
+		size_t source_strides[CV_MAX_DIM];
+		std::fill(source_strides, source_strides + out.dims, 0);
+		for (unsigned int i = 0; i < in.dims; ++i)
+		{
+			CEDAR_ASSERT(mapping[i] < out.dims && in.sizes[i] == out.sizes[mapping[i]]);
+			source_strides[mapping[i]] = in.strides[i];
+		}
+
+		const int inner = static_cast<int>(out.dims) - 1;
+		const size_t row_length = static_cast<size_t>(out.sizes[inner]);
+		const size_t row_count = target.total() / row_length;
+		const size_t source_inner_stride = source_strides[inner];
+		const size_t target_inner_stride = out.strides[inner];
+		const T* source_data = source.ptr<T>();
+		T* target_data = target.ptr<T>();
+
+		runChunked(row_count, row_length, [&](size_t begin, size_t end)
+		{
+			// find the position of the first row of this chunk
+			int index[CV_MAX_DIM];
+			size_t source_offset = 0;
+			size_t target_offset = 0;
+			size_t rest = begin;
+			for (int d = inner - 1; d >= 0; --d)
+			{
+				index[d] = static_cast<int>(rest % out.sizes[d]);
+				rest /= out.sizes[d];
+				source_offset += index[d] * source_strides[d];
+				target_offset += index[d] * out.strides[d];
+			}
+
+			for (size_t row = begin; row < end; ++row)
+			{
+				const T* source_row = source_data + source_offset;
+				T* target_row = target_data + target_offset;
+				if (target_inner_stride == 1 && source_inner_stride == 0)
+				{
+					if (Accumulate)
+					{
+						const T value = *source_row;
+						for (size_t k = 0; k < row_length; ++k)
+						{
+							target_row[k] += value;
+						}
+					}
+					else
+					{
+						std::fill(target_row, target_row + row_length, *source_row);
+					}
+				}
+				else if (target_inner_stride == 1 && source_inner_stride == 1)
+				{
+					if (Accumulate)
+					{
+						for (size_t k = 0; k < row_length; ++k)
+						{
+							target_row[k] += source_row[k];
+						}
+					}
+					else
+					{
+						std::copy(source_row, source_row + row_length, target_row);
+					}
+				}
+				else
+				{
+					for (size_t k = 0; k < row_length; ++k)
+					{
+						if (Accumulate)
+						{
+							target_row[k * target_inner_stride] += source_row[k * source_inner_stride];
+						}
+						else
+						{
+							target_row[k * target_inner_stride] = source_row[k * source_inner_stride];
+						}
+					}
+				}
+
+				// advance to the next row
+				for (int d = inner - 1; d >= 0; --d)
+				{
+					source_offset += source_strides[d];
+					target_offset += out.strides[d];
+					if (++index[d] < out.sizes[d])
+					{
+						break;
+					}
+					source_offset -= source_strides[d] * out.sizes[d];
+					target_offset -= out.strides[d] * out.sizes[d];
+					index[d] = 0;
+				}
+			}
+		});
+	}
+
+	//! Reduction by summation; also used for averaging.
+	template <typename T>
+	struct SumReduction
+	{
+		static T identity()
+		{
+			return static_cast<T>(0);
+		}
+
+		static void apply(T& accumulator, T value)
+		{
+			accumulator += value;
+		}
+	};
+
+	//! Reduction by taking the maximum.
+	template <typename T>
+	struct MaxReduction
+	{
+		static T identity()
+		{
+			return std::numeric_limits<T>::lowest();
+		}
+
+		static void apply(T& accumulator, T value)
+		{
+			accumulator = value > accumulator ? value : accumulator;
+		}
+	};
+
+	//! Reduction by taking the minimum.
+	template <typename T>
+	struct MinReduction
+	{
+		static T identity()
+		{
+			return std::numeric_limits<T>::max();
+		}
+
+		static void apply(T& accumulator, T value)
+		{
+			accumulator = value < accumulator ? value : accumulator;
+		}
+	};
+
+	/*!@brief Reduces source into target in a single pass over the source.
+	 *
+	 *        Dimension i of source is kept as dimension mapping.at(i) of target, or reduced if it is
+	 *        DROPPED_DIMENSION. The work is split along the largest kept dimension, so every task writes to its own part
+	 *        of the target and no partial results have to be merged.
+	 */
+	template <typename T, class Reduction>
+	void reduce(const cv::Mat& source, const std::vector<unsigned int>& mapping, cv::Mat& target, unsigned int targetDims)
+	{
+		Layout in(source, static_cast<unsigned int>(mapping.size()));
+		Layout out(target, targetDims);
+		CEDAR_ASSERT(in.dims > 0);
+
+		// stride in the target for each source dimension; dropped dimensions do not advance in the target
+		size_t target_strides[CV_MAX_DIM];
+		int split_dim = -1;
+		for (unsigned int i = 0; i < in.dims; ++i)
+		{
+			if (mapping[i] == DROPPED_DIMENSION)
+			{
+				target_strides[i] = 0;
+			}
+			else
+			{
+				CEDAR_ASSERT(mapping[i] < out.dims && in.sizes[i] == out.sizes[mapping[i]]);
+				target_strides[i] = out.strides[mapping[i]];
+				if (split_dim < 0 || in.sizes[i] > in.sizes[split_dim])
+				{
+					split_dim = static_cast<int>(i);
+				}
+			}
+		}
+		CEDAR_ASSERT(split_dim >= 0);
+
+		CEDAR_DEBUG_ASSERT(target.isContinuous());
+		std::fill(target.ptr<T>(), target.ptr<T>() + target.total(), Reduction::identity());
+
+		const int inner = static_cast<int>(in.dims) - 1;
+		const size_t source_inner_stride = in.strides[inner];
+		const size_t target_inner_stride = target_strides[inner];
+		const T* source_data = source.ptr<T>();
+		T* target_data = target.ptr<T>();
+
+		const size_t split_size = static_cast<size_t>(in.sizes[split_dim]);
+		runChunked(split_size, source.total() / split_size, [&](size_t begin, size_t end)
+		{
+			// this task covers the full range of every dimension except for the split dimension
+			int first[CV_MAX_DIM];
+			int last[CV_MAX_DIM];
+			int index[CV_MAX_DIM];
+			size_t source_offset = 0;
+			size_t target_offset = 0;
+			for (int d = 0; d <= inner; ++d)
+			{
+				first[d] = d == split_dim ? static_cast<int>(begin) : 0;
+				last[d] = d == split_dim ? static_cast<int>(end) : in.sizes[d];
+				index[d] = first[d];
+				source_offset += first[d] * in.strides[d];
+				target_offset += first[d] * target_strides[d];
+			}
+			const size_t row_length = static_cast<size_t>(last[inner] - first[inner]);
+
+			bool done = false;
+			while (!done)
+			{
+				const T* source_row = source_data + source_offset;
+				T* target_row = target_data + target_offset;
+				if (target_inner_stride == 0)
+				{
+					// the innermost dimension is dropped, reduce the row to a single value
+					size_t k = 0;
+					T accumulator = *target_row;
+					if (source_inner_stride == 1)
+					{
+						// independent accumulators break the dependency chain of the loop
+						T partial[4] = {accumulator, Reduction::identity(), Reduction::identity(), Reduction::identity()};
+						for (; k + 4 <= row_length; k += 4)
+						{
+							Reduction::apply(partial[0], source_row[k]);
+							Reduction::apply(partial[1], source_row[k + 1]);
+							Reduction::apply(partial[2], source_row[k + 2]);
+							Reduction::apply(partial[3], source_row[k + 3]);
+						}
+						Reduction::apply(partial[0], partial[1]);
+						Reduction::apply(partial[2], partial[3]);
+						Reduction::apply(partial[0], partial[2]);
+						accumulator = partial[0];
+					}
+					for (; k < row_length; ++k)
+					{
+						Reduction::apply(accumulator, source_row[k * source_inner_stride]);
+					}
+					*target_row = accumulator;
+				}
+				else if (target_inner_stride == 1 && source_inner_stride == 1)
+				{
+					for (size_t k = 0; k < row_length; ++k)
+					{
+						Reduction::apply(target_row[k], source_row[k]);
+					}
+				}
+				else
+				{
+					for (size_t k = 0; k < row_length; ++k)
+					{
+						Reduction::apply(target_row[k * target_inner_stride], source_row[k * source_inner_stride]);
+					}
+				}
+
+				// advance to the next row
+				done = true;
+				for (int d = inner - 1; d >= 0; --d)
+				{
+					source_offset += in.strides[d];
+					target_offset += target_strides[d];
+					if (++index[d] < last[d])
+					{
+						done = false;
+						break;
+					}
+					source_offset -= in.strides[d] * (last[d] - first[d]);
+					target_offset -= target_strides[d] * (last[d] - first[d]);
+					index[d] = first[d];
+				}
+			}
+		});
+	}
+
+	//! Makes sure that target is a continuous matrix of the given logical sizes and type without reallocating needlessly.
+	void prepareTarget(cv::Mat& target, const std::vector<int>& sizes, int type)
+	{
+		bool matches = target.type() == type && target.isContinuous();
+		if (matches && sizes.size() == 1)
+		{
+			matches = (target.rows == 1 || target.cols == 1) && target.total() == static_cast<size_t>(sizes.front());
+		}
+		else if (matches)
+		{
+			matches = target.dims == static_cast<int>(sizes.size()) && std::equal(sizes.begin(), sizes.end(), target.size.p);
+		}
+
+		if (!matches)
+		{
+			if (sizes.size() == 1)
+			{
+				// 1D outputs are column vectors
+				target = cv::Mat(sizes.front(), 1, type);
+			}
+			else
+			{
+				target = cv::Mat(static_cast<int>(sizes.size()), sizes.data(), type);
+			}
+		}
+	}
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -63,6 +458,26 @@ cedar::proc::ProjectionFunctions::~ProjectionFunctions()
 // methods
 //----------------------------------------------------------------------------------------------------------------------
 
+void cedar::proc::ProjectionFunctions::lookUpMapping(cedar::proc::ProjectionMappingParameterPtr dimensionMappings,
+																										bool allowDropped)
+{
+	auto mapping = dimensionMappings->getValue();
+	unsigned int number_of_mappings = mapping->getNumberOfMappings();
+	// resizing only allocates when the number of mappings grows, so this is cheap to do in every step
+	this->mMappingLookup.resize(number_of_mappings);
+	for (unsigned int i = 0; i < number_of_mappings; ++i)
+	{
+		if (allowDropped && mapping->isDropped(i))
+		{
+			this->mMappingLookup.at(i) = DROPPED_DIMENSION;
+		}
+		else
+		{
+			// throws if the dimension is not mapped
+			this->mMappingLookup.at(i) = mapping->lookUp(i);
+		}
+	}
+}
 
 template<typename T>
 void cedar::proc::ProjectionFunctions::expand0DtoND(cedar::aux::ConstMatDataPtr input,
@@ -106,31 +521,9 @@ void cedar::proc::ProjectionFunctions::expand1Dto2D(cedar::aux::ConstMatDataPtr
 																									 cedar::aux::EnumParameterPtr compressionType,
 																									 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
-	const cv::Mat& inputMat = input->getData();
-	cv::Mat& outputMat = output->getData();
-	outputMat = outputMat * 0;
-
-	bool transposed = false;
-
-	// if dimension 0 is mapped onto 1
-	if (dimensionMappings->getValue()->lookUp(0) == 1)
-	{
-		transposed = true;
-		outputMat = outputMat.t();
-	}
-
-	for (int i = 0; i < inputMat.rows; ++i)
-	{
-		inputMat.row(i).copyTo(outputMat);
-	}
-
-	if (transposed)
-	{
-		outputMat = outputMat.t();
-	}
+	this->expandMDtoND(input, output, indicesToCompress, compressionType, dimensionMappings);
 }
 
-
 void cedar::proc::ProjectionFunctions::expand2Dto3D(cedar::aux::ConstMatDataPtr input,
 																									 cedar::aux::MatDataPtr output,
 																									 std::vector<unsigned int> indicesToCompress,
@@ -155,134 +548,20 @@ void cedar::proc::ProjectionFunctions::expand2Dto3D(cedar::aux::ConstMatDataPtr
 }
 
 template<typename T>
-void cedar::proc::ProjectionFunctions::expand2Dto3D(cedar::aux::ConstMatDataPtr _input,
-																									 cedar::aux::MatDataPtr _output,
+void cedar::proc::ProjectionFunctions::expand2Dto3D(cedar::aux::ConstMatDataPtr input,
+																									 cedar::aux::MatDataPtr output,
 																									 std::vector<unsigned int> indicesToCompress,
 																									 cedar::aux::EnumParameterPtr compressionType,
 																									 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
-	const cv::Mat& input = _input->getData();
-	cv::Mat& output = _output->getData();
-	// sanity check
 	CEDAR_DEBUG_ASSERT
 	(
-					cedar::aux::math::getDimensionalityOf(input) == 2
-					&& cedar::aux::math::getDimensionalityOf(output) == 3
+					cedar::aux::math::getDimensionalityOf(input->getData()) == 2
+					&& cedar::aux::math::getDimensionalityOf(output->getData()) == 3
 	);
-	auto mapping = dimensionMappings->getValue();
-	unsigned int number_of_mappings = mapping->getNumberOfMappings();
-	unsigned int i = 0;
-	// do this lookup only once, assuming that mapping does not change at run time...
-	this->mMappingLookup.resize(number_of_mappings);
-	for (i = 0; i < number_of_mappings; ++i)
-	{
-		this->mMappingLookup.at(i) = mapping->lookUp(i);
-	}
-	CEDAR_DEBUG_ASSERT(this->mMappingLookup.size() == 2);
-	T value;
-	int x;
-	int y;
-	int target_index;
-	if (std::find(this->mMappingLookup.begin(), this->mMappingLookup.end(), 0) == this->mMappingLookup.end()) // expand over dim 0
-	{
-		if (this->mMappingLookup.at(0) == 1) // not flipped
-		{
-			for (x = 0; x < input.size[0]; ++x)
-			{
-				for (y = 0; y < input.size[1]; ++y)
-				{
-					value = input.at<T>(x, y);
-					for (target_index = 0; target_index < output.size[0]; ++ target_index)
-					{
-						output.at<T>(target_index, x, y) = value;
-					}
-				}
-			}
-		}
-		else // flipped
-		{
-			for (x = 0; x < input.size[0]; ++x)
-			{
-				for (y = 0; y < input.size[1]; ++y)
-				{
-					value = input.at<T>(x, y);
-					for (target_index = 0; target_index < output.size[0]; ++ target_index)
-					{
-						output.at<T>(target_index, y, x) = value;
-					}
-				}
-			}
-		}
-	}
-	else if (std::find(this->mMappingLookup.begin(), this->mMappingLookup.end(), 1) == this->mMappingLookup.end()) // expand over dim 1
-	{
-		if (this->mMappingLookup.at(0) == 0) // not flipped
-		{
-			for (x = 0; x < input.size[0]; ++x)
-			{
-				for (y = 0; y < input.size[1]; ++y)
-				{
-					value = input.at<T>(x, y);
-					for (target_index = 0; target_index < output.size[1]; ++ target_index)
-					{
-						output.at<T>(x, target_index, y) = value;
-					}
-				}
-			}
-		}
-		else // flipped
-		{
-			for (x = 0; x < input.size[0]; ++x)
-			{
-				for (y = 0; y < input.size[1]; ++y)
-				{
-					value = input.at<T>(x, y);
-					for (target_index = 0; target_index < output.size[0]; ++ target_index)
-					{
-						output.at<T>(y, target_index, x) = value;
-					}
-				}
-			}
-		}
-	}
-	else if (std::find(this->mMappingLookup.begin(), this->mMappingLookup.end(), 2) == this->mMappingLookup.end()) // expand over dim 2
-	{
-		if (this->mMappingLookup.at(0) == 0) // not flipped
-		{
-			for (x = 0; x < input.size[0]; ++x)
-			{
-				for (y = 0; y < input.size[1]; ++y)
-				{
-					value = input.at<T>(x, y);
-					for (target_index = 0; target_index < output.size[2]; ++target_index)
-					{
-						output.at<T>(x, y, target_index) = value;
-					}
-				}
-			}
-		}
-		else // flipped
-		{
-			for (x = 0; x < input.size[0]; ++x)
-			{
-				for (y = 0; y < input.size[1]; ++y)
-				{
-					value = input.at<T>(x, y);
-					for (target_index = 0; target_index < output.size[2]; ++ target_index)
-					{
-						output.at<T>(y, x, target_index) = value;
-					}
-				}
-			}
-		}
-	}
-	else
-	{
-		CEDAR_ASSERT(false);
-	}
+	this->expandMDtoND<T>(input, output, indicesToCompress, compressionType, dimensionMappings);
 }
 
-
 void cedar::proc::ProjectionFunctions::expand1Dto3D(cedar::aux::ConstMatDataPtr input,
 																									 cedar::aux::MatDataPtr output,
 																									 std::vector<unsigned int> indicesToCompress,
@@ -307,97 +586,20 @@ void cedar::proc::ProjectionFunctions::expand1Dto3D(cedar::aux::ConstMatDataPtr
 }
 
 template<typename T>
-void cedar::proc::ProjectionFunctions::expand1Dto3D(cedar::aux::ConstMatDataPtr _input,
-																									 cedar::aux::MatDataPtr _output,
+void cedar::proc::ProjectionFunctions::expand1Dto3D(cedar::aux::ConstMatDataPtr input,
+																									 cedar::aux::MatDataPtr output,
 																									 std::vector<unsigned int> indicesToCompress,
 																									 cedar::aux::EnumParameterPtr compressionType,
 																									 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
-	const cv::Mat& input = _input->getData();
-	cv::Mat& output = _output->getData();
-	// sanity check
 	CEDAR_DEBUG_ASSERT
 	(
-					cedar::aux::math::getDimensionalityOf(input) == 1
-					&& cedar::aux::math::getDimensionalityOf(output) == 3
+					cedar::aux::math::getDimensionalityOf(input->getData()) == 1
+					&& cedar::aux::math::getDimensionalityOf(output->getData()) == 3
 	);
-	auto mapping = dimensionMappings->getValue();
-	unsigned int number_of_mappings = mapping->getNumberOfMappings();
-	unsigned int i = 0;
-	// do this lookup only once, assuming that mapping does not change at run time...
-	this->mMappingLookup.resize(number_of_mappings);
-	for (i = 0; i < number_of_mappings; ++i)
-	{
-		this->mMappingLookup.at(i) = mapping->lookUp(i);
-	}
-	CEDAR_DEBUG_ASSERT(this->mMappingLookup.size() == 1);
-	switch (this->mMappingLookup.at(0))
-	{
-		// do not allocate these for every for loop
-		int x;
-		int y;
-		case 0:
-		{
-			T value;
-			// outer loop
-			for (int source_index = 0; source_index < input.rows; ++ source_index)
-			{
-				// get value
-				value = input.at<T>(source_index, 0);
-				for (x = 0; x < output.size[1]; ++x)
-				{
-					for (y = 0; y < output.size[2]; ++y)
-					{
-						output.at<T>(source_index, x, y) = value;
-					}
-				}
-			}
-			break;
-		}
-		case 1:
-		{
-			T value;
-			// outer loop
-			for (int source_index = 0; source_index < input.rows; ++ source_index)
-			{
-				// get value
-				value = input.at<T>(source_index, 0);
-				for (x = 0; x < output.size[0]; ++x)
-				{
-					for (y = 0; y < output.size[2]; ++y)
-					{
-						output.at<T>(x, source_index, y) = value;
-					}
-				}
-			}
-			break;
-		}
-		case 2:
-		{
-			T value;
-			// outer loop
-			for (int source_index = 0; source_index < input.rows; ++ source_index)
-			{
-				// get value
-				value = input.at<T>(source_index, 0);
-				for (x = 0; x < output.size[0]; ++x)
-				{
-					for (y = 0; y < output.size[1]; ++y)
-					{
-						output.at<T>(x, y, source_index) = value;
-					}
-				}
-			}
-			break;
-		}
-		default:
-		{
-			CEDAR_ASSERT(false);
-		}
-	}
+	this->expandMDtoND<T>(input, output, indicesToCompress, compressionType, dimensionMappings);
 }
 
-
 void cedar::proc::ProjectionFunctions::expandMDtoND(cedar::aux::ConstMatDataPtr input,
 																									 cedar::aux::MatDataPtr output,
 																									 std::vector<unsigned int> indicesToCompress,
@@ -428,48 +630,58 @@ void cedar::proc::ProjectionFunctions::expandMDtoND(cedar::aux::ConstMatDataPtr
 																									 cedar::aux::EnumParameterPtr compressionType,
 																									 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
-	unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(input->getData());
-
-	// create an iterator for the output matrix
-	cedar::aux::MatrixIterator output_iterator(output->getData());
-
-	// iterate through all elements of the output matrix
-	std::vector<int> input_index;
-	input_index.resize(input_dimensionality);
-	// if the input dimensionality is 1 ...
-	if (input_dimensionality == 1)
+	this->lookUpMapping(dimensionMappings, false);
+	cv::Mat& target = output->getData();
+	if (!target.isContinuous())
 	{
-		// ... we still need to have an index tuple because of OpenCV limitations
-		input_index.push_back(0);
+		target = cv::Mat(target.dims, target.size.p, target.type());
 	}
+	broadcast<T, false>(input->getData(), this->mMappingLookup, target);
+}
 
-	auto mapping = dimensionMappings->getValue();
-	unsigned int number_of_mappings = mapping->getNumberOfMappings();
-	unsigned int i = 0;
-	// do this lookup only once, assuming that mapping does not change at run time...
-	this->mMappingLookup.resize(number_of_mappings);
-	for (i = 0; i < number_of_mappings; ++i)
-	{
-		this->mMappingLookup.at(i) = mapping->lookUp(i);
-	}
-	do
+void cedar::proc::ProjectionFunctions::addExpanded(const cv::Mat& input, cv::Mat& target,
+																									const std::vector<unsigned int>& mapping)
+{
+	CEDAR_ASSERT(input.type() == target.type());
+	switch (input.type())
 	{
-		// get index pointing to the current element in the output matrix
-		const std::vector<int>& output_index = output_iterator.getCurrentIndexVector();
-
-		// compute the corresponding index in the input matrix
-		for (i = 0; i < number_of_mappings; ++i)
+		case CV_32F:
 		{
-			input_index[i] = output_index.at(this->mMappingLookup.at(i));
+			broadcast<float, true>(input, mapping, target);
+			break;
 		}
-
-		// copy the activation value in the input matrix to the corresponding output matrix
-		output->getData().at<T>(&(output_index.front()))
-						= input->getData().at<T>(&(input_index.front()));
+		case CV_64F:
+		{
+			broadcast<double, true>(input, mapping, target);
+			break;
+		}
+		default:
+		CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot project matrices of this type.");
 	}
-	while (output_iterator.increment());
 }
 
+void cedar::proc::ProjectionFunctions::expandAsBroadcastView(cedar::aux::ConstMatDataPtr input,
+																														cedar::aux::MatDataPtr output,
+																														std::vector<unsigned int> indicesToCompress,
+																														cedar::aux::EnumParameterPtr compressionType,
+																														cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
+{
+	this->lookUpMapping(dimensionMappings, false);
+
+	cedar::aux::annotation::BroadcastViewPtr view;
+	if (output->hasAnnotation<cedar::aux::annotation::BroadcastView>())
+	{
+		view = output->getAnnotation<cedar::aux::annotation::BroadcastView>();
+	}
+	else
+	{
+		view = cedar::aux::annotation::BroadcastViewPtr(new cedar::aux::annotation::BroadcastView());
+		output->setAnnotation(view);
+	}
+	// only the (small) input is copied; the output matrix itself is left untouched
+	view->setSource(input->getData());
+	view->setMapping(this->mMappingLookup);
+}
 
 void cedar::proc::ProjectionFunctions::compress2Dto1D(cedar::aux::ConstMatDataPtr input,
 																										 cedar::aux::MatDataPtr output,
@@ -478,19 +690,9 @@ void cedar::proc::ProjectionFunctions::compress2Dto1D(cedar::aux::ConstMatDataPt
 																										 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
 	CEDAR_DEBUG_ASSERT(indicesToCompress.size() == 1);
-
-	cv::reduce(input->getData(), output->getData(), indicesToCompress.at(0), compressionType->getValue());
-
-	if (output->getData().rows == 1)
-	{
-		output->getData() = output->getData().t();
-	}
+	this->compressMDtoND(input, output, indicesToCompress, compressionType, dimensionMappings);
 }
 
-
-
-
-
 void cedar::proc::ProjectionFunctions::compress3Dto2D(cedar::aux::ConstMatDataPtr input,
 																										 cedar::aux::MatDataPtr output,
 																										 std::vector<unsigned int> indicesToCompress,
@@ -522,15 +724,7 @@ void cedar::proc::ProjectionFunctions::compress3Dto2D(cedar::aux::ConstMatDataPt
 																										 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
 	CEDAR_DEBUG_ASSERT(indicesToCompress.size() == 1);
-
-	cedar::aux::math::reduceCvMat3D<T>
-					(
-									input->getData(),
-									output->getData(),
-									indicesToCompress.at(0),
-									compressionType->getValue(),
-									false // don't flip
-					);
+	this->compressMDtoND<T>(input, output, indicesToCompress, compressionType, dimensionMappings);
 }
 
 void cedar::proc::ProjectionFunctions::compress3Dto2DSwapped(cedar::aux::ConstMatDataPtr input,
@@ -564,18 +758,9 @@ void cedar::proc::ProjectionFunctions::compress3Dto2DSwapped(cedar::aux::ConstMa
 																														cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
 	CEDAR_DEBUG_ASSERT(indicesToCompress.size() == 1);
-
-	cedar::aux::math::reduceCvMat3D<T>
-					(
-									input->getData(),
-									output->getData(),
-									indicesToCompress.at(0),
-									compressionType->getValue(),
-									true // don't flip
-					);
+	this->compressMDtoND<T>(input, output, indicesToCompress, compressionType, dimensionMappings);
 }
 
-
 void cedar::proc::ProjectionFunctions::compress3Dto1D(cedar::aux::ConstMatDataPtr input,
 																										 cedar::aux::MatDataPtr output,
 																										 std::vector<unsigned int> indicesToCompress,
@@ -607,40 +792,104 @@ void cedar::proc::ProjectionFunctions::compress3Dto1D(cedar::aux::ConstMatDataPt
 																										 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
 	CEDAR_DEBUG_ASSERT(indicesToCompress.size() == 2);
+	// both dimensions are reduced in the same pass, there is no temporary 2D matrix
+	this->compressMDtoND<T>(input, output, indicesToCompress, compressionType, dimensionMappings);
+}
+
+void cedar::proc::ProjectionFunctions::compressMDtoND(cedar::aux::ConstMatDataPtr input,
+																										 cedar::aux::MatDataPtr output,
+																										 std::vector<unsigned int> indicesToCompress,
+																										 cedar::aux::EnumParameterPtr compressionType,
+																										 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
+{
+	switch (input->getCvType())
+	{
+		case CV_32F:
+		{
+			this->compressMDtoND<float>(input, output, indicesToCompress, compressionType, dimensionMappings);
+			break;
+		}
+		case CV_64F:
+		{
+			this->compressMDtoND<double>(input, output, indicesToCompress, compressionType, dimensionMappings);
+			break;
+		}
+		default:
+		CEDAR_THROW(cedar::aux::UnhandledTypeException, "Cannot project matrices of this type.");
+	}
+}
 
-	unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(input->getData());
+template<typename T>
+void cedar::proc::ProjectionFunctions::compressMDtoND(cedar::aux::ConstMatDataPtr input,
+																										 cedar::aux::MatDataPtr output,
+																										 std::vector<unsigned int> indicesToCompress,
+																										 cedar::aux::EnumParameterPtr compressionType,
+																										 cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
+{
+	const cv::Mat& source = input->getData();
+	this->lookUpMapping(dimensionMappings, true);
 
-	// the compression from 3D to 1D first compresses the input
-	// cube to a temporary 2D matrix and then compresses that to 1D
+	// the sizes of the output follow from the dimensions that are kept
+	size_t reduced_count = 1;
+	unsigned int kept_count = 0;
+	for (unsigned int i = 0; i < this->mMappingLookup.size(); ++i)
+	{
+		if (this->mMappingLookup.at(i) == DROPPED_DIMENSION)
+		{
+			reduced_count *= source.size[i];
+		}
+		else
+		{
+			++kept_count;
+		}
+	}
+	if (kept_count == 0)
+	{
+		CEDAR_THROW(cedar::aux::InvalidValueException, "At least one dimension must be kept, use a 0D compression otherwise.");
+	}
 
-	// in order to do that, we first have to find a vector containing
-	// the sizes of the temporary 2D matrix ...
-	std::vector<int> sizes;
-	for (unsigned int i = 0; i < input_dimensionality; ++i)
+	// every output dimension has to be the target of exactly one input dimension; otherwise, the parallel reduction
+	// would write to the same output entries from different tasks
+	std::vector<int> sizes(kept_count, 0);
+	for (unsigned int i = 0; i < this->mMappingLookup.size(); ++i)
 	{
-		if (i != indicesToCompress.at(0))
+		unsigned int output_dimension = this->mMappingLookup.at(i);
+		if (output_dimension != DROPPED_DIMENSION)
 		{
-			sizes.push_back(input->getData().size[i]);
+			if (output_dimension >= kept_count || sizes.at(output_dimension) != 0)
+			{
+				CEDAR_THROW(cedar::aux::InvalidValueException, "Each output dimension must be mapped onto exactly once.");
+			}
+			sizes.at(output_dimension) = source.size[i];
 		}
 	}
+	cv::Mat& target = output->getData();
+	prepareTarget(target, sizes, source.type());
 
-	// ... and create the temporary 2D matrix with those sizes
-	cv::Mat tmp_2d(input_dimensionality - 1, &sizes.front(), input->getCvType(), cv::Scalar(0.0));
+	switch (compressionType->getValue().id())
+	{
+		case CEDAR_OPENCV_CONSTANT(REDUCE_SUM):
+			reduce<T, SumReduction<T> >(source, this->mMappingLookup, target, sizes.size());
+			break;
 
-	// reduce the 3D input to the (temporary) 2D matrix
-	cedar::aux::math::reduceCvMat3D<T>(input->getData(), tmp_2d, indicesToCompress.at(0), compressionType->getValue());
+		case CEDAR_OPENCV_CONSTANT(REDUCE_AVG):
+			reduce<T, SumReduction<T> >(source, this->mMappingLookup, target, sizes.size());
+			target *= 1.0 / static_cast<double>(reduced_count);
+			break;
 
-	// reduce the temporary 2D matrix to the final 1D output of the projection
-	cv::reduce(tmp_2d, output->getData(), indicesToCompress.at(1) - 1, compressionType->getValue());
+		case CEDAR_OPENCV_CONSTANT(REDUCE_MAX):
+			reduce<T, MaxReduction<T> >(source, this->mMappingLookup, target, sizes.size());
+			break;
 
-	if (output->getData().rows == 1)
-	{
-		output->getData() = output->getData().t();
+		case CEDAR_OPENCV_CONSTANT(REDUCE_MIN):
+			reduce<T, MinReduction<T> >(source, this->mMappingLookup, target, sizes.size());
+			break;
+
+		default:
+			CEDAR_THROW(cedar::aux::UnhandledValueException, "Unknown compression type.");
 	}
 }
 
-
-
 void cedar::proc::ProjectionFunctions::compressNDto0Dsum(cedar::aux::ConstMatDataPtr input,
 																												cedar::aux::MatDataPtr output,
 																												std::vector<unsigned int> indicesToCompress,
@@ -735,38 +984,13 @@ void cedar::proc::ProjectionFunctions::compressNDto0Dmin(cedar::aux::ConstMatDat
 																												cedar::aux::EnumParameterPtr compressionType,
 																												cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
-	double minimum = std::numeric_limits<double>::max();
-	unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(input->getData());
-
-	// for a dimensionality below 3 ...
-	if (input_dimensionality < 3)
-	{
-		// ... we can use an OpenCV function to determine the minimum
-		double maximum;
-		cv::minMaxLoc(input->getData(), &minimum, &maximum);
-	}
-		// for all other dimensionalities, we have to iterate through the
-		// input matrix and find the minimum ourselves
-	else
-	{
-		// create an iterator for the input matrix
-		cedar::aux::MatrixIterator matrix_iterator(input->getData());
-
-		// iterate over input matrix and find the maximum value
-		do
-		{
-			double current_value = input->getData().at<T>(matrix_iterator.getCurrentIndex());
-
-			if (current_value < minimum)
-			{
-				minimum = current_value;
-			}
-		}
-		while (matrix_iterator.increment());
-	}
+	// minMaxIdx works on matrices of any dimensionality
+	double minimum;
+	double maximum;
+	cv::minMaxIdx(input->getData(), &minimum, &maximum);
 
 	// set the minimum of the input matrix as the output of the projection
-	output->getData().at<T>(0) = minimum;
+	output->getData().at<T>(0) = static_cast<T>(minimum);
 }
 
 void cedar::proc::ProjectionFunctions::compressNDto0Dmax(cedar::aux::ConstMatDataPtr input,
@@ -799,36 +1023,11 @@ void cedar::proc::ProjectionFunctions::compressNDto0Dmax(cedar::aux::ConstMatDat
 																												cedar::aux::EnumParameterPtr compressionType,
 																												cedar::proc::ProjectionMappingParameterPtr dimensionMappings)
 {
-	double maximum = std::numeric_limits<double>::min();
-	unsigned int input_dimensionality = cedar::aux::math::getDimensionalityOf(input->getData());
-
-	// for a dimensionality below 3 ...
-	if (input_dimensionality < 3)
-	{
-		// ... we can use an OpenCV function to determine the maximum
-		double minimum;
-		cv::minMaxLoc(input->getData(), &minimum, &maximum);
-	}
-		// for all other dimensionalities, we have to iterate through the
-		// input matrix and find the maximum ourselves
-	else
-	{
-		// create an iterator for the input matrix
-		cedar::aux::MatrixIterator matrix_iterator(input->getData());
-
-		// iterate over input matrix and find the maximum value
-		do
-		{
-			double current_value = input->getData().at<T>(matrix_iterator.getCurrentIndex());
-
-			if (current_value > maximum)
-			{
-				maximum = current_value;
-			}
-		}
-		while (matrix_iterator.increment());
-	}
+	// minMaxIdx works on matrices of any dimensionality
+	double minimum;
+	double maximum;
+	cv::minMaxIdx(input->getData(), &minimum, &maximum);
 
 	// set the maximum of the input matrix as the output of the projection
-	output->getData().at<T>(0) = maximum;
+	output->getData().at<T>(0) = static_cast<T>(maximum);
 }
@@ -49,11 +49,15 @@
 #include "cedar/processing/ProjectionFunctions.fwd.h"
 
 // SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <vector>
 
 
-/*!@todo describe.
+/*!@brief Implementations of the expansions and compressions used by projections.
  *
- * @todo describe more.
+ *        All expansions and all compressions onto at least one dimension are handled by two generic, strided kernels
+ *        that work directly on the matrix memory and split larger matrices across cedar::aux::ThreadPool. The kernels
+ *        process the innermost dimension in contiguous rows so that the compiler can vectorize the inner loops.
  */
 class cedar::proc::ProjectionFunctions
 {
@@ -111,6 +115,24 @@ public:
 										std::vector<unsigned int> indicesToCompress, cedar::aux::EnumParameterPtr compressionType,
 										cedar::proc::ProjectionMappingParameterPtr dimensionMappings);
 
+	/*!@brief Expands the input without writing to the output matrix.
+	 *
+	 *        Instead, the output is annotated with a cedar::aux::annotation::BroadcastView holding a copy of the input
+	 *        and the dimension mapping. Consumers that know about this annotation (e.g., cedar::proc::steps::Sum and
+	 *        the input sum of neural fields) add the expansion directly via addExpanded; all other consumers only see
+	 *        the (unchanged) output matrix.
+	 */
+	void expandAsBroadcastView(cedar::aux::ConstMatDataPtr input, cedar::aux::MatDataPtr output,
+										std::vector<unsigned int> indicesToCompress, cedar::aux::EnumParameterPtr compressionType,
+										cedar::proc::ProjectionMappingParameterPtr dimensionMappings);
+
+	/*!@brief Adds the expansion of input onto target.
+	 *
+	 *        Dimension i of the input corresponds to dimension mapping.at(i) of the target; the input is repeated along
+	 *        all other dimensions of the target.
+	 */
+	static void addExpanded(const cv::Mat& input, cv::Mat& target, const std::vector<unsigned int>& mapping);
+
 
 	//!@brief compresses 2D input to 1D output
 	void compress2Dto1D(cedar::aux::ConstMatDataPtr input, cedar::aux::MatDataPtr output,
@@ -144,7 +166,17 @@ public:
 											std::vector<unsigned int> indicesToCompress, cedar::aux::EnumParameterPtr compressionType,
 											cedar::proc::ProjectionMappingParameterPtr dimensionMappings);
 
-//!@brief compresses ND input to 0D output by computing the minimum over all positions
+	//!@brief compresses MD input to ND output (N > 0) by reducing all dropped dimensions in a single pass
+	void compressMDtoND(cedar::aux::ConstMatDataPtr input, cedar::aux::MatDataPtr output,
+											std::vector<unsigned int> indicesToCompress, cedar::aux::EnumParameterPtr compressionType,
+											cedar::proc::ProjectionMappingParameterPtr dimensionMappings);
+
+	template<typename T>
+	void compressMDtoND(cedar::aux::ConstMatDataPtr input, cedar::aux::MatDataPtr output,
+											std::vector<unsigned int> indicesToCompress, cedar::aux::EnumParameterPtr compressionType,
+											cedar::proc::ProjectionMappingParameterPtr dimensionMappings);
+
+	//!@brief compresses ND input to 0D output by computing the minimum over all positions
 	void compressNDto0Dmin(cedar::aux::ConstMatDataPtr input, cedar::aux::MatDataPtr output,
 												 std::vector<unsigned int> indicesToCompress, cedar::aux::EnumParameterPtr compressionType,
 												 cedar::proc::ProjectionMappingParameterPtr dimensionMappings);
@@ -191,6 +223,12 @@ protected:
 	// private methods
 	//--------------------------------------------------------------------------------------------------------------------
 private:
+	/*!@brief Fills mMappingLookup with the output dimension of each input dimension.
+	 *
+	 * @param allowDropped If true, dropped dimensions are marked in the lookup, otherwise they cause an exception.
+	 */
+	void lookUpMapping(cedar::proc::ProjectionMappingParameterPtr dimensionMappings, bool allowDropped);
+
 	//!@brief a lookup table for mappings
 	std::vector<unsigned int> mMappingLookup;
 
@@ -47,11 +47,15 @@
 #include "cedar/processing/Group.h"
 #include "cedar/processing/Trigger.h"
 #include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/ExternalData.h"
+#include "cedar/processing/ElementDeclaration.h"
+#include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/systemFunctions.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 #include "cedar/defines.h"
@@ -77,6 +81,20 @@
 // Check for NaNs after every compute call
 //#define CEDAR_ENABLE_NAN_CHECK
 
+//----------------------------------------------------------------------------------------------------------------------
+// static members
+//----------------------------------------------------------------------------------------------------------------------
+
+std::atomic<bool> cedar::proc::Step::mTimeMeasurementsEnabled(true);
+
+namespace
+{
+  inline cedar::unit::Time toTime(std::chrono::steady_clock::duration duration)
+  {
+    return cedar::unit::Time(std::chrono::duration<double>(duration).count() * cedar::unit::seconds);
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
@@ -85,7 +103,11 @@ cedar::proc::Step::Step(bool isLooped)
 Triggerable(isLooped),
 // initialize parameters
 mAutoLockInputsAndOutputs(true),
-mLastExecutionTime(cedar::unit::Time(-1.0*cedar::unit::seconds)) //not sure about the right initialization yet
+mLastExecutionTime(cedar::unit::Time(-1.0*cedar::unit::seconds)), //not sure about the right initialization yet
+mPurityKnown(false),
+mIsPure(false),
+mComputedGenerationsInvalid(true),
+mOutputsUnchanged(false)
 {
   this->mComputeTimeId = this->registerTimeMeasurement("compute call");
   this->mLockingTimeId = this->registerTimeMeasurement("locking");
@@ -172,6 +194,28 @@ void cedar::proc::Step::unlockData() const
   }
 }
 
+void cedar::proc::Step::callResetComputationState()
+{
+  cedar::proc::Step::ReadLocker locker(this);
+  this->resetComputationState();
+}
+
+void cedar::proc::Step::resetComputationState()
+{
+  this->mLastExecutionTime = cedar::unit::Time(-1.0*cedar::unit::seconds); //not sure about the right initialization yet;
+  this->invalidateComputedOutputs();
+}
+
+void cedar::proc::Step::invalidateComputedOutputs()
+{
+  this->mComputedGenerationsInvalid = true;
+}
+
+void cedar::proc::Step::setOutputsUnchanged()
+{
+  this->mOutputsUnchanged = true;
+}
+
 void cedar::proc::Step::callReset()
 {
   // first, reset the current state of the step (i.e., clear any exception etc. state)
@@ -180,9 +224,10 @@ void cedar::proc::Step::callReset()
   // lock everything
   cedar::proc::Step::ReadLocker locker(this);
 
-  this->mLastExecutionTime = cedar::unit::Time(-1.0*cedar::unit::seconds); //not sure about the right initialization yet;
+  this->resetComputationState();
   // reset the step
   this->reset();
+  this->markOutputsChanged();
 
   // unlock everything
   locker.unlock();
@@ -195,6 +240,21 @@ void cedar::proc::Step::reset()
   // empty as default implementation
 }
 
+unsigned int cedar::proc::Step::getUpdateRatio() const
+{
+  return 1;
+}
+
+void cedar::proc::Step::setTimeMeasurementsEnabled(bool enabled)
+{
+  cedar::proc::Step::mTimeMeasurementsEnabled = enabled;
+}
+
+bool cedar::proc::Step::getTimeMeasurementsEnabled()
+{
+  return cedar::proc::Step::mTimeMeasurementsEnabled;
+}
+
 void cedar::proc::Step::setAutoLockInputsAndOutputs(bool autoLock)
 {
   this->mAutoLockInputsAndOutputs = autoLock;
@@ -308,7 +368,7 @@ void cedar::proc::Step::addTrigger(cedar::proc::TriggerPtr trigger)
 
 #include "cedar/auxiliaries/MatData.h"
 
-void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::proc::TriggerPtr trigger)
+void cedar::proc::Step::onTrigger(const cedar::proc::ArgumentsPtr& arguments, const cedar::proc::TriggerPtr& trigger)
 {
 #ifdef DEBUG_RUNNING
   std::cout << "DEBUG_RUNNING> " << this->getName() << ".onTrigger()" << std::endl;
@@ -345,18 +405,25 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
   {
     return;
   }
-  // start measuring the lock time.
-  boost::posix_time::ptime lock_start = boost::posix_time::microsec_clock::universal_time();
+  // the clock is only read if time measurements are enabled
+  const bool measure_time = cedar::proc::Step::mTimeMeasurementsEnabled;
+  std::chrono::steady_clock::time_point lock_start;
+  if (measure_time)
+  {
+    lock_start = std::chrono::steady_clock::now();
+  }
 
   connections_locker.unlock();
 
   // lock the step
   cedar::proc::Step::ReadLocker step_locker(this);
 
-  boost::posix_time::ptime lock_end = boost::posix_time::microsec_clock::universal_time();
-  boost::posix_time::time_duration lock_elapsed = lock_end - lock_start;
-  cedar::unit::Time lock_elapsed_s(lock_elapsed.total_microseconds() * cedar::unit::micro * cedar::unit::seconds);
-  this->setLockTimeMeasurement(lock_elapsed_s);
+  std::chrono::steady_clock::time_point run_start;
+  if (measure_time)
+  {
+    run_start = std::chrono::steady_clock::now();
+    this->setLockTimeMeasurement(toTime(run_start - lock_start));
+  }
 
   if (!this->mandatoryConnectionsAreSet())
   {
@@ -372,33 +439,61 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
   } // this->mMandatoryConnectionsAreSet
 
 
-  if (this->mPreciseLastComputeCall.is_not_a_date_time()) // was not called before, initialize time
+  if (!measure_time)
+  {
+    // the next round time is measured from the next compute call on
+    this->mLastComputeCallTime = std::chrono::steady_clock::time_point();
+  }
+  else if (this->mLastComputeCallTime == std::chrono::steady_clock::time_point()) // was not called before
   {
-    this->mPreciseLastComputeCall = boost::posix_time::microsec_clock::universal_time();
+    this->mLastComputeCallTime = run_start;
   }
   else
   {
-    boost::posix_time::ptime last_precise = this->mPreciseLastComputeCall;
-    this->mPreciseLastComputeCall = boost::posix_time::microsec_clock::universal_time();
-    boost::posix_time::time_duration elapsed_precise = this->mPreciseLastComputeCall - last_precise;
-    cedar::unit::Time precise_time(elapsed_precise.total_microseconds() * cedar::unit::micro * cedar::unit::seconds);
-    this->setRoundTimeMeasurement(precise_time);
+    this->setRoundTimeMeasurement(toTime(run_start - this->mLastComputeCallTime));
+    this->mLastComputeCallTime = run_start;
+  }
+
+  // pure steps that are triggered by a trigger chain can reuse their outputs if nothing they depend on has changed
+  bool reuse_outputs = false;
+  std::vector<unsigned long long> input_generations;
+  if (trigger && this->isPure())
+  {
+    this->getInputGenerations(input_generations);
+    reuse_outputs = !this->mComputedGenerationsInvalid.exchange(false) && input_generations == this->mComputedGenerations;
   }
+  if (!reuse_outputs)
+  {
+    // if the computation fails, the outputs must not be reused next time
+    this->mComputedGenerations.clear();
+  }
+
+  // the arguments are only inspected through raw pointers; this avoids touching their reference counts
+  const cedar::proc::StepTime* step_time = dynamic_cast<const cedar::proc::StepTime*>(arguments.get());
 
-  // start measuring the execution time.
-  boost::posix_time::ptime run_start = boost::posix_time::microsec_clock::universal_time();
+  this->mOutputsUnchanged = false;
+  // compute may be skipped by the time stamp check, in which case the outputs stay as they are
+  bool computed = false;
 
   try
   {
-    if (arguments.get() != nullptr)
+    if (reuse_outputs)
+    {
+      if (step_time != nullptr)
+      {
+        this->mLastExecutionTime = step_time->getGlobalTimeStamp();
+      }
+    }
+    else if (arguments.get() != nullptr)
     {
 
-      if(auto step_time = boost::dynamic_pointer_cast< cedar::proc::StepTime>(arguments))
+      if (step_time != nullptr)
       {
         // The arguments cam from a step trigger and contain a TimeStamp. Only execute, if the timesstamp is newer than the last executed one
         if(step_time->getGlobalTimeStamp() > this->mLastExecutionTime)
         {
           this->compute(*(arguments.get()));
+          computed = true;
         }
         this->mLastExecutionTime = step_time->getGlobalTimeStamp(); //Guarantee that the step will be computed the next time, if it somehow got a weird initialization
       }
@@ -406,6 +501,7 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
       {
         // call the compute function with the given arguments
         this->compute(*(arguments.get()));
+        computed = true;
       }
 
     }
@@ -414,6 +510,7 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
       // call the compute function with empty arguments
       cedar::proc::Arguments args;
       this->compute(args);
+      computed = true;
 
       if (this->getState() == cedar::proc::Triggerable::STATE_UNKNOWN)
       {
@@ -421,8 +518,17 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
       }
     }
 
-    auto looped_trigger= boost::dynamic_pointer_cast< cedar::proc::LoopedTrigger >( trigger );
-    if (looped_trigger)
+    if (computed)
+    {
+      if (!this->mOutputsUnchanged)
+      {
+        this->markOutputsChanged();
+      }
+      this->mComputedGenerations.swap(input_generations);
+    }
+
+    auto looped_trigger = dynamic_cast<const cedar::proc::LoopedTrigger*>(trigger.get());
+    if (looped_trigger != nullptr)
     {
       mNumberOfStepsMissed= looped_trigger->getNumberOfStepsMissed();
     }
@@ -460,12 +566,11 @@ void cedar::proc::Step::onTrigger(cedar::proc::ArgumentsPtr arguments, cedar::pr
     this->setState(cedar::proc::Triggerable::STATE_EXCEPTION, "An unknown exception type occurred.");
   }
 
-  boost::posix_time::ptime run_end = boost::posix_time::microsec_clock::universal_time();
-  boost::posix_time::time_duration run_elapsed = run_end - run_start;
-  cedar::unit::Time run_elapsed_s(run_elapsed.total_microseconds() * cedar::unit::micro * cedar::unit::seconds);
-
   // take time measurements
-  this->setRunTimeMeasurement(run_elapsed_s);
+  if (measure_time)
+  {
+    this->setRunTimeMeasurement(toTime(std::chrono::steady_clock::now() - run_start));
+  }
 
 #ifdef CEDAR_ENABLE_NAN_CHECK
   if (this->hasSlotForRole(cedar::proc::DataRole::OUTPUT))
@@ -559,6 +664,80 @@ void cedar::proc::Step::processChangedSlots()
   locker.unlock();
 }
 
+bool cedar::proc::Step::isPure()
+{
+  if (!this->mPurityKnown)
+  {
+    try
+    {
+      auto self = boost::dynamic_pointer_cast<const cedar::proc::Element>(this->shared_from_this());
+      auto declaration = boost::dynamic_pointer_cast<const cedar::proc::ElementDeclaration>
+                         (
+                           cedar::proc::ElementManagerSingleton::getInstance()->getDeclarationOf(self)
+                         );
+      this->mIsPure = declaration && declaration->isPure();
+    }
+    catch (const cedar::aux::UnknownTypeException&)
+    {
+      // steps that were not created via a declaration are never pure
+      this->mIsPure = false;
+    }
+    catch (const boost::bad_weak_ptr&)
+    {
+      // neither are steps that are not managed by a shared pointer
+      this->mIsPure = false;
+    }
+    this->mPurityKnown = true;
+  }
+  return this->mIsPure;
+}
+
+void cedar::proc::Step::getInputGenerations(std::vector<unsigned long long>& generations) const
+{
+  generations.clear();
+  generations.push_back(this->getParameterGeneration());
+
+  if (!this->hasSlotForRole(cedar::proc::DataRole::INPUT))
+  {
+    return;
+  }
+
+  for (const auto& name_slot_pair : this->getDataSlots(cedar::proc::DataRole::INPUT))
+  {
+    auto slot = boost::static_pointer_cast<const cedar::proc::ExternalData>(name_slot_pair.second);
+    for (unsigned int i = 0; i < slot->getDataCount(); ++i)
+    {
+      auto data = slot->getData(i);
+      generations.push_back(data ? data->getGeneration() : 0);
+    }
+  }
+}
+
+void cedar::proc::Step::markOutputsChanged()
+{
+  if (!this->hasSlotForRole(cedar::proc::DataRole::OUTPUT))
+  {
+    return;
+  }
+
+  bool publish = cedar::aux::MatData::isAnyDoubleBuffered();
+  for (const auto& name_slot_pair : this->getDataSlots(cedar::proc::DataRole::OUTPUT))
+  {
+    if (auto data = name_slot_pair.second->getData())
+    {
+      data->markChanged();
+
+      if (publish)
+      {
+        if (auto mat_data = boost::dynamic_pointer_cast<cedar::aux::MatData>(data))
+        {
+          mat_data->publish();
+        }
+      }
+    }
+  }
+}
+
 void cedar::proc::Step::emitOutputPropertiesChangedSignal(const std::string& slot)
 {
   if (!this->mBusy.tryLock())
@@ -74,6 +74,8 @@
 #include <utility>
 #include <vector>
 #include <deque>
+#include <atomic>
+#include <chrono>
 
 
 /*!@brief This class represents a processing step in the processing framework.
@@ -211,8 +213,8 @@ public:
    */
   void onTrigger
        (
-         cedar::proc::ArgumentsPtr args = cedar::proc::ArgumentsPtr(),
-         cedar::proc::TriggerPtr = cedar::proc::TriggerPtr()
+         const cedar::proc::ArgumentsPtr& args = cedar::proc::ArgumentsPtr(),
+         const cedar::proc::TriggerPtr& = cedar::proc::TriggerPtr()
        );
 
   //! The same as onTrigger, but does not trigger subsequent steps.
@@ -237,6 +239,13 @@ public:
   //!@brief Calls the reset signal in a thread-safe manner.
   void callReset();
 
+  /*!@brief Makes the step forget when and from which inputs it was last computed, without changing its data.
+   *
+   *        Needed when the global time goes back without a reset, e.g., when a checkpoint is restored; otherwise, the
+   *        step would not compute again until the time has caught up.
+   */
+  void callResetComputationState();
+
   //! True if the step currently has a run time measurement.
   bool hasRunTimeMeasurement() const;
 
@@ -276,6 +285,15 @@ public:
    */
   cedar::unit::Time getRoundTimeAverage() const;
 
+  /*!@brief Enables or disables measuring the lock, run and round times of all steps (enabled by default).
+   *
+   *        Without measurements, a step does not read the clock or update its moving averages when it is triggered.
+   */
+  static void setTimeMeasurementsEnabled(bool enabled);
+
+  //! Whether steps measure their lock, run and round times.
+  static bool getTimeMeasurementsEnabled();
+
   //! Returns the mutex that is prevents mutual access in run calls.
   QMutex& getComputeMutex() const
   {
@@ -297,6 +315,12 @@ public:
   //! Returns the name of a given time measurement
   const std::string& getTimeMeasurementName(unsigned int id) const;
 
+  /*!@brief Returns after how many trigger steps this step is computed.
+   *
+   *        This is one for all steps except dynamics that are updated less often in multi-rate simulation.
+   */
+  virtual unsigned int getUpdateRatio() const;
+
   //! Updates the step's trigger chains
   void updateTriggerChains(std::set<cedar::proc::Trigger*>& visited);
 
@@ -432,6 +456,22 @@ private:
    */
   virtual void reset();
 
+  /*!@brief Resets the state that decides whether and how far the next compute call computes.
+   *
+   *        Called by callReset and callResetComputationState. Implementations must call the base class method.
+   */
+  virtual void resetComputationState();
+
+  //! Makes the next triggered compute call run even if this is a pure step whose inputs have not changed.
+  void invalidateComputedOutputs();
+
+  /*!@brief States that the current compute call has not changed any outputs.
+   *
+   *        The outputs are then neither given a new generation nor published, so steps downstream can reuse theirs.
+   *        Only call this from within compute.
+   */
+  void setOutputsUnchanged();
+
   /*!@brief Sets the current execution time measurement.
    */
   void setRunTimeMeasurement(const cedar::unit::Time& time);
@@ -464,6 +504,15 @@ private:
   //! Processes all slots that have been changed during the compute call.
   void processChangedSlots();
 
+  //! Returns whether the declaration of this step marks it as pure (see cedar::proc::ElementDeclaration::setPure).
+  bool isPure();
+
+  //! Writes the generations of the parameters and of all input data into the given vector.
+  void getInputGenerations(std::vector<unsigned long long>& generations) const;
+
+  //! Gives all outputs of this step a new generation and publishes the double-buffered ones.
+  void markOutputsChanged();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -496,7 +545,8 @@ private:
   //!@brief Moving average of the time between compute calls.
   unsigned int mRoundTimeId;
 
-  boost::posix_time::ptime mPreciseLastComputeCall;
+  //! Time of the last compute call, used for the round time; default-constructed if there is none yet.
+  std::chrono::steady_clock::time_point mLastComputeCallTime;
 
   //! Whether the step should lock its inputs and outputs automatically.
   bool mAutoLockInputsAndOutputs;
@@ -511,6 +561,24 @@ private:
 
   cedar::unit::Time mLastExecutionTime;
 
+  //! Whether the declaration of the step has been checked for purity; see isPure().
+  bool mPurityKnown;
+
+  //! Whether the step is pure; only valid if mPurityKnown is true.
+  bool mIsPure;
+
+  //! Generations of the parameters and inputs from which the current outputs were computed.
+  std::vector<unsigned long long> mComputedGenerations;
+
+  //! Set when the current outputs can no longer be reused, e.g., after a reset.
+  std::atomic<bool> mComputedGenerationsInvalid;
+
+  //! Set by setOutputsUnchanged during a compute call.
+  bool mOutputsUnchanged;
+
+  //! Whether steps measure their lock, run and round times.
+  static std::atomic<bool> mTimeMeasurementsEnabled;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -49,16 +49,22 @@
 #include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/processing/sources/GroupSource.h"
 #include "cedar/processing/sinks/GroupSink.h"
+#include "cedar/auxiliaries/GlobalClock.h"
 #include "cedar/auxiliaries/GraphTemplate.h"
 #include "cedar/auxiliaries/Log.h"
+#include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/ThreadPool.h"
 #include "cedar/auxiliaries/stringFunctions.h"
 
 // SYSTEM INCLUDES
 #include <QReadLocker>
 #include <QWriteLocker>
+#include <opencv2/opencv.hpp>
 #include <algorithm>
+#include <cstdlib>
 #include <string>
 #include <iostream>
+#include <mutex>
 
 // for debugging
 #include "cedar/auxiliaries/NamedConfigurable.h"
@@ -632,6 +638,17 @@ void cedar::proc::Trigger::updateTriggeringOrder(std::set<cedar::proc::Trigger*>
     iter->second.insert(triggerable);
   }
 
+  this->mDispatchOrder.clear();
+  this->mDispatchLevelEnds.clear();
+  for (const auto& order_triggerables_pair : this->mTriggeringOrder.member())
+  {
+    for (const cedar::proc::TriggerablePtr& triggerable : order_triggerables_pair.second)
+    {
+      this->mDispatchOrder.push_back(triggerable.get());
+    }
+    this->mDispatchLevelEnds.push_back(this->mDispatchOrder.size());
+  }
+
   lock_w.unlock();
 
   {
@@ -774,38 +791,103 @@ void cedar::proc::Trigger::updateTriggeringOrderRecurseUpSource(cedar::proc::sou
 }
 
 
-void cedar::proc::Trigger::trigger(cedar::proc::ArgumentsPtr arguments)
+cedar::aux::ThreadPoolPtr cedar::proc::Trigger::getThreadPool()
 {
-  auto this_ptr = boost::dynamic_pointer_cast<cedar::proc::Trigger>(this->shared_from_this());
+  // the pool starts without workers; apply the configured number once (later changes are applied by the settings)
+  static std::once_flag thread_pool_initialized;
+  std::call_once
+  (
+    thread_pool_initialized,
+    []()
+    {
+      cedar::aux::ThreadPoolSingleton::getInstance()->setNumberOfThreads
+      (
+        cedar::aux::SettingsSingleton::getInstance()->getNumberOfTriggerThreads()
+      );
+    }
+  );
+  return cedar::aux::ThreadPoolSingleton::getInstance();
+}
 
+void cedar::proc::Trigger::trigger(const cedar::proc::ArgumentsPtr& arguments)
+{
   QReadLocker lock(this->mTriggeringOrder.getLockPtr());
+  if (this->mDispatchOrder.empty())
+  {
+    return;
+  }
+
+  auto this_ptr = boost::dynamic_pointer_cast<cedar::proc::Trigger>(this->shared_from_this());
+  auto thread_pool = cedar::proc::Trigger::getThreadPool();
 
 #ifdef DEBUG_TRIGGERING
 /* DEBUG_TRIGGERING */  std::cout << "> Triggering " << nameTrigger(this) << std::endl;
 #endif
 
-  for (auto order_triggerables_pair : this->mTriggeringOrder.member())
+  std::vector<cedar::aux::ThreadPool::Task> level_tasks;
+  size_t level_begin = 0;
+  for (size_t level_end : this->mDispatchLevelEnds)
   {
-    auto triggerables = order_triggerables_pair.second;
-    for (cedar::proc::TriggerablePtr triggerable : triggerables)
+    // all triggerables of one level are independent of each other; run them concurrently if there are workers
+    if (level_end - level_begin > 1 && thread_pool->getNumberOfThreads() > 0)
+    {
+      // which thread runs which task is arbitrary, so every task gets a random state derived from the calling thread's
+      // state and its position in the level; this keeps noise reproducible for a given seed of the global clock
+      uint64 level_seed = cv::theRNG().state;
+      std::vector<uint64> final_states(level_end - level_begin);
+      level_tasks.clear();
+      for (size_t i = level_begin; i < level_end; ++i)
+      {
+        size_t index = i - level_begin;
+        uint64 task_seed = cedar::aux::GlobalClock::mixSeed(level_seed ^ index);
+        cedar::proc::Triggerable* triggerable = this->mDispatchOrder[i];
+        level_tasks.push_back
+        (
+          [task_seed, index, triggerable, &arguments, &this_ptr, &final_states]()
+          {
+            srand(task_seed);
+            cv::theRNG().state = task_seed;
+            triggerable->onTrigger(arguments, this_ptr);
+            final_states[index] = cv::theRNG().state;
+          }
+        );
+      }
+      // returns once the whole level is done, i.e., acts as the barrier between levels
+      thread_pool->run(level_tasks);
+
+      // continue from a state that depends on the draws of all tasks, no matter which thread made them
+      uint64 state = level_seed;
+      for (uint64 final_state : final_states)
+      {
+        state = cedar::aux::GlobalClock::mixSeed(state ^ final_state);
+      }
+      srand(state);
+      cv::theRNG().state = state;
+
+      level_begin = level_end;
+      continue;
+    }
+
+    for (size_t i = level_begin; i < level_end; ++i)
     {
 #ifdef DEBUG_TRIGGERING
-/* DEBUG_TRIGGERING */ std::cout << "  > Triggering chain item " << nameTriggerable(triggerable) << std::endl;
+/* DEBUG_TRIGGERING */ std::cout << "  > Triggering chain item " << nameTriggerable(this->mDispatchOrder[i]) << std::endl;
 #endif
 
-      triggerable->onTrigger(arguments, this_ptr);
+      this->mDispatchOrder[i]->onTrigger(arguments, this_ptr);
 
 #ifdef DEBUG_TRIGGERING
-/* DEBUG_TRIGGERING */ std::cout << "  < Done triggering chain item " << nameTriggerable(triggerable) << std::endl;
+/* DEBUG_TRIGGERING */ std::cout << "  < Done triggering chain item " << nameTriggerable(this->mDispatchOrder[i]) << std::endl;
 #endif
     }
+    level_begin = level_end;
   }
 #ifdef DEBUG_TRIGGERING
 /* DEBUG_TRIGGERING */ std::cout << "< Done triggering " << nameTrigger(this) << std::endl;
 #endif
 }
 
-void cedar::proc::Trigger::onTrigger(cedar::proc::ArgumentsPtr, cedar::proc::TriggerPtr)
+void cedar::proc::Trigger::onTrigger(const cedar::proc::ArgumentsPtr&, const cedar::proc::TriggerPtr&)
 {
 }
 
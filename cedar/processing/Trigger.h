@@ -54,6 +54,7 @@
 #include "cedar/auxiliaries/GraphTemplate.fwd.h"
 #include "cedar/processing/Trigger.fwd.h"
 #include "cedar/processing/Step.fwd.h"
+#include "cedar/auxiliaries/ThreadPool.fwd.h"
 
 // SYSTEM INCLUDES
 #include <QReadWriteLock>
@@ -94,10 +95,10 @@ public:
   //--------------------------------------------------------------------------------------------------------------------
 public:
   //!@brief sends trigger signal and arguments to all listeners
-  void trigger(cedar::proc::ArgumentsPtr arguments = cedar::proc::ArgumentsPtr());
+  void trigger(const cedar::proc::ArgumentsPtr& arguments = cedar::proc::ArgumentsPtr());
 
   //!@brief handles an incoming trigger signal if Trigger instance is listener
-  void onTrigger(cedar::proc::ArgumentsPtr args, cedar::proc::TriggerPtr pSender);
+  void onTrigger(const cedar::proc::ArgumentsPtr& args, const cedar::proc::TriggerPtr& pSender);
 
   //!@brief a boolean check, if a given triggerable is a listener of this Trigger instance
   bool isListener(cedar::proc::TriggerablePtr triggerable) const;
@@ -144,6 +145,12 @@ public:
   //! Returns the number of triggerables directly listening to this trigger.
   size_t getTriggerCount() const;
 
+  /*!@brief Returns the thread pool on which triggerables are processed in parallel.
+   *
+   *        On first use, the pool is set up with the number of trigger threads from the settings.
+   */
+  static cedar::aux::ThreadPoolPtr getThreadPool();
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -236,7 +243,14 @@ protected:
   cedar::aux::LockableMember< std::map<unsigned int, std::set<cedar::proc::TriggerablePtr> > > mTriggeringOrder;
 
 private:
-  // none yet
+  /*! The triggering order flattened into one array when it is updated, so that trigger() does not have to walk the
+   *  map and its sets. Triggerables of the same depth are stored next to each other; protected by the lock of
+   *  mTriggeringOrder, which also keeps the triggerables alive.
+   */
+  std::vector<cedar::proc::Triggerable*> mDispatchOrder;
+
+  //! End index in mDispatchOrder of each depth of the triggering order.
+  std::vector<size_t> mDispatchLevelEnds;
 
   //--------------------------------------------------------------------------------------------------------------------
   // boost signals
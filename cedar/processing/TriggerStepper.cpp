@@ -43,9 +43,39 @@
 
 // CEDAR INCLUDES
 #include "cedar/auxiliaries/sleepFunctions.h"
+#include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/ThreadPool.h"
 
 // SYSTEM INCLUDES
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+  /*! Returns the pool on which looped triggers are stepped in parallel, with enough workers to step @em count triggers
+   *  at once; the calling thread steps one of them. This is not the trigger pool: that one is sized by the user and
+   *  has no workers by default, which would step the triggers one after another.
+   */
+  cedar::aux::ThreadPool& getSteppingPool(size_t count)
+  {
+    static cedar::aux::ThreadPool pool;
+    static std::mutex resize_mutex;
+
+    size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int workers = static_cast<unsigned int>(std::min(count, cores) - std::min<size_t>(count, 1));
+
+    // only grow, so that alternating callers with different numbers of triggers don't restart the workers every tick
+    std::lock_guard<std::mutex> lock(resize_mutex);
+    if (pool.getNumberOfThreads() < workers)
+    {
+      pool.setNumberOfThreads(workers);
+    }
+    return pool;
+  }
+}
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
@@ -163,6 +193,12 @@ void cedar::proc::TriggerStepper::stepTriggers()
     auto timeStep = cedar::aux::GlobalClockSingleton::getInstance()->getSimulationStepSize();
     cedar::aux::GlobalClockSingleton ::getInstance()->addTime(timeStep);
 
+    if (cedar::aux::SettingsSingleton::getInstance()->getParallelTriggerStepping())
+    {
+      cedar::proc::TriggerStepper::stepInParallel(this->mTriggerList, timeStep);
+      return;
+    }
+
     std::vector<std::thread> threadList;
     for(auto trigger: mTriggerList)
     {
@@ -179,3 +215,46 @@ void cedar::proc::TriggerStepper::stepTriggers()
 
   }
 }
+
+void cedar::proc::TriggerStepper::stepInParallel
+     (
+       const std::vector<cedar::proc::LoopedTriggerPtr>& triggers,
+       cedar::unit::Time timeStep
+     )
+{
+  std::vector<cedar::proc::LoopedTriggerPtr> stepped_triggers;
+  for (const auto& trigger : triggers)
+  {
+    if (!trigger->isRunning())
+    {
+      stepped_triggers.push_back(trigger);
+    }
+  }
+
+  // the order in which triggers are listed is arbitrary, but the seeds must always go to the same triggers
+  std::sort
+  (
+    stepped_triggers.begin(),
+    stepped_triggers.end(),
+    [](const cedar::proc::LoopedTriggerPtr& a, const cedar::proc::LoopedTriggerPtr& b)
+    {
+      return a->getFullPath() < b->getFullPath();
+    }
+  );
+
+  auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+  uint64 tick_seed = clock->getSeed();
+
+  std::vector<cedar::aux::ThreadPool::Task> tasks;
+  tasks.reserve(stepped_triggers.size());
+  for (size_t i = 0; i < stepped_triggers.size(); ++i)
+  {
+    tasks.push_back
+    (
+      boost::bind(&cedar::proc::LoopedTrigger::stepWithSeed, stepped_triggers.at(i), timeStep, cedar::aux::GlobalClock::mixSeed(tick_seed + i + 1))
+    );
+  }
+  getSteppingPool(tasks.size()).run(tasks);
+
+  clock->setSeed(cedar::aux::GlobalClock::mixSeed(tick_seed));
+}
@@ -79,6 +79,15 @@ public:
   void run();
   void setTriggers(std::vector<LoopedTriggerPtr> trigger);
 
+  /*!@brief Steps all given triggers that are not running once, concurrently.
+   *
+   *        The triggers are stepped on a pool that has a thread for each of them (up to the number of cores),
+   *        independent of the number of trigger threads set in the settings.
+   *        Returns when all triggers have been stepped, i.e., there is one barrier per call. Each trigger is stepped
+   *        with a seed derived from the global clock's seed and its position among the triggers sorted by path, so
+   *        runs with the same initial seed give the same results. Afterwards, the global clock's seed is advanced.
+   */
+  static void stepInParallel(const std::vector<cedar::proc::LoopedTriggerPtr>& triggers, cedar::unit::Time timeStep);
 
 
   //--------------------------------------------------------------------------------------------------------------------
@@ -129,8 +129,8 @@ public:
    */
   virtual void onTrigger
                (
-                 cedar::proc::ArgumentsPtr args = cedar::proc::ArgumentsPtr(),
-                 cedar::proc::TriggerPtr pSender = cedar::proc::TriggerPtr()
+                 const cedar::proc::ArgumentsPtr& args = cedar::proc::ArgumentsPtr(),
+                 const cedar::proc::TriggerPtr& pSender = cedar::proc::TriggerPtr()
                ) = 0;
 
   /*!@brief   Sets this Triggerable's looped trigger. Looped triggerable's may only be triggerd by one looped trigger
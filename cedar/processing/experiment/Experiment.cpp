@@ -43,6 +43,7 @@
 #include "cedar/auxiliaries/Recorder.h"
 #include "cedar/processing/experiment/Supervisor.h"
 #include "cedar/processing/Step.h"
+#include "cedar/processing/GroupCheckpoint.h"
 #include "cedar/processing/Trigger.h"
 #include "cedar/processing/LoopedTrigger.h"
 #include "cedar/auxiliaries/FileLog.h"
@@ -73,6 +74,7 @@ cedar::proc::experiment::Experiment::Experiment(cedar::proc::GroupPtr group)
 :
 mCurrentTrial(0),
 mIsRunning(false),
+mCheckpointRestored(false),
 _mFileName(new cedar::aux::StringParameter(this, "filename", "")),
 _mTrials(new cedar::aux::UIntParameter(this, "repetitions", 1)),
 _mActionSequences
@@ -242,6 +244,8 @@ void cedar::proc::experiment::Experiment::startExperiment()
     // Set record directory
     this->mRecordFolderName = this->_mName->getValue()+ "_" + time_stamp;
     this->mCurrentTrial = 0;
+    this->mCheckpoint.reset();
+    this->mCheckpointRestored = false;
     this->mLooper->start();
     this->mIsRunning = true;
     emit experimentRunning(true);
@@ -270,8 +274,17 @@ void cedar::proc::experiment::Experiment::startTrial()
   //this->mStopGroup->start();
   this->mGroup->stopTriggers();
   cedar::aux::GlobalClockSingleton::getInstance()->stop();
-  this->mGroup->reset();
-  cedar::aux::GlobalClockSingleton::getInstance()->reset();
+  // a restored checkpoint already contains the state the trial should start with
+  if (!this->mCheckpointRestored)
+  {
+    this->mGroup->reset();
+    cedar::aux::GlobalClockSingleton::getInstance()->reset();
+  }
+  this->mCheckpointRestored = false;
+  if (!this->mCheckpoint)
+  {
+    this->mCheckpoint = this->mGroup->createCheckpoint();
+  }
   cedar::aux::GlobalClockSingleton::getInstance()->start();
 
   // reset all action sequences
@@ -341,6 +354,19 @@ void cedar::proc::experiment::Experiment::stopTrial(ResetType::Id reset, bool st
       this->resetGroupState();
       break;
     }
+    case ResetType::RestoreCheckpoint:
+    {
+      if (this->mCheckpoint)
+      {
+        this->mGroup->restoreCheckpoint(this->mCheckpoint);
+        this->mCheckpointRestored = true;
+      }
+      else
+      {
+        this->mGroup->reset();
+      }
+      break;
+    }
     case ResetType::Reset:
     default:
     {
@@ -442,6 +468,9 @@ void cedar::proc::experiment::Experiment::setGroup(cedar::proc::GroupPtr group)
 {
   if (group != this->mGroup)
   {
+    this->mCheckpoint.reset();
+    this->mCheckpointRestored = false;
+
     // Initialize Group starter and stopper
     /*this->mStartGroup = cedar::aux::CallFunctionInThreadPtr
                                 (
@@ -57,6 +57,7 @@
 
 // FORWARD DECLARATIONS
 #include "cedar/auxiliaries/FileLog.fwd.h"
+#include "cedar/processing/GroupCheckpoint.fwd.h"
 #include "cedar/processing/experiment/Experiment.fwd.h"
 #include "cedar/processing/experiment/Supervisor.fwd.h"
 
@@ -107,6 +108,7 @@ public:
         mType.type()->def(cedar::aux::Enum(None, "None", "", "The architecture is left in the state it had at the end of the trial."));
         mType.type()->def(cedar::aux::Enum(Reset, "Reset", "", "The architecture is reset after reaching the end of the trial."));
         mType.type()->def(cedar::aux::Enum(Reload, "Reload", "", "The architecture is reloaded after reaching the end of the trial."));
+        mType.type()->def(cedar::aux::Enum(RestoreCheckpoint, "RestoreCheckpoint", "", "The outputs and buffers of the architecture are restored to an in-memory checkpoint taken at the start of the first trial."));
       }
 
       //! Returns the enumeration type.
@@ -128,6 +130,8 @@ public:
       static const Id Reset = 2;
       //!@brief the architecture is reloaded after reaching the end of the trial
       static const Id Reload = 3;
+      //!@brief the outputs and buffers are restored to the checkpoint taken at the start of the first trial
+      static const Id RestoreCheckpoint = 4;
 
     private:
       static cedar::aux::EnumType<ResetType> mType;
@@ -356,6 +360,12 @@ private:
   //! Logger used while the experiment is running.
   cedar::aux::FileLogPtr mFileLogger;
 
+  //! Checkpoint of the group taken at the start of the first trial, used by ResetType::RestoreCheckpoint.
+  cedar::proc::GroupCheckpointPtr mCheckpoint;
+
+  //! Whether the group has been restored from the checkpoint at the end of the last trial and needs no reset.
+  bool mCheckpointRestored;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
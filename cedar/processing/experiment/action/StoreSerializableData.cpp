@@ -43,6 +43,7 @@
 #include "cedar/auxiliaries/LockerBase.h"
 
 // SYSTEM INCLUDES
+#include <QDir>
 #include <string>
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -70,6 +71,16 @@ _mAppendTime(new cedar::aux::BoolParameter(this, "append time to filename", true
 // methods
 //----------------------------------------------------------------------------------------------------------------------
 
+std::string cedar::proc::experiment::action::StoreSerializableData::getOutputFile() const
+{
+  return this->_mOutputFile->getPath(true);
+}
+
+void cedar::proc::experiment::action::StoreSerializableData::setOutputFile(const std::string& path)
+{
+  this->_mOutputFile->setValue(QDir(QString::fromStdString(path)), true);
+}
+
 void cedar::proc::experiment::action::StoreSerializableData::run()
 {
   //!@todo There should be a Configurable::Read/WriteLocker instead of this
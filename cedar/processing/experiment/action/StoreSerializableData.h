@@ -72,6 +72,12 @@ public:
 public:
   void run();
 
+  //!@brief Returns the absolute path of the file the data is stored in (without the appended time).
+  std::string getOutputFile() const;
+
+  //!@brief Sets the file the data is stored in.
+  void setOutputFile(const std::string& path);
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
@@ -3252,6 +3252,7 @@ void cedar::proc::gui::Ide::setGroup(cedar::proc::gui::GroupPtr group)
   this->mGroup->getGroup()->applySimulationTimeStep();
   this->mGroup->getGroup()->applyDefaultCPUStep();
   this->mGroup->getGroup()->applyMinimumComputationTime();
+  this->mGroup->getGroup()->applyMultiRate();
 }
 
 void cedar::proc::gui::Ide::updateArchitectureWidgetsMenu()
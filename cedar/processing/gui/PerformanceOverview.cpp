@@ -153,6 +153,9 @@ mTimerId(0)
   this->autoRefreshToggled(this->mpAutoRefresh->isChecked());
 
   QObject::connect(this->mpAutoRefresh, SIGNAL(toggled(bool)), this, SLOT(autoRefreshToggled(bool)));
+
+  this->mpMeasureTimes->setChecked(cedar::proc::Step::getTimeMeasurementsEnabled());
+  QObject::connect(this->mpMeasureTimes, SIGNAL(toggled(bool)), this, SLOT(measureTimesToggled(bool)));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -252,6 +255,17 @@ void cedar::proc::gui::PerformanceOverview::addStepRow(cedar::proc::ConstStepPtr
   {
     this->addUnAvailableMeasurement(p_name->row(), 4);
   }
+
+  // in multi-rate simulation, slow dynamics are only computed every few trigger steps
+  unsigned int update_ratio = step->getUpdateRatio();
+  auto p_rate = new QTableWidgetItem(update_ratio > 1 ? QString("1/%1").arg(update_ratio) : QString("every step"));
+  p_rate->setToolTip("How often the step is computed relative to the steps of its trigger.");
+  p_rate->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+  if (!step->isStarted())
+  {
+    p_rate->setBackgroundColor(Qt::lightGray);
+  }
+  this->mpStepTimeOverview->setItem(p_name->row(), 5, p_rate);
 }
 
 void cedar::proc::gui::PerformanceOverview::addUnAvailableMeasurement(int row, int column)
@@ -277,6 +291,11 @@ void cedar::proc::gui::PerformanceOverview::clear()
   }
 }
 
+void cedar::proc::gui::PerformanceOverview::measureTimesToggled(bool enabled)
+{
+  cedar::proc::Step::setTimeMeasurementsEnabled(enabled);
+}
+
 void cedar::proc::gui::PerformanceOverview::autoRefreshToggled(bool enabled)
 {
   if (enabled)
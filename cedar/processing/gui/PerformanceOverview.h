@@ -86,6 +86,9 @@ public slots:
   //! react to a change in auto refresh
   void autoRefreshToggled(bool enabled);
 
+  //! enables or disables the time measurements of all steps
+  void measureTimesToggled(bool enabled);
+
   //--------------------------------------------------------------------------------------------------------------------
   // protected methods
   //--------------------------------------------------------------------------------------------------------------------
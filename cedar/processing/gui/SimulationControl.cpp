@@ -173,6 +173,8 @@ mSimulationRunning(false)
   auto minimumComputationTime = cedar::aux::GlobalClockSingleton::getInstance()->getMinimumComputationTime()/cedar::unit::Time(1.0 * cedar::unit::seconds);
   this->mpMinimumSleepSpinBox->setValue(minimumComputationTime);
 
+  this->mpMultiRateCheckBox->setChecked(cedar::aux::GlobalClockSingleton::getInstance()->isMultiRateEnabled());
+
 
 
   auto element_filter = [] (cedar::proc::ConstElementPtr element)
@@ -209,6 +211,7 @@ mSimulationRunning(false)
   QObject::connect(this, SIGNAL(signalTriggerCountChanged(QString)), this, SLOT(triggerCountChanged(QString)));
   QObject::connect(this->mpCPUStepSpinBox,SIGNAL(valueChanged(double)),this,SLOT(defaultCPUStepSizeChanged(double)));
   QObject::connect(this->mpMinimumSleepSpinBox,SIGNAL(valueChanged(double)),this,SLOT(minimumComputationTimeChanged(double)));
+  QObject::connect(this->mpMultiRateCheckBox, SIGNAL(toggled(bool)), this, SLOT(multiRateToggled(bool)));
 
   this->mSimulationModeChangedConnection = cedar::aux::GlobalClockSingleton::getInstance()->connectToLoopModeChangedSignal(boost::bind(&cedar::proc::gui::SimulationControl::toggleSpinBoxUsability,this,_1));
 
@@ -377,6 +380,10 @@ void cedar::proc::gui::SimulationControl::setGroup(cedar::proc::gui::GroupPtr gr
 
   this->toggleSpinBoxUsability(this->mGroup->getGroup()->getLoopMode());
 
+  bool blocked = this->mpMultiRateCheckBox->blockSignals(true);
+  this->mpMultiRateCheckBox->setChecked(this->mGroup->getGroup()->isMultiRateEnabled());
+  this->mpMultiRateCheckBox->blockSignals(blocked);
+
   QObject::connect(this->mGroup->getGroup().get(), SIGNAL(triggerStarted()), this, SLOT(triggerStarted()));
   QObject::connect(this->mGroup->getGroup().get(), SIGNAL(allTriggersStopped()), this, SLOT(allTriggersStopped()));
   QObject::connect(this->mGroup.get(), SIGNAL(triggerColorsChanged()), this, SLOT(updateAllTriggerColors()));
@@ -632,6 +639,11 @@ void cedar::proc::gui::SimulationControl::minimumComputationTimeChanged(double n
   this->mGroup->getGroup()->setMinimumComputationTime(cedar::unit::Time(newValue * cedar::unit::seconds));
 }
 
+void cedar::proc::gui::SimulationControl::multiRateToggled(bool enabled)
+{
+  this->mGroup->getGroup()->setMultiRateEnabled(enabled);
+}
+
 void cedar::proc::gui::SimulationControl::toggleSpinBoxUsability(cedar::aux::LoopMode::Id curLoopMode)
 {
   bool running = this->mSimulationRunning.member();
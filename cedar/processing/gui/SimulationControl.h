@@ -199,6 +199,8 @@ private slots:
 
   void minimumComputationTimeChanged(double newValue);
 
+  void multiRateToggled(bool enabled);
+
   void toggleSpinBoxUsability(cedar::aux::LoopMode::Id curLoopMode );
 
   //--------------------------------------------------------------------------------------------------------------------
@@ -45,6 +45,8 @@
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/version.h"
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/SharedMemoryMatChannel.h"
+#include "cedar/auxiliaries/exceptions.h"
 
 // SYSTEM INCLUDES
 #include <QReadLocker>
@@ -74,7 +76,8 @@ namespace
     input_declaration->setIconPath(":/steps/local_writer.svg");
     input_declaration->setDescription("Forwards a tensor to a "
                           "'LocalReader' step inside the same local "
-                          "cedar instance. "
+                          "cedar instance or, with \"shared memory\", "
+                          "in another cedar process on this machine. "
                           "See also the LocalReader step.");
 
     input_declaration->declare();
@@ -96,13 +99,15 @@ cedar::proc::sinks::LocalWriter::LocalWriter()
 cedar::proc::Step(true),
 // outputs
 mInput(new cedar::aux::MatData(cv::Mat())),
-_mPort(new cedar::aux::StringParameter(this, "port", "default local port"))
+_mPort(new cedar::aux::StringParameter(this, "port", "default local port")),
+_mSharedMemory(new cedar::aux::BoolParameter(this, "shared memory", false))
 {
   cedar::proc::sinks::LocalWriter::mpDataLock= new QReadWriteLock();
 
   // declare all data
   this->declareInput("input");
   _mPort->setValidator(boost::bind(&cedar::proc::sinks::LocalWriter::validatePortName, this, _1));
+  _mSharedMemory->markAdvanced();
 }
 //----------------------------------------------------------------------------------------------------------------------
 // methods
@@ -114,6 +119,11 @@ void cedar::proc::sinks::LocalWriter::onStart()
     return;
 
   _mPort->setConstant(true);
+  _mSharedMemory->setConstant(true);
+
+  // the segment is created again on the next write, so changes of the port or the setting take effect
+  this->mSharedMemoryChannel.reset();
+
     if("" != oldName && oldName != _mPort->getValue())
     {
         if(getPortCount(oldName) > 0)
@@ -142,6 +152,7 @@ void cedar::proc::sinks::LocalWriter::connect()
 void cedar::proc::sinks::LocalWriter::onStop()
 {
   _mPort->setConstant(false);
+  _mSharedMemory->setConstant(false);
 }
 
 void cedar::proc::sinks::LocalWriter::reset()
@@ -159,9 +170,34 @@ void cedar::proc::sinks::LocalWriter::compute(const cedar::proc::Arguments&)
     else
     {
       this->setMatrix( _mPort->getValue(), this->mInput->getData() );
+
+      if (this->_mSharedMemory->getValue())
+      {
+        this->writeSharedMemory();
+      }
     }
 }
 
+void cedar::proc::sinks::LocalWriter::writeSharedMemory()
+{
+  try
+  {
+    if (!this->mSharedMemoryChannel)
+    {
+      this->mSharedMemoryChannel.reset
+      (
+        new cedar::aux::SharedMemoryMatChannel(_mPort->getValue(), cedar::aux::SharedMemoryMatChannel::ROLE_WRITER)
+      );
+    }
+    this->mSharedMemoryChannel->write(this->mInput->getData());
+  }
+  catch (const cedar::aux::ExceptionBase& e)
+  {
+    this->mSharedMemoryChannel.reset();
+    this->setState(cedar::proc::Step::STATE_EXCEPTION, e.getMessage());
+  }
+}
+
 cedar::proc::DataSlot::VALIDITY cedar::proc::sinks::LocalWriter::determineInputValidity
                                 (
                                   cedar::proc::ConstDataSlotPtr CEDAR_DEBUG_ONLY(slot),
@@ -219,7 +255,7 @@ void cedar::proc::sinks::LocalWriter::setMatrix(const std::string &key, const cv
 cv::Mat cedar::proc::sinks::LocalWriter::getMatrix(const std::string &key)
 {
   QReadLocker lock( mpDataLock ); // locking for multi-threaded writers/readers
-  auto data= accessDataUnlocked();
+  auto& data= accessDataUnlocked();
 
   // there is no guarantee that the key already exists
   auto found= data.find( key );
@@ -232,6 +268,19 @@ cv::Mat cedar::proc::sinks::LocalWriter::getMatrix(const std::string &key)
                       // their memory
 }
 
+cv::Mat cedar::proc::sinks::LocalWriter::getSharedMatrix(const std::string &key)
+{
+  QReadLocker lock( mpDataLock );
+  auto& data= accessDataUnlocked();
+
+  auto found= data.find( key );
+  if  (found == data.end())
+    return cv::Mat();
+
+  // no clone: setMatrix replaces the stored matrix instead of writing into it
+  return found->second;
+}
+
 unsigned int cedar::proc::sinks::LocalWriter::getPortCount(const std::string &key)
 {
   QReadLocker lock( mpDataLock );
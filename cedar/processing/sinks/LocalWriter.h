@@ -42,11 +42,13 @@
 // CEDAR INCLUDES
 #include "cedar/processing/Step.h"
 #include "cedar/auxiliaries/StringParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/NumericParameter.h"
 #include "cedar/auxiliaries/MatData.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/processing/sinks/LocalWriter.fwd.h"
+#include "cedar/auxiliaries/SharedMemoryMatChannel.fwd.h"
 
 // SYSTEM INCLUDES
 
@@ -116,6 +118,8 @@ private:
   void reset();
   void connect();
   void validatePortName(const std::string& portName) const;
+  //!@brief Publishes the input to readers in other processes.
+  void writeSharedMemory();
 
   //--------------------------------------------------------------------------------------------------------------------
   // members
@@ -124,9 +128,17 @@ protected:
   //!@brief MatrixData representing the input. Storing it like this saves time during computation.
   cedar::aux::ConstMatDataPtr mInput;
   std::string oldName = "";
+  //!@brief Channel to readers in other processes; only used if shared memory is enabled.
+  cedar::aux::SharedMemoryMatChannelPtr mSharedMemoryChannel;
 
 public:
   static cv::Mat getMatrix(const std::string &key);
+  /*!@brief Returns the matrix stored for the port without copying it.
+   *
+   *        Every call of setMatrix stores a fresh copy, so the returned matrix is never written to again and may be
+   *        kept as long as needed; it must not be changed, though.
+   */
+  static cv::Mat getSharedMatrix(const std::string &key);
   static void setMatrix(const std::string &key, const cv::Mat &mat);
   static unsigned int getPortCount(const std::string &key);
 
@@ -135,6 +147,8 @@ public:
   //--------------------------------------------------------------------------------------------------------------------
 private:
   cedar::aux::StringParameterPtr _mPort;
+  //!@brief Whether the input is also published to readers in other processes.
+  cedar::aux::BoolParameterPtr _mSharedMemory;
 
   // locking for thread safety
   static QReadWriteLock *mpDataLock;
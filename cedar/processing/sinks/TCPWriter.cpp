@@ -45,6 +45,7 @@
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/version.h"
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/BinaryMatFrame.h"
 
 // SYSTEM INCLUDES
 #include <QReadLocker>
@@ -66,7 +67,9 @@
 #include <netinet/in.h> /* definition of struct sockaddr_in */
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>  /* definition of struct iovec */
 #include <unistd.h> /* definition of close */
+#include <errno.h>
 
 #endif
 
@@ -99,7 +102,9 @@ namespace
             );
     input_declaration->setIconPath(":/steps/tcp_writer.svg");
     input_declaration->setDescription("Forwards a tensor via a TCP Socket to a destination."
-                                      "See also the TCPReader step.");
+                                      "See also the TCPReader step. Tensors are sent as text, or, if \"binary format\" "
+                                      "is set, as raw binary frames that are much cheaper to send and receive. The "
+                                      "TCPReader has to use the same format.");
 
     input_declaration->declare();
 
@@ -123,17 +128,23 @@ cedar::proc::sinks::TCPWriter::TCPWriter()
         stepCounter(0),
         numConsecutiveTimeOuts(0),
         startMeasurement(std::chrono::steady_clock::now()),
+        mSequenceNumber(0),
         _mPort(new cedar::aux::UIntParameter(this, "port", 50000, 49152, 65535)), //ephemeral ports only
         _mIpAdress(new cedar::aux::StringParameter(this, "ip_adress", "127.0.0.1")),
         _mReconnectionTimeOut(new cedar::aux::UIntParameter(this, "timeout (ms)", 100)),
         _mMaxTimeouts(new cedar::aux::UIntParameter(this, "max timeouts", 50)),
-        _mSendInterval(new cedar::aux::UIntParameter(this, "send interval (timesteps)", 1))
+        _mSendInterval(new cedar::aux::UIntParameter(this, "send interval (timesteps)", 1)),
+        _mBinaryFormat(new cedar::aux::BoolParameter(this, "binary format", false)),
+        _mCompress(new cedar::aux::BoolParameter(this, "compress (LZ4)", false))
 {
   cedar::proc::sinks::TCPWriter::mpDataLock = new QReadWriteLock();
 
   _mReconnectionTimeOut->markAdvanced(true);
   _mMaxTimeouts->markAdvanced(true);
   _mSendInterval->markAdvanced(true);
+  _mCompress->markAdvanced(true);
+  // compression needs LZ4
+  _mCompress->setConstant(!cedar::aux::BinaryMatFrame::isCompressionAvailable());
 
   mAbortRequested.store(false);
   mSendMatrixWasSet.store(false);
@@ -348,6 +359,66 @@ void cedar::proc::sinks::TCPWriter::sendMatData(cedar::aux::ConstMatDataPtr data
 
 }
 
+void cedar::proc::sinks::TCPWriter::sendBinaryMatData(const cv::Mat& matrix)
+{
+  this->mFrame.pack(matrix, this->mSequenceNumber++, this->_mCompress->getValue());
+
+  char* header = reinterpret_cast<char*>(const_cast<cedar::aux::BinaryMatFrame::Header*>(&this->mFrame.getHeader()));
+  char* payload = const_cast<char*>(this->mFrame.getPayload());
+
+#ifdef _WIN32
+  WSABUF buffers[2];
+  buffers[0].buf = header;
+  buffers[0].len = static_cast<ULONG>(sizeof(cedar::aux::BinaryMatFrame::Header));
+  buffers[1].buf = payload;
+  buffers[1].len = static_cast<ULONG>(this->mFrame.getPayloadSize());
+  DWORD sent = 0;
+  WSASend(socket_h, buffers, 2, &sent, 0, NULL, NULL);
+#else
+  struct iovec buffers[2];
+  buffers[0].iov_base = header;
+  buffers[0].iov_len = sizeof(cedar::aux::BinaryMatFrame::Header);
+  buffers[1].iov_base = payload;
+  buffers[1].iov_len = this->mFrame.getPayloadSize();
+
+  // sendmsg is writev with flags, i.e., it allows for MSG_NOSIGNAL
+  struct iovec* remaining = buffers;
+  size_t remaining_count = 2;
+  while (remaining_count > 0)
+  {
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = remaining;
+    message.msg_iovlen = remaining_count;
+
+    ssize_t sent = sendmsg(socket_h, &message, MSG_NOSIGNAL);
+    if (sent < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      // the reader is gone; checkReaderStatus will notice and reconnect
+      return;
+    }
+
+    // large frames may only be sent in parts, so continue where the last call stopped
+    size_t sent_bytes = static_cast<size_t>(sent);
+    while (remaining_count > 0 && sent_bytes >= remaining->iov_len)
+    {
+      sent_bytes -= remaining->iov_len;
+      ++remaining;
+      --remaining_count;
+    }
+    if (remaining_count > 0)
+    {
+      remaining->iov_base = static_cast<char*>(remaining->iov_base) + sent_bytes;
+      remaining->iov_len -= sent_bytes;
+    }
+  }
+#endif
+}
+
 void cedar::proc::sinks::TCPWriter::onStop()
 {
   _mPort->setConstant(false);
@@ -568,8 +639,16 @@ void cedar::proc::sinks::TCPWriter::communicationLoop()
         stepCounter = 0;
         if (mSendMatrixWasSet.load())
         {
-          cedar::aux::ConstMatDataPtr mySendData(new cedar::aux::MatData(this->getMatrixToSend()));
-          sendMatData(mySendData);
+          if (this->_mBinaryFormat->getValue())
+          {
+            this->copyMatrixToSend(this->mSendBuffer);
+            this->sendBinaryMatData(this->mSendBuffer);
+          }
+          else
+          {
+            cedar::aux::ConstMatDataPtr mySendData(new cedar::aux::MatData(this->getMatrixToSend()));
+            sendMatData(mySendData);
+          }
           bool isReaderAlive = checkReaderStatus();
           if (!isReaderAlive)
           {
@@ -611,6 +690,12 @@ cv::Mat cedar::proc::sinks::TCPWriter::getMatrixToSend()
   return mMatrixToSend.clone();
 }
 
+void cedar::proc::sinks::TCPWriter::copyMatrixToSend(cv::Mat& target)
+{
+  std::lock_guard<std::shared_timed_mutex> guard(writeMatrixMutex);
+  mMatrixToSend.copyTo(target);
+}
+
 cedar::proc::Triggerable::State cedar::proc::sinks::TCPWriter::getCurrentState()
 {
   std::lock_guard<std::shared_timed_mutex> guard(stateMutex);
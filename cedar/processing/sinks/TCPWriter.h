@@ -43,7 +43,9 @@
 #include "cedar/processing/Step.h"
 #include "cedar/auxiliaries/StringParameter.h"
 #include "cedar/auxiliaries/NumericParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/BinaryMatFrame.h"
 #include "cedar/auxiliaries/utilities.h"
 
 // FORWARD DECLARATIONS
@@ -58,12 +60,14 @@
 #include <netinet/in.h> /* definition of struct sockaddr_in */
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>  /* definition of struct iovec */
 #include <unistd.h> /* definition of close */
 #endif
 
 
 #include <cedar/auxiliaries/UIntParameter.h>
 #include <chrono>
+#include <cstdint>
 
 #include "thread"
 #include "atomic"
@@ -137,6 +141,8 @@ private:
   void reset();
   void establishConnection();
   void sendMatData(cedar::aux::ConstMatDataPtr data);
+  //!@brief Sends the matrix as a binary frame (see cedar::aux::BinaryMatFrame) with a single scatter-gather write.
+  void sendBinaryMatData(const cv::Mat& matrix);
   bool checkReaderStatus();
   void closeConnection();
   void reconnect();
@@ -146,6 +152,8 @@ private:
   void communicationLoop();
   void setMatrixToSend(cv::Mat sendMatrix);
   cv::Mat getMatrixToSend();
+  //!@brief Copies the matrix to send into the target, reusing the target's memory if the size did not change.
+  void copyMatrixToSend(cv::Mat& target);
   void setCurrentStateAndAnnotation(Triggerable::State state, std::string annotation);
   Triggerable::State getCurrentState();
   std::string getCurrentAnnotation();
@@ -180,6 +188,11 @@ private:
     cv::Mat mMatrixToSend;
     mutable std::shared_timed_mutex writeMatrixMutex;
 
+    //! Copy of the matrix to send that is owned by the communication thread (binary format only).
+    cv::Mat mSendBuffer;
+    cedar::aux::BinaryMatFrame mFrame;
+    uint64_t mSequenceNumber;
+
     mutable std::shared_timed_mutex stateMutex;
     Triggerable::State mCurState;
     std::string mCurStateAnnotation;
@@ -195,6 +208,10 @@ private:
   cedar::aux::UIntParameterPtr _mReconnectionTimeOut;
   cedar::aux::UIntParameterPtr _mMaxTimeouts;
   cedar::aux::UIntParameterPtr _mSendInterval;
+  //! If true, matrices are sent as binary frames instead of text. The reader has to use the same format.
+  cedar::aux::BoolParameterPtr _mBinaryFormat;
+  //! If true, binary frames are compressed with LZ4 (if available).
+  cedar::aux::BoolParameterPtr _mCompress;
 
   // locking for thread safety
   static QReadWriteLock *mpDataLock;
@@ -71,6 +71,8 @@ namespace
     declaration->setDescription("Create a matrix with one common constant value  of your specification for all entries.");
     declaration->deprecatedName("cedar.processing.source.ConstMatrix");
 
+    declaration->setPure(true);
+
     declaration->declare();
 
     return true;
@@ -77,6 +77,8 @@ namespace
     declaration->setDescription("Generates a tensor that contains a sampled Gauss function of your specification. Note: If you require that the parameters be set via inputs, please consider the VariableGauss step.");
     declaration->deprecatedName("cedar.processing.source.GaussInput");
 
+    declaration->setPure(true);
+
     declaration->declare();
 
     return true;
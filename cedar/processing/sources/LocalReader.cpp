@@ -43,6 +43,8 @@
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/processing/sinks/LocalWriter.h"
+#include "cedar/auxiliaries/SharedMemoryMatChannel.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/stringFunctions.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/net/exceptions.h"
@@ -73,7 +75,9 @@ namespace
     );
     declaration->setIconPath(":/steps/local_reader.svg");
     declaration->setDescription("Reads a tensor that was sent from a "
-                    "'LocalWriter' inside the same local cedar instance. "
+                    "'LocalWriter' inside the same local cedar instance or, "
+                    "with \"shared memory\", in another cedar process on "
+                    "this machine. "
                     "See also the "
                     "LocalWriter step.");
 
@@ -93,10 +97,12 @@ cedar::proc::sources::LocalReader::LocalReader()
 cedar::proc::Step(true),
 mOutput(new cedar::aux::MatData(cv::Mat())),
 // parameters
-_mPort(new cedar::aux::StringParameter(this, "port", "default local port"))
+_mPort(new cedar::aux::StringParameter(this, "port", "default local port")),
+_mSharedMemory(new cedar::aux::BoolParameter(this, "shared memory", false))
 {
   // declare all data
   this->declareOutput("output", mOutput);
+  _mSharedMemory->markAdvanced();
 
   //add actions that emits the output properties changed signal
 
@@ -130,12 +136,28 @@ void cedar::proc::sources::LocalReader::connect()
 void cedar::proc::sources::LocalReader::onStart()
 {
   this->_mPort->setConstant(true);
+  this->_mSharedMemory->setConstant(true);
+  this->mSharedMemoryChannel.reset();
+
   this->connect();
 }
 
 void cedar::proc::sources::LocalReader::onStop()
 {
   this->_mPort->setConstant(false);
+  this->_mSharedMemory->setConstant(false);
+}
+
+bool cedar::proc::sources::LocalReader::readSharedMemory()
+{
+  if (!this->mSharedMemoryChannel)
+  {
+    this->mSharedMemoryChannel.reset
+    (
+      new cedar::aux::SharedMemoryMatChannel(_mPort->getValue(), cedar::aux::SharedMemoryMatChannel::ROLE_READER)
+    );
+  }
+  return this->mSharedMemoryChannel->read(this->mOutput->getData());
 }
 
 void cedar::proc::sources::LocalReader::compute(const cedar::proc::Arguments&)
@@ -145,14 +167,64 @@ void cedar::proc::sources::LocalReader::compute(const cedar::proc::Arguments&)
         this->setState(cedar::proc::Step::STATE_EXCEPTION, "Local port name is empty!");
         //CEDAR_THROW(cedar::aux::InvalidNameException, "Local port name is empty!");
     }
+  else if(this->_mSharedMemory->getValue())
+  {
+    cv::Mat old = this->mOutput->getData();
+
+    bool read = false;
+    try
+    {
+      read = this->readSharedMemory();
+    }
+    catch (const cedar::aux::ExceptionBase& e)
+    {
+      this->mSharedMemoryChannel.reset();
+      this->setState(cedar::proc::Step::STATE_EXCEPTION, e.getMessage());
+      return;
+    }
+
+    if (!read)
+    {
+      switch (this->mSharedMemoryChannel->getLastReadStatus())
+      {
+        case cedar::aux::SharedMemoryMatChannel::READ_OVERTAKEN:
+          this->setState
+          (
+            cedar::proc::Step::STATE_EXCEPTION,
+            "The writer overwrote every frame of this shared memory port while it was being read!"
+          );
+          break;
+
+        case cedar::aux::SharedMemoryMatChannel::READ_INVALID_FRAME:
+          this->setState
+          (
+            cedar::proc::Step::STATE_EXCEPTION,
+            "The writer published an invalid frame to this shared memory port!"
+          );
+          break;
+
+        default:
+          this->setState(cedar::proc::Step::STATE_EXCEPTION, "No writer has published to this shared memory port yet!");
+      }
+      return;
+    }
+
+    const cv::Mat& output = this->mOutput->getData();
+    if (old.type() != output.type() || old.size != output.size)
+    {
+      this->emitOutputPropertiesChangedSignal("output");
+    }
+  }
   else if(cedar::proc::sinks::LocalWriter::getPortCount( _mPort->getValue() ) > 0)
   {
     cv::Mat old = this->mOutput->getData();
 
-    cv::Mat read = cedar::proc::sinks::LocalWriter::getMatrix( _mPort->getValue() );
+    // the writer stores a fresh copy for every step and never writes into it, so the output can share it instead of
+    // copying it again; code that writes into data in-place detaches shared memory first (see cedar::aux::sharesData)
+    cv::Mat read = cedar::proc::sinks::LocalWriter::getSharedMatrix( _mPort->getValue() );
 
     bool changed = (old.type() != read.type() || old.size != read.size);
-    this->mOutput->setData(read.clone()); // this should already be a clone, but I get crashes when I remove the .clone() here
+    this->mOutput->setData(read);
     if (changed)
     {
       this->emitOutputPropertiesChangedSignal("output");
@@ -42,11 +42,13 @@
 // CEDAR INCLUDES
 #include "cedar/processing/Step.h"
 #include "cedar/auxiliaries/StringParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/NumericParameter.h"
 #include "cedar/auxiliaries/MatData.h"
 
 // FORWARD DECLARATIONS
 #include "cedar/processing/sources/LocalReader.fwd.h"
+#include "cedar/auxiliaries/SharedMemoryMatChannel.fwd.h"
 
 // SYSTEM INCLUDES
 
@@ -111,6 +113,9 @@ private:
 
   void connect();
 
+  //!@brief Reads the output from a writer in another process; returns false if there is nothing to read.
+  bool readSharedMemory();
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -118,6 +123,8 @@ protected:
   //!@brief The data containing the output.
   cedar::aux::MatDataPtr mOutput;
 private:
+  //!@brief Channel from a writer in another process; only used if shared memory is enabled.
+  cedar::aux::SharedMemoryMatChannelPtr mSharedMemoryChannel;
 
 
   //--------------------------------------------------------------------------------------------------------------------
@@ -125,6 +132,8 @@ private:
   //--------------------------------------------------------------------------------------------------------------------
 private:
   cedar::aux::StringParameterPtr _mPort;
+  //!@brief Whether the output is read from a writer in another process.
+  cedar::aux::BoolParameterPtr _mSharedMemory;
 
 }; // class cedar::proc::sources::LocalReader
 
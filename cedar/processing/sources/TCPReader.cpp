@@ -52,6 +52,7 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <utility>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -123,7 +124,8 @@ cedar::proc::sources::TCPReader::TCPReader()
         _mPort(new cedar::aux::UIntParameter(this, "port", 50000, 49152, 65535)), //ephemeral ports only
         _mTimeOutBetweenPackets(new cedar::aux::UIntParameter(this, "packet timeout (ms)", 500)),
         _mTimeStepsBetweenMessages(new cedar::aux::UIntParameter(this, "message timeout (ms)", 5)),
-        _mTimeStepsBetweenAcceptTrials(new cedar::aux::UIntParameter(this, "accept interval (steps)", 30))
+        _mTimeStepsBetweenAcceptTrials(new cedar::aux::UIntParameter(this, "accept interval (steps)", 30)),
+        _mBinaryFormat(new cedar::aux::BoolParameter(this, "binary format", false))
 {
 
   isConnected.store(false);
@@ -143,7 +145,8 @@ cedar::proc::sources::TCPReader::TCPReader()
 
   this->declareOutput("output", mOutput);
 
-  mOutput->setData(lastReadMatrix);
+  // binary frames are received into the memory of former matrices, which must not be shared with the output
+  mOutput->setData(lastReadMatrix.clone());
 }
 
 cedar::proc::sources::TCPReader::~TCPReader()
@@ -327,6 +330,11 @@ void cedar::proc::sources::TCPReader::receiveMatData()
     return;
   }
 
+  if (this->_mBinaryFormat->getValue())
+  {
+    this->receiveBinaryMatData();
+    return;
+  }
 
   // Size may be varied. Just picked this number for now.
   char *buffer = (char *) malloc(_mBufferLength->getValue() * sizeof(char));
@@ -470,6 +478,101 @@ void cedar::proc::sources::TCPReader::receiveMatData()
   lastReadMatrix = transformData.getData();
 }
 
+void cedar::proc::sources::TCPReader::receiveBinaryMatData()
+{
+  cedar::aux::BinaryMatFrame::Header header;
+  size_t received = this->receiveBytes(reinterpret_cast<char*>(&header), sizeof(header));
+
+  if (received == 0)
+  {
+    // nothing was sent, handled like a failed read of the text format
+    numberOfFailedReads = numberOfFailedReads + 1;
+    if (numberOfFailedReads > _mTimeStepsBetweenMessages->getValue())
+    {
+      numberOfFailedReads = 0;
+      if (raw_socket_h != -1)
+      {
+        //Just wait for some connection!
+        socket_h = accept_client(raw_socket_h);
+      } else
+      {
+        reconnect();
+      }
+    }
+    return;
+  }
+  numberOfFailedReads = 0;
+
+  // without delimiters, there is no way to find the start of the next frame in a broken stream; start over instead
+  if (received < sizeof(header) || !cedar::aux::BinaryMatFrame::isValid(header))
+  {
+    reconnect();
+    return;
+  }
+
+  char* destination = this->mFrame.preparePayload(header, this->mReceiveMatrix);
+  size_t payload_size = static_cast<size_t>(header.mPayloadSize);
+  if (payload_size > 0 && this->receiveBytes(destination, payload_size) < payload_size)
+  {
+    reconnect();
+    return;
+  }
+
+  if (!this->mFrame.unpack(header, this->mReceiveMatrix))
+  {
+    return;
+  }
+
+  // the previous matrix is reused for the next frame if it has the same size
+  std::lock_guard<std::shared_timed_mutex> guard(readMatrixMutex);
+  std::swap(lastReadMatrix, mReceiveMatrix);
+}
+
+size_t cedar::proc::sources::TCPReader::receiveBytes(char* destination, size_t length)
+{
+  size_t received = 0;
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+  while (received < length)
+  {
+    if (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count()
+          > _mTimeOutBetweenPackets->getValue())
+    {
+      break;
+    }
+
+    int msgLength = -1;
+#ifdef _WIN32
+    msgLength = recv(socket_h, destination + received, static_cast<int>(length - received), 0);
+#else
+    fd_set set;
+    struct timeval selectTimeout;
+    FD_ZERO(&set); /* clear the set */
+    FD_SET(socket_h, &set); /* add our file descriptor to the set */
+    selectTimeout.tv_sec = 0;
+    selectTimeout.tv_usec = 100000;
+
+    int rv = select(socket_h + 1, &set, NULL, NULL, &selectTimeout);
+    if (rv > 0)
+    {
+      msgLength = recv(socket_h, destination + received, length - received, 0);
+    }
+#endif
+
+    if (msgLength > 0)
+    {
+      received += static_cast<size_t>(msgLength);
+    }
+    else if (received == 0 || msgLength == 0)
+    {
+      // either nothing was sent or the writer closed the connection
+      break;
+    }
+  }
+
+  return received;
+}
+
 void cedar::proc::sources::TCPReader::onStop()
 {
   _mPort->setConstant(false);
@@ -43,7 +43,9 @@
 #include "cedar/processing/Step.h"
 #include "cedar/auxiliaries/StringParameter.h"
 #include "cedar/auxiliaries/NumericParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/BinaryMatFrame.h"
 #include "cedar/auxiliaries/utilities.h"
 
 
@@ -145,6 +147,15 @@ private:
 
   void receiveMatData();
 
+  //!@brief Receives a matrix sent as a binary frame (see cedar::aux::BinaryMatFrame).
+  void receiveBinaryMatData();
+
+  /*!@brief Receives up to length bytes into the destination, waiting at most the packet timeout.
+   *
+   * @returns The number of bytes received; less than length if the connection timed out or was closed.
+   */
+  size_t receiveBytes(char* destination, size_t length);
+
   int accept_client(int server_fd);
 
   int create_socket_server(int port);
@@ -193,6 +204,9 @@ private:
   cv::Mat lastReadMatrix;
   cv::Mat lastReadDimensions;
   std::string mOverflowBuffer;
+  //! Matrix the binary frames are received into; swapped with lastReadMatrix once a frame is complete.
+  cv::Mat mReceiveMatrix;
+  cedar::aux::BinaryMatFrame mFrame;
 
   //parallel communication
   std::thread mCommunicationThread;
@@ -216,6 +230,8 @@ private:
   cedar::aux::UIntParameterPtr _mTimeOutBetweenPackets;
   cedar::aux::UIntParameterPtr _mTimeStepsBetweenMessages;
   cedar::aux::UIntParameterPtr _mTimeStepsBetweenAcceptTrials;
+  //! If true, matrices are expected as binary frames instead of text. The writer has to use the same format.
+  cedar::aux::BoolParameterPtr _mBinaryFormat;
 
   // locking for thread safety
   static QReadWriteLock *mpDataLock;
@@ -78,7 +78,8 @@ namespace
                         "Convolution can be done with to different engines: OpenCV and FFTW. "
                         "The OpenCV engine provides Convolution with three modes: Full, same, and valid. "
                         "Also the border handling can be set as: Cyclic, zero-filled, mirrowed, and replicate. "
-                        "The FFTW engine only provides cyclic border handling with mode same.\n\n"
+                        "The FFTW engine only provides cyclic border handling with mode same. "
+                        "The Auto engine measures both engines once for each configuration and uses the faster one.\n\n"
                         "The step can either use an kernel matrix (input) to perform the convolution, or it can use "
                         " a list of kernels set via parameters."
                       );
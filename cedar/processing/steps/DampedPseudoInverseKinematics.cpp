@@ -103,7 +103,8 @@ void cedar::proc::steps::DampedPseudoInverseKinematics::compute(const cedar::pro
     cedar::dev::KinematicChainPtr kinChain = boost::dynamic_pointer_cast < cedar::dev::KinematicChain > (component);
     if (kinChain)
     {
-      cv::Mat Jacobian = kinChain->calculateEndEffectorJacobian();
+      kinChain->calculateEndEffectorJacobian(this->mJacobian);
+      const cv::Mat& Jacobian = this->mJacobian;
       cv::Mat jacobian_pseudo_inverse = cv::Mat::zeros(kinChain->getNumberOfJoints(), 2, CV_32FC1);
 
       cv::Mat U, V_transposed, S;
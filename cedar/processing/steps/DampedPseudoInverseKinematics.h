@@ -115,6 +115,9 @@ private:
   cedar::aux::MatDataPtr mOutputVelocity;
   std::string mInputVelocityName;
 
+  //! Reused storage for the end-effector Jacobian.
+  cv::Mat mJacobian;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
@@ -40,11 +40,14 @@
 #include "cedar/processing/ProjectionMapping.h"
 #include "cedar/processing/ProjectionMappingParameter.h"
 #include "cedar/processing/DataSlot.h"
+#include "cedar/processing/DataConnection.h"
+#include "cedar/processing/ExternalData.h"
 #include "cedar/processing/Arguments.h"
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/processing/GroupXMLFileFormatV1.h"
 #include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/annotation/BroadcastView.h"
 #include "cedar/auxiliaries/assert.h"
 #include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/math/tools.h"
@@ -94,9 +97,16 @@ namespace
         "or max along that dimension.\n"
       "For an immersion, i.e. when the output order M is larger: "
         "the emtpy entries are expanded by filling them with copies of "
-        "the input."
+        "the input. With the advanced option \"broadcast view\", the "
+        "output is not filled as long as all connected steps are sums "
+        "or neural fields, which add the copies of the input directly. "
+        "Plots, recordings and checkpoints of the output then only see "
+        "zeros; as soon as any other step is connected, the output is "
+        "filled as usual."
     );
 
+    declaration->setPure(true);
+
     declaration->declare();
 
     return true;
@@ -112,6 +122,8 @@ cedar::proc::steps::Projection::Projection()
 :
 mOutput(new cedar::aux::MatData(cv::Mat())),
 mpProjectionMethod(nullptr),
+mUseBroadcastView(false),
+mBroadcastOutputFilled(false),
 _mDimensionMappings(new cedar::proc::ProjectionMappingParameter(this, "dimension mapping")),
 _mOutputDimensionality(new cedar::aux::UIntParameter(this, "output dimensionality", 1, 0, 4)),
 _mOutputDimensionSizes(new cedar::aux::UIntVectorParameter(this, "output dimension sizes", 1, 50, 1, 1000)),
@@ -121,8 +133,11 @@ _mCompressionType(new cedar::aux::EnumParameter(
                                                  cedar::proc::steps::Projection::CompressionType::typePtr(),
                                                  cedar::proc::steps::Projection::CompressionType::SUM
                                                )
-                  )
+                  ),
+_mBroadcastView(new cedar::aux::BoolParameter(this, "broadcast view", false))
 {
+  this->_mBroadcastView->markAdvanced();
+
   // declare input and output
   this->declareInput("input");
   this->declareOutput("output", mOutput);
@@ -133,6 +148,7 @@ _mCompressionType(new cedar::aux::EnumParameter(
   // connect signals and slots
   QObject::connect(_mDimensionMappings.get(), SIGNAL(valueChanged()), this, SLOT(reconfigure()), Qt::DirectConnection);
   QObject::connect(_mCompressionType.get(), SIGNAL(valueChanged()), this, SLOT(reconfigure()), Qt::DirectConnection);
+  QObject::connect(_mBroadcastView.get(), SIGNAL(valueChanged()), this, SLOT(reconfigure()), Qt::DirectConnection);
   QObject::connect(_mOutputDimensionality.get(), SIGNAL(valueChanged()), this, SLOT(outputDimensionalityChanged()), Qt::DirectConnection);
   QObject::connect(_mOutputDimensionSizes.get(), SIGNAL(valueChanged()), this, SLOT(outputDimensionSizesChanged()), Qt::DirectConnection);
 }
@@ -156,6 +172,24 @@ void cedar::proc::steps::Projection::compute(const cedar::proc::Arguments&)
   if (!mInput) // quickfix
     return;
 
+  if (this->mUseBroadcastView)
+  {
+    this->expandAsBroadcastView(this->mInput, this->mOutput, this->mIndicesToCompress, this->_mCompressionType, this->_mDimensionMappings);
+
+    // consumers that do not know about broadcast views read the output matrix itself, so it has to be filled for them
+    if (this->allConsumersAcceptBroadcastViews())
+    {
+      // don't leave values behind from a time when the output had to be filled
+      if (this->mBroadcastOutputFilled)
+      {
+        this->mOutput->getData().setTo(0);
+        this->mBroadcastOutputFilled = false;
+      }
+      return;
+    }
+    this->mBroadcastOutputFilled = true;
+  }
+
   // call the appropriate projection method via the function pointer
   if(this->mpProjectionMethod)
   {
@@ -163,6 +197,43 @@ void cedar::proc::steps::Projection::compute(const cedar::proc::Arguments&)
   }
 }
 
+void cedar::proc::steps::Projection::outputConnectionAdded(cedar::proc::DataSlotPtr /* slot */)
+{
+  // the inputs did not change, so the (pure) projection would otherwise reuse its output as it is
+  if (this->mUseBroadcastView)
+  {
+    this->invalidateComputedOutputs();
+  }
+}
+
+void cedar::proc::steps::Projection::outputConnectionRemoved(cedar::proc::DataSlotPtr /* slot */)
+{
+  if (this->mUseBroadcastView)
+  {
+    this->invalidateComputedOutputs();
+  }
+}
+
+bool cedar::proc::steps::Projection::allConsumersAcceptBroadcastViews() const
+{
+  const auto& connections = this->getOutputSlot("output")->getDataConnections();
+  // without any consumers, the output is most likely only looked at in plots, which need the full matrix
+  if (connections.empty())
+  {
+    return false;
+  }
+
+  for (const auto& connection : connections)
+  {
+    auto target = connection->getTarget();
+    if (!target || !target->acceptsBroadcastViews())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 void cedar::proc::steps::Projection::outputDimensionalityChanged()
 {
   // get the new output dimensionality
@@ -284,8 +355,8 @@ void cedar::proc::steps::Projection::reconfigure(bool triggerSubsequent)
     }
     else
     {
-      mpProjectionMethod = NULL;
-      CEDAR_THROW(cedar::aux::NotImplementedException, "The projection for this configuration is not implemented.");
+      // all other compressions (e.g., 4D to 2D) are handled by the generic implementation
+      mpProjectionMethod = &cedar::proc::steps::Projection::compressMDtoND;
     }
   }
   // if the projection expands ...
@@ -341,8 +412,22 @@ void cedar::proc::steps::Projection::reconfigure(bool triggerSubsequent)
     this->_mOutputDimensionSizes->setConstantAt(output_dim, true);
   }
 
+  // the broadcast view only describes the output as long as it is in use; the output matrix is reset whenever it is
+  // switched on or off so it never holds stale values
+  // the full expansion is kept as the projection method for consumers that do not understand the view
+  bool broadcast_view = this->_mBroadcastView->getValue() && input_dimensionality < output_dimensionality;
+  this->mUseBroadcastView = broadcast_view;
+  if (broadcast_view != this->mOutput->hasAnnotation<cedar::aux::annotation::BroadcastView>())
+  {
+    if (!broadcast_view)
+    {
+      this->mOutput->removeAnnotations<cedar::aux::annotation::BroadcastView>();
+    }
+    this->initializeOutputMatrix();
+    this->emitOutputPropertiesChangedSignal("output");
+  }
   // if input type and output type do not match, we have to re-initialize the output matrix
-  if (this->mInput->getCvType() != this->mOutput->getCvType())
+  else if (this->mInput->getCvType() != this->mOutput->getCvType())
   {
     this->initializeOutputMatrix();
     this->emitOutputPropertiesChangedSignal("output");
@@ -42,6 +42,7 @@
 #include "cedar/processing/Step.h"
 #include "cedar/processing/ProjectionFunctions.h"
 #include "cedar/processing/ProjectionMappingParameter.h"
+#include "cedar/auxiliaries/BoolParameter.h"
 #include "cedar/auxiliaries/UIntParameter.h"
 #include "cedar/auxiliaries/UIntVectorParameter.h"
 #include "cedar/auxiliaries/EnumParameter.h"
@@ -156,6 +157,18 @@ public:
     this->_mOutputDimensionSizes->setValue(dimension, size);
   }
 
+  /*! Sets whether expansions are passed on as a broadcast view rather than being written to the output matrix.
+   *
+   *  The output matrix is still filled whenever a connected slot does not accept broadcast views, i.e., the view only
+   *  takes effect if all consumers are sums or neural fields.
+   *
+   *  @see cedar::proc::ProjectionFunctions::expandAsBroadcastView
+   */
+  inline void setBroadcastView(bool broadcast)
+  {
+    this->_mBroadcastView->setValue(broadcast);
+  }
+
   void writeConfigurationXML(cedar::aux::ConfigurationNode& root) const;
 
   bool isXMLExportable(std::string& errorMsg) override;
@@ -191,6 +204,15 @@ private:
   //!@brief initializes or reconfigures the output matrix
   void initializeOutputMatrix();
 
+  //!@brief whether the output is connected and all connected slots read broadcast views via their source
+  bool allConsumersAcceptBroadcastViews() const;
+
+  //!@brief a new consumer may need the output of a broadcast view to be filled
+  void outputConnectionAdded(cedar::proc::DataSlotPtr slot);
+
+  //!@brief without its last unaware consumer, the output of a broadcast view no longer needs to be filled
+  void outputConnectionRemoved(cedar::proc::DataSlotPtr slot);
+
   //!@brief gets called once by cedar::proc::LoopedTrigger once prior to starting the trigger
   virtual void onStart();
   //!@brief gets called once by cedar::proc::LoopedTrigger after it stops
@@ -208,6 +230,10 @@ protected:
 private:
   //!@brief function pointer to one of the projection member functions
   ProjectionFunctionPtr mpProjectionMethod;
+  //!@brief whether the output is annotated with a broadcast view (mpProjectionMethod then fills it only when needed)
+  bool mUseBroadcastView;
+  //!@brief whether the output was filled in addition to the broadcast view in the last computation
+  bool mBroadcastOutputFilled;
   //!@brief vector holding all indices of dimensions that have to be compressed
   //! this is only in use when the projection is set up to compress the dimensionality of the input
   std::vector<unsigned int> mIndicesToCompress;
@@ -230,6 +256,9 @@ private:
   //!@brief type of compression used when reducing the dimensionality (maximum, minimum, average, sum)
   cedar::aux::EnumParameterPtr _mCompressionType;
 
+  //!@brief if set, expansions only annotate the output with a broadcast view instead of filling the output matrix
+  cedar::aux::BoolParameterPtr _mBroadcastView;
+
   //!@brief a lookup table for mappings
   std::vector<unsigned int> mMappingLookup;
 }; // class cedar::proc::steps::Projection
@@ -74,6 +74,8 @@ namespace
       "That scalar ist set as a GUI parameter."
     );
 
+    declaration->setPure(true);
+
     declaration->declare();
 
     return true;
@@ -41,9 +41,11 @@
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/processing/GroupXMLFileFormatV1.h"
+#include "cedar/processing/ProjectionFunctions.h"
 #include "cedar/processing/typecheck/SameSizedCollection.h"
 #include "cedar/processing/typecheck/SameTypeCollection.h"
 #include "cedar/processing/typecheck/And.h"
+#include "cedar/auxiliaries/annotation/BroadcastView.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/assert.h"
@@ -107,6 +109,8 @@ mOutput(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F)))
   this->declareOutput("sum", this->mOutput);
 
   this->mInputs = this->getInputSlot("terms");
+  // sumSlot adds broadcast views via their source
+  this->mInputs->setAcceptsBroadcastViews(true);
 }
 //----------------------------------------------------------------------------------------------------------------------
 // methods
@@ -150,7 +154,13 @@ void cedar::proc::steps::Sum::sumSlot(cedar::proc::ExternalDataPtr slot, cv::Mat
         }
 
         cv::Mat to_add;
-        if (input_dim == 1)
+        if (mat_data->hasAnnotation<cedar::aux::annotation::BroadcastView>())
+        {
+          // the input matrix of a broadcast view is not filled; its (small) source is added directly instead
+          auto view = mat_data->getAnnotation<cedar::aux::annotation::BroadcastView>();
+          cedar::proc::ProjectionFunctions::addExpanded(view->getSource(), sum, view->getMapping());
+        }
+        else if (input_dim == 1)
         {
           sum += cedar::aux::math::canonicalRowVector(input_mat);
         }
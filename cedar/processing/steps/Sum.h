@@ -72,7 +72,8 @@ public:
   /*! A helper function that calculates the sum of all matrices in the given slot.
    *
    * @remarks This function assumes that the output matrix, sum, is initialized to the appropriate size, and that all
-   *          matrices in the slot are the same size (0D matrices are treated as scalar additions).
+   *          matrices in the slot are the same size (0D matrices are treated as scalar additions). Matrices annotated
+   *          with a cedar::aux::annotation::BroadcastView are added via their broadcast source.
    */
   static void sumSlot(cedar::proc::ExternalDataPtr slot, cv::Mat& sum, bool lock = false);
 
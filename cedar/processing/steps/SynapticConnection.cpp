@@ -730,8 +730,8 @@ void cedar::proc::steps::SynapticConnection::reconfigure(bool triggerSubsequent)
       }
       else
       {
-        mpProjectionMethod = NULL;
-        CEDAR_THROW(cedar::aux::NotImplementedException, "The projection for this configuration is not implemented.");
+        // all other compressions (e.g., 4D to 2D) are handled by the generic implementation
+        mpProjectionMethod = &cedar::proc::ProjectionFunctions::compressMDtoND;
       }
     }
       // if the projection expands ...
@@ -149,7 +149,7 @@ void cedar::proc::steps::TransferFunction::recompute()
   cv::Mat& sigmoid_u = this->mOutput->getData();
 
   // calculate output
-  sigmoid_u = _mTransferFunction->getValue()->compute(input.clone());
+  _mTransferFunction->getValue()->compute(input, sigmoid_u);
 }
 
 void cedar::proc::steps::TransferFunction::inputConnectionChanged(const std::string& inputName)
@@ -2,6 +2,8 @@
 # FFTW_FOUND - whether FFTW was found or not
 # FFTW_INCLUDE_DIRS - the FFTW include directories
 # FFTW_LIBS - FFTW libraries
+# FFTW_FLOAT_FOUND - whether the single-precision variant of FFTW (fftwf) was found
+# FFTW_FLOAT_LIBS - single-precision FFTW libraries
 
 # find include dir in set of paths
 find_path(FFTW_INCLUDE_DIRS
@@ -18,6 +20,14 @@ find_library(FFTW_LIBS_THREADED
   NAMES fftw3_omp
   PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
 )
+find_library(FFTW_FLOAT_LIBS
+  NAMES fftw3f libfftw3f libfftw3f-3
+  PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
+)
+find_library(FFTW_FLOAT_LIBS_THREADED
+  NAMES fftw3f_omp
+  PATHS ${CEDAR_DEPENDENCY_LIBRARIES}
+)
 
 # now check if anything is missing
 if(FFTW_INCLUDE_DIRS AND FFTW_LIBS)
@@ -35,3 +45,14 @@ else(FFTW_LIBS_THREADED)
     set(FFTW_THREADED false)
 endif(FFTW_LIBS_THREADED)
 
+
+if(FFTW_FOUND AND FFTW_FLOAT_LIBS)
+  set(FFTW_FLOAT_FOUND true)
+else(FFTW_FOUND AND FFTW_FLOAT_LIBS)
+  set(FFTW_FLOAT_LIBS "")
+  set(FFTW_FLOAT_FOUND false)
+endif(FFTW_FOUND AND FFTW_FLOAT_LIBS)
+
+if(NOT FFTW_FLOAT_LIBS_THREADED)
+  set(FFTW_FLOAT_LIBS_THREADED "")
+endif(NOT FFTW_FLOAT_LIBS_THREADED)
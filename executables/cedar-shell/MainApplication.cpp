@@ -39,6 +39,11 @@
 
 // CEDAR INCLUDES
 #include "cedar/processing/Group.h"
+#include "cedar/processing/experiment/Experiment.h"
+#include "cedar/processing/experiment/ActionSequence.h"
+#include "cedar/processing/experiment/action/StoreSerializableData.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/Recorder.h"
 #include "cedar/auxiliaries/Settings.h"
 
 // LOCAL INCLUDES
@@ -46,17 +51,36 @@
 
 // SYSTEM INCLUDES
 #include <boost/make_shared.hpp>
+#include <QCoreApplication>
+#include <QDir>
+#include <QEventLoop>
+#include <QFileInfo>
+#include <QProcess>
+#include <QStringList>
 #include <QTime>
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
 
 //----------------------------------------------------------------------------------------------------------------------
 // constructors and destructor
 //----------------------------------------------------------------------------------------------------------------------
 
 cedar::processingCL::MainApplication::MainApplication(int argc, char** argv)
+:
+mFirstTrial(0),
+mSeed(0),
+mExitCode(0)
 {
   mParser.defineFlag("run", "Run the architecture after loading it.", 'r');
   mParser.defineFlag("no-plugins", "Do not load default plugins.", 'p');
   mParser.defineValue("load", "Load an architecture.", 'l');
+  mParser.defineValue("experiment", "Run the trials of an experiment without user interaction (requires --load).", 'e', "batch");
+  mParser.defineValue("workers", "Number of worker processes the trials of the experiment are distributed to.", 1, 'w', "batch");
+  mParser.defineValue("results", "Directory that collects the stored data, recordings and logs of the experiment.", std::string("results"), 0, "batch");
+  mParser.defineValue("seed", "Seed of the first trial; trial n runs with seed + n.", 0, 0, "batch");
+  mParser.defineValue("worker", "Index of this worker process; set by the batch runner.", -1, 0, "batch");
   mParser.parse(argc, argv, true);
 }
 
@@ -64,8 +88,22 @@ cedar::processingCL::MainApplication::MainApplication(int argc, char** argv)
 // methods
 //----------------------------------------------------------------------------------------------------------------------
 
+int cedar::processingCL::MainApplication::getExitCode() const
+{
+  return this->mExitCode;
+}
+
 void cedar::processingCL::MainApplication::exec()
 {
+  // in batch mode, the worker processes load the architecture
+  if (this->mParser.hasParsedValue("experiment") && this->mParser.getValue<int>("worker") < 0)
+  {
+    int failed = this->runBatch();
+    this->mExitCode = std::min(failed, 255);
+    emit quit();
+    return;
+  }
+
   // load default plugins
   if (!this->mParser.hasParsedFlag("no-plugins"))
   {
@@ -79,6 +117,13 @@ void cedar::processingCL::MainApplication::exec()
     this->loadArchitecture(this->mParser.getValue<std::string>("load"));
   }
 
+  if (this->mParser.hasParsedValue("experiment"))
+  {
+    this->mExitCode = this->runWorker();
+    emit quit();
+    return;
+  }
+
   if (this->mParser.hasParsedFlag("run"))
   {
     this->startTriggers();
@@ -143,5 +188,204 @@ void cedar::processingCL::MainApplication::loadArchitecture(const std::string& p
   QTime timer;
   timer.start();
   this->mArchitecture->readJson(path);
+
+  // apply the simulation settings stored in the architecture, as the ide does when loading it
+  this->mArchitecture->applyTimeFactor();
+  this->mArchitecture->applyLoopMode();
+  this->mArchitecture->applySimulationTimeStep();
+  this->mArchitecture->applyDefaultCPUStep();
+  this->mArchitecture->applyMinimumComputationTime();
+  this->mArchitecture->applyMultiRate();
   std::cout << "Loading done, it took " << timer.elapsed() << " ms." << std::endl;
 }
+
+QString cedar::processingCL::MainApplication::getResultsDirectory() const
+{
+  return QDir(QString::fromStdString(this->mParser.getValue<std::string>("results"))).absolutePath();
+}
+
+int cedar::processingCL::MainApplication::runBatch()
+{
+  if (!this->mParser.hasParsedValue("load"))
+  {
+    std::cout << "Cannot run experiment: no architecture given (use --load)." << std::endl;
+    return 1;
+  }
+
+  int workers = std::max(1, this->mParser.getValue<int>("workers"));
+  QString results = this->getResultsDirectory();
+  QDir results_dir(results);
+  results_dir.mkpath("logs");
+
+  // the workers get absolute paths so that they do not depend on the working directory
+  QStringList common_arguments;
+  common_arguments
+    << "--load" << QFileInfo(QString::fromStdString(this->mParser.getValue<std::string>("load"))).absoluteFilePath()
+    << "--experiment" << QFileInfo(QString::fromStdString(this->mParser.getValue<std::string>("experiment"))).absoluteFilePath()
+    << "--workers" << QString::number(workers)
+    << "--results" << results
+    << "--seed" << QString::number(this->mParser.getValue<unsigned int>("seed"));
+  if (this->mParser.hasParsedFlag("no-plugins"))
+  {
+    common_arguments << "--no-plugins";
+  }
+
+  std::cout << "Running experiment with " << workers << " worker processes, results go to \""
+            << results.toStdString() << "\"." << std::endl;
+
+  QTime timer;
+  timer.start();
+  std::vector<QProcess*> processes;
+  for (int worker = 0; worker < workers; ++worker)
+  {
+    auto process = new QProcess();
+    QString log = results_dir.filePath("logs/worker_" + QString::number(worker));
+    process->setStandardOutputFile(log + ".out");
+    process->setStandardErrorFile(log + ".err");
+    process->start(QCoreApplication::applicationFilePath(), QStringList(common_arguments) << "--worker" << QString::number(worker));
+    processes.push_back(process);
+  }
+
+  int failed = 0;
+  for (size_t worker = 0; worker < processes.size(); ++worker)
+  {
+    QProcess* process = processes.at(worker);
+    process->waitForFinished(-1);
+    if (process->exitStatus() != QProcess::NormalExit || process->exitCode() != 0)
+    {
+      std::cout << "Worker " << worker << " failed, see the logs in \"" << results.toStdString() << "/logs\"." << std::endl;
+      ++failed;
+    }
+    delete process;
+  }
+
+  std::cout << "Experiment done, it took " << timer.elapsed() << " ms; " << failed << " of " << workers
+            << " workers failed." << std::endl;
+  return failed;
+}
+
+int cedar::processingCL::MainApplication::runWorker()
+{
+  if (!this->mArchitecture)
+  {
+    std::cout << "Cannot run experiment: no architecture loaded." << std::endl;
+    return 1;
+  }
+
+  int worker = this->mParser.getValue<int>("worker");
+  int workers = std::max(1, this->mParser.getValue<int>("workers"));
+  if (worker < 0)
+  {
+    worker = 0;
+    workers = 1;
+  }
+  QString results = this->getResultsDirectory();
+  QDir results_dir(results);
+  QString worker_name = "worker_" + QString::number(worker);
+
+  this->mExperiment = boost::make_shared<cedar::proc::experiment::Experiment>(this->mArchitecture);
+  this->mExperiment->readJson(this->mParser.getValue<std::string>("experiment"));
+
+  // this worker runs a contiguous block of the trials
+  unsigned int trials = this->mExperiment->getTrialCount();
+  this->mFirstTrial = trials * worker / workers;
+  unsigned int end_trial = trials * (worker + 1) / workers;
+  this->mSeed = this->mParser.getValue<unsigned int>("seed");
+  if (end_trial == this->mFirstTrial)
+  {
+    std::cout << "No trials left for " << worker_name.toStdString() << "." << std::endl;
+    return 0;
+  }
+
+  // the experiment log is written next to the experiment file
+  results_dir.mkpath("logs");
+  this->mExperiment->setFileName(results_dir.filePath("logs/" + worker_name + ".json").toStdString());
+  this->mExperiment->setTrialCount(end_trial - this->mFirstTrial);
+  this->mExperiment->setRepeating(false);
+
+  this->mStoreActions.clear();
+  for (auto sequence : this->mExperiment->getActionSequences())
+  {
+    for (auto action : sequence->getActions())
+    {
+      if (auto store = boost::dynamic_pointer_cast<cedar::proc::experiment::action::StoreSerializableData>(action))
+      {
+        QString file_name = QFileInfo(QString::fromStdString(store->getOutputFile())).fileName();
+        this->mStoreActions.push_back(std::make_pair(store, file_name));
+      }
+    }
+  }
+
+  std::vector<std::string> errors, warnings;
+  if (!this->mExperiment->checkValidity(errors, warnings))
+  {
+    for (const auto& error : errors)
+    {
+      std::cout << "Error: " << error << std::endl;
+    }
+    return 1;
+  }
+
+  // the slot has to run in the experiment's thread, before the trial's triggers are started
+  QObject::connect
+  (
+    this->mExperiment.get(),
+    SIGNAL(trialNumberChanged(int)),
+    this,
+    SLOT(trialStarted(int)),
+    Qt::DirectConnection
+  );
+
+  // recordings go to the results directory; only this process is redirected, the user's settings stay untouched
+  results_dir.mkpath("recordings/" + worker_name);
+  cedar::aux::RecorderSingleton::getInstance()->setOutputBaseDirectory
+  (
+    results_dir.filePath("recordings/" + worker_name).toStdString()
+  );
+
+  std::cout << "Running trials " << this->mFirstTrial << " to " << (end_trial - 1) << "." << std::endl;
+  QTime timer;
+  timer.start();
+
+  // the experiment stops itself from its own thread; wait for it without blocking queued events
+  QEventLoop wait_loop;
+  QObject::connect
+  (
+    this->mExperiment.get(),
+    &cedar::proc::experiment::Experiment::experimentRunning,
+    &wait_loop,
+    [&wait_loop](bool running)
+    {
+      if (!running)
+      {
+        wait_loop.quit();
+      }
+    }
+  );
+  this->mExperiment->startExperiment();
+  if (this->mExperiment->isRunning())
+  {
+    wait_loop.exec();
+  }
+  std::cout << "Trials done, they took " << timer.elapsed() << " ms." << std::endl;
+
+  cedar::aux::RecorderSingleton::getInstance()->setOutputBaseDirectory(std::string());
+  return 0;
+}
+
+void cedar::processingCL::MainApplication::trialStarted(int trial)
+{
+  unsigned int experiment_trial = this->mFirstTrial + static_cast<unsigned int>(trial);
+
+  QDir results_dir(this->getResultsDirectory());
+  QString trial_dir = "trial_" + QString::number(experiment_trial);
+  results_dir.mkpath(trial_dir);
+  for (const auto& store_name_pair : this->mStoreActions)
+  {
+    store_name_pair.first->setOutputFile(results_dir.filePath(trial_dir + "/" + store_name_pair.second).toStdString());
+  }
+
+  unsigned int seed = this->mSeed + experiment_trial;
+  cedar::aux::GlobalClockSingleton::getInstance()->setSeed(seed);
+  std::srand(seed);
+}
@@ -45,15 +45,30 @@
 
 // FORWARD DECLARATIONS
 #include "cedar/processing/Group.fwd.h"
+#include "cedar/processing/experiment/Experiment.fwd.h"
+#include "cedar/processing/experiment/action/StoreSerializableData.fwd.h"
 
 // FORWARD DECLARATIONS
 #include "MainApplication.fwd.h"
 
 // SYSTEM INCLUDES
 #include <QObject>
+#include <QString>
+#include <vector>
+#include <utility>
 
 
 /*!@brief Main application of the processingCL.
+ *
+ *        When started with an experiment file, the application runs the experiment's trials without user interaction.
+ *        The trials are distributed to a number of worker processes that each load the architecture once and run a
+ *        contiguous block of trials. Stored serializable data, recordings and logs of all workers are collected in one
+ *        results directory:
+ *        - trial_<n>/ holds the files written by the StoreSerializableData actions of trial n,
+ *        - recordings/worker_<k>/ holds the recordings of worker k,
+ *        - logs/ holds the experiment log and the console output of each worker.
+ *
+ *        Trial n runs with the seed (seed + n), so results do not depend on the number of workers.
  */
 class cedar::processingCL::MainApplication : public QObject
 {
@@ -73,11 +88,16 @@ public:
   // public methods
   //--------------------------------------------------------------------------------------------------------------------
 public:
-  // none yet
+  //!@brief Returns the exit code of the application.
+  int getExitCode() const;
 
 public slots:
   void exec();
 
+private slots:
+  //! Redirects the stored data of a trial and seeds it; called by the experiment at the start of each trial.
+  void trialStarted(int trial);
+
 signals:
   void quit();
 
@@ -97,6 +117,15 @@ private:
 
   void startTriggers();
 
+  //! Starts the worker processes of an experiment and waits for them. Returns the number of failed workers.
+  int runBatch();
+
+  //! Runs this process' share of the trials of an experiment. Returns 0 on success.
+  int runWorker();
+
+  //! Returns the results directory as an absolute path.
+  QString getResultsDirectory() const;
+
   //--------------------------------------------------------------------------------------------------------------------
   // members
   //--------------------------------------------------------------------------------------------------------------------
@@ -107,6 +136,21 @@ private:
 
   cedar::proc::GroupPtr mArchitecture;
 
+  //! The experiment run by this worker process.
+  cedar::proc::experiment::ExperimentPtr mExperiment;
+
+  //! Store actions of the experiment and the file names they originally wrote to.
+  std::vector<std::pair<cedar::proc::experiment::action::StoreSerializableDataPtr, QString> > mStoreActions;
+
+  //! Index of the first trial run by this worker.
+  unsigned int mFirstTrial;
+
+  //! Seed of the first trial of the experiment.
+  unsigned int mSeed;
+
+  //! The exit code of the application.
+  int mExitCode;
+
   //--------------------------------------------------------------------------------------------------------------------
   // parameters
   //--------------------------------------------------------------------------------------------------------------------
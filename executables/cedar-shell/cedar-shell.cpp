@@ -56,5 +56,6 @@ int main(int argc, char** argv)
 
   QTimer::singleShot(0, application.get(), SLOT(exec()));
 
-  return app.exec();
+  int result = app.exec();
+  return result != 0 ? result : application->getExitCode();
 }
@@ -37,6 +37,9 @@
 
 // LOCAL INCLUDES
 #include "cedar/auxiliaries/LoopedThread.h"
+#include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/Group.h"
+#include "cedar/processing/Step.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 #include "cedar/testingUtilities/measurementFunctions.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
@@ -46,6 +49,8 @@
 // SYSTEM INCLUDES
 #include <QReadWriteLock>
 #include <QCoreApplication>
+#include <chrono>
+#include <string>
 
 
 // global variables
@@ -102,44 +107,62 @@ private:
 
 std::list< MyThread* > threads;
 
-void create_test()
+// a step that does nothing, so that triggering it only costs the dispatch overhead
+class EmptyStep : public cedar::proc::Step
 {
-  unsigned int i= 0;
-  for (; i <= MAX_THREADS; i++ )
+public:
+  EmptyStep()
+  :
+  cedar::proc::Step(true)
   {
-    threads.push_back( new MyThread() );
-    threads.back()->setStepSize(step_size);
   }
-}
 
-void start_test()
-{
-  auto it = threads.begin();
-
-  for (; it != threads.end(); it++ )
+private:
+  void compute(const cedar::proc::Arguments&)
   {
-    (*it)->start();
   }
-}
+};
 
-void stop_test()
-{
-  auto it = threads.begin();
+const unsigned int NUM_DISPATCH_STEPS = 100;
+const unsigned int NUM_DISPATCH_TICKS = 10000;
 
-  for (; it != threads.end(); it++ )
+// measures the time it takes a looped trigger to dispatch a tick to each of its steps
+void measure_dispatch_overhead(cedar::proc::LoopedTriggerPtr trigger, const std::string& id)
+{
+  const cedar::unit::Time tick(1.0 * cedar::unit::milli * cedar::unit::seconds);
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < NUM_DISPATCH_TICKS; ++i)
   {
-    (*it)->stop();
+    trigger->step(tick);
   }
+  auto end = std::chrono::steady_clock::now();
+
+  double per_step = std::chrono::duration<double>(end - start).count()
+                    / static_cast<double>(NUM_DISPATCH_TICKS * NUM_DISPATCH_STEPS);
+  cedar::test::write_measurement(id, per_step);
 }
 
-void delete_test()
+void dispatch_test()
 {
-  auto it = threads.begin();
-
-  for (; it != threads.end(); it++ )
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  cedar::proc::LoopedTriggerPtr trigger(new cedar::proc::LoopedTrigger());
+  group->add(trigger, "trigger");
+  for (unsigned int i = 0; i < NUM_DISPATCH_STEPS; ++i)
   {
-    delete (*it);
+    cedar::proc::StepPtr step(new EmptyStep());
+    group->add(step, "step " + std::to_string(i));
+    group->connectTrigger(trigger, step);
   }
+
+  bool measurements_enabled = cedar::proc::Step::getTimeMeasurementsEnabled();
+
+  cedar::proc::Step::setTimeMeasurementsEnabled(true);
+  measure_dispatch_overhead(trigger, "per-step overhead (time measurements)");
+
+  cedar::proc::Step::setTimeMeasurementsEnabled(false);
+  measure_dispatch_overhead(trigger, "per-step overhead (no time measurements)");
+
+  cedar::proc::Step::setTimeMeasurementsEnabled(measurements_enabled);
 }
 
 void run_test()
@@ -179,6 +202,8 @@ void run_test()
   double deviation = ((total_real_step_all / one_second) / num_steps_all7) - (step_size / one_second);
   cedar::test::write_measurement("rel deviatiation", deviation);
   cedar::test::test_time("delete threads", delete_test);
+
+  cedar::test::test_time("step dispatch", dispatch_test);
 }
 
 int main(int argc, char* argv[])
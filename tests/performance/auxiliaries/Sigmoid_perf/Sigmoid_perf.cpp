@@ -38,6 +38,10 @@
 // LOCAL INCLUDES
 #include "cedar/testingUtilities/measurementFunctions.h"
 #include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/ExpSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/HeavisideSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/SemiLinearTransferFunction.h"
+#include "cedar/auxiliaries/math/transferFunctions/LinearTransferFunction.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/configuration.h"
 
@@ -46,11 +50,26 @@
 #ifndef Q_MOC_RUN
   #include <boost/date_time/posix_time/posix_time.hpp>
 #endif
+#include <vector>
+#include <string>
 
 struct TestSet
 {
-  TestSet(unsigned dim, unsigned int imsize, unsigned int reps)
+  TestSet
+  (
+    const std::string& functionName,
+    cedar::aux::math::TransferFunctionPtr function,
+    int type,
+    bool inPlace,
+    unsigned dim,
+    unsigned int imsize,
+    unsigned int reps
+  )
   :
+  mFunctionName(functionName),
+  mFunction(function),
+  mType(type),
+  mInPlace(inPlace),
   mDimensionality(dim),
   mMatrixSize(imsize),
   mReps(reps),
@@ -60,12 +79,19 @@ struct TestSet
 
   std::string id() const
   {
-    std::string case_id = "transfer - dimensionality = " + cedar::aux::toString(this->mDimensionality)
+    std::string case_id = "transfer " + this->mFunctionName
+                          + (this->mType == CV_32F ? " (float" : " (double")
+                          + (this->mInPlace ? ", in-place)" : ", allocating)")
+                          + " - dimensionality = " + cedar::aux::toString(this->mDimensionality)
                           + ", matrix size = " + cedar::aux::toString(this->mMatrixSize)
                           + ", reps = " + cedar::aux::toString(this->mReps);
     return case_id;
   }
 
+  std::string mFunctionName;
+  cedar::aux::math::TransferFunctionPtr mFunction;
+  int mType;
+  bool mInPlace;
   unsigned int mDimensionality;
   unsigned int mMatrixSize;
   unsigned int mReps;
@@ -79,35 +105,69 @@ void test_sigmoid(TestSet& test)
 
   std::string case_id = test.id();
 
-  cedar::aux::math::TransferFunctionPtr sigmoid(new cedar::aux::math::AbsSigmoid());
-
   std::vector<int> sizes;
   for (unsigned int dim = 0; dim < test.mDimensionality; ++dim)
   {
     sizes.push_back(static_cast<int>(test.mMatrixSize));
   }
-  cv::Mat matrix(static_cast<int>(test.mDimensionality), &(sizes.front()), CV_32F);
-  matrix = 1.0;
+  cv::Mat matrix(static_cast<int>(test.mDimensionality), &(sizes.front()), test.mType);
+  cv::randu(matrix, cv::Scalar(-1.0), cv::Scalar(1.0));
+  cv::Mat result;
 
   ptime start = microsec_clock::local_time();
   for (unsigned int i = 0; i < test.mReps; ++i)
   {
-    // volatile so this doesn't get optimized away
-    volatile cv::Mat test = sigmoid->compute<float>(matrix);
+    if (test.mInPlace)
+    {
+      test.mFunction->compute(matrix, result);
+    }
+    else
+    {
+      result = test.mFunction->compute(matrix);
+    }
   }
   ptime end = microsec_clock::local_time();
+  // use the result so this doesn't get optimized away
+  volatile double sum = cv::sum(result)[0];
+  (void)sum;
   test.mDuration = static_cast<double>((end - start).total_milliseconds()) / 1000.0;
   cedar::test::write_measurement(case_id, test.mDuration);
 }
 
+void add_tests(std::vector<TestSet>& tests, const std::string& name, cedar::aux::math::TransferFunctionPtr function)
+{
+  int types[] = {CV_32F, CV_64F};
+  for (int type : types)
+  {
+    for (bool in_place : {false, true})
+    {
+      tests.push_back(TestSet(name, function, type, in_place, 2, 20, 100));
+      tests.push_back(TestSet(name, function, type, in_place, 2, 100, 10));
+      tests.push_back(TestSet(name, function, type, in_place, 3, 20, 100));
+      tests.push_back(TestSet(name, function, type, in_place, 3, 100, 10));
+    }
+  }
+}
+
 int main(int, char**)
 {
   std::vector<TestSet> test;
-//  test.push_back(TestSet(1, 100, 100));
-  test.push_back(TestSet(2, 20, 100));
-  test.push_back(TestSet(2, 100, 10));
-  test.push_back(TestSet(3, 20, 100));
-  test.push_back(TestSet(3, 100, 10));
+  add_tests(test, "AbsSigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::AbsSigmoid()));
+  add_tests(test, "ExpSigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::ExpSigmoid()));
+  add_tests(test, "HeavisideSigmoid", cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::HeavisideSigmoid()));
+  add_tests
+  (
+    test,
+    "SemiLinearTransferFunction",
+    cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::SemiLinearTransferFunction())
+  );
+  add_tests
+  (
+    test,
+    "LinearTransferFunction",
+    cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::LinearTransferFunction())
+  );
+
   // measure
   for (size_t i = 0; i < test.size(); ++i)
   {
@@ -51,8 +51,17 @@
 
 struct TestSet
 {
-  TestSet(double sigma, double limit, unsigned int imsize, unsigned int reps, cedar::aux::conv::BorderType::Id borderType)
+  TestSet
+  (
+    double sigma,
+    double limit,
+    unsigned int imsize,
+    unsigned int reps,
+    cedar::aux::conv::BorderType::Id borderType,
+    unsigned int dimensionality = 1
+  )
   :
+  mDimensionality(dimensionality),
   mSigma(sigma),
   mLimit(limit),
   mImsize(imsize),
@@ -64,7 +73,8 @@ struct TestSet
 
   std::string id() const
   {
-    std::string case_id = "conv1d - sigma = " + cedar::aux::toString(this->mSigma)
+    std::string case_id = "conv" + cedar::aux::toString(this->mDimensionality) + "d"
+                          + " - sigma = " + cedar::aux::toString(this->mSigma)
                           + ", limit = " + cedar::aux::toString(this->mLimit)
                           + ", imsize = " + cedar::aux::toString(this->mImsize)
                           + ", reps = " + cedar::aux::toString(this->mReps)
@@ -72,6 +82,7 @@ struct TestSet
     return case_id;
   }
 
+  unsigned int mDimensionality;
   double mSigma;
   double mLimit;
   unsigned int mImsize;
@@ -80,7 +91,7 @@ struct TestSet
   double mDuration;
 };
 
-void test_convolution_time_1d(TestSet& test)
+void test_convolution_time(TestSet& test)
 {
   using boost::posix_time::ptime;
   using boost::posix_time::microsec_clock;
@@ -88,13 +99,26 @@ void test_convolution_time_1d(TestSet& test)
   std::string case_id = test.id();
 
   cedar::aux::conv::ConvolutionPtr conv(new cedar::aux::conv::Convolution());
+  conv->setEngine(cedar::aux::conv::OpenCVPtr(new cedar::aux::conv::OpenCV()));
   conv->setBorderType(test.mBorderType);
 
-  cedar::aux::kernel::GaussPtr gauss (new cedar::aux::kernel::Gauss(1, 1.0, test.mSigma, 0.0, test.mLimit));
+  cedar::aux::kernel::GaussPtr gauss
+  (
+    new cedar::aux::kernel::Gauss(test.mDimensionality, 1.0, test.mSigma, 0.0, test.mLimit)
+  );
 
   conv->getKernelList()->append(gauss);
 
-  cv::Mat image = cv::Mat::ones(test.mImsize, 1, CV_32F);
+  cv::Mat image;
+  if (test.mDimensionality == 1)
+  {
+    image = cv::Mat::ones(test.mImsize, 1, CV_32F);
+  }
+  else
+  {
+    std::vector<int> sizes(test.mDimensionality, static_cast<int>(test.mImsize));
+    image = cv::Mat(static_cast<int>(sizes.size()), sizes.data(), CV_32F, cv::Scalar(1.0));
+  }
   ptime start = microsec_clock::local_time();
   for (unsigned int i = 0; i < test.mReps; ++i)
   {
@@ -120,10 +144,18 @@ int main(int, char**)
   test.push_back(TestSet(1000.0, 10.0, 100, 1000, cedar::aux::conv::BorderType::Cyclic));
   test.push_back(TestSet(10000.0, 10.0, 100, 100, cedar::aux::conv::BorderType::Cyclic));
 
+  // n-dimensional separable convolution
+  test.push_back(TestSet(3.0, 5.0, 50, 100, cedar::aux::conv::BorderType::Zero, 3));
+  test.push_back(TestSet(3.0, 5.0, 50, 100, cedar::aux::conv::BorderType::Replicate, 3));
+  test.push_back(TestSet(3.0, 5.0, 50, 100, cedar::aux::conv::BorderType::Reflect, 3));
+  test.push_back(TestSet(3.0, 5.0, 50, 100, cedar::aux::conv::BorderType::Cyclic, 3));
+  test.push_back(TestSet(10.0, 5.0, 100, 10, cedar::aux::conv::BorderType::Cyclic, 3));
+  test.push_back(TestSet(2.0, 5.0, 20, 100, cedar::aux::conv::BorderType::Zero, 4));
+
   // measure
   for (size_t i = 0; i < test.size(); ++i)
   {
-    test_convolution_time_1d(test[i]);
+    test_convolution_time(test[i]);
   }
 
   // summarize results
@@ -39,6 +39,7 @@
 #include "cedar/configuration.h"
 #include "cedar/processing/sources/GaussInput.h"
 #include "cedar/processing/steps/Projection.h"
+#include "cedar/processing/steps/Sum.h"
 #include "cedar/processing/Step.h"
 #include "cedar/processing/Group.h"
 #include "cedar/testingUtilities/measurementFunctions.h"
@@ -57,7 +58,16 @@ void event_loop()
   }
 }
 
-void measure(unsigned int sourceDim, unsigned int targetDim, unsigned int repetitions)
+void measure
+(
+  unsigned int sourceDim,
+  unsigned int targetDim,
+  unsigned int repetitions,
+  unsigned int sourceSize = 90,
+  cedar::aux::EnumId compressionType = cedar::proc::steps::Projection::CompressionType::SUM,
+  bool broadcastView = false,
+  bool addSum = false
+)
 {
   using cedar::proc::Group;
   using cedar::proc::GroupPtr;
@@ -78,11 +88,13 @@ void measure(unsigned int sourceDim, unsigned int targetDim, unsigned int repeti
     source->setDimensionality(sourceDim);
     for (unsigned int i = 0; i < sourceDim; ++i)
     {
-      source->setSize(i, 90);
+      source->setSize(i, sourceSize);
     }
   }
 
   projection->setOutputDimensionality(targetDim);
+  projection->getParameter<cedar::aux::EnumParameter>("compression type")->setValue(compressionType);
+  projection->setBroadcastView(broadcastView);
 
   auto mapping_parameter = projection->getParameter<ProjectionMappingParameter>("dimension mapping");
 
@@ -107,12 +119,35 @@ void measure(unsigned int sourceDim, unsigned int targetDim, unsigned int repeti
     }
   }
 
+  // a sum behind the projection shows what consumers pay for reading (or not reading) the expanded output
+  if (addSum)
+  {
+    network->add(cedar::proc::steps::SumPtr(new cedar::proc::steps::Sum()), "sum");
+    network->connectSlots("projection.output", "sum.terms");
+  }
+
   event_loop();
 
   std::string id;
   id += cedar::aux::toString(sourceDim);
   id += " -> ";
   id += cedar::aux::toString(targetDim);
+  if (sourceSize != 90)
+  {
+    id += " (size " + cedar::aux::toString(sourceSize) + ")";
+  }
+  if (targetDim < sourceDim && targetDim > 0)
+  {
+    id += " " + Projection::CompressionType::type().get(compressionType).prettyString();
+  }
+  if (broadcastView)
+  {
+    id += " as broadcast view";
+  }
+  if (addSum)
+  {
+    id += " + sum";
+  }
   cedar::test::test_time
   (
     id,
@@ -132,6 +167,8 @@ void measure(unsigned int sourceDim, unsigned int targetDim, unsigned int repeti
 
 int main(int, char**)
 {
+  using cedar::proc::steps::Projection;
+
   unsigned int max_dim = 3;
   for (unsigned int source = 0; source <= max_dim; ++source)
   {
@@ -147,5 +184,16 @@ int main(int, char**)
       measure(source, target, repetitions);
     }
   }
+
+  // expanding 1D into large 3D fields, with a consumer that either reads the full output or the broadcast view
+  measure(1, 3, 10, 100);
+  measure(1, 3, 10, 100, Projection::CompressionType::SUM, false, true);
+  measure(1, 3, 10, 100, Projection::CompressionType::SUM, true, true);
+
+  // compressing several dimensions at once
+  measure(3, 1, 10, 100, Projection::CompressionType::SUM);
+  measure(3, 1, 10, 100, Projection::CompressionType::MAXIMUM);
+  measure(4, 2, 10, 40, Projection::CompressionType::SUM);
+  measure(4, 2, 10, 40, Projection::CompressionType::MAXIMUM);
   return 0; // no errors -- this is a performance test.
 }
@@ -0,0 +1,160 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Unit test for cedar::aux::BinaryMatFrame.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/BinaryMatFrame.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+//! Packs the matrix, copies header and payload as if they were sent and checks that the received matrix is equal.
+int roundTrip(const std::string& name, const cv::Mat& matrix, bool compress, cv::Mat& target)
+{
+  std::cout << "Sending " << name << (compress ? " (compressed)" : "") << ": ";
+
+  cedar::aux::BinaryMatFrame sender;
+  sender.pack(matrix, 42, compress);
+
+  cedar::aux::BinaryMatFrame::Header header;
+  std::memcpy(&header, &sender.getHeader(), sizeof(header));
+  if (!cedar::aux::BinaryMatFrame::isValid(header))
+  {
+    std::cout << "ERROR, header is not valid." << std::endl;
+    return 1;
+  }
+
+  if (header.mSequenceNumber != 42)
+  {
+    std::cout << "ERROR, sequence number is " << header.mSequenceNumber << std::endl;
+    return 1;
+  }
+
+  if (compress && cedar::aux::BinaryMatFrame::isCompressionAvailable() && sender.getPayloadSize() >= header.mRawSize)
+  {
+    std::cout << "ERROR, payload was not compressed." << std::endl;
+    return 1;
+  }
+
+  cedar::aux::BinaryMatFrame receiver;
+  char* destination = receiver.preparePayload(header, target);
+  if (sender.getPayloadSize() > 0)
+  {
+    std::memcpy(destination, sender.getPayload(), sender.getPayloadSize());
+  }
+  if (!receiver.unpack(header, target))
+  {
+    std::cout << "ERROR, could not unpack the payload." << std::endl;
+    return 1;
+  }
+
+  if (target.type() != matrix.type() || target.dims != matrix.dims || target.total() != matrix.total())
+  {
+    std::cout << "ERROR, received matrix has the wrong type or size." << std::endl;
+    return 1;
+  }
+
+  if (!matrix.empty() && cv::norm(matrix, target, cv::NORM_INF) != 0.0)
+  {
+    std::cout << "ERROR, received matrix differs." << std::endl;
+    return 1;
+  }
+
+  std::cout << "ok" << std::endl;
+  return 0;
+}
+
+int main()
+{
+  int errors = 0;
+
+  cv::Mat field(50, 70, CV_32F);
+  cv::randu(field, cv::Scalar(-1.0), cv::Scalar(1.0));
+  cv::Mat target;
+  errors += roundTrip("2d float matrix", field, false, target);
+
+  {
+    // a matrix of the same size must be received into the memory of the previous one
+    const uchar* data = target.data;
+    cv::Mat scaled_field = field * 2.0;
+    errors += roundTrip("2d float matrix of the same size", scaled_field, false, target);
+    if (target.data != data)
+    {
+      std::cout << "ERROR, the target was reallocated." << std::endl;
+      ++errors;
+    }
+  }
+
+  int sizes[3] = {10, 12, 7};
+  cv::Mat volume(3, sizes, CV_64F);
+  cv::randu(volume, cv::Scalar(0.0), cv::Scalar(1.0));
+  cv::Mat volume_target;
+  errors += roundTrip("3d double matrix", volume, false, volume_target);
+
+  cv::Mat region = field(cv::Rect(5, 5, 20, 10));
+  cv::Mat region_target;
+  errors += roundTrip("non-continuous matrix", region, false, region_target);
+
+  cv::Mat sparse = cv::Mat::zeros(100, 100, CV_32F);
+  sparse.at<float>(10, 20) = 1.0f;
+  cv::Mat sparse_target;
+  errors += roundTrip("mostly empty matrix", sparse, true, sparse_target);
+
+  cv::Mat empty_target;
+  errors += roundTrip("empty matrix", cv::Mat(), false, empty_target);
+
+  std::cout << "Rejecting a corrupted header: ";
+  {
+    cedar::aux::BinaryMatFrame sender;
+    sender.pack(field, 1);
+    cedar::aux::BinaryMatFrame::Header header = sender.getHeader();
+    header.mSizes[0] += 1;
+    if (cedar::aux::BinaryMatFrame::isValid(header))
+    {
+      std::cout << "ERROR, corrupted header was accepted." << std::endl;
+      ++errors;
+    }
+    else
+    {
+      std::cout << "ok" << std::endl;
+    }
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -0,0 +1,167 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Unit test for the binary recording format.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/BinaryRecordingWriter.h"
+#include "cedar/auxiliaries/BinaryRecordingReader.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <boost/filesystem.hpp>
+#include <opencv2/opencv.hpp>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main()
+{
+  int errors = 0;
+
+  std::string path = "unit_test_binary_recording.bin";
+  std::string csv_path = "unit_test_binary_recording.csv";
+  boost::filesystem::remove(path);
+  boost::filesystem::remove(csv_path);
+
+  // write records with two different shapes and a small chunk size so that the file consists of several chunks
+  std::vector<cv::Mat> written;
+  std::vector<double> times;
+  {
+    cedar::aux::BinaryRecordingWriter writer(path, 256);
+    for (int i = 0; i < 20; ++i)
+    {
+      cv::Mat matrix = (i < 12) ? cv::Mat(5, 7, CV_32F) : cv::Mat(3, 4, CV_64F);
+      cv::randu(matrix, cv::Scalar(-1.0), cv::Scalar(1.0));
+      double time = 0.001 * i;
+      writer.write(cedar::unit::Time(time * cedar::unit::seconds), matrix);
+      written.push_back(matrix);
+      times.push_back(time);
+    }
+  }
+
+  std::cout << "Reading the records back." << std::endl;
+  {
+    cedar::aux::BinaryRecordingReader reader(path);
+    cedar::unit::Time time;
+    cv::Mat matrix;
+    size_t count = 0;
+    while (reader.readNext(time, matrix))
+    {
+      if (count >= written.size())
+      {
+        break;
+      }
+      if (matrix.type() != written[count].type() || cv::norm(matrix, written[count], cv::NORM_INF) != 0.0)
+      {
+        std::cout << "ERROR: record " << count << " differs from the written matrix." << std::endl;
+        ++errors;
+      }
+      if (std::abs(time / cedar::unit::seconds - times[count]) > 1e-12)
+      {
+        std::cout << "ERROR: time of record " << count << " differs from the written one." << std::endl;
+        ++errors;
+      }
+      ++count;
+    }
+
+    if (count != written.size() || reader.isTruncated())
+    {
+      std::cout << "ERROR: read " << count << " of " << written.size() << " records." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Converting to CSV." << std::endl;
+  cedar::aux::BinaryRecordingReader::convertToCSV(path, csv_path);
+  {
+    std::ifstream csv(csv_path);
+    std::string line;
+    size_t lines = 0;
+    while (std::getline(csv, line))
+    {
+      ++lines;
+    }
+    // one header line and one line per record
+    if (lines != written.size() + 1)
+    {
+      std::cout << "ERROR: CSV file has " << lines << " lines, expected " << written.size() + 1 << "." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Reading a truncated file." << std::endl;
+  {
+    boost::filesystem::resize_file(path, boost::filesystem::file_size(path) - 10);
+    cedar::aux::BinaryRecordingReader reader(path);
+    cedar::unit::Time time;
+    cv::Mat matrix;
+    size_t count = 0;
+    while (reader.readNext(time, matrix))
+    {
+      ++count;
+    }
+    if (!reader.isTruncated() || count != written.size() - 1)
+    {
+      std::cout << "ERROR: truncated file was not detected." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Reading a file that is not a recording." << std::endl;
+  {
+    bool thrown = false;
+    try
+    {
+      cedar::aux::BinaryRecordingReader reader(csv_path);
+    }
+    catch (const cedar::aux::ParseException&)
+    {
+      thrown = true;
+    }
+    if (!thrown)
+    {
+      std::cout << "ERROR: reading a CSV file as binary recording did not throw." << std::endl;
+      ++errors;
+    }
+  }
+
+  boost::filesystem::remove(path);
+  boost::filesystem::remove(csv_path);
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
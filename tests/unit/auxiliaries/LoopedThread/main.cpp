@@ -175,6 +175,54 @@ int testConfiguration
 
 
 
+int testPreciseTiming()
+{
+  int errors = 0;
+
+  std::cout << "Running a thread with precise timing ..." << std::endl;
+  CountingThread thread
+  (
+    cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second),
+    cedar::unit::Time(0.01 * cedar::unit::milli * cedar::unit::second),
+    cedar::unit::Time(1.0 * cedar::unit::milli * cedar::unit::second),
+    cedar::aux::LoopMode::RealDT
+  );
+  thread.setPreciseTiming(true);
+  thread.setSpinTime(cedar::unit::Time(0.05 * cedar::unit::milli * cedar::unit::second));
+
+  thread.start();
+  cedar::aux::sleep(cedar::unit::Time(0.5 * cedar::unit::second));
+  thread.stop();
+
+  if (thread.mCounter < 2)
+  {
+    std::cout << "ERROR: the thread didn't iterate often enough, only "
+              << boost::lexical_cast<std::string>(thread.mCounter)
+              << " times." << std::endl;
+    ++errors;
+  }
+
+  std::vector<unsigned long> histogram = thread.getWakeupLatencyHistogram();
+  unsigned long wakeups = 0;
+  for (auto count : histogram)
+  {
+    wakeups += count;
+  }
+  std::cout << "maximum wakeup latency: " << thread.getMaximumWakeupLatency() << std::endl;
+
+#ifdef CEDAR_OS_LINUX
+  // every step is preceded by a recorded wakeup
+  if (wakeups < thread.mCounter)
+  {
+    std::cout << "ERROR: the latency histogram contains only " << wakeups << " wakeups for "
+              << thread.mCounter << " steps." << std::endl;
+    ++errors;
+  }
+#endif // CEDAR_OS_LINUX
+
+  return errors;
+}
+
 void runTests()
 {
   MyTestThread thread(cedar::unit::Time(100.0 * cedar::unit::milli * cedar::unit::seconds));
@@ -241,6 +289,8 @@ void runTests()
               cedar::aux::LoopMode::Fixed
             );
 
+  errors += testPreciseTiming();
+
   std::cout << "Test finished, there were " << errors << " error(s)." << std::endl;
 }
 
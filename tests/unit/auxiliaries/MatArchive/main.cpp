@@ -0,0 +1,154 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests writing and mapping binary matrix archives.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/MatArchive.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+int main()
+{
+  int errors = 0;
+  std::string path = "unit_test_mat_archive.bin";
+
+  std::map<std::string, cv::Mat> matrices;
+  matrices["float 2d"] = cv::Mat(50, 70, CV_32F);
+  cv::randu(matrices["float 2d"], cv::Scalar(-1.0), cv::Scalar(1.0));
+  matrices["double column"] = cv::Mat(13, 1, CV_64F);
+  cv::randu(matrices["double column"], cv::Scalar(-1.0), cv::Scalar(1.0));
+  int sizes_3d[3] = {7, 9, 11};
+  matrices["float 3d"] = cv::Mat(3, sizes_3d, CV_32F);
+  cv::randu(matrices["float 3d"], cv::Scalar(-1.0), cv::Scalar(1.0));
+  cv::Mat image(20, 30, CV_8UC3);
+  cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(255));
+  matrices["non-continuous"] = image(cv::Rect(3, 4, 10, 5));
+  matrices["empty"] = cv::Mat();
+
+  std::cout << "Writing an archive." << std::endl;
+  {
+    cedar::aux::MatArchive archive;
+    for (const auto& name_matrix_pair : matrices)
+    {
+      archive.add(name_matrix_pair.first, name_matrix_pair.second);
+    }
+    archive.write(path);
+  }
+
+  std::cout << "Reading the archive." << std::endl;
+  {
+    cedar::aux::MatArchive archive;
+    archive.open(path);
+
+    if (archive.listEntries().size() != matrices.size())
+    {
+      std::cout << "ERROR: archive has " << archive.listEntries().size() << " entries instead of " << matrices.size()
+                << "." << std::endl;
+      ++errors;
+    }
+
+    for (const auto& name_matrix_pair : matrices)
+    {
+      const auto& expected = name_matrix_pair.second;
+      if (!archive.hasEntry(name_matrix_pair.first))
+      {
+        std::cout << "ERROR: entry \"" << name_matrix_pair.first << "\" is missing." << std::endl;
+        ++errors;
+        continue;
+      }
+
+      cv::Mat read = archive.getEntry(name_matrix_pair.first);
+      if (expected.empty())
+      {
+        if (!read.empty())
+        {
+          std::cout << "ERROR: entry \"" << name_matrix_pair.first << "\" is not empty." << std::endl;
+          ++errors;
+        }
+        continue;
+      }
+
+      if
+      (
+        read.type() != expected.type() || read.dims != expected.dims
+        || !std::equal(expected.size.p, expected.size.p + expected.dims, read.size.p)
+        || cv::norm(expected, read, cv::NORM_INF) != 0.0
+      )
+      {
+        std::cout << "ERROR: entry \"" << name_matrix_pair.first << "\" differs from the matrix written." << std::endl;
+        ++errors;
+      }
+
+#ifdef CEDAR_OS_UNIX
+      // mappings start at page boundaries, so blobs aligned in the file are aligned in memory
+      if (reinterpret_cast<size_t>(read.data) % cedar::aux::MatArchive::BLOB_ALIGNMENT != 0)
+      {
+        std::cout << "ERROR: entry \"" << name_matrix_pair.first << "\" is not aligned." << std::endl;
+        ++errors;
+      }
+#endif // CEDAR_OS_UNIX
+    }
+  }
+
+  std::cout << "Reading a file that is not an archive." << std::endl;
+  {
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    stream << "{ \"this\": \"is json\" }";
+  }
+  try
+  {
+    cedar::aux::MatArchive archive;
+    archive.open(path);
+    std::cout << "ERROR: opening an invalid archive did not throw." << std::endl;
+    ++errors;
+  }
+  catch (const cedar::aux::ParseException&)
+  {
+    // expected
+  }
+
+  std::remove(path.c_str());
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -0,0 +1,143 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests the double buffering of cedar::aux::MatData.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/MatData.h"
+
+// SYSTEM INCLUDES
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <opencv2/opencv.hpp>
+#include <iostream>
+
+int main()
+{
+  int errors = 0;
+
+  cedar::aux::MatDataPtr data(new cedar::aux::MatData(cv::Mat::ones(3, 3, CV_32F)));
+
+  std::cout << "Checking data that is not double-buffered." << std::endl;
+  if (data->getFront())
+  {
+    std::cout << "ERROR: data that is not double-buffered returned a front buffer." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking the initial front buffer." << std::endl;
+  data->setDoubleBuffered(true);
+  cedar::aux::MatData::ConstMatPtr front = data->getFront();
+  if (!front || cv::countNonZero(*front != 1.0f) != 0)
+  {
+    std::cout << "ERROR: the front buffer does not contain the initial matrix." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Writing to the back buffer." << std::endl;
+  {
+    QWriteLocker locker(&data->getLock());
+    data->getData().setTo(2.0);
+  }
+  if (cv::countNonZero(*front != 1.0f) != 0 || cv::countNonZero(*data->getFront() != 1.0f) != 0)
+  {
+    std::cout << "ERROR: writing to the back buffer changed the front buffer." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Publishing while a reader holds the old front buffer." << std::endl;
+  {
+    QReadLocker locker(&data->getLock());
+    data->publish();
+  }
+  if (cv::countNonZero(*front != 1.0f) != 0)
+  {
+    std::cout << "ERROR: publishing changed a front buffer that was still held by a reader." << std::endl;
+    ++errors;
+  }
+  if (cv::countNonZero(*data->getFront() != 2.0f) != 0)
+  {
+    std::cout << "ERROR: the published front buffer does not contain the new matrix." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Publishing repeatedly after the reader is done." << std::endl;
+  front.reset();
+  for (int i = 3; i < 6; ++i)
+  {
+    QWriteLocker locker(&data->getLock());
+    data->getData().setTo(static_cast<double>(i));
+    data->publish();
+    locker.unlock();
+
+    cv::Mat copy;
+    data->copyFrontTo(copy);
+    if (cv::countNonZero(copy != static_cast<float>(i)) != 0)
+    {
+      std::cout << "ERROR: the front buffer does not contain the matrix published in round " << i << "." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Setting the data outside of a compute call." << std::endl;
+  data->setData(cv::Mat::zeros(4, 2, CV_32F));
+  cedar::aux::MatData::ConstMatPtr set_front = data->getFront();
+  if (set_front->rows != 4 || set_front->cols != 2 || cv::countNonZero(*set_front) != 0)
+  {
+    std::cout << "ERROR: setting the data did not publish it." << std::endl;
+    ++errors;
+  }
+
+  if (!cedar::aux::MatData::isAnyDoubleBuffered())
+  {
+    std::cout << "ERROR: double-buffered data is not counted." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Disabling double buffering." << std::endl;
+  data->setDoubleBuffered(false);
+  if (data->getFront())
+  {
+    std::cout << "ERROR: data still has a front buffer after double buffering was disabled." << std::endl;
+    ++errors;
+  }
+  if (cedar::aux::MatData::isAnyDoubleBuffered())
+  {
+    std::cout << "ERROR: data that is no longer double-buffered is still counted." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
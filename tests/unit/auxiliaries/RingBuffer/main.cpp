@@ -0,0 +1,165 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests the lock-free ring buffer.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/RingBuffer.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <iostream>
+#include <thread>
+
+int main()
+{
+  int errors = 0;
+
+  std::cout << "Filling and emptying a ring." << std::endl;
+  {
+    cedar::aux::RingBuffer<int> ring(3);
+    for (int i = 0; i < 3; ++i)
+    {
+      int* slot = ring.beginWrite();
+      if (slot == nullptr)
+      {
+        std::cout << "ERROR: ring is full after " << i << " elements." << std::endl;
+        ++errors;
+        break;
+      }
+      *slot = i;
+      ring.commitWrite();
+    }
+
+    if (ring.beginWrite() != nullptr)
+    {
+      std::cout << "ERROR: full ring returned a free slot." << std::endl;
+      ++errors;
+    }
+
+    if (ring.size() != 3)
+    {
+      std::cout << "ERROR: size is " << ring.size() << " instead of 3." << std::endl;
+      ++errors;
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+      int* slot = ring.beginRead();
+      if (slot == nullptr || *slot != i)
+      {
+        std::cout << "ERROR: wrong element read at position " << i << "." << std::endl;
+        ++errors;
+        break;
+      }
+      ring.commitRead();
+    }
+
+    if (ring.beginRead() != nullptr)
+    {
+      std::cout << "ERROR: empty ring returned a filled slot." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Reusing the memory of matrix slots." << std::endl;
+  {
+    cedar::aux::RingBuffer<cv::Mat> ring(2);
+    for (auto& slot : ring.slots())
+    {
+      slot = cv::Mat::zeros(10, 10, CV_32F);
+    }
+    const uchar* memory = ring.slots().front().data;
+
+    cv::Mat source = cv::Mat::ones(10, 10, CV_32F);
+    for (int i = 0; i < 4; ++i)
+    {
+      source.copyTo(*ring.beginWrite());
+      ring.commitWrite();
+      ring.beginRead();
+      ring.commitRead();
+    }
+
+    if (ring.slots().front().data != memory)
+    {
+      std::cout << "ERROR: copying into a slot reallocated its matrix." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Handing elements from one thread to another." << std::endl;
+  {
+    const unsigned int count = 100000;
+    cedar::aux::RingBuffer<unsigned int> ring(16);
+
+    std::thread producer([&]()
+    {
+      for (unsigned int i = 0; i < count; ++i)
+      {
+        unsigned int* slot;
+        while ((slot = ring.beginWrite()) == nullptr)
+        {
+          std::this_thread::yield();
+        }
+        *slot = i;
+        ring.commitWrite();
+      }
+    });
+
+    unsigned int out_of_order = 0;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      unsigned int* slot;
+      while ((slot = ring.beginRead()) == nullptr)
+      {
+        std::this_thread::yield();
+      }
+      if (*slot != i)
+      {
+        ++out_of_order;
+      }
+      ring.commitRead();
+    }
+    producer.join();
+
+    if (out_of_order > 0)
+    {
+      std::cout << "ERROR: " << out_of_order << " element(s) arrived out of order." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
@@ -0,0 +1,184 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests sending matrices through shared memory channels.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/SharedMemoryMatChannel.h"
+#include "cedar/auxiliaries/exceptions.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+namespace
+{
+  bool equal(const cv::Mat& expected, const cv::Mat& read)
+  {
+    if (expected.empty() || read.empty())
+    {
+      return expected.empty() && read.empty();
+    }
+    return read.type() == expected.type() && read.dims == expected.dims
+           && std::equal(expected.size.p, expected.size.p + expected.dims, read.size.p)
+           && cv::norm(expected, read, cv::NORM_INF) == 0.0;
+  }
+}
+
+int main()
+{
+  int errors = 0;
+
+  if (!cedar::aux::SharedMemoryMatChannel::isAvailable())
+  {
+    std::cout << "Shared memory is not available on this system, skipping the test." << std::endl;
+    return 0;
+  }
+
+  std::string port = "unit test shared memory channel";
+  cedar::aux::SharedMemoryMatChannel reader(port, cedar::aux::SharedMemoryMatChannel::ROLE_READER);
+  cv::Mat read;
+
+  std::cout << "Reading before there is a writer." << std::endl;
+  if (reader.read(read))
+  {
+    std::cout << "ERROR: reading without a writer succeeded." << std::endl;
+    ++errors;
+  }
+  if (reader.getLastReadStatus() != cedar::aux::SharedMemoryMatChannel::READ_NOTHING_PUBLISHED)
+  {
+    std::cout << "ERROR: reading without a writer was not reported as nothing being published." << std::endl;
+    ++errors;
+  }
+
+  {
+    cedar::aux::SharedMemoryMatChannel writer(port, cedar::aux::SharedMemoryMatChannel::ROLE_WRITER);
+
+    std::cout << "Sending a small matrix." << std::endl;
+    cv::Mat small(5, 7, CV_32F);
+    cv::randu(small, cv::Scalar(-1.0), cv::Scalar(1.0));
+    writer.write(small);
+    if (!reader.read(read) || !equal(small, read))
+    {
+      std::cout << "ERROR: the small matrix was not received correctly." << std::endl;
+      ++errors;
+    }
+    if (reader.getLastReadStatus() != cedar::aux::SharedMemoryMatChannel::READ_OK)
+    {
+      std::cout << "ERROR: a successful read was not reported as such." << std::endl;
+      ++errors;
+    }
+
+    std::cout << "Reading again without a new frame." << std::endl;
+    uchar* data = read.data;
+    if (!reader.read(read) || read.data != data || !equal(small, read))
+    {
+      std::cout << "ERROR: reading without a new frame changed the matrix." << std::endl;
+      ++errors;
+    }
+
+    std::cout << "Sending more frames than there are slots." << std::endl;
+    for (unsigned int i = 0; i < 3 * cedar::aux::SharedMemoryMatChannel::DEFAULT_NUMBER_OF_SLOTS; ++i)
+    {
+      small.setTo(static_cast<double>(i));
+      writer.write(small);
+    }
+    if (!reader.read(read) || !equal(small, read))
+    {
+      std::cout << "ERROR: the newest frame was not received correctly." << std::endl;
+      ++errors;
+    }
+
+    std::cout << "Reading new frames into the memory of earlier ones." << std::endl;
+    small.setTo(1.0);
+    writer.write(small);
+    reader.read(read);
+    uchar* first = read.data;
+    small.setTo(2.0);
+    writer.write(small);
+    reader.read(read);
+    small.setTo(3.0);
+    writer.write(small);
+    if (!reader.read(read) || !equal(small, read) || read.data != first)
+    {
+      std::cout << "ERROR: reading new frames did not reuse the memory of earlier ones." << std::endl;
+      ++errors;
+    }
+
+    std::cout << "Sending a matrix that does not fit into the slots." << std::endl;
+    int sizes_3d[3] = {40, 50, 60};
+    cv::Mat large(3, sizes_3d, CV_64F);
+    cv::randu(large, cv::Scalar(-1.0), cv::Scalar(1.0));
+    writer.write(large);
+    if (!reader.read(read) || !equal(large, read))
+    {
+      std::cout << "ERROR: the large matrix was not received correctly." << std::endl;
+      ++errors;
+    }
+
+    std::cout << "Sending a non-continuous matrix." << std::endl;
+    cv::Mat image(20, 30, CV_8UC3);
+    cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::Mat roi = image(cv::Rect(3, 4, 10, 5));
+    writer.write(roi);
+    if (!reader.read(read) || !equal(roi, read))
+    {
+      std::cout << "ERROR: the non-continuous matrix was not received correctly." << std::endl;
+      ++errors;
+    }
+
+    std::cout << "Sending an empty matrix." << std::endl;
+    writer.write(cv::Mat());
+    if (!reader.read(read) || !read.empty())
+    {
+      std::cout << "ERROR: the empty matrix was not received correctly." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Reading after the writer is gone." << std::endl;
+  if (reader.read(read))
+  {
+    std::cout << "ERROR: reading after the writer was destroyed succeeded." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
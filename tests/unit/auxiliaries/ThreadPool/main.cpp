@@ -0,0 +1,148 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests for cedar::aux::ThreadPool.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/auxiliaries/ThreadPool.h"
+
+// SYSTEM INCLUDES
+#include <boost/bind.hpp>
+#include <iostream>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+void add(std::atomic<int>* pCounter, int amount)
+{
+  *pCounter += amount;
+}
+
+void fail()
+{
+  throw std::runtime_error("task failed");
+}
+
+void nested(cedar::aux::ThreadPool* pPool, std::atomic<int>* pCounter)
+{
+  std::vector<cedar::aux::ThreadPool::Task> tasks;
+  for (int i = 0; i < 4; ++i)
+  {
+    tasks.push_back(boost::bind(&add, pCounter, 1));
+  }
+  pPool->run(tasks);
+}
+
+int main()
+{
+  // the number of errors encountered in this test
+  int errors = 0;
+
+  for (unsigned int threads = 0; threads < 5; ++threads)
+  {
+    std::cout << "Testing pool with " << threads << " thread(s)." << std::endl;
+    cedar::aux::ThreadPool pool(threads);
+
+    if (pool.getNumberOfThreads() != threads)
+    {
+      std::cout << "ERROR: pool has " << pool.getNumberOfThreads() << " threads." << std::endl;
+      ++errors;
+    }
+
+    // run() must only return after all tasks are done
+    std::atomic<int> counter(0);
+    std::vector<cedar::aux::ThreadPool::Task> tasks;
+    for (int i = 1; i <= 100; ++i)
+    {
+      tasks.push_back(boost::bind(&add, &counter, i));
+    }
+    for (int round = 0; round < 10; ++round)
+    {
+      counter = 0;
+      pool.run(tasks);
+      if (counter.load() != 5050)
+      {
+        std::cout << "ERROR: counter is " << counter.load() << " after run, expected 5050." << std::endl;
+        ++errors;
+      }
+    }
+
+    // nested calls must not deadlock
+    counter = 0;
+    tasks.clear();
+    for (int i = 0; i < 8; ++i)
+    {
+      tasks.push_back(boost::bind(&nested, &pool, &counter));
+    }
+    pool.run(tasks);
+    if (counter.load() != 32)
+    {
+      std::cout << "ERROR: counter is " << counter.load() << " after nested run, expected 32." << std::endl;
+      ++errors;
+    }
+
+    // exceptions are passed on to the caller
+    tasks.clear();
+    tasks.push_back(boost::bind(&add, &counter, 1));
+    tasks.push_back(&fail);
+    tasks.push_back(boost::bind(&add, &counter, 1));
+    bool thrown = false;
+    try
+    {
+      pool.run(tasks);
+    }
+    catch (const std::runtime_error&)
+    {
+      thrown = true;
+    }
+    if (!thrown)
+    {
+      std::cout << "ERROR: exception in task was not rethrown." << std::endl;
+      ++errors;
+    }
+  }
+
+  // resizing
+  cedar::aux::ThreadPool pool(2);
+  pool.setNumberOfThreads(4);
+  pool.setNumberOfThreads(0);
+  if (pool.getNumberOfThreads() != 0)
+  {
+    std::cout << "ERROR: pool was not resized." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Done. There were " << errors << " error(s)." << std::endl;
+  return errors;
+}
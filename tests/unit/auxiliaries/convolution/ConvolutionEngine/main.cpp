@@ -39,11 +39,14 @@
 #include "cedar/auxiliaries/convolution/Engine.h"
 #include "cedar/auxiliaries/convolution/OpenCV.h"
 #include "cedar/auxiliaries/convolution/FFTW.h"
+#include "cedar/auxiliaries/convolution/Auto.h"
+#include "cedar/auxiliaries/convolution/Convolution.h"
 #include "cedar/auxiliaries/kernel/Kernel.h"
 #include "cedar/auxiliaries/kernel/Separable.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/auxiliaries/utilities.h"
+#include "cedar/auxiliaries/exceptions.h"
 #include "cedar/auxiliaries/kernel/Gauss.h"
 #include "cedar/configuration.h"
 
@@ -1210,6 +1213,375 @@ void testConv()
   printMatrix(expected_even);
 }
 
+//! Maps an index outside of [0, size) back into it; returns -1 for zero borders.
+int map_border_index(int index, int size, cedar::aux::conv::BorderType::Id borderType)
+{
+  while (index < 0 || index >= size)
+  {
+    switch (borderType)
+    {
+      case cedar::aux::conv::BorderType::Cyclic:
+        index = index < 0 ? index + size : index - size;
+        break;
+
+      case cedar::aux::conv::BorderType::Replicate:
+        index = index < 0 ? 0 : size - 1;
+        break;
+
+      case cedar::aux::conv::BorderType::Reflect:
+        index = index < 0 ? -index - 1 : 2 * size - 1 - index;
+        break;
+
+      default:
+        return -1;
+    }
+  }
+  return index;
+}
+
+//! Convolves a 3d matrix with a full kernel element by element.
+cv::Mat conv_3d(const cv::Mat& matrix, const cv::Mat& kernel, cedar::aux::conv::BorderType::Id borderType)
+{
+  cv::Mat result(3, matrix.size, CV_32F, cv::Scalar(0));
+  for (int x = 0; x < matrix.size[0]; ++x)
+  {
+    for (int y = 0; y < matrix.size[1]; ++y)
+    {
+      for (int z = 0; z < matrix.size[2]; ++z)
+      {
+        double sum = 0.0;
+        for (int i = 0; i < kernel.size[0]; ++i)
+        {
+          for (int j = 0; j < kernel.size[1]; ++j)
+          {
+            for (int k = 0; k < kernel.size[2]; ++k)
+            {
+              int sx = map_border_index(x + kernel.size[0] / 2 - i, matrix.size[0], borderType);
+              int sy = map_border_index(y + kernel.size[1] / 2 - j, matrix.size[1], borderType);
+              int sz = map_border_index(z + kernel.size[2] / 2 - k, matrix.size[2], borderType);
+              if (sx < 0 || sy < 0 || sz < 0)
+              {
+                continue;
+              }
+              sum += kernel.at<float>(i, j, k) * matrix.at<float>(sx, sy, sz);
+            }
+          }
+        }
+        result.at<float>(x, y, z) = static_cast<float>(sum);
+      }
+    }
+  }
+  return result;
+}
+
+//! Tests the n-dimensional separable convolution of the OpenCV engine.
+int testSeparable3D()
+{
+  std::cout << "=============================================================================" << std::endl;
+  std::cout << "Testing 3d separable convolution of the OpenCV engine" << std::endl;
+  std::cout << "=============================================================================" << std::endl;
+
+  int errors = 0;
+  cedar::aux::conv::OpenCVPtr engine(new cedar::aux::conv::OpenCV());
+
+  int sizes[3] = {9, 6, 11};
+  cv::Mat matrix(3, sizes, CV_32F);
+  cv::randu(matrix, cv::Scalar(-1.0), cv::Scalar(1.0));
+
+  std::vector<double> sigmas(3, 1.0);
+  std::vector<double> shifts(3, 0.0);
+  cedar::aux::kernel::GaussPtr gauss(new cedar::aux::kernel::Gauss(1.0, sigmas, shifts, 2.0, 3));
+  cv::Mat kernel;
+  gauss->getKernel().convertTo(kernel, CV_32F);
+
+  std::vector<cedar::aux::conv::BorderType::Id> border_types;
+  border_types.push_back(cedar::aux::conv::BorderType::Zero);
+  border_types.push_back(cedar::aux::conv::BorderType::Replicate);
+  border_types.push_back(cedar::aux::conv::BorderType::Reflect);
+  border_types.push_back(cedar::aux::conv::BorderType::Cyclic);
+
+  for (auto border_type : border_types)
+  {
+    std::cout << "Border type " << cedar::aux::conv::BorderType::type().get(border_type).prettyString() << ": ";
+    cv::Mat result = engine->convolve(matrix, gauss, border_type, cedar::aux::conv::Mode::Same);
+    cv::Mat expected = conv_3d(matrix, kernel, border_type);
+    double difference = cv::norm(result - expected, cv::NORM_INF);
+    if (difference > 1e-4)
+    {
+      std::cout << "ERROR, results differ by " << difference << std::endl;
+      ++errors;
+    }
+    else
+    {
+      std::cout << "ok" << std::endl;
+    }
+  }
+
+  return errors;
+}
+
+//! Tests that 3d separable kernels are accepted by the capability checks and convolved through the public interface.
+int testSeparable3DConvolution()
+{
+  std::cout << "=============================================================================" << std::endl;
+  std::cout << "Testing 3d separable convolution through the convolution class" << std::endl;
+  std::cout << "=============================================================================" << std::endl;
+
+  int errors = 0;
+
+  int sizes[3] = {9, 6, 11};
+  cv::Mat matrix(3, sizes, CV_32F);
+  cv::randu(matrix, cv::Scalar(-1.0), cv::Scalar(1.0));
+
+  std::vector<double> sigmas(3, 1.0);
+  std::vector<double> shifts(3, 0.0);
+  cedar::aux::kernel::GaussPtr gauss(new cedar::aux::kernel::Gauss(1.0, sigmas, shifts, 2.0, 3));
+  cv::Mat kernel;
+  gauss->getKernel().convertTo(kernel, CV_32F);
+  cv::Mat expected = conv_3d(matrix, kernel, cedar::aux::conv::BorderType::Zero);
+
+  std::vector<cedar::aux::conv::EnginePtr> engines;
+  engines.push_back(cedar::aux::conv::OpenCVPtr(new cedar::aux::conv::OpenCV()));
+  engines.push_back(cedar::aux::conv::AutoPtr(new cedar::aux::conv::Auto()));
+
+  for (auto engine : engines)
+  {
+    std::cout << "Engine " << cedar::aux::objectTypeToString(engine) << ": ";
+    cedar::aux::conv::ConvolutionPtr convolution(new cedar::aux::conv::Convolution());
+    convolution->setEngine(engine);
+    convolution->setBorderType(cedar::aux::conv::BorderType::Zero);
+    convolution->setMode(cedar::aux::conv::Mode::Same);
+    convolution->getKernelList()->append(gauss);
+
+    if
+    (
+      !engine->checkKernelCapability(3, gauss, cedar::aux::conv::BorderType::Zero, cedar::aux::conv::Mode::Same)
+      || !engine->checkKernelListCapability
+              (
+                3,
+                convolution->getKernelList(),
+                cedar::aux::conv::BorderType::Zero,
+                cedar::aux::conv::Mode::Same
+              )
+    )
+    {
+      std::cout << "ERROR, engine does not claim to handle the kernel" << std::endl;
+      ++errors;
+      continue;
+    }
+
+    try
+    {
+      cv::Mat result = convolution->convolve(matrix);
+      double difference = cv::norm(result - expected, cv::NORM_INF);
+      if (difference > 1e-4)
+      {
+        std::cout << "ERROR, results differ by " << difference << std::endl;
+        ++errors;
+      }
+      else
+      {
+        std::cout << "ok" << std::endl;
+      }
+    }
+    catch (const std::exception& e)
+    {
+      std::cout << "ERROR, exception: " << e.what() << std::endl;
+      ++errors;
+    }
+  }
+
+  // full mode is not implemented for more than two dimensions
+  cedar::aux::conv::OpenCVPtr opencv(new cedar::aux::conv::OpenCV());
+  if (opencv->checkKernelCapability(3, gauss, cedar::aux::conv::BorderType::Zero, cedar::aux::conv::Mode::Full))
+  {
+    std::cout << "ERROR, OpenCV claims to handle 3d full convolution" << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+//! Tests that fusing the kernels of a list gives the same result as convolving with each kernel.
+int testKernelFusion()
+{
+  std::cout << "=============================================================================" << std::endl;
+  std::cout << "Testing kernel fusion of the OpenCV engine" << std::endl;
+  std::cout << "=============================================================================" << std::endl;
+
+  int errors = 0;
+
+  // a mexican hat in 1D and two gaussians of the same width (i.e., a rank-1 sum) in 2D
+  std::vector<cedar::aux::conv::KernelListPtr> lists;
+  std::vector<cv::Mat> matrices;
+  {
+    cedar::aux::conv::KernelListPtr list(new cedar::aux::conv::KernelList());
+    list->append(cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(1, 1.0, 2.0, 0.0, 5.0)));
+    list->append(cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(1, -0.5, 5.0, 0.0, 5.0)));
+    lists.push_back(list);
+    cv::Mat matrix(120, 1, CV_32F);
+    cv::randu(matrix, cv::Scalar(0.0), cv::Scalar(1.0));
+    matrices.push_back(matrix);
+  }
+  {
+    cedar::aux::conv::KernelListPtr list(new cedar::aux::conv::KernelList());
+    list->append(cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(2, 1.0, 3.0, 0.0, 5.0)));
+    list->append(cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(2, -0.5, 3.0, 0.0, 5.0)));
+    lists.push_back(list);
+    cv::Mat matrix(30, 40, CV_32F);
+    cv::randu(matrix, cv::Scalar(0.0), cv::Scalar(1.0));
+    matrices.push_back(matrix);
+  }
+
+  for (size_t i = 0; i < lists.size(); ++i)
+  {
+    std::cout << "Kernel list " << i << ": ";
+    if (lists.at(i)->getFusedKernel().size() != 1)
+    {
+      std::cout << "ERROR, the kernels were not fused into a single term." << std::endl;
+      ++errors;
+      continue;
+    }
+
+    cedar::aux::conv::OpenCVPtr engine(new cedar::aux::conv::OpenCV());
+    engine->setKernelList(lists.at(i));
+    cv::Mat fused = engine->convolve(matrices.at(i), cedar::aux::conv::BorderType::Cyclic, cedar::aux::conv::Mode::Same);
+    cv::Mat single = engine->convolve
+                     (
+                       matrices.at(i),
+                       cedar::aux::conv::ConstKernelListPtr(lists.at(i)),
+                       cedar::aux::conv::BorderType::Cyclic,
+                       cedar::aux::conv::Mode::Same
+                     );
+    double difference = cv::norm(fused - single, cv::NORM_INF);
+    if (difference > 1e-4)
+    {
+      std::cout << "ERROR, results differ by " << difference << std::endl;
+      ++errors;
+    }
+    else
+    {
+      std::cout << "ok" << std::endl;
+    }
+  }
+
+  return errors;
+}
+
+//! Tests that the auto engine gives the results of the other engines, including configurations none of them claims.
+int testAutoEngine()
+{
+  std::cout << "=============================================================================" << std::endl;
+  std::cout << "Testing the Auto engine" << std::endl;
+  std::cout << "=============================================================================" << std::endl;
+
+  int errors = 0;
+  cedar::aux::conv::AutoPtr engine(new cedar::aux::conv::Auto());
+  cedar::aux::conv::OpenCVPtr reference(new cedar::aux::conv::OpenCV());
+
+  std::cout << "2d kernel list: ";
+  {
+    cedar::aux::conv::KernelListPtr list(new cedar::aux::conv::KernelList());
+    list->append(cedar::aux::kernel::GaussPtr(new cedar::aux::kernel::Gauss(2, 1.0, 3.0, 0.0, 5.0)));
+    engine->setKernelList(list);
+    reference->setKernelList(list);
+    cv::Mat matrix(30, 40, CV_32F);
+    cv::randu(matrix, cv::Scalar(0.0), cv::Scalar(1.0));
+
+    // the second call is dispatched to the stored winner
+    cv::Mat result = engine->convolve(matrix, cedar::aux::conv::BorderType::Cyclic, cedar::aux::conv::Mode::Same);
+    result = engine->convolve(matrix, cedar::aux::conv::BorderType::Cyclic, cedar::aux::conv::Mode::Same);
+    cv::Mat expected = reference->convolve(matrix, cedar::aux::conv::BorderType::Cyclic, cedar::aux::conv::Mode::Same);
+    double difference = cv::norm(result - expected, cv::NORM_INF);
+    if (difference > 1e-4)
+    {
+      std::cout << "ERROR, results differ by " << difference << std::endl;
+      ++errors;
+    }
+    else
+    {
+      std::cout << "ok" << std::endl;
+    }
+  }
+
+  std::cout << "selected engine is remembered: ";
+  {
+    cv::Mat matrix = cv::Mat::ones(20, 20, CV_32F);
+    cv::Mat kernel = cv::Mat::ones(5, 5, CV_32F);
+    engine->convolve(matrix, kernel, cedar::aux::conv::BorderType::Zero, cedar::aux::conv::Mode::Same);
+    std::string selected
+      = engine->getSelectedEngine(matrix, kernel, cedar::aux::conv::BorderType::Zero, cedar::aux::conv::Mode::Same);
+    // only OpenCV supports zero borders
+    if (selected != "OpenCV")
+    {
+      std::cout << "ERROR, selected engine is \"" << selected << "\"" << std::endl;
+      ++errors;
+    }
+    else
+    {
+      std::cout << "ok" << std::endl;
+    }
+  }
+
+  std::cout << "3d separable kernel: ";
+  {
+    int sizes[3] = {9, 6, 11};
+    cv::Mat matrix(3, sizes, CV_32F);
+    cv::randu(matrix, cv::Scalar(-1.0), cv::Scalar(1.0));
+    std::vector<double> sigmas(3, 1.0);
+    std::vector<double> shifts(3, 0.0);
+    cedar::aux::kernel::GaussPtr gauss(new cedar::aux::kernel::Gauss(1.0, sigmas, shifts, 2.0, 3));
+    try
+    {
+      cv::Mat result = engine->convolve(matrix, gauss, cedar::aux::conv::BorderType::Replicate);
+      cv::Mat expected = reference->convolve(matrix, gauss, cedar::aux::conv::BorderType::Replicate);
+      double difference = cv::norm(result - expected, cv::NORM_INF);
+      if (difference > 1e-4)
+      {
+        std::cout << "ERROR, results differ by " << difference << std::endl;
+        ++errors;
+      }
+      else
+      {
+        std::cout << "ok" << std::endl;
+      }
+    }
+    catch (const std::exception& e)
+    {
+      std::cout << "ERROR, exception: " << e.what() << std::endl;
+      ++errors;
+    }
+  }
+
+  // neither OpenCV (2d only for full kernels) nor FFTW (cyclic borders only) can do this, so no engine may be used
+  std::cout << "3d full kernel with zero borders is rejected: ";
+  {
+    int sizes[3] = {9, 6, 11};
+    cv::Mat matrix(3, sizes, CV_32F);
+    cv::randu(matrix, cv::Scalar(-1.0), cv::Scalar(1.0));
+    int kernel_sizes[3] = {3, 3, 3};
+    cv::Mat kernel(3, kernel_sizes, CV_32F);
+    cv::randu(kernel, cv::Scalar(-1.0), cv::Scalar(1.0));
+    try
+    {
+      engine->convolve(matrix, kernel, cedar::aux::conv::BorderType::Zero, cedar::aux::conv::Mode::Same);
+      std::cout << "ERROR, no exception was thrown" << std::endl;
+      ++errors;
+    }
+    catch (const cedar::aux::UnhandledValueException&)
+    {
+      std::cout << "ok" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+      std::cout << "ERROR, unexpected exception: " << e.what() << std::endl;
+      ++errors;
+    }
+  }
+
+  return errors;
+}
+
 int main()
 {
   // initialize matrices
@@ -1239,6 +1611,10 @@ int main()
 
   cedar::aux::conv::OpenCVPtr open_cv (new cedar::aux::conv::OpenCV());
   errors += testEngine(open_cv);
+  errors += testSeparable3D();
+  errors += testSeparable3DConvolution();
+  errors += testKernelFusion();
+  errors += testAutoEngine();
 
 #ifdef CEDAR_USE_FFTW
   cedar::aux::conv::FFTWPtr fftw (new cedar::aux::conv::FFTW());
@@ -239,6 +239,35 @@ void run_test()
   kernel_pad = cv::Mat(3, sizes_kernel, CV_32F);
   padded = fftw->padTheKernel(matrix_pad, kernel_pad);
 
+  std::cout << "test no " << test_number++ << ": single and double precision results match" << std::endl;
+  {
+    int sizes_precision[3] = {20, 15, 17};
+    int sizes_kernel_precision[3] = {5, 5, 7};
+    cv::Mat matrix_64(3, sizes_precision, CV_64F);
+    cv::Mat kernel_64(3, sizes_kernel_precision, CV_64F);
+    cv::randu(matrix_64, cv::Scalar(-1.0), cv::Scalar(1.0));
+    cv::randu(kernel_64, cv::Scalar(-1.0), cv::Scalar(1.0));
+    cv::Mat matrix_32, kernel_32;
+    matrix_64.convertTo(matrix_32, CV_32F);
+    kernel_64.convertTo(kernel_32, CV_32F);
+
+    cv::Mat result_64 = fftw->convolve(matrix_64, kernel_64, cedar::aux::conv::BorderType::Cyclic);
+    cv::Mat result_32 = fftw->convolve(matrix_32, kernel_32, cedar::aux::conv::BorderType::Cyclic);
+    if (result_32.type() != CV_32F)
+    {
+      ++errors;
+      std::cout << "error: convolving a CV_32F matrix did not return a CV_32F matrix" << std::endl;
+    }
+    cv::Mat result_32_as_64;
+    result_32.convertTo(result_32_as_64, CV_64F);
+    double difference = cv::norm(result_64 - result_32_as_64, cv::NORM_INF);
+    if (difference > 1e-3)
+    {
+      ++errors;
+      std::cout << "error: single and double precision results differ by " << difference << std::endl;
+    }
+  }
+
   multi_thread_test();
 
   std::cout << "test finished, there were " << errors << " errors" << std::endl;
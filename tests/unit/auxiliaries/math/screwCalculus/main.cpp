@@ -803,6 +803,59 @@ int main()
     std::cout << "ERROR in function twistCoordinates<float>(const cv::Mat& supportPoint, const cv::Mat& axis)" << std::endl;
   }
 
+  //--------------------------------------------------------------------------------------------------------------------
+  // fixed-size versions
+  //--------------------------------------------------------------------------------------------------------------------
+  std::cout << "test: fixed-size versions" << std::endl;
+  {
+    cv::Mat support_point = (cv::Mat_<float>(3, 1) << 1.0f, -2.0f, 0.5f);
+    cv::Mat axis = (cv::Mat_<float>(3, 1) << 0.0f, 0.6f, 0.8f);
+    cv::Mat xi = cedar::aux::math::twistCoordinates<float>(support_point, axis);
+    cv::Vec6f xi_fixed = xi;
+    float angle = 0.7f;
+
+    cv::Mat exp_mat = cedar::aux::math::expTwist<float>(xi, angle);
+    cv::Matx44f exp_fixed;
+    cedar::aux::math::expTwist(xi_fixed, angle, exp_fixed);
+    if (cv::norm(exp_mat - cv::Mat(exp_fixed), cv::NORM_INF) > 1e-5)
+    {
+      errors++;
+      std::cout << "ERROR in fixed-size expTwist: results differ from the cv::Mat version" << std::endl;
+    }
+
+    cv::Mat adjoint_mat = cedar::aux::math::rigidToAdjointTransformation<float>(exp_mat);
+    cv::Matx66f adjoint_fixed;
+    cedar::aux::math::rigidToAdjointTransformation(exp_fixed, adjoint_fixed);
+    if (cv::norm(adjoint_mat - cv::Mat(adjoint_fixed), cv::NORM_INF) > 1e-5)
+    {
+      errors++;
+      std::cout << "ERROR in fixed-size rigidToAdjointTransformation: results differ from the cv::Mat version" << std::endl;
+    }
+
+    cv::Vec6f other_twist(0.3f, -0.1f, 0.2f, 1.0f, 0.0f, 0.0f);
+    cv::Vec6f transformed;
+    cedar::aux::math::transformTwist(exp_fixed, other_twist, transformed);
+    if (cv::norm(cv::Mat(adjoint_fixed * other_twist) - cv::Mat(transformed), cv::NORM_INF) > 1e-5)
+    {
+      errors++;
+      std::cout << "ERROR in transformTwist: result differs from applying the adjoint transformation" << std::endl;
+    }
+
+    cv::Matx44f wedge_fixed;
+    cedar::aux::math::wedgeTwist(xi_fixed, wedge_fixed);
+    cv::Vec6f vee_fixed;
+    cedar::aux::math::veeTwist(wedge_fixed, vee_fixed);
+    if
+    (
+      cv::norm(cedar::aux::math::wedgeTwist<float>(xi) - cv::Mat(wedge_fixed), cv::NORM_INF) > 1e-6
+      || cv::norm(cv::Mat(vee_fixed) - cv::Mat(xi_fixed), cv::NORM_INF) > 1e-6
+    )
+    {
+      errors++;
+      std::cout << "ERROR in fixed-size wedgeTwist or veeTwist" << std::endl;
+    }
+  }
+
   std::cout << "test finished, there were " << errors << " errors" << std::endl;
   std::cout << std::endl;
   if (errors > 255)
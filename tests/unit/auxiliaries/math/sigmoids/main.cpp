@@ -40,11 +40,14 @@
 #include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
 #include "cedar/auxiliaries/math/transferFunctions/ExpSigmoid.h"
 #include "cedar/auxiliaries/math/transferFunctions/HeavisideSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/SemiLinearTransferFunction.h"
+#include "cedar/auxiliaries/math/transferFunctions/LinearTransferFunction.h"
 #include "cedar/auxiliaries/math/tools.h"
 #include "cedar/auxiliaries/math/TransferFunctionDeclaration.h"
 #include "cedar/auxiliaries/utilities.h"
 
 // SYSTEM INCLUDES
+#include <vector>
 
 int main()
 {
@@ -120,6 +123,49 @@ int main()
   cedar::aux::write(sigmoid_my_values);
   cedar::aux::write(sigmoid_my_values_double);
 
+  // test in-place computation against the element-wise results
+  std::cout << "test no " << test_number++ << std::endl;
+  std::vector<cedar::aux::math::TransferFunctionPtr> transfer_functions;
+  transfer_functions.push_back(cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::AbsSigmoid(0.2, 10.0)));
+  transfer_functions.push_back(cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::ExpSigmoid(0.2, 10.0)));
+  transfer_functions.push_back(cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::HeavisideSigmoid(0.2)));
+  transfer_functions.push_back
+  (
+    cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::SemiLinearTransferFunction(0.0, 2.0))
+  );
+  transfer_functions.push_back(cedar::aux::math::TransferFunctionPtr(new cedar::aux::math::LinearTransferFunction()));
+  int sizes[3] = {7, 5, 3};
+  for (auto transfer_function : transfer_functions)
+  {
+    for (int type : {CV_32F, CV_64F})
+    {
+      cv::Mat input(3, sizes, type);
+      cv::randu(input, cv::Scalar(-1.0), cv::Scalar(1.0));
+      // the templated compute calls compute(double) for each element
+      cv::Mat expected
+        = (type == CV_32F) ? transfer_function->compute<float>(input) : transfer_function->compute<double>(input);
+
+      cv::Mat output;
+      transfer_function->compute(input, output);
+      cv::Mat in_place = input.clone();
+      transfer_function->compute(in_place, in_place);
+
+      if (output.type() != type || !cedar::aux::math::matrixSizesEqual(output, input))
+      {
+        std::cout << "error: in-place computation returned a matrix of the wrong type or size" << std::endl;
+        ++errors;
+        continue;
+      }
+
+      double tolerance = (type == CV_32F) ? 1e-5 : 1e-12;
+      if (cv::norm(output - expected, cv::NORM_INF) > tolerance || cv::norm(in_place - expected, cv::NORM_INF) > tolerance)
+      {
+        std::cout << "error: in-place computation differs from the element-wise one" << std::endl;
+        ++errors;
+      }
+    }
+  }
+
   std::cout << "test finished, there were " << errors << " errors" << std::endl;
   if (errors > 255)
   {
@@ -766,6 +766,46 @@ void test()
     std::cout << "passed" << std::endl;
   }
 
+  //--------------------------------------------------------------------------------------------------------------------
+  // batch evaluation
+  //--------------------------------------------------------------------------------------------------------------------
+  std::cout << "test: calculateEndEffectorTransformations and calculateEndEffectorJacobians" << std::endl;
+  {
+    // evaluate the current configuration many times so the batch is split across the thread pool, if there is one
+    cv::Mat configuration = test_coordinate_frames->getJointAngles().t();
+    cv::Mat configurations;
+    cv::repeat(configuration, 1000, 1, configurations);
+    cv::Mat transformations, jacobians;
+    test_coordinate_frames->calculateEndEffectorTransformations(configurations, transformations);
+    test_coordinate_frames->calculateEndEffectorJacobians(configurations, jacobians);
+
+    cv::Mat end_effector_transformation = test_coordinate_frames->getEndEffectorTransformation();
+    bool batch_correct = transformations.rows == 1000 && jacobians.rows == 1000;
+    for (int i = 0; batch_correct && i < configurations.rows; ++i)
+    {
+      batch_correct = cv::norm(transformations.row(i).reshape(1, 4) - end_effector_transformation, cv::NORM_INF) < 1e-4
+                      && cv::norm(jacobians.row(i).reshape(1, 3) - end_effector_jacobian, cv::NORM_INF) < 1e-4;
+    }
+
+    cv::Mat reused_jacobian(3, test_coordinate_frames->getNumberOfJoints(), CV_32F);
+    const uchar* jacobian_memory = reused_jacobian.data;
+    test_coordinate_frames->calculateEndEffectorJacobian(reused_jacobian);
+    if
+    (
+      !batch_correct
+      || reused_jacobian.data != jacobian_memory
+      || cv::norm(reused_jacobian - end_effector_jacobian, cv::NORM_INF) > 1e-4
+    )
+    {
+      errors++;
+      std::cout << "ERROR with batch evaluation or calculateEndEffectorJacobian(cv::Mat&)" << std::endl;
+    }
+    else
+    {
+      std::cout << "passed" << std::endl;
+    }
+  }
+
   //--------------------------------------------------------------------------------------------------------------------
   // calculate finite differences for time derivatives
   //--------------------------------------------------------------------------------------------------------------------
@@ -36,9 +36,14 @@
 
 // LOCAL INCLUDES
 #include "cedar/testingUtilities/devices/TestGrabber.h"
+#include "cedar/devices/sensors/visual/FrameRecorder.h"
 
 // SYSTEM INCLUDES
 #include <opencv2/opencv.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #ifndef Q_MOC_RUN
   #include <boost/filesystem.hpp>
 #endif
@@ -223,6 +228,129 @@ int main(int , char **)
   }
 
 
+  //-----------------------------------------------------------
+  std::cout << "test no " << test_number++ <<": setRecordingQueueSize() and recording statistics" << std::endl;
+  try
+  {
+    pGrabber->setRecordingQueueSize(5);
+    if (pGrabber->getRecordingQueueSize() != 5) {throw (-1);}
+
+    // nothing was recorded yet
+    if (pGrabber->getNumberOfRecordedFrames() != 0) {throw (-1);}
+    if (pGrabber->getNumberOfDroppedFrames(0) != 0) {throw (-1);}
+    if (pGrabber->getNumberOfLateFrames(0) != 0) {throw (-1);}
+  }
+  catch (...)
+  {
+    std::cout << "error" << std::endl;
+    errors++;
+  }
+
+  try
+  {
+    pGrabber->setRecordingQueueSize(0);
+    std::cout << "error: a queue size of zero was accepted" << std::endl;
+    errors++;
+  }
+  catch (const cedar::dev::sensors::visual::InvalidParameterException&)
+  {
+    // expected
+  }
+
+  //-----------------------------------------------------------
+  std::cout << "test no " << test_number++ <<": recording statistics when the queue overflows" << std::endl;
+  {
+    // the first frame blocks the encoder until it is released, so the queue fills up deterministically
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool writing = false;
+    bool released = false;
+    auto write = [&](const cv::Mat&)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      writing = true;
+      changed.notify_all();
+      changed.wait(lock, [&] { return released; });
+    };
+
+    const unsigned int queue_size = 3;
+    const unsigned int frames = 10;
+    cv::Mat frame = cv::Mat::zeros(4, 4, CV_8UC3);
+    // one frame period is 50 ms
+    cedar::dev::sensors::visual::FrameRecorder recorder(write, 20.0, frame, queue_size);
+
+    recorder.record(frame);
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      changed.wait(lock, [&] { return writing; });
+    }
+
+    // the slot of the frame being written stays occupied, so queue_size - 1 frames fit and the rest is dropped
+    for (unsigned int i = 1; i < frames; ++i)
+    {
+      recorder.record(frame);
+    }
+
+    // the queued frames now wait longer than one frame period
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      released = true;
+    }
+    changed.notify_all();
+    recorder.stop();
+
+    if (recorder.getNumberOfRecordedFrames() != queue_size)
+    {
+      std::cout << "error: " << recorder.getNumberOfRecordedFrames() << " frames were recorded, expected "
+                << queue_size << std::endl;
+      errors++;
+    }
+    if (recorder.getNumberOfDroppedFrames() != frames - queue_size)
+    {
+      std::cout << "error: " << recorder.getNumberOfDroppedFrames() << " frames were dropped, expected "
+                << frames - queue_size << std::endl;
+      errors++;
+    }
+    if (recorder.getNumberOfLateFrames() != queue_size - 1)
+    {
+      std::cout << "error: " << recorder.getNumberOfLateFrames() << " frames were late, expected "
+                << queue_size - 1 << std::endl;
+      errors++;
+    }
+  }
+
+  //-----------------------------------------------------------
+  std::cout << "test no " << test_number++ <<": stopping a recorder while frames are recorded" << std::endl;
+  {
+    cv::Mat frame = cv::Mat::zeros(4, 4, CV_8UC3);
+    cedar::dev::sensors::visual::FrameRecorder recorder([](const cv::Mat&) {}, 0.0, frame, 2);
+
+    const unsigned int frames = 1000;
+    std::thread grabbing([&]
+    {
+      for (unsigned int i = 0; i < frames; ++i)
+      {
+        recorder.record(frame);
+      }
+    });
+    recorder.stop();
+    grabbing.join();
+
+    unsigned int handled = recorder.getNumberOfRecordedFrames() + recorder.getNumberOfDroppedFrames();
+    recorder.record(frame);
+    if (handled > frames)
+    {
+      std::cout << "error: " << handled << " frames were handled, but only " << frames << " were recorded" << std::endl;
+      errors++;
+    }
+    if (recorder.getNumberOfRecordedFrames() + recorder.getNumberOfDroppedFrames() != handled)
+    {
+      std::cout << "error: a frame was taken after the recorder stopped" << std::endl;
+      errors++;
+    }
+  }
+
   //-----------------------------------------------------------
   std::cout << "test no " << test_number++ <<": setSnapshotName() and getSnapshotName()" << std::endl;
   try
@@ -0,0 +1,240 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests the integrators of cedar::dyn::Dynamics.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Integrator.h"
+#include "cedar/dynamics/integrators/Euler.h"
+#include "cedar/dynamics/integrators/ExponentialEuler.h"
+#include "cedar/dynamics/integrators/RungeKutta2.h"
+#include "cedar/dynamics/integrators/RungeKutta4.h"
+#include "cedar/dynamics/integrators/AdaptiveRungeKutta45.h"
+#include "cedar/auxiliaries/exceptions.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <opencv2/opencv.hpp>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // x' = -decay * x + drive, with the exact solution x(t) = drive / decay + (x(0) - drive / decay) * exp(-decay * t)
+  const double DECAY = 20.0;
+  const double DRIVE = 30.0;
+  const double START = -5.0;
+
+  void decayDerivative(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& derivative)
+  {
+    derivative[0] = -DECAY * state[0] + DRIVE;
+  }
+
+  double decaySolution(double time)
+  {
+    return DRIVE / DECAY + (START - DRIVE / DECAY) * std::exp(-DECAY * time);
+  }
+
+  // x'' = -omega^2 x, as a system of two state variables
+  const double OMEGA = 2.0;
+
+  void oscillatorDerivative(const std::vector<cv::Mat>& state, std::vector<cv::Mat>& derivative)
+  {
+    state[1].copyTo(derivative[0]);
+    derivative[1] = -OMEGA * OMEGA * state[0];
+  }
+
+  //! Integrates the decay up to time 0.25 s in the given number of steps and returns the maximal error.
+  double decayError(cedar::dyn::IntegratorPtr integrator, unsigned int steps, bool passDecayRate, int type = CV_64F)
+  {
+    std::vector<cv::Mat> state(1, cv::Mat(4, 3, type, cv::Scalar(START)));
+    const uchar* data = state[0].data;
+    const double duration = 0.25;
+    for (unsigned int i = 0; i < steps; ++i)
+    {
+      integrator->integrate
+      (
+        state,
+        cedar::unit::Time(duration / steps * cedar::unit::seconds),
+        passDecayRate ? DECAY : 0.0,
+        &decayDerivative
+      );
+    }
+
+    if (state[0].data != data)
+    {
+      std::cout << "ERROR: the state was reallocated." << std::endl;
+      return 1e10;
+    }
+
+    cv::Mat state_64;
+    state[0].convertTo(state_64, CV_64F);
+    return cv::norm(state_64 - decaySolution(duration), cv::NORM_INF);
+  }
+
+  //! Checks that halving the step size reduces the error by at least the given factor.
+  int checkOrder(const std::string& name, cedar::dyn::IntegratorPtr integrator, double minimumReduction)
+  {
+    double coarse = decayError(integrator, 20, false);
+    double fine = decayError(integrator, 40, false);
+    std::cout << name << ": error " << coarse << " with 20 steps, " << fine << " with 40 steps." << std::endl;
+    if (!(coarse / fine >= minimumReduction))
+    {
+      std::cout << "ERROR: " << name << " converges too slowly." << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+}
+
+int main()
+{
+  int errors = 0;
+
+  std::cout << "Checking the order of convergence." << std::endl;
+  errors += checkOrder("Euler", cedar::dyn::IntegratorPtr(new cedar::dyn::integrators::Euler()), 1.8);
+  errors += checkOrder("Heun", cedar::dyn::IntegratorPtr(new cedar::dyn::integrators::RungeKutta2()), 3.5);
+  errors += checkOrder("RK4", cedar::dyn::IntegratorPtr(new cedar::dyn::integrators::RungeKutta4()), 12.0);
+
+  std::cout << "Checking that exponential Euler is exact for linear decay." << std::endl;
+  {
+    cedar::dyn::IntegratorPtr exponential(new cedar::dyn::integrators::ExponentialEuler());
+    // a single step of ten time constants would make forward Euler explode
+    double error = decayError(exponential, 1, true);
+    if (error > 1e-10)
+    {
+      std::cout << "ERROR: exponential Euler has an error of " << error << std::endl;
+      ++errors;
+    }
+
+    // without a decay rate, it is forward Euler
+    double euler_error = decayError(cedar::dyn::IntegratorPtr(new cedar::dyn::integrators::Euler()), 20, false);
+    double fallback_error = decayError(exponential, 20, false);
+    if (std::abs(euler_error - fallback_error) > 1e-12)
+    {
+      std::cout << "ERROR: exponential Euler without decay rate differs from Euler." << std::endl;
+      ++errors;
+    }
+
+    double float_error = decayError(exponential, 1, true, CV_32F);
+    if (float_error > 1e-5)
+    {
+      std::cout << "ERROR: exponential Euler has an error of " << float_error << " for float matrices." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking the adaptive integrator." << std::endl;
+  {
+    cedar::dyn::integrators::AdaptiveRungeKutta45Ptr adaptive(new cedar::dyn::integrators::AdaptiveRungeKutta45());
+    adaptive->setAbsoluteTolerance(1e-8);
+    adaptive->setRelativeTolerance(1e-8);
+    double error = decayError(adaptive, 1, false);
+    std::cout << "Adaptive RK45: error " << error << " in " << adaptive->getNumberOfSubsteps() << " substeps." << std::endl;
+    if (error > 1e-6)
+    {
+      std::cout << "ERROR: the adaptive integrator does not meet its tolerance." << std::endl;
+      ++errors;
+    }
+    if (adaptive->getNumberOfSubsteps() < 2)
+    {
+      std::cout << "ERROR: the adaptive integrator did not subdivide a step of five time constants." << std::endl;
+      ++errors;
+    }
+
+    // a system resting at its fixed point is integrated in a single step
+    cedar::dyn::integrators::AdaptiveRungeKutta45Ptr resting(new cedar::dyn::integrators::AdaptiveRungeKutta45());
+    std::vector<cv::Mat> state(1, cv::Mat(1, 1, CV_64F, cv::Scalar(DRIVE / DECAY)));
+    resting->integrate(state, cedar::unit::Time(0.25 * cedar::unit::seconds), 0.0, &decayDerivative);
+    if (resting->getNumberOfSubsteps() != 1)
+    {
+      std::cout << "ERROR: the adaptive integrator needs " << resting->getNumberOfSubsteps()
+                << " substeps at the fixed point." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking a system with two state variables." << std::endl;
+  {
+    cedar::dyn::IntegratorPtr rk4(new cedar::dyn::integrators::RungeKutta4());
+    std::vector<cv::Mat> state;
+    state.push_back(cv::Mat(1, 1, CV_64F, cv::Scalar(1.0)));
+    state.push_back(cv::Mat(1, 1, CV_64F, cv::Scalar(0.0)));
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+      rk4->integrate(state, cedar::unit::Time(0.01 * cedar::unit::seconds), 0.0, &oscillatorDerivative);
+    }
+    double position_error = std::abs(state[0].at<double>(0, 0) - std::cos(OMEGA));
+    double velocity_error = std::abs(state[1].at<double>(0, 0) + OMEGA * std::sin(OMEGA));
+    if (position_error > 1e-6 || velocity_error > 1e-6)
+    {
+      std::cout << "ERROR: RK4 oscillator errors are " << position_error << " and " << velocity_error << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Allocating integrators by name." << std::endl;
+  {
+    std::vector<std::string> types =
+    {
+      "cedar.dyn.integrators.Euler",
+      "cedar.dyn.integrators.ExponentialEuler",
+      "cedar.dyn.integrators.RungeKutta2",
+      "cedar.dyn.integrators.RungeKutta4",
+      "cedar.dyn.integrators.AdaptiveRungeKutta45"
+    };
+    for (const auto& type : types)
+    {
+      try
+      {
+        if (!cedar::dyn::IntegratorManagerSingleton::getInstance()->allocate(type))
+        {
+          std::cout << "ERROR: could not allocate " << type << std::endl;
+          ++errors;
+        }
+      }
+      catch (const cedar::aux::ExceptionBase& e)
+      {
+        std::cout << "ERROR: could not allocate " << type << ": " << e.exceptionInfo() << std::endl;
+        ++errors;
+      }
+    }
+  }
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
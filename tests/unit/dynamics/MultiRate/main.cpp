@@ -0,0 +1,224 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests the multi-rate simulation of dynamics.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/Dynamics.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/Configurable.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  //! Dynamics that only count their updates.
+  class CountingDynamics : public cedar::dyn::Dynamics
+  {
+  public:
+    CountingDynamics(double tau)
+    :
+    mTau(tau),
+    mUpdates(0),
+    mIntegratedTime(0.0 * cedar::unit::seconds),
+    mSteps(0),
+    mOutput(new cedar::aux::MatData(cv::Mat::zeros(1, 1, CV_32F)))
+    {
+      this->declareOutput("output", this->mOutput);
+    }
+
+    cedar::unit::Time getTimeScale() const
+    {
+      return cedar::unit::Time(this->mTau * cedar::unit::milli * cedar::unit::seconds);
+    }
+
+    double mTau;
+    unsigned int mUpdates;
+    cedar::unit::Time mIntegratedTime;
+    //! Number of steps triggered so far; used for the global time stamps.
+    unsigned int mSteps;
+    cedar::aux::MatDataPtr mOutput;
+
+  private:
+    void eulerStep(const cedar::unit::Time& time)
+    {
+      ++this->mUpdates;
+      this->mIntegratedTime += time;
+    }
+  };
+
+  typedef boost::shared_ptr<CountingDynamics> CountingDynamicsPtr;
+
+  void run(CountingDynamicsPtr dynamics, unsigned int steps)
+  {
+    cedar::unit::Time step_time(10.0 * cedar::unit::milli * cedar::unit::seconds);
+    for (unsigned int i = 0; i < steps; ++i)
+    {
+      // the time stamps have to increase, otherwise the step is only computed once
+      ++dynamics->mSteps;
+      cedar::proc::ArgumentsPtr arguments
+      (
+        new cedar::proc::StepTime(step_time, static_cast<double>(dynamics->mSteps) * step_time)
+      );
+      dynamics->onTrigger(arguments);
+    }
+  }
+}
+
+int main()
+{
+  int errors = 0;
+  auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+
+  // the fastest "field" of the architecture has a tau of 10 ms
+  cedar::aux::ConfigurablePtr fast_field(new cedar::aux::Configurable());
+  clock->updateFieldTauMap(fast_field, 10.0);
+
+  std::cout << "Checking update ratios." << std::endl;
+  clock->setMaximumUpdateRatio(16);
+  clock->setMultiRateEnabled(false);
+  if (clock->getUpdateRatio(cedar::unit::Time(1.0 * cedar::unit::seconds)) != 1)
+  {
+    std::cout << "ERROR: update ratio is not one without multi-rate simulation." << std::endl;
+    ++errors;
+  }
+
+  clock->setMultiRateEnabled(true);
+  // ratios are rounded down to powers of two and limited by the maximum ratio
+  std::vector<std::pair<double, unsigned int> > expected =
+  {
+    {0.0, 1}, {5.0, 1}, {10.0, 1}, {30.0, 2}, {80.0, 8}, {1000.0, 16}
+  };
+  for (const auto& tau_ratio : expected)
+  {
+    cedar::unit::Time tau(tau_ratio.first * cedar::unit::milli * cedar::unit::seconds);
+    unsigned int ratio = clock->getUpdateRatio(tau);
+    if (ratio != tau_ratio.second)
+    {
+      std::cout << "ERROR: update ratio for tau = " << tau_ratio.first << " ms is " << ratio
+                << ", expected " << tau_ratio.second << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking that slow dynamics are updated less often." << std::endl;
+  CountingDynamicsPtr fast(new CountingDynamics(10.0));
+  CountingDynamicsPtr slow(new CountingDynamics(40.0));
+  run(fast, 16);
+  run(slow, 16);
+  if (fast->mUpdates != 16 || slow->mUpdates != 4)
+  {
+    std::cout << "ERROR: fast/slow dynamics were updated " << fast->mUpdates << "/" << slow->mUpdates
+              << " times, expected 16/4." << std::endl;
+    ++errors;
+  }
+  if (slow->getUpdateRatio() != 4)
+  {
+    std::cout << "ERROR: slow dynamics report an update ratio of " << slow->getUpdateRatio() << std::endl;
+    ++errors;
+  }
+
+  // no time may be lost by skipping updates
+  cedar::unit::Time time_difference = fast->mIntegratedTime - slow->mIntegratedTime;
+  if (std::abs(time_difference / cedar::unit::Time(1.0 * cedar::unit::seconds)) > 1e-9)
+  {
+    std::cout << "ERROR: fast and slow dynamics integrated different amounts of time." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking that skipped steps leave the outputs unchanged." << std::endl;
+  {
+    CountingDynamicsPtr dynamics(new CountingDynamics(40.0));
+    run(dynamics, 4);
+    unsigned long long generation = dynamics->mOutput->getGeneration();
+    run(dynamics, 3);
+    if (dynamics->mOutput->getGeneration() != generation)
+    {
+      std::cout << "ERROR: outputs were marked as changed in steps that did not update the dynamics." << std::endl;
+      ++errors;
+    }
+    run(dynamics, 1);
+    if (dynamics->mOutput->getGeneration() == generation)
+    {
+      std::cout << "ERROR: outputs were not marked as changed when the dynamics were updated." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking that a reset discards the time accumulated since the last update." << std::endl;
+  {
+    CountingDynamicsPtr dynamics(new CountingDynamics(40.0));
+    run(dynamics, 3);
+    dynamics->callReset();
+    dynamics->mSteps = 0;
+    run(dynamics, 1);
+    if (dynamics->mUpdates != 0)
+    {
+      std::cout << "ERROR: time from before the reset was integrated after it." << std::endl;
+      ++errors;
+    }
+    run(dynamics, 3);
+    cedar::unit::Time expected_time(40.0 * cedar::unit::milli * cedar::unit::seconds);
+    if
+    (
+      dynamics->mUpdates != 1
+      || std::abs((dynamics->mIntegratedTime - expected_time) / cedar::unit::Time(1.0 * cedar::unit::seconds)) > 1e-9
+    )
+    {
+      std::cout << "ERROR: after a reset, the dynamics were updated " << dynamics->mUpdates
+                << " times, expected once with the time of four steps." << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking that disabling multi-rate simulation updates all dynamics in every step." << std::endl;
+  clock->setMultiRateEnabled(false);
+  run(slow, 4);
+  if (slow->mUpdates != 8 || slow->getUpdateRatio() != 1)
+  {
+    std::cout << "ERROR: slow dynamics were updated " << slow->mUpdates << " times, expected 8." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
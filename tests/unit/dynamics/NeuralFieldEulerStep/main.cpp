@@ -0,0 +1,230 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Compares the fused euler step of neural fields with the reference computation.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/fields/NeuralField.h"
+#include "cedar/processing/sources/GaussInput.h"
+#include "cedar/processing/Group.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/auxiliaries/math/transferFunctions/AbsSigmoid.h"
+#include "cedar/auxiliaries/math/transferFunctions/ExpSigmoid.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/ThreadPool.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+namespace
+{
+  enum NoiseMode
+  {
+    NOISE_ADDITIVE,
+    NOISE_MULTIPLICATIVE_INPUT,
+    NOISE_MULTIPLICATIVE_ACTIVATION
+  };
+
+  const double resting_level = -2.0;
+  const double time_scale = 50.0;
+  const double global_inhibition = -0.001;
+  const double noise_gain = 0.5;
+  const double step_ms = 5.0;
+
+  cv::Mat buffer(cedar::dyn::NeuralFieldPtr field, const std::string& name)
+  {
+    return boost::dynamic_pointer_cast<const cedar::aux::MatData>(field->getBuffer(name))->getData();
+  }
+
+  cv::Mat output(cedar::dyn::NeuralFieldPtr field, const std::string& name)
+  {
+    return boost::dynamic_pointer_cast<const cedar::aux::MatData>(field->getOutput(name))->getData();
+  }
+
+  double maxDifference(const cv::Mat& a, const cv::Mat& b)
+  {
+    return cv::norm(a, b, cv::NORM_INF);
+  }
+
+  /*!@brief Runs a few steps of a field and compares each with the computation the euler step was fused from.
+   *
+   *        The input noise is drawn from the RNG of the calling thread, so reseeding it before the step and before the
+   *        reference computation reproduces the same noise.
+   */
+  int compare(const std::string& sigmoidName, NoiseMode noiseMode, unsigned int size)
+  {
+    int errors = 0;
+    std::cout << "Comparing the euler step with " << sigmoidName << ", noise mode " << noiseMode << " and "
+              << size << "x" << size << " elements." << std::endl;
+
+    cedar::proc::GroupPtr group(new cedar::proc::Group());
+    cedar::dyn::NeuralFieldPtr field(new cedar::dyn::NeuralField());
+    cedar::proc::sources::GaussInputPtr input(new cedar::proc::sources::GaussInput());
+    group->add(field, "field");
+    group->add(input, "input");
+
+    field->setDimensionality(2);
+    field->setSize(0, size);
+    field->setSize(1, size);
+    field->setRestingLevel(resting_level);
+    field->getParameter<cedar::aux::DoubleParameter>("time scale")->setValue(time_scale);
+    field->getParameter<cedar::aux::DoubleParameter>("global inhibition")->setValue(global_inhibition);
+    field->getParameter<cedar::aux::DoubleParameter>("input noise gain")->setValue(noise_gain);
+    field->getParameter<cedar::aux::BoolParameter>("multiplicative noise (input)")
+      ->setValue(noiseMode == NOISE_MULTIPLICATIVE_INPUT);
+    field->getParameter<cedar::aux::BoolParameter>("multiplicative noise (activation)")
+      ->setValue(noiseMode == NOISE_MULTIPLICATIVE_ACTIVATION);
+
+    cedar::aux::math::TransferFunctionPtr sigmoid;
+    if (sigmoidName == "AbsSigmoid")
+    {
+      sigmoid.reset(new cedar::aux::math::AbsSigmoid(0.0, 4.0));
+    }
+    else
+    {
+      sigmoid.reset(new cedar::aux::math::ExpSigmoid(0.0, 4.0));
+    }
+    field->getParameter<cedar::dyn::NeuralField::SigmoidParameter>("sigmoid")->setValue(sigmoid);
+
+    input->setDimensionality(2);
+    input->setSize(0, size);
+    input->setSize(1, size);
+    input->setAmplitude(3.0);
+    input->setCenter(0, size / 3.0);
+    input->setCenter(1, size / 2.0);
+    group->connectSlots("input.Gauss input", "field.input");
+    input->onTrigger();
+
+    // start from a random activation so that all regions of the sigmoid are covered
+    cv::Mat& activation = field->getFieldActivation()->getData();
+    cv::randu(activation, cv::Scalar(-3.0), cv::Scalar(3.0));
+
+    const cedar::unit::Time step_time(step_ms * cedar::unit::milli * cedar::unit::seconds);
+    for (unsigned int step = 0; step < 3; ++step)
+    {
+      cv::Mat u_before = activation.clone();
+      uint64 seed = 0x5eed0000 + step;
+
+      cv::theRNG().state = seed;
+      cedar::proc::ArgumentsPtr arguments
+      (
+        new cedar::proc::StepTime(step_time, static_cast<double>(step + 1) * step_time)
+      );
+      field->onTrigger(arguments);
+
+      // reference: the computation of the euler step before it was fused
+      cv::Mat sigmoid_u = sigmoid->compute(u_before);
+      cv::Mat lateral = buffer(field, "lateral interaction");
+      cv::Mat input_sum = buffer(field, "input sum");
+
+      cv::theRNG().state = seed;
+      cv::Mat noise(u_before.dims, u_before.size, CV_32F);
+      cv::randn(noise, cv::Scalar(0), cv::Scalar(1));
+      if (noiseMode == NOISE_MULTIPLICATIVE_INPUT)
+      {
+        noise = noise.mul(input_sum);
+      }
+      else if (noiseMode == NOISE_MULTIPLICATIVE_ACTIVATION)
+      {
+        noise = noise.mul(u_before);
+      }
+
+      cv::Mat d_u = -u_before + resting_level;
+      d_u += lateral;
+      d_u += global_inhibition * cv::sum(sigmoid_u)[0];
+      d_u += input_sum;
+      cv::Mat expected = u_before + step_ms / time_scale * d_u + (std::sqrt(step_ms) / time_scale) * noise_gain * noise;
+
+      double sigmoid_error = maxDifference(sigmoid_u, output(field, "sigmoided activation"));
+      if (sigmoid_error > 1e-5)
+      {
+        std::cout << "ERROR: the sigmoid differs by " << sigmoid_error << " in step " << step << "." << std::endl;
+        ++errors;
+      }
+
+      double noise_error = maxDifference(noise, buffer(field, "noise"));
+      if (noise_error > 1e-5)
+      {
+        std::cout << "ERROR: the input noise differs by " << noise_error << " in step " << step << "." << std::endl;
+        ++errors;
+      }
+
+      double activation_error = maxDifference(expected, activation);
+      double tolerance = 1e-4 * (1.0 + cv::norm(expected, cv::NORM_INF));
+      if (activation_error > tolerance)
+      {
+        std::cout << "ERROR: the activation differs by " << activation_error << " in step " << step << "."
+                  << std::endl;
+        ++errors;
+      }
+    }
+
+    return errors;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc, argv);
+  int errors = 0;
+
+  // fields of 300x300 elements are split into chunks for the pool's workers, 40x40 fields are updated in one piece
+  cedar::aux::ThreadPoolSingleton::getInstance()->setNumberOfThreads(3);
+
+  for (const std::string& sigmoid : {"AbsSigmoid", "ExpSigmoid"})
+  {
+    for (NoiseMode noise_mode : {NOISE_ADDITIVE, NOISE_MULTIPLICATIVE_INPUT, NOISE_MULTIPLICATIVE_ACTIVATION})
+    {
+      for (unsigned int size : {40u, 300u})
+      {
+        errors += compare(sigmoid, noise_mode, size);
+      }
+    }
+  }
+
+  cedar::aux::ThreadPoolSingleton::getInstance()->setNumberOfThreads(0);
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
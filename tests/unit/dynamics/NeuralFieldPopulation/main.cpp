@@ -0,0 +1,213 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests that nodes integrated by a population behave like nodes that integrate themselves.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/fields/NeuralField.h"
+#include "cedar/dynamics/fields/NeuralFieldPopulation.h"
+#include "cedar/processing/Group.h"
+#include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/StepTime.h"
+#include "cedar/processing/steps/StaticGain.h"
+#include "cedar/auxiliaries/BoolParameter.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+  cedar::dyn::NeuralFieldPtr createNode(double restingLevel, bool population)
+  {
+    cedar::dyn::NeuralFieldPtr node(new cedar::dyn::NeuralField());
+    node->setDimensionality(0);
+    node->setRestingLevel(restingLevel);
+    node->getParameter<cedar::aux::DoubleParameter>("input noise gain")->setValue(0.0);
+    node->getParameter<cedar::aux::BoolParameter>("population backend")->setValue(population);
+    return node;
+  }
+
+  float activation(cedar::dyn::NeuralFieldPtr node)
+  {
+    return node->getFieldActivation()->getData().at<float>(0, 0);
+  }
+
+  //! Arguments for the given time step; the time stamps have to increase, otherwise steps are only computed once.
+  cedar::proc::ArgumentsPtr stepArguments(unsigned int step)
+  {
+    cedar::unit::Time step_time(10.0 * cedar::unit::milli * cedar::unit::seconds);
+    return cedar::proc::ArgumentsPtr
+           (
+             new cedar::proc::StepTime(step_time, static_cast<double>(step + 1) * step_time)
+           );
+  }
+
+  /*!@brief Steps a node, a static gain and another node in this order and returns the second node's activation.
+   *
+   *        The second node only receives the output of the first through the gain, so it has to read the gain's output
+   *        of the current time step.
+   */
+  float runGainChain(bool population)
+  {
+    cedar::proc::GroupPtr group(new cedar::proc::Group());
+    cedar::proc::LoopedTriggerPtr trigger(new cedar::proc::LoopedTrigger());
+    cedar::dyn::NeuralFieldPtr source = createNode(2.0, population);
+    cedar::proc::steps::StaticGainPtr gain(new cedar::proc::steps::StaticGain());
+    cedar::dyn::NeuralFieldPtr target = createNode(-1.0, population);
+    group->add(source, "source");
+    group->add(gain, "gain");
+    group->add(target, "target");
+    gain->setGainFactor(3.0);
+    group->connectSlots("source.sigmoided activation", "gain.input");
+    group->connectSlots("gain.output", "target.input");
+
+    source->setLoopedTrigger(trigger);
+    source->onStart();
+    target->setLoopedTrigger(trigger);
+    target->onStart();
+
+    // the target's activation only depends on the first step of the source if the gain is read in the same step
+    for (unsigned int step = 0; step < 3; ++step)
+    {
+      cedar::proc::ArgumentsPtr arguments = stepArguments(step);
+      source->onTrigger(arguments);
+      gain->onTrigger(arguments);
+      target->onTrigger(arguments);
+    }
+
+    float result = activation(target);
+    source->onStop();
+    target->onStop();
+    return result;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc, argv);
+  int errors = 0;
+
+  cedar::proc::LoopedTriggerPtr trigger(new cedar::proc::LoopedTrigger());
+  std::vector<double> resting_levels = {-5.0, -0.5, 0.0, 2.0};
+
+  std::vector<cedar::dyn::NeuralFieldPtr> reference_nodes;
+  std::vector<cedar::dyn::NeuralFieldPtr> population_nodes;
+  for (double resting_level : resting_levels)
+  {
+    reference_nodes.push_back(createNode(resting_level, false));
+    population_nodes.push_back(createNode(resting_level, true));
+  }
+
+  for (auto node : reference_nodes)
+  {
+    node->setLoopedTrigger(trigger);
+    node->onStart();
+  }
+  for (auto node : population_nodes)
+  {
+    node->setLoopedTrigger(trigger);
+    node->onStart();
+  }
+
+  std::cout << "Checking that all nodes joined the population." << std::endl;
+  cedar::dyn::NeuralFieldPopulationPtr population
+    = cedar::dyn::NeuralFieldPopulation::join(trigger, population_nodes.front().get());
+  if (population->getNumberOfMembers() != population_nodes.size())
+  {
+    std::cout << "ERROR: the population has " << population->getNumberOfMembers() << " members, expected "
+              << population_nodes.size() << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Checking that the population integrates like the nodes themselves." << std::endl;
+  for (unsigned int step = 0; step < 100; ++step)
+  {
+    cedar::proc::ArgumentsPtr arguments = stepArguments(step);
+    for (size_t i = 0; i < resting_levels.size(); ++i)
+    {
+      reference_nodes.at(i)->onTrigger(arguments);
+      population_nodes.at(i)->onTrigger(arguments);
+    }
+  }
+
+  for (size_t i = 0; i < resting_levels.size(); ++i)
+  {
+    float expected = activation(reference_nodes.at(i));
+    float actual = activation(population_nodes.at(i));
+    if (std::abs(expected - actual) > 1e-4f)
+    {
+      std::cout << "ERROR: node with resting level " << resting_levels.at(i) << " has an activation of " << actual
+                << ", expected " << expected << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking that inputs through other steps are read in the same time step as without the population."
+            << std::endl;
+  {
+    float expected = runGainChain(false);
+    float actual = runGainChain(true);
+    if (std::abs(expected - actual) > 1e-4f)
+    {
+      std::cout << "ERROR: node behind a static gain has an activation of " << actual << ", expected " << expected
+                << std::endl;
+      ++errors;
+    }
+  }
+
+  std::cout << "Checking that stopped nodes leave the population." << std::endl;
+  for (auto node : population_nodes)
+  {
+    node->onStop();
+  }
+  for (auto node : reference_nodes)
+  {
+    node->onStop();
+  }
+  population->leave(population_nodes.front().get());
+  if (population->getNumberOfMembers() != 0)
+  {
+    std::cout << "ERROR: the population still has " << population->getNumberOfMembers() << " members." << std::endl;
+    ++errors;
+  }
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
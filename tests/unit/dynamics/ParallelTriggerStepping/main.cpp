@@ -0,0 +1,170 @@
+/*======================================================================================================================
+
+    Copyright 2011, 2012, 2013, 2014, 2015, 2016, 2017 Institut fuer Neuroinformatik, Ruhr-Universitaet Bochum, Germany
+ 
+    This file is part of cedar.
+
+    cedar is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License as published by the
+    Free Software Foundation, either version 3 of the License, or (at your
+    option) any later version.
+
+    cedar is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with cedar. If not, see <http://www.gnu.org/licenses/>.
+
+========================================================================================================================
+
+    Institute:   Ruhr-Universitaet Bochum
+                 Institut fuer Neuroinformatik
+
+    File:        main.cpp
+
+    Maintainer:  all cedar developers
+    Email:       cedar@ini.rub.de
+    Date:        2026 10 18
+
+    Description: Tests that stepping looped triggers in parallel is deterministic.
+
+    Credits:
+
+======================================================================================================================*/
+
+// CEDAR CONFIGURATION
+#include "cedar/configuration.h"
+
+// CEDAR INCLUDES
+#include "cedar/dynamics/fields/NeuralField.h"
+#include "cedar/processing/sources/GaussInput.h"
+#include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/Group.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/Settings.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/stringFunctions.h"
+#include "cedar/units/Time.h"
+#include "cedar/units/prefixes.h"
+
+// SYSTEM INCLUDES
+#include <QCoreApplication>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  const unsigned int number_of_triggers = 4;
+  const unsigned int number_of_steps = 50;
+
+  /*!@brief Builds an architecture with a field and a looped trigger per field, steps it and returns the activations.
+   *
+   *        The clock and its seed are reset first, so every run starts from the same state. With a shared trigger, all
+   *        fields are connected to a single looped trigger instead, so they form one level of its triggering order.
+   */
+  std::vector<cv::Mat> run(bool parallel, double noiseGain, bool sharedTrigger = false)
+  {
+    cedar::aux::SettingsSingleton::getInstance()->setParallelTriggerStepping(parallel);
+    auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+    clock->reset();
+    clock->setSeed(42);
+
+    cedar::proc::GroupPtr group(new cedar::proc::Group());
+    std::vector<cedar::dyn::NeuralFieldPtr> fields;
+    cedar::proc::LoopedTriggerPtr shared_trigger;
+    if (sharedTrigger)
+    {
+      shared_trigger = cedar::proc::LoopedTriggerPtr(new cedar::proc::LoopedTrigger());
+      group->add(shared_trigger, "shared trigger");
+    }
+    for (unsigned int i = 0; i < number_of_triggers; ++i)
+    {
+      std::string index = cedar::aux::toString(i);
+      cedar::dyn::NeuralFieldPtr field(new cedar::dyn::NeuralField());
+      cedar::proc::sources::GaussInputPtr input(new cedar::proc::sources::GaussInput());
+      cedar::proc::LoopedTriggerPtr trigger = shared_trigger;
+      if (!trigger)
+      {
+        trigger = cedar::proc::LoopedTriggerPtr(new cedar::proc::LoopedTrigger());
+        group->add(trigger, "trigger " + index);
+      }
+      group->add(field, "field " + index);
+      group->add(input, "input " + index);
+
+      field->setDimensionality(1);
+      field->setSize(0, 100);
+      field->getParameter<cedar::aux::DoubleParameter>("input noise gain")->setValue(noiseGain);
+      input->setDimensionality(1);
+      input->setSize(0, 100);
+      input->setAmplitude(3.0 + i);
+      input->setCenter(0, 20.0 * i);
+      group->connectSlots("input " + index + ".Gauss input", "field " + index + ".input");
+      input->onTrigger();
+      group->connectTrigger(trigger, field);
+      fields.push_back(field);
+    }
+
+    for (unsigned int step = 0; step < number_of_steps; ++step)
+    {
+      group->stepTriggers(cedar::unit::Time(10.0 * cedar::unit::milli * cedar::unit::seconds));
+    }
+
+    std::vector<cv::Mat> activations;
+    for (auto field : fields)
+    {
+      activations.push_back(field->getFieldActivation()->getData().clone());
+    }
+    return activations;
+  }
+
+  int compare(const std::vector<cv::Mat>& expected, const std::vector<cv::Mat>& actual)
+  {
+    int errors = 0;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      double difference = cv::norm(expected.at(i), actual.at(i), cv::NORM_INF);
+      if (difference > 0.0)
+      {
+        std::cout << "ERROR: the activation of field " << i << " differs by " << difference << "." << std::endl;
+        ++errors;
+      }
+    }
+    return errors;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc, argv);
+  int errors = 0;
+
+  std::cout << "Checking that parallel stepping gives the results of sequential stepping." << std::endl;
+  errors += compare(run(false, 0.0), run(true, 0.0));
+
+  // with noise, sequential stepping depends on the order in which the trigger threads read and write the seed
+  std::cout << "Checking that parallel stepping with noise gives the same results in every run." << std::endl;
+  std::vector<cv::Mat> first = run(true, 1.0);
+  for (unsigned int repetition = 0; repetition < 3; ++repetition)
+  {
+    errors += compare(first, run(true, 1.0));
+  }
+
+  cedar::aux::SettingsSingleton::getInstance()->setParallelTriggerStepping(false);
+
+  // fields of one trigger that are independent of each other are computed on the trigger threads
+  std::cout << "Checking that noisy fields on trigger threads give the same results in every run." << std::endl;
+  cedar::aux::SettingsSingleton::getInstance()->setNumberOfTriggerThreads(3);
+  std::vector<cv::Mat> first_shared = run(false, 1.0, true);
+  for (unsigned int repetition = 0; repetition < 3; ++repetition)
+  {
+    errors += compare(first_shared, run(false, 1.0, true));
+  }
+  cedar::aux::SettingsSingleton::getInstance()->setNumberOfTriggerThreads(0);
+
+  std::cout << "Done. There were " << errors << " errors." << std::endl;
+  return errors;
+}
@@ -43,6 +43,7 @@
 
 // PROJECT INCLUDES
 #include "cedar/processing/Group.h"
+#include "cedar/processing/GroupCheckpoint.h"
 #include "cedar/processing/GroupDeclaration.h"
 #include "cedar/processing/GroupDeclarationManager.h"
 #include "cedar/processing/Step.h"
@@ -50,16 +51,21 @@
 #include "cedar/processing/ElementDeclaration.h"
 #include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/experiment/Experiment.h"
 #include "cedar/processing/sources/GaussInput.h"
 #include "cedar/processing/sources/Noise.h"
 #include "cedar/processing/steps/StaticGain.h"
 #include "cedar/dynamics/fields/NeuralField.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
+#include "cedar/auxiliaries/GlobalClock.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
 #include "cedar/auxiliaries/sleepFunctions.h"
 #include "cedar/units/Time.h"
 
 // SYSTEM INCLUDES
 #include <QApplication>
+#include <QReadLocker>
 #include <iostream>
 #include <list>
 
@@ -412,6 +418,113 @@ int test_looped_trigger_auto_connect()
   return errors;
 }
 
+int test_checkpoint()
+{
+  int errors = 0;
+  std::cout << "Testing checkpoints of groups" << std::endl;
+  cedar::proc::GroupPtr root(new cedar::proc::Group());
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  root->add(group, "group");
+  cedar::dyn::NeuralFieldPtr field(new cedar::dyn::NeuralField());
+  group->add(field, "field");
+
+  auto activation = boost::const_pointer_cast<cedar::aux::MatData>
+                    (
+                      boost::dynamic_pointer_cast<const cedar::aux::MatData>(field->getBuffer("activation"))
+                    );
+  activation->getData().setTo(1.0);
+  auto clock = cedar::aux::GlobalClockSingleton::getInstance();
+  clock->setSeed(42);
+
+  auto checkpoint = root->createCheckpoint();
+  if (checkpoint->getSize() == 0)
+  {
+    std::cout << "error: checkpoint holds no data" << std::endl;
+    ++errors;
+  }
+
+  activation->getData().setTo(-5.0);
+  clock->setSeed(7);
+  auto generation = activation->getGeneration();
+
+  root->restoreCheckpoint(checkpoint);
+  if (cv::countNonZero(activation->getData() != 1.0) != 0)
+  {
+    std::cout << "error: restoring a checkpoint did not restore the activation of a field in a subgroup" << std::endl;
+    ++errors;
+  }
+  if (activation->getGeneration() == generation)
+  {
+    std::cout << "error: restoring a checkpoint did not mark the data as changed" << std::endl;
+    ++errors;
+  }
+  if (clock->getSeed() != 42)
+  {
+    std::cout << "error: restoring a checkpoint did not restore the seed of the global clock" << std::endl;
+    ++errors;
+  }
+
+  return errors;
+}
+
+float max_activation(cedar::dyn::NeuralFieldPtr field)
+{
+  auto activation = field->getFieldActivation();
+  QReadLocker locker(&activation->getLock());
+  double max = 0.0;
+  cv::minMaxLoc(activation->getData(), nullptr, &max);
+  return static_cast<float>(max);
+}
+
+int test_experiment_checkpoint_trials()
+{
+  int errors = 0;
+  std::cout << "Testing experiment trials that restore a checkpoint" << std::endl;
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  cedar::dyn::NeuralFieldPtr field(new cedar::dyn::NeuralField());
+  cedar::proc::sources::GaussInputPtr input(new cedar::proc::sources::GaussInput());
+  cedar::proc::LoopedTriggerPtr trigger(new cedar::proc::LoopedTrigger());
+  group->add(field, "field");
+  group->add(input, "input");
+  group->add(trigger, "trigger");
+
+  field->setDimensionality(1);
+  field->setSize(0, 10);
+  field->setRestingLevel(-5.0);
+  field->getParameter<cedar::aux::DoubleParameter>("input noise gain")->setValue(0.0);
+  input->setDimensionality(1);
+  input->setSize(0, 10);
+  input->setAmplitude(8.0);
+  input->setCenter(0, 5.0);
+  group->connectSlots("input.Gauss input", "field.input");
+  input->onTrigger();
+  group->connectTrigger(trigger, field);
+
+  cedar::proc::experiment::Experiment experiment(group);
+  for (unsigned int trial = 0; trial < 2; ++trial)
+  {
+    experiment.startTrial();
+    cedar::aux::sleep(0.5 * cedar::unit::seconds);
+    float max = max_activation(field);
+    if (max < -4.0f)
+    {
+      std::cout << "error: the field did not evolve in trial " << trial << "; its maximum is " << max << std::endl;
+      ++errors;
+    }
+    experiment.stopTrial(cedar::proc::experiment::Experiment::ResetType::RestoreCheckpoint);
+
+    max = max_activation(field);
+    if (max > -4.9f)
+    {
+      std::cout << "error: the checkpoint was not restored after trial " << trial << "; the maximum is " << max
+                << std::endl;
+      ++errors;
+    }
+  }
+
+  return errors;
+}
+
 void run_test()
 {
   using cedar::proc::Group;
@@ -702,6 +815,8 @@ void run_test()
   errors += test_connector_renaming();
   errors += test_name_exists();
   errors += test_looped_trigger_auto_connect();
+  errors += test_checkpoint();
+  errors += test_experiment_checkpoint_trials();
 
   // return
   std::cout << "Done. There were " << errors << " errors." << std::endl;
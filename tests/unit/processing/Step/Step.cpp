@@ -39,6 +39,9 @@
 #include "cedar/auxiliaries/MatData.h"
 #include "cedar/processing/Group.h"
 #include "cedar/processing/LoopedTrigger.h"
+#include "cedar/processing/ElementDeclaration.h"
+#include "cedar/processing/DeclarationRegistry.h"
+#include "cedar/auxiliaries/DoubleParameter.h"
 #include "cedar/auxiliaries/CallFunctionInThread.h"
 
 // SYSTEM INCLUDES
@@ -240,6 +243,82 @@ int testThrowInAction()
   return 0;
 }
 
+class PureStep : public cedar::proc::Step
+{
+public:
+  PureStep()
+  :
+  mComputeCount(0),
+  _mGain(new cedar::aux::DoubleParameter(this, "gain", 1.0)),
+  mData(new cedar::aux::MatData(cv::Mat::zeros(2, 2, CV_32F)))
+  {
+    this->declareInput("input", false);
+    this->declareOutput("output", this->mData);
+  }
+
+private:
+  void compute(const cedar::proc::Arguments&)
+  {
+    ++mComputeCount;
+  }
+
+public:
+  int mComputeCount;
+
+  cedar::aux::DoubleParameterPtr _mGain;
+
+private:
+  cedar::aux::MatDataPtr mData;
+};
+CEDAR_GENERATE_POINTER_TYPES(PureStep);
+
+int testPureSteps()
+{
+  int errors = 0;
+  std::cout << "Testing pure steps" << std::endl;
+
+  cedar::proc::ElementDeclarationPtr declaration(new cedar::proc::ElementDeclarationTemplate<PureStep>("Test"));
+  declaration->setPure(true);
+  declaration->declare();
+
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  StartStopTesterPtr source(new StartStopTester());
+  PureStepPtr pure(new PureStep());
+  group->add(source, "source");
+  group->add(pure, "pure");
+  group->connectSlots("source.output", "pure.input");
+
+  auto expect_computes = [&](int expected, const std::string& situation)
+  {
+    if (pure->mComputeCount != expected)
+    {
+      std::cout << "ERROR: pure step was computed " << pure->mComputeCount << " times " << situation
+                << "; should be " << expected << "." << std::endl;
+      ++errors;
+    }
+  };
+
+  pure->callComputeWithoutTriggering();
+  expect_computes(1, "after the first trigger");
+
+  pure->callComputeWithoutTriggering();
+  expect_computes(1, "when nothing changed");
+
+  source->callComputeWithoutTriggering();
+  pure->callComputeWithoutTriggering();
+  expect_computes(2, "after its input was recomputed");
+
+  pure->_mGain->setValue(2.0);
+  pure->callComputeWithoutTriggering();
+  expect_computes(3, "after a parameter changed");
+
+  pure->onTrigger();
+  expect_computes(4, "when triggered outside of a trigger chain");
+
+  std::cout << "Pure step test uncovered " << errors << " error(s)." << std::endl;
+  return errors;
+}
+
 // global variable:
 int global_errors;
 
@@ -268,6 +347,7 @@ void run_test()
 
   global_errors += testStartingStopping();
   global_errors += testThrowInAction();
+  global_errors += testPureSteps();
 
   std::cout << "test finished with " << global_errors << " error(s)." << std::endl;
 }
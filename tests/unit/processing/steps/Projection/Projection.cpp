@@ -39,15 +39,23 @@
 #include "cedar/processing/LoopedTrigger.h"
 #include "cedar/processing/DeclarationRegistry.h"
 #include "cedar/processing/steps/Projection.h"
+#include "cedar/processing/steps/Sum.h"
+#include "cedar/processing/sources/GaussInput.h"
 #include "cedar/processing/ProjectionMapping.h"
+#include "cedar/processing/ProjectionMappingParameter.h"
 #include "cedar/processing/Triggerable.h"
 #include "cedar/processing/StepTime.h"
 #include "cedar/auxiliaries/logFilter/Type.h"
 #include "cedar/auxiliaries/NullLogger.h"
+#include "cedar/auxiliaries/MatData.h"
+#include "cedar/auxiliaries/annotation/BroadcastView.h"
 #include "cedar/units/Time.h"
 #include "cedar/units/prefixes.h"
 
 // SYSTEM INCLUDES
+#include <algorithm>
+#include <numeric>
+#include <vector>
 
 /*!@brief Check whether the (only) projection of the network is in the given state.
  *
@@ -135,6 +143,197 @@ void checkInvalidProjection(const std::string& configurationFile, unsigned int&
   stepArchitecture(network, numberOfErrors);
 }
 
+//!@brief Returns the matrix in the given output slot of a step.
+const cv::Mat& getOutputMatrix(cedar::proc::StepPtr step, const std::string& slot)
+{
+  return boost::dynamic_pointer_cast<cedar::aux::MatData>(step->getOutput(slot))->getData();
+}
+
+/*!@brief Compares the results of a 4D to 2D compression with values computed naively.
+ *
+ * @param numberOfErrors counter for the number of errors
+ */
+void checkCompressionValues(unsigned int& numberOfErrors)
+{
+  std::cout << "Checking values of 4D to 2D projections" << std::endl;
+
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  group->create("cedar.processing.sources.GaussInput", "gauss");
+  group->create("cedar.processing.Projection", "projection");
+  auto gauss = group->getElement<cedar::proc::sources::GaussInput>("gauss");
+  auto projection = group->getElement<cedar::proc::steps::Projection>("projection");
+
+  // different sizes and centers in each dimension, so that mixing up dimensions changes the result
+  gauss->setDimensionality(4);
+  for (unsigned int dim = 0; dim < 4; ++dim)
+  {
+    gauss->setSize(dim, 5 + dim);
+    gauss->setCenter(dim, 1.0 + dim);
+  }
+  group->connectSlots("gauss.Gauss input", "projection.input");
+
+  // keep dimensions 3 and 1 (in swapped order), compress dimensions 0 and 2
+  projection->setOutputDimensionality(2);
+  auto mapping = projection->getParameter<cedar::proc::ProjectionMappingParameter>("dimension mapping");
+  mapping->changeMapping(1, 1);
+  mapping->changeMapping(3, 0);
+
+  const cv::Mat& input = getOutputMatrix(gauss, "Gauss input");
+
+  std::vector<cedar::aux::EnumId> compression_types;
+  compression_types.push_back(cedar::proc::steps::Projection::CompressionType::SUM);
+  compression_types.push_back(cedar::proc::steps::Projection::CompressionType::AVERAGE);
+  compression_types.push_back(cedar::proc::steps::Projection::CompressionType::MAXIMUM);
+  compression_types.push_back(cedar::proc::steps::Projection::CompressionType::MINIMUM);
+  for (auto compression_type : compression_types)
+  {
+    projection->getParameter<cedar::aux::EnumParameter>("compression type")->setValue(compression_type);
+    projection->onTrigger(cedar::proc::ArgumentsPtr(), cedar::proc::TriggerPtr());
+
+    cv::Mat expected(input.size[3], input.size[1], CV_32F, cv::Scalar(0));
+    for (int i3 = 0; i3 < input.size[3]; ++i3)
+    {
+      for (int i1 = 0; i1 < input.size[1]; ++i1)
+      {
+        std::vector<float> values;
+        for (int i0 = 0; i0 < input.size[0]; ++i0)
+        {
+          for (int i2 = 0; i2 < input.size[2]; ++i2)
+          {
+            int index[4] = {i0, i1, i2, i3};
+            values.push_back(input.at<float>(index));
+          }
+        }
+
+        float& result = expected.at<float>(i3, i1);
+        if (compression_type == cedar::proc::steps::Projection::CompressionType::MAXIMUM)
+        {
+          result = *std::max_element(values.begin(), values.end());
+        }
+        else if (compression_type == cedar::proc::steps::Projection::CompressionType::MINIMUM)
+        {
+          result = *std::min_element(values.begin(), values.end());
+        }
+        else
+        {
+          result = std::accumulate(values.begin(), values.end(), 0.0f);
+          if (compression_type == cedar::proc::steps::Projection::CompressionType::AVERAGE)
+          {
+            result /= static_cast<float>(values.size());
+          }
+        }
+      }
+    }
+
+    const cv::Mat& output = getOutputMatrix(projection, "output");
+    if (output.dims != 2 || output.rows != expected.rows || output.cols != expected.cols
+        || cv::norm(output - expected, cv::NORM_INF) > 1e-4)
+    {
+      std::cout << "ERROR: 4D to 2D projection with compression type "
+                << cedar::proc::steps::Projection::CompressionType::type().get(compression_type).name()
+                << " computed wrong values." << std::endl;
+      ++numberOfErrors;
+    }
+  }
+}
+
+/*!@brief Checks the values of a 1D to 3D expansion, both written to the output and passed on as a broadcast view.
+ *
+ * @param numberOfErrors counter for the number of errors
+ */
+void checkExpansionValues(unsigned int& numberOfErrors)
+{
+  std::cout << "Checking values of 1D to 3D projections" << std::endl;
+
+  cedar::proc::GroupPtr group(new cedar::proc::Group());
+  group->create("cedar.processing.sources.GaussInput", "gauss");
+  group->create("cedar.processing.Projection", "projection");
+  group->create("cedar.processing.steps.Sum", "sum");
+  auto gauss = group->getElement<cedar::proc::sources::GaussInput>("gauss");
+  auto projection = group->getElement<cedar::proc::steps::Projection>("projection");
+  auto sum = group->getElement<cedar::proc::steps::Sum>("sum");
+
+  gauss->setDimensionality(1);
+  gauss->setSize(0, 7);
+  gauss->setCenter(0, 2.0);
+  group->connectSlots("gauss.Gauss input", "projection.input");
+
+  projection->setOutputDimensionality(3);
+  projection->setOutputDimensionSize(0, 4);
+  projection->setOutputDimensionSize(2, 5);
+  auto mapping = projection->getParameter<cedar::proc::ProjectionMappingParameter>("dimension mapping");
+  mapping->changeMapping(0, 1);
+  group->connectSlots("projection.output", "sum.terms");
+
+  const cv::Mat& input = getOutputMatrix(gauss, "Gauss input");
+  int sizes[3] = {4, 7, 5};
+  cv::Mat expected(3, sizes, CV_32F);
+  for (int i0 = 0; i0 < sizes[0]; ++i0)
+  {
+    for (int i1 = 0; i1 < sizes[1]; ++i1)
+    {
+      for (int i2 = 0; i2 < sizes[2]; ++i2)
+      {
+        expected.at<float>(i0, i1, i2) = input.at<float>(i1, 0);
+      }
+    }
+  }
+
+  projection->onTrigger(cedar::proc::ArgumentsPtr(), cedar::proc::TriggerPtr());
+  sum->onTrigger(cedar::proc::ArgumentsPtr(), cedar::proc::TriggerPtr());
+  const cv::Mat& output = getOutputMatrix(projection, "output");
+  if (output.dims != 3 || cv::norm(output - expected, cv::NORM_INF) > 1e-6)
+  {
+    std::cout << "ERROR: 1D to 3D projection computed wrong values." << std::endl;
+    ++numberOfErrors;
+  }
+
+  projection->setBroadcastView(true);
+  projection->onTrigger(cedar::proc::ArgumentsPtr(), cedar::proc::TriggerPtr());
+  sum->onTrigger(cedar::proc::ArgumentsPtr(), cedar::proc::TriggerPtr());
+  if (!projection->getOutput("output")->hasAnnotation<cedar::aux::annotation::BroadcastView>())
+  {
+    std::cout << "ERROR: Output of the projection is not annotated as a broadcast view." << std::endl;
+    ++numberOfErrors;
+  }
+  if (cv::norm(getOutputMatrix(projection, "output"), cv::NORM_INF) != 0.0)
+  {
+    std::cout << "ERROR: Output of the projection was written although it is a broadcast view." << std::endl;
+    ++numberOfErrors;
+  }
+  const cv::Mat& summed = getOutputMatrix(sum, "sum");
+  if (summed.dims != 3 || cv::norm(summed - expected, cv::NORM_INF) > 1e-6)
+  {
+    std::cout << "ERROR: Sum of a broadcast view computed wrong values." << std::endl;
+    ++numberOfErrors;
+  }
+
+  // a consumer that does not understand broadcast views needs the output to be filled
+  group->create("cedar.processing.StaticGain", "gain");
+  group->connectSlots("projection.output", "gain.input");
+  projection->onTrigger(cedar::proc::ArgumentsPtr(), cedar::proc::TriggerPtr());
+  if (cv::norm(getOutputMatrix(projection, "output") - expected, cv::NORM_INF) > 1e-6)
+  {
+    std::cout << "ERROR: Broadcast view was not filled for a consumer that does not accept broadcast views." << std::endl;
+    ++numberOfErrors;
+  }
+
+  group->disconnectSlots("projection.output", "gain.input");
+  projection->onTrigger(cedar::proc::ArgumentsPtr(), cedar::proc::TriggerPtr());
+  if (cv::norm(getOutputMatrix(projection, "output"), cv::NORM_INF) != 0.0)
+  {
+    std::cout << "ERROR: Broadcast view kept values after its last unaware consumer was disconnected." << std::endl;
+    ++numberOfErrors;
+  }
+
+  projection->setBroadcastView(false);
+  if (projection->getOutput("output")->hasAnnotation<cedar::aux::annotation::BroadcastView>())
+  {
+    std::cout << "ERROR: Broadcast view annotation was not removed." << std::endl;
+    ++numberOfErrors;
+  }
+}
+
 int main()
 {
   // Filter out mem-debug messages so the output reamins readable
@@ -273,6 +472,9 @@ int main()
   checkValidProjection("configs/config_3Dto3D_1_2_0_valid.json", number_of_errors);
 #endif // CEDAR_USE_FFTW
 
+  checkCompressionValues(number_of_errors);
+  checkExpansionValues(number_of_errors);
+
   // check strange bugs!
   cedar::proc::GroupPtr group(new cedar::proc::Group());
   group->create("cedar.processing.sources.GaussInput", "gauss");